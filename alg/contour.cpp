@@ -22,14 +22,22 @@
 
 #include "gdal.h"
 #include "gdal_alg.h"
+#include "gdal_priv.h"
+#include "gdal_thread_pool.h"
+#include "gdalstripprocessing.h"
 #include "cpl_conv.h"
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
 #include "ogr_api.h"
 #include "ogr_srs_api.h"
 #include "ogr_geometry.h"
 
+#include <atomic>
 #include <climits>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 static CPLErr OGRPolygonContourWriter(double dfLevelMin, double dfLevelMax,
                                       const OGRMultiPolygon &multipoly,
@@ -218,6 +226,205 @@ struct GDALRingAppender
     void *data_;
 };
 
+/************************************************************************/
+/*                        ContourLineCollector                          */
+/************************************************************************/
+
+// Stores the lines emitted while processing a strip of the raster in a
+// worker thread, so that they can be written from the main thread.
+struct ContourLineCollector
+{
+    struct Line
+    {
+        double level;
+        marching_squares::LineString ls;
+        bool closed;
+    };
+
+    std::vector<Line> lines{};
+
+    void addLine(double level, marching_squares::LineString &ls, bool closed)
+    {
+        lines.push_back(Line{level, marching_squares::LineString(), closed});
+        lines.back().ls.swap(ls);
+    }
+};
+
+/************************************************************************/
+/*                    ContourGenerateMultiThreaded()                    */
+/************************************************************************/
+
+// Generate the contour lines of horizontal strips of the raster in parallel.
+//
+// Each strip is processed by its own ContourGenerator and SegmentMerger,
+// starting from the last line of the previous strip, so that each row of
+// squares is processed exactly once. Lines finished within a strip are written
+// in the order of strips, and the unfinished ones, which end on a strip
+// border, are joined by the SegmentMerger of the main thread.
+//
+// This is not used in polygonal mode, where the way rings are split at
+// vertices shared by several of them depends on the processing order.
+static bool ContourGenerateMultiThreaded(
+    GDALRasterBandH hBand, bool useNoData, double noDataValue,
+    GDALRingAppender &lineWriter,
+    marching_squares::FixedLevelRangeIterator &levels, int nThreads,
+    int nStripHeight, GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    using namespace marching_squares;
+
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return false;
+
+    const int nXSize = GDALGetRasterBandXSize(hBand);
+    const int nYSize = GDALGetRasterBandYSize(hBand);
+    const int nStrips = DIV_ROUND_UP(nYSize, nStripHeight);
+
+    // Use a thread-safe instance of the band if possible. Otherwise reads
+    // are serialized.
+    GDALThreadSafeSourceBands oSourceBands(hBand, nullptr, "CONTOUR");
+    GDALRasterBandH hReadBand = oSourceBands.GetSrcBand();
+    std::mutex *poReadMutex = oSourceBands.GetMutex();
+
+    struct StripJob
+    {
+        ContourLineCollector oCollector{};
+        LevelLineStrings aoUnfinishedLines{};
+        std::atomic<bool> bDone{false};
+    };
+
+    std::vector<StripJob> aoJobs(nStrips);
+    std::atomic<bool> bError{false};
+    std::atomic<bool> bStop{false};
+    std::atomic<int> nLinesDone{0};
+
+    const auto ProcessStrip = [&](int iStrip)
+    {
+        const int nStartLine = iStrip * nStripHeight;
+        const int nEndLine = std::min(nYSize, nStartLine + nStripHeight);
+        StripJob &oJob = aoJobs[iStrip];
+
+        SegmentMerger<ContourLineCollector, FixedLevelRangeIterator> writer(
+            oJob.oCollector, levels, /* polygonize */ false);
+        ContourGenerator<decltype(writer), FixedLevelRangeIterator> cg(
+            nXSize, nYSize, useNoData, noDataValue, writer, levels);
+
+        std::vector<double> line(nXSize);
+        const auto ReadLine = [&](int iLine)
+        {
+            std::unique_lock<std::mutex> oLock;
+            if (poReadMutex)
+                oLock = std::unique_lock<std::mutex>(*poReadMutex);
+            if (GDALRasterIO(hReadBand, GF_Read, 0, iLine, nXSize, 1,
+                             line.data(), nXSize, 1, GDT_Float64, 0,
+                             0) != CE_None)
+            {
+                CPLDebug("CONTOUR", "failed fetch %d %d", iLine, nXSize);
+                return false;
+            }
+            return true;
+        };
+
+        if (nStartLine > 0)
+        {
+            if (!ReadLine(nStartLine - 1))
+            {
+                writer.discardUnfinishedLines();
+                return false;
+            }
+            cg.startAtLine(nStartLine, line.data());
+            writer.setStripTopY(nStartLine - .5);
+        }
+        for (int iLine = nStartLine; iLine < nEndLine; ++iLine)
+        {
+            if (bError || bStop || !ReadLine(iLine))
+            {
+                writer.discardUnfinishedLines();
+                return false;
+            }
+            cg.feedLine(line.data());
+            ++nLinesDone;
+        }
+        oJob.aoUnfinishedLines = writer.takeUnfinishedLines();
+        return true;
+    };
+
+    CPLErrorAccumulator oErrorAccumulator;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+    // Limit the number of strips being processed or waiting to be written,
+    // and thus the memory used by their lines.
+    const int nMaxStripsInFlight = 2 * poThreadPool->GetThreadCount();
+    int iNextSubmittedStrip = 0;
+    const auto SubmitStrips = [&](int nEndStrip)
+    {
+        for (; !bError && iNextSubmittedStrip < std::min(nEndStrip, nStrips);
+             ++iNextSubmittedStrip)
+        {
+            const int iStrip = iNextSubmittedStrip;
+            const auto Job = [&ProcessStrip, &aoJobs, &bError,
+                              &oErrorAccumulator, iStrip]()
+            {
+                auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oAccumulator);
+                try
+                {
+                    if (!ProcessStrip(iStrip))
+                        bError = true;
+                }
+                catch (const std::exception &e)
+                {
+                    CPLError(CE_Failure, CPLE_AppDefined, "%s", e.what());
+                    bError = true;
+                }
+                aoJobs[iStrip].bDone = true;
+            };
+            if (!poJobQueue->SubmitJob(Job))
+                bError = true;
+        }
+    };
+
+    // Write the lines in the order of strips, as soon as they are available,
+    // and join the lines crossing strip borders.
+    {
+        SegmentMerger<GDALRingAppender, FixedLevelRangeIterator> writer(
+            lineWriter, levels, /* polygonize */ false);
+
+        SubmitStrips(nMaxStripsInFlight);
+        int iNextStrip = 0;
+        while (iNextStrip < nStrips && !bError && !bStop)
+        {
+            if (!pfnProgress(static_cast<double>(nLinesDone) / nYSize, "",
+                             pProgressArg))
+            {
+                bStop = true;
+                break;
+            }
+            StripJob &oJob = aoJobs[iNextStrip];
+            if (!oJob.bDone)
+            {
+                poJobQueue->WaitEvent();
+                continue;
+            }
+            for (auto &oLine : oJob.oCollector.lines)
+                lineWriter.addLine(oLine.level, oLine.ls, oLine.closed);
+            std::vector<ContourLineCollector::Line>().swap(
+                oJob.oCollector.lines);
+            writer.joinUnfinishedLines(oJob.aoUnfinishedLines);
+            ++iNextStrip;
+            SubmitStrips(iNextStrip + nMaxStripsInFlight);
+        }
+
+        poJobQueue->WaitCompletion();
+        oErrorAccumulator.ReplayErrors();
+
+        // Do not write the partial lines of an interrupted processing
+        if (bError || bStop)
+            writer.discardUnfinishedLines();
+    }
+
+    return !bError && !bStop;
+}
+
 /************************************************************************/
 /* ==================================================================== */
 /*                   Additional C Callable Functions                    */
@@ -563,6 +770,16 @@ mode.
  * A negative value means a single transaction. The function takes care of
  * issuing the starting transaction and committing the final one.
  *
+ *   NUM_THREADS=num|ALL_CPUS
+ *
+ * (GDAL >= 3.12) Number of worker threads used to generate contour lines.
+ * Defaults to the value of the GDAL_NUM_THREADS configuration option, or 1.
+ * When several threads are used, horizontal strips of the raster are processed
+ * in parallel, and the lines crossing strip borders are joined afterwards.
+ * The generated lines are the same as with a single thread, but the order of
+ * features, and the starting point of closed lines, may differ.
+ * Ignored in polygonal contouring mode.
+ *
  * @return CE_None on success or CE_Failure if an error occurs.
  */
 CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
@@ -727,6 +944,20 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
         }
     }
 
+    // Process horizontal strips of the raster in parallel if several threads
+    // are requested and the raster is tall enough (only for contour lines).
+    const int nThreads = GDALGetNumThreads(options, "NUM_THREADS");
+    int nStripHeight = 0;
+    if (nThreads > 1 && !polygonize)
+    {
+        const int nYSize = GDALGetRasterBandYSize(hBand);
+        nStripHeight = GDALGetProcessingStripHeight(
+            GDALGetRasterBandXSize(hBand), nYSize, nThreads,
+            "GDAL_CONTOUR_MIN_STRIP_HEIGHT");
+        if (nYSize <= nStripHeight)
+            nStripHeight = 0;
+    }
+
     bool ok = true;
 
     // Replace fixed levels min/max values with raster min/max values
@@ -895,12 +1126,21 @@ CPLErr GDALContourGenerateEx(GDALRasterBandH hBand, void *hLayer,
                 fixedLevels.erase(uniqueIt, fixedLevels.end());
                 FixedLevelRangeIterator levels(
                     &fixedLevels[0], fixedLevels.size(), dfMinimum, dfMaximum);
-                SegmentMerger<GDALRingAppender, FixedLevelRangeIterator> writer(
-                    appender, levels, /* polygonize */ false);
-                ContourGeneratorFromRaster<decltype(writer),
-                                           FixedLevelRangeIterator>
-                    cg(hBand, useNoData, noDataValue, writer, levels);
-                ok = cg.process(pfnProgress, pProgressArg);
+                if (nStripHeight > 0)
+                {
+                    ok = ContourGenerateMultiThreaded(
+                        hBand, useNoData, noDataValue, appender, levels,
+                        nThreads, nStripHeight, pfnProgress, pProgressArg);
+                }
+                else
+                {
+                    SegmentMerger<GDALRingAppender, FixedLevelRangeIterator>
+                        writer(appender, levels, /* polygonize */ false);
+                    ContourGeneratorFromRaster<decltype(writer),
+                                               FixedLevelRangeIterator>
+                        cg(hBand, useNoData, noDataValue, writer, levels);
+                    ok = cg.process(pfnProgress, pProgressArg);
+                }
             }
         }
     }
@@ -242,6 +242,16 @@ int CPL_DLL GDALApproxTransform(void *pTransformArg, int bDstToSrc,
                                 int nPointCount, double *x, double *y,
                                 double *z, int *panSuccess);
 
+/* Warp plan transformer ... precomputed grids of pixel/line coordinates */
+void CPL_DLL *GDALCreateWarpPlanTransformer(
+    GDALTransformerFunc pfnBaseTransformer, void *pBaseTransformArg,
+    int nSrcXSize, int nSrcYSize, int nDstXSize, int nDstYSize,
+    double dfMaxError, CSLConstList papszOptions);
+void CPL_DLL GDALDestroyWarpPlanTransformer(void *pTransformArg);
+int CPL_DLL GDALWarpPlanTransform(void *pTransformArg, int bDstToSrc,
+                                  int nPointCount, double *x, double *y,
+                                  double *z, int *panSuccess);
+
 int CPL_DLL CPL_STDCALL GDALSimpleImageWarp(
     GDALDatasetH hSrcDS, GDALDatasetH hDstDS, int nBandCount, int *panBandList,
     GDALTransformerFunc pfnTransform, void *pTransformArg,
@@ -203,6 +203,9 @@ typedef struct
     bool bReversed;
     double dfOversampleFactor;
 
+    // Number of threads used to build the backmap.
+    int nNumThreads;
+
     // Map from target georef coordinates back to geolocation array
     // pixel line coordinates.  Built only if needed.
     int nBackMapWidth;
@@ -27,6 +27,9 @@
 
 #include <algorithm>
 #include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -36,6 +39,7 @@
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 #include "memdataset.h"
 
 constexpr float INVALID_BMXY = -10.0f;
@@ -1009,6 +1013,259 @@ void GDALInverseBilinearInterpolation(const double x, const double y,
     j += s;
 }
 
+/************************************************************************/
+/*                   GDALGeoLocComputeBackMapSamples()                  */
+/************************************************************************/
+
+// Geometry of the backmap being generated
+struct GDALGeoLocBackMapGrid
+{
+    double dfMinX = 0;
+    double dfMaxY = 0;
+    double dfPixelXSize = 0;
+    double dfPixelYSize = 0;
+    int nBMXSize = 0;
+    int nBMYSize = 0;
+    double dfGeorefConventionOffset = 0;
+};
+
+// Contribution of a sample of the geolocation array to the backmap.
+struct GDALGeoLocBackMapSample
+{
+    // Backmap node at the top-left of the sample
+    int iBMX = 0;
+    int iBMY = 0;
+    // If true, the node falls into a cell of the geolocation array, and
+    // (dfA, dfB) are its backmap values. Otherwise, (dfA, dfB) are the
+    // pixel/line position of the sample, to be spread over the 4 surrounding
+    // nodes according to (dfFracBMX, dfFracBMY).
+    bool bInCell = false;
+    double dfA = 0;
+    double dfB = 0;
+    double dfFracBMX = 0;
+    double dfFracBMY = 0;
+};
+
+// Compute the backmap contributions of the samples of the geolocation array
+// in [dfYStart, dfYEnd[ x [dfXStart, dfXEnd[. This only reads the geolocation
+// arrays, through psTransform->pAccessors of type Reader, so it may run
+// concurrently for different tiles.
+template <class Reader>
+static void GDALGeoLocComputeBackMapSamples(
+    const GDALGeoLocTransformInfo *psTransform,
+    const GDALGeoLocBackMapGrid &sGrid, double dfStep,
+    const std::pair<double, double> &yStartEnd,
+    const std::pair<double, double> &xStartEnd,
+    std::vector<GDALGeoLocBackMapSample> &aSamples)
+{
+    const double dfMinX = sGrid.dfMinX;
+    const double dfMaxY = sGrid.dfMaxY;
+    const double dfPixelXSize = sGrid.dfPixelXSize;
+    const double dfPixelYSize = sGrid.dfPixelYSize;
+    const int nBMXSize = sGrid.nBMXSize;
+    const int nBMYSize = sGrid.nBMYSize;
+    const double dfGeorefConventionOffset = sGrid.dfGeorefConventionOffset;
+
+    // Keep those objects in this outer scope, so they are reused, to
+    // save memory allocations.
+    OGRPoint oPoint;
+    OGRLinearRing oRing;
+    oRing.setNumPoints(5);
+
+    for (double dfY = yStartEnd.first; dfY < yStartEnd.second; dfY += dfStep)
+    {
+        for (double dfX = xStartEnd.first; dfX < xStartEnd.second;
+             dfX += dfStep)
+        {
+            // Use forward geolocation array interpolation to compute
+            // the georeferenced position corresponding to (dfX, dfY)
+            double dfGeoLocX;
+            double dfGeoLocY;
+            if (!GDALGeoLoc<Reader>::PixelLineToXY(psTransform, dfX, dfY,
+                                                   dfGeoLocX, dfGeoLocY))
+                continue;
+
+            // Compute the floating point coordinates in the pixel space
+            // of the backmap
+            const double dBMX =
+                static_cast<double>((dfGeoLocX - dfMinX) / dfPixelXSize);
+
+            const double dBMY =
+                static_cast<double>((dfMaxY - dfGeoLocY) / dfPixelYSize);
+
+            // Get top left index by truncation
+            const int iBMX = static_cast<int>(std::floor(dBMX));
+            const int iBMY = static_cast<int>(std::floor(dBMY));
+
+            GDALGeoLocBackMapSample sSample;
+            sSample.iBMX = iBMX;
+            sSample.iBMY = iBMY;
+
+            if (iBMX >= 0 && iBMX < nBMXSize && iBMY >= 0 && iBMY < nBMYSize)
+            {
+                // Compute the georeferenced position of the top-left
+                // index of the backmap
+                double dfGeoX = dfMinX + iBMX * dfPixelXSize;
+                const double dfGeoY = dfMaxY - iBMY * dfPixelYSize;
+
+                bool bMatchingGeoLocCellFound = false;
+
+                const int nOuterIters =
+                    psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
+                            fabs(dfGeoX) >= 180
+                        ? 2
+                        : 1;
+
+                for (int iOuterIter = 0; iOuterIter < nOuterIters;
+                     ++iOuterIter)
+                {
+                    if (iOuterIter == 1 && dfGeoX >= 180)
+                        dfGeoX -= 360;
+                    else if (iOuterIter == 1 && dfGeoX <= -180)
+                        dfGeoX += 360;
+
+                    // Identify a cell (quadrilateral in georeferenced
+                    // space) in the geolocation array in which dfGeoX,
+                    // dfGeoY falls into.
+                    oPoint.setX(dfGeoX);
+                    oPoint.setY(dfGeoY);
+                    const int nX = static_cast<int>(std::floor(dfX));
+                    const int nY = static_cast<int>(std::floor(dfY));
+                    for (int sx = -1; !bMatchingGeoLocCellFound && sx <= 0;
+                         sx++)
+                    {
+                        for (int sy = -1; !bMatchingGeoLocCellFound && sy <= 0;
+                             sy++)
+                        {
+                            const int pixel = nX + sx;
+                            const int line = nY + sy;
+                            double x0, y0, x1, y1, x2, y2, x3, y3;
+                            if (!GDALGeoLoc<Reader>::PixelLineToXY(
+                                    psTransform, pixel, line, x0, y0) ||
+                                !GDALGeoLoc<Reader>::PixelLineToXY(
+                                    psTransform, pixel + 1, line, x2, y2) ||
+                                !GDALGeoLoc<Reader>::PixelLineToXY(
+                                    psTransform, pixel, line + 1, x1, y1) ||
+                                !GDALGeoLoc<Reader>::PixelLineToXY(
+                                    psTransform, pixel + 1, line + 1, x3, y3))
+                            {
+                                break;
+                            }
+
+                            int nIters = 1;
+                            if (psTransform
+                                    ->bGeographicSRSWithMinus180Plus180LongRange &&
+                                std::fabs(x0) > 170 && std::fabs(x1) > 170 &&
+                                std::fabs(x2) > 170 && std::fabs(x3) > 170 &&
+                                (std::fabs(x1 - x0) > 180 ||
+                                 std::fabs(x2 - x0) > 180 ||
+                                 std::fabs(x3 - x0) > 180))
+                            {
+                                nIters = 2;
+                                if (x0 > 0)
+                                    x0 -= 360;
+                                if (x1 > 0)
+                                    x1 -= 360;
+                                if (x2 > 0)
+                                    x2 -= 360;
+                                if (x3 > 0)
+                                    x3 -= 360;
+                            }
+                            for (int iIter = 0; iIter < nIters; ++iIter)
+                            {
+                                if (iIter == 1)
+                                {
+                                    x0 += 360;
+                                    x1 += 360;
+                                    x2 += 360;
+                                    x3 += 360;
+                                }
+
+                                oRing.setPoint(0, x0, y0);
+                                oRing.setPoint(1, x2, y2);
+                                oRing.setPoint(2, x3, y3);
+                                oRing.setPoint(3, x1, y1);
+                                oRing.setPoint(4, x0, y0);
+                                if (oRing.isPointInRing(&oPoint) ||
+                                    oRing.isPointOnRingBoundary(&oPoint))
+                                {
+                                    bMatchingGeoLocCellFound = true;
+                                    double dfBMXValue = pixel;
+                                    double dfBMYValue = line;
+                                    GDALInverseBilinearInterpolation(
+                                        dfGeoX, dfGeoY, x0, y0, x1, y1, x2, y2,
+                                        x3, y3, dfBMXValue, dfBMYValue);
+
+                                    sSample.bInCell = true;
+                                    sSample.dfA =
+                                        (dfBMXValue +
+                                         dfGeorefConventionOffset) *
+                                            psTransform->dfPIXEL_STEP +
+                                        psTransform->dfPIXEL_OFFSET;
+                                    sSample.dfB =
+                                        (dfBMYValue +
+                                         dfGeorefConventionOffset) *
+                                            psTransform->dfLINE_STEP +
+                                        psTransform->dfLINE_OFFSET;
+                                }
+                            }
+                        }
+                    }
+                }
+                if (bMatchingGeoLocCellFound)
+                {
+                    aSamples.push_back(sSample);
+                    continue;
+                }
+            }
+
+            // We will end up here in non-nominal cases, with nodata,
+            // holes, etc.
+
+            // Check if the center is in range
+            if (iBMX < -1 || iBMY < -1 || iBMX > nBMXSize || iBMY > nBMYSize)
+                continue;
+
+            sSample.dfA = dfX;
+            sSample.dfB = dfY;
+            sSample.dfFracBMX = dBMX - iBMX;
+            sSample.dfFracBMY = dBMY - iBMY;
+            aSamples.push_back(sSample);
+        }
+    }
+}
+
+/************************************************************************/
+/*                     GDALGeoLocProcessRowStrips()                     */
+/************************************************************************/
+
+// Call func(iYStart, iYEnd) over strips of rows covering [0, nYSize[,
+// concurrently on nThreads threads of the global thread pool if possible.
+template <class F>
+static void GDALGeoLocProcessRowStrips(int nYSize, int nThreads, const F &func)
+{
+    CPLJobQueuePtr poJobQueue;
+    if (nThreads > 1 && nYSize > 1)
+    {
+        CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
+    if (!poJobQueue)
+    {
+        func(0, nYSize);
+        return;
+    }
+    const int nStripHeight = DIV_ROUND_UP(nYSize, 4 * nThreads);
+    for (int iYStart = 0; iYStart < nYSize; iYStart += nStripHeight)
+    {
+        const int iYEnd = std::min(nYSize, iYStart + nStripHeight);
+        poJobQueue->SubmitJob([&func, iYStart, iYEnd]()
+                              { func(iYStart, iYEnd); });
+    }
+    poJobQueue->WaitCompletion();
+}
+
 /************************************************************************/
 /*                       GeoLocGenerateBackMap()                        */
 /************************************************************************/
@@ -1156,12 +1413,6 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
         }
     };
 
-    // Keep those objects in this outer scope, so they are reused, to
-    // save memory allocations.
-    OGRPoint oPoint;
-    OGRLinearRing oRing;
-    oRing.setNumPoints(5);
-
     /* -------------------------------------------------------------------- */
     /*      Run through the whole geoloc array forward projecting and       */
     /*      pushing into the backmap.                                       */
@@ -1219,228 +1470,147 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
         xStartEnd[iXBlock].second = dfX + dfStep / 10;
     }
 
-    for (int iYBlock = 0; iYBlock < nYBlocks; ++iYBlock)
+    GDALGeoLocBackMapGrid sGrid;
+    sGrid.dfMinX = dfMinX;
+    sGrid.dfMaxY = dfMaxY;
+    sGrid.dfPixelXSize = dfPixelXSize;
+    sGrid.dfPixelYSize = dfPixelYSize;
+    sGrid.nBMXSize = nBMXSize;
+    sGrid.nBMYSize = nBMYSize;
+    sGrid.dfGeorefConventionOffset = dfGeorefConventionOffset;
+
+    const auto PushSamples =
+        [&](const std::vector<GDALGeoLocBackMapSample> &aSamples)
     {
-        for (int iXBlock = 0; iXBlock < nXBlocks; ++iXBlock)
+        for (const auto &sSample : aSamples)
         {
-#if 0
-        CPLDebug("Process geoloc block (y=%d,x=%d) for y in [%f, %f] and x in [%f, %f]",
-                 iYBlock, iXBlock,
-                 yStartEnd[iYBlock].first, yStartEnd[iYBlock].second,
-                 xStartEnd[iXBlock].first, xStartEnd[iXBlock].second);
-#endif
-            for (double dfY = yStartEnd[iYBlock].first;
-                 dfY < yStartEnd[iYBlock].second; dfY += dfStep)
+            const int iBMX = sSample.iBMX;
+            const int iBMY = sSample.iBMY;
+            if (sSample.bInCell)
             {
-                for (double dfX = xStartEnd[iXBlock].first;
-                     dfX < xStartEnd[iXBlock].second; dfX += dfStep)
-                {
-                    // Use forward geolocation array interpolation to compute
-                    // the georeferenced position corresponding to (dfX, dfY)
-                    double dfGeoLocX;
-                    double dfGeoLocY;
-                    if (!PixelLineToXY(psTransform, dfX, dfY, dfGeoLocX,
-                                       dfGeoLocY))
-                        continue;
-
-                    // Compute the floating point coordinates in the pixel space
-                    // of the backmap
-                    const double dBMX = static_cast<double>(
-                        (dfGeoLocX - dfMinX) / dfPixelXSize);
-
-                    const double dBMY = static_cast<double>(
-                        (dfMaxY - dfGeoLocY) / dfPixelYSize);
-
-                    // Get top left index by truncation
-                    const int iBMX = static_cast<int>(std::floor(dBMX));
-                    const int iBMY = static_cast<int>(std::floor(dBMY));
-
-                    if (iBMX >= 0 && iBMX < nBMXSize && iBMY >= 0 &&
-                        iBMY < nBMYSize)
-                    {
-                        // Compute the georeferenced position of the top-left
-                        // index of the backmap
-                        double dfGeoX = dfMinX + iBMX * dfPixelXSize;
-                        const double dfGeoY = dfMaxY - iBMY * dfPixelYSize;
-
-                        bool bMatchingGeoLocCellFound = false;
-
-                        const int nOuterIters =
-                            psTransform->bGeographicSRSWithMinus180Plus180LongRange &&
-                                    fabs(dfGeoX) >= 180
-                                ? 2
-                                : 1;
+                pAccessors->backMapXAccessor.Set(
+                    iBMX, iBMY, static_cast<float>(sSample.dfA));
+                pAccessors->backMapYAccessor.Set(
+                    iBMX, iBMY, static_cast<float>(sSample.dfB));
+                pAccessors->backMapWeightAccessor.Set(iBMX, iBMY, 1.0f);
+                continue;
+            }
 
-                        for (int iOuterIter = 0; iOuterIter < nOuterIters;
-                             ++iOuterIter)
-                        {
-                            if (iOuterIter == 1 && dfGeoX >= 180)
-                                dfGeoX -= 360;
-                            else if (iOuterIter == 1 && dfGeoX <= -180)
-                                dfGeoX += 360;
-
-                            // Identify a cell (quadrilateral in georeferenced
-                            // space) in the geolocation array in which dfGeoX,
-                            // dfGeoY falls into.
-                            oPoint.setX(dfGeoX);
-                            oPoint.setY(dfGeoY);
-                            const int nX = static_cast<int>(std::floor(dfX));
-                            const int nY = static_cast<int>(std::floor(dfY));
-                            for (int sx = -1;
-                                 !bMatchingGeoLocCellFound && sx <= 0; sx++)
-                            {
-                                for (int sy = -1;
-                                     !bMatchingGeoLocCellFound && sy <= 0; sy++)
-                                {
-                                    const int pixel = nX + sx;
-                                    const int line = nY + sy;
-                                    double x0, y0, x1, y1, x2, y2, x3, y3;
-                                    if (!PixelLineToXY(psTransform, pixel, line,
-                                                       x0, y0) ||
-                                        !PixelLineToXY(psTransform, pixel + 1,
-                                                       line, x2, y2) ||
-                                        !PixelLineToXY(psTransform, pixel,
-                                                       line + 1, x1, y1) ||
-                                        !PixelLineToXY(psTransform, pixel + 1,
-                                                       line + 1, x3, y3))
-                                    {
-                                        break;
-                                    }
-
-                                    int nIters = 1;
-                                    if (psTransform
-                                            ->bGeographicSRSWithMinus180Plus180LongRange &&
-                                        std::fabs(x0) > 170 &&
-                                        std::fabs(x1) > 170 &&
-                                        std::fabs(x2) > 170 &&
-                                        std::fabs(x3) > 170 &&
-                                        (std::fabs(x1 - x0) > 180 ||
-                                         std::fabs(x2 - x0) > 180 ||
-                                         std::fabs(x3 - x0) > 180))
-                                    {
-                                        nIters = 2;
-                                        if (x0 > 0)
-                                            x0 -= 360;
-                                        if (x1 > 0)
-                                            x1 -= 360;
-                                        if (x2 > 0)
-                                            x2 -= 360;
-                                        if (x3 > 0)
-                                            x3 -= 360;
-                                    }
-                                    for (int iIter = 0; iIter < nIters; ++iIter)
-                                    {
-                                        if (iIter == 1)
-                                        {
-                                            x0 += 360;
-                                            x1 += 360;
-                                            x2 += 360;
-                                            x3 += 360;
-                                        }
-
-                                        oRing.setPoint(0, x0, y0);
-                                        oRing.setPoint(1, x2, y2);
-                                        oRing.setPoint(2, x3, y3);
-                                        oRing.setPoint(3, x1, y1);
-                                        oRing.setPoint(4, x0, y0);
-                                        if (oRing.isPointInRing(&oPoint) ||
-                                            oRing.isPointOnRingBoundary(
-                                                &oPoint))
-                                        {
-                                            bMatchingGeoLocCellFound = true;
-                                            double dfBMXValue = pixel;
-                                            double dfBMYValue = line;
-                                            GDALInverseBilinearInterpolation(
-                                                dfGeoX, dfGeoY, x0, y0, x1, y1,
-                                                x2, y2, x3, y3, dfBMXValue,
-                                                dfBMYValue);
-
-                                            dfBMXValue =
-                                                (dfBMXValue +
-                                                 dfGeorefConventionOffset) *
-                                                    psTransform->dfPIXEL_STEP +
-                                                psTransform->dfPIXEL_OFFSET;
-                                            dfBMYValue =
-                                                (dfBMYValue +
-                                                 dfGeorefConventionOffset) *
-                                                    psTransform->dfLINE_STEP +
-                                                psTransform->dfLINE_OFFSET;
-
-                                            pAccessors->backMapXAccessor.Set(
-                                                iBMX, iBMY,
-                                                static_cast<float>(dfBMXValue));
-                                            pAccessors->backMapYAccessor.Set(
-                                                iBMX, iBMY,
-                                                static_cast<float>(dfBMYValue));
-                                            pAccessors->backMapWeightAccessor
-                                                .Set(iBMX, iBMY, 1.0f);
-                                        }
-                                    }
-                                }
-                            }
-                        }
-                        if (bMatchingGeoLocCellFound)
-                            continue;
-                    }
+            const double dfX = sSample.dfA;
+            const double dfY = sSample.dfB;
+            const double fracBMX = sSample.dfFracBMX;
+            const double fracBMY = sSample.dfFracBMY;
 
-                    // We will end up here in non-nominal cases, with nodata,
-                    // holes, etc.
+            // Check logic for top left pixel
+            if ((iBMX >= 0) && (iBMY >= 0) && (iBMX < nBMXSize) &&
+                (iBMY < nBMYSize) &&
+                pAccessors->backMapWeightAccessor.Get(iBMX, iBMY) != 1.0f)
+            {
+                const double tempwt = (1.0 - fracBMX) * (1.0 - fracBMY);
+                UpdateBackmap(iBMX, iBMY, dfX, dfY, tempwt);
+            }
 
-                    // Check if the center is in range
-                    if (iBMX < -1 || iBMY < -1 || iBMX > nBMXSize ||
-                        iBMY > nBMYSize)
-                        continue;
+            // Check logic for top right pixel
+            if ((iBMY >= 0) && (iBMX + 1 < nBMXSize) && (iBMY < nBMYSize) &&
+                pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY) != 1.0f)
+            {
+                const double tempwt = fracBMX * (1.0 - fracBMY);
+                UpdateBackmap(iBMX + 1, iBMY, dfX, dfY, tempwt);
+            }
 
-                    const double fracBMX = dBMX - iBMX;
-                    const double fracBMY = dBMY - iBMY;
+            // Check logic for bottom right pixel
+            if ((iBMX + 1 < nBMXSize) && (iBMY + 1 < nBMYSize) &&
+                pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY + 1) !=
+                    1.0f)
+            {
+                const double tempwt = fracBMX * fracBMY;
+                UpdateBackmap(iBMX + 1, iBMY + 1, dfX, dfY, tempwt);
+            }
 
-                    // Check logic for top left pixel
-                    if ((iBMX >= 0) && (iBMY >= 0) && (iBMX < nBMXSize) &&
-                        (iBMY < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX, iBMY) !=
-                            1.0f)
-                    {
-                        const double tempwt = (1.0 - fracBMX) * (1.0 - fracBMY);
-                        UpdateBackmap(iBMX, iBMY, dfX, dfY, tempwt);
-                    }
+            // Check logic for bottom left pixel
+            if ((iBMX >= 0) && (iBMX < nBMXSize) && (iBMY + 1 < nBMYSize) &&
+                pAccessors->backMapWeightAccessor.Get(iBMX, iBMY + 1) != 1.0f)
+            {
+                const double tempwt = (1.0 - fracBMX) * fracBMY;
+                UpdateBackmap(iBMX, iBMY + 1, dfX, dfY, tempwt);
+            }
+        }
+    };
 
-                    // Check logic for top right pixel
-                    if ((iBMY >= 0) && (iBMX + 1 < nBMXSize) &&
-                        (iBMY < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX + 1, iBMY) !=
-                            1.0f)
-                    {
-                        const double tempwt = fracBMX * (1.0 - fracBMY);
-                        UpdateBackmap(iBMX + 1, iBMY, dfX, dfY, tempwt);
-                    }
+    // The contributions of the samples of each geolocation tile only depend
+    // on the geolocation arrays, so they can be computed by several threads.
+    // They are then pushed into the backmap serially, in the order of tiles,
+    // so that the result does not depend on the number of threads.
+    const int nTiles = nXBlocks * nYBlocks;
+    const int nThreads = std::min(psTransform->nNumThreads, nTiles);
+    CPLJobQueuePtr poJobQueue;
+    if (nThreads > 1)
+    {
+        CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+            poJobQueue = poThreadPool->CreateJobQueue();
+    }
 
-                    // Check logic for bottom right pixel
-                    if ((iBMX + 1 < nBMXSize) && (iBMY + 1 < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX + 1,
-                                                              iBMY + 1) != 1.0f)
-                    {
-                        const double tempwt = fracBMX * fracBMY;
-                        UpdateBackmap(iBMX + 1, iBMY + 1, dfX, dfY, tempwt);
-                    }
+    if (!poJobQueue)
+    {
+        std::vector<GDALGeoLocBackMapSample> aSamples;
+        for (int iTile = 0; iTile < nTiles; ++iTile)
+        {
+            const int iYBlock = iTile / nXBlocks;
+            const int iXBlock = iTile % nXBlocks;
+            aSamples.clear();
+            GDALGeoLocComputeBackMapSamples<Accessors>(
+                psTransform, sGrid, dfStep, yStartEnd[iYBlock],
+                xStartEnd[iXBlock], aSamples);
+            PushSamples(aSamples);
+        }
+    }
+    else
+    {
+        CPLDebug("GEOLOC", "Using %d threads for backmap generation",
+                 nThreads);
+
+        // Each job reads the geolocation arrays through its own reader
+        using Reader = typename Accessors::GeolocReader;
+        std::mutex oReaderMutex;
+        std::vector<std::unique_ptr<Reader>> apoReaders;
+        std::vector<GDALGeoLocTransformInfo> asTransforms(nThreads,
+                                                          *psTransform);
+        std::vector<std::vector<GDALGeoLocBackMapSample>> aaSamples(nThreads);
+        for (int i = 0; i < nThreads; ++i)
+        {
+            apoReaders.push_back(
+                std::make_unique<Reader>(*pAccessors, oReaderMutex));
+            asTransforms[i].pAccessors = apoReaders.back().get();
+        }
 
-                    // Check logic for bottom left pixel
-                    if ((iBMX >= 0) && (iBMX < nBMXSize) &&
-                        (iBMY + 1 < nBMYSize) &&
-                        pAccessors->backMapWeightAccessor.Get(iBMX, iBMY + 1) !=
-                            1.0f)
+        for (int iFirstTile = 0; iFirstTile < nTiles; iFirstTile += nThreads)
+        {
+            const int nJobs = std::min(nThreads, nTiles - iFirstTile);
+            for (int i = 0; i < nJobs; ++i)
+            {
+                const int iYBlock = (iFirstTile + i) / nXBlocks;
+                const int iXBlock = (iFirstTile + i) % nXBlocks;
+                poJobQueue->SubmitJob(
+                    [&, i, iYBlock, iXBlock]()
                     {
-                        const double tempwt = (1.0 - fracBMX) * fracBMY;
-                        UpdateBackmap(iBMX, iBMY + 1, dfX, dfY, tempwt);
-                    }
-                }
+                        aaSamples[i].clear();
+                        GDALGeoLocComputeBackMapSamples<Reader>(
+                            &asTransforms[i], sGrid, dfStep,
+                            yStartEnd[iYBlock], xStartEnd[iXBlock],
+                            aaSamples[i]);
+                    });
             }
+            poJobQueue->WaitCompletion();
+            for (int i = 0; i < nJobs; ++i)
+                PushSamples(aaSamples[i]);
         }
     }
 
     // Each pixel in the backmap may have multiple entries.
     // We now go in average it out using the weights
-    START_ITER_PER_BLOCK(nBMXSize, TILE_SIZE, nBMYSize, TILE_SIZE, (void)0,
-                         iXStart, iXEnd, iYStart, iYEnd)
+    const auto AverageBackmap =
+        [pAccessors](int iXStart, int iXEnd, int iYStart, int iYEnd)
     {
         for (int iY = iYStart; iY < iYEnd; ++iY)
         {
@@ -1467,8 +1637,27 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
                 }
             }
         }
+    };
+
+    if constexpr (Accessors::CONCURRENT_BACKMAP_ACCESS)
+    {
+        GDALGeoLocProcessRowStrips(nBMYSize, psTransform->nNumThreads,
+                                   [&AverageBackmap, nBMXSize](int iYStart,
+                                                               int iYEnd)
+                                   {
+                                       AverageBackmap(0, nBMXSize, iYStart,
+                                                      iYEnd);
+                                   });
+    }
+    else
+    {
+        START_ITER_PER_BLOCK(nBMXSize, TILE_SIZE, nBMYSize, TILE_SIZE, (void)0,
+                             iXStart, iXEnd, iYStart, iYEnd)
+        {
+            AverageBackmap(iXStart, iXEnd, iYStart, iYEnd);
+        }
+        END_ITER_PER_BLOCK
     }
-    END_ITER_PER_BLOCK
 
     pAccessors->FreeWghtsBackMap();
 
@@ -1489,12 +1678,17 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
 
     constexpr double dfMaxSearchDist = 3.0;
     constexpr int nSmoothingIterations = 1;
+    CPLStringList aosFillOptions;
+    if (psTransform->nNumThreads > 1)
+        aosFillOptions.SetNameValue(
+            "NUM_THREADS", CPLSPrintf("%d", psTransform->nNumThreads));
     for (int i = 1; i <= 2; i++)
     {
         GDALFillNodata(GDALRasterBand::ToHandle(poBackmapDS->GetRasterBand(i)),
                        nullptr, dfMaxSearchDist,
                        0,  // unused parameter
-                       nSmoothingIterations, nullptr, nullptr, nullptr);
+                       nSmoothingIterations, aosFillOptions.List(), nullptr,
+                       nullptr);
     }
 
 #ifdef DEBUG_GEOLOC
@@ -1514,15 +1708,9 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
         float bmX = 0;
     };
 
-    std::vector<LastValidStruct> lastValid(TILE_SIZE);
-    const auto reinitLine = [&lastValid]()
-    {
-        const size_t nSize = lastValid.size();
-        lastValid.clear();
-        lastValid.resize(nSize);
-    };
-    START_ITER_PER_BLOCK(nBMXSize, TILE_SIZE, nBMYSize, TILE_SIZE, reinitLine(),
-                         iXStart, iXEnd, iYStart, iYEnd)
+    const auto FillLines = [pAccessors](int iXStart, int iXEnd, int iYStart,
+                                        int iYEnd,
+                                        std::vector<LastValidStruct> &lastValid)
     {
         const int iYCount = iYEnd - iYStart;
         for (int iYIter = 0; iYIter < iYCount; ++iYIter)
@@ -1565,8 +1753,34 @@ bool GDALGeoLoc<Accessors>::GenerateBackMap(
             lastValid[iYIter].iX = iLastValidIX;
             lastValid[iYIter].bmX = bmXLastValid;
         }
+    };
+
+    if constexpr (Accessors::CONCURRENT_BACKMAP_ACCESS)
+    {
+        GDALGeoLocProcessRowStrips(
+            nBMYSize, psTransform->nNumThreads,
+            [&FillLines, nBMXSize](int iYStart, int iYEnd)
+            {
+                std::vector<LastValidStruct> lastValid(iYEnd - iYStart);
+                FillLines(0, nBMXSize, iYStart, iYEnd, lastValid);
+            });
+    }
+    else
+    {
+        std::vector<LastValidStruct> lastValid(TILE_SIZE);
+        const auto reinitLine = [&lastValid]()
+        {
+            const size_t nSize = lastValid.size();
+            lastValid.clear();
+            lastValid.resize(nSize);
+        };
+        START_ITER_PER_BLOCK(nBMXSize, TILE_SIZE, nBMYSize, TILE_SIZE,
+                             reinitLine(), iXStart, iXEnd, iYStart, iYEnd)
+        {
+            FillLines(iXStart, iXEnd, iYStart, iYEnd, lastValid);
+        }
+        END_ITER_PER_BLOCK
     }
-    END_ITER_PER_BLOCK
 
 #ifdef DEBUG_GEOLOC
     if (CPLTestBool(CPLGetConfigOption("GEOLOC_DUMP", "NO")))
@@ -1631,6 +1845,7 @@ static void *GDALCreateSimilarGeoLocTransformer(void *hTransformArg,
         static_cast<GDALGeoLocTransformInfo *>(GDALCreateGeoLocTransformer(
             nullptr, papszGeolocationInfo, psInfo->bReversed));
     psInfoNew->dfOversampleFactor = psInfo->dfOversampleFactor;
+    psInfoNew->nNumThreads = psInfo->nNumThreads;
 
     CSLDestroy(papszGeolocationInfo);
 
@@ -1798,6 +2013,8 @@ void *GDALCreateGeoLocTransformerEx(GDALDatasetH hBaseDS,
                      papszTransformOptions, "GEOLOC_BACKMAP_OVERSAMPLE_FACTOR",
                      CPLGetConfigOption("GDAL_GEOLOC_BACKMAP_OVERSAMPLE_FACTOR",
                                         "1.3")))));
+    psTransform->nNumThreads =
+        GDALGetNumThreads(papszTransformOptions, "NUM_THREADS");
 
     memcpy(psTransform->sTI.abySignature, GDAL_GTI2_SIGNATURE,
            strlen(GDAL_GTI2_SIGNATURE));
@@ -60,6 +60,23 @@ class GDALGeoLocCArrayAccessors
     CArrayAccessor<float> backMapYAccessor;
     CArrayAccessor<float> backMapWeightAccessor;
 
+    // Backmap arrays are plain memory, so distinct nodes can be updated
+    // concurrently.
+    static constexpr bool CONCURRENT_BACKMAP_ACCESS = true;
+
+    // Read-only access to the geolocation arrays, for a worker thread.
+    struct GeolocReader
+    {
+        CArrayAccessor<double> geolocXAccessor;
+        CArrayAccessor<double> geolocYAccessor;
+
+        GeolocReader(const GDALGeoLocCArrayAccessors &oAccessors, std::mutex &)
+            : geolocXAccessor(oAccessors.geolocXAccessor),
+              geolocYAccessor(oAccessors.geolocYAccessor)
+        {
+        }
+    };
+
     explicit GDALGeoLocCArrayAccessors(GDALGeoLocTransformInfo *psTransform)
         : m_psTransform(psTransform), geolocXAccessor(nullptr, 0),
           geolocYAccessor(nullptr, 0), backMapXAccessor(nullptr, 0),
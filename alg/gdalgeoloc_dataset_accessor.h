@@ -12,8 +12,90 @@
 
 #include "gdalcachedpixelaccessor.h"
 
+#include <array>
+#include <mutex>
+#include <vector>
+
 /*! @cond Doxygen_Suppress */
 
+/************************************************************************/
+/*                   GDALGeoLocConcurrentBandReader                     */
+/************************************************************************/
+
+// Read-only cached access to a geolocation band, used by a worker thread
+// while generating the backmap. Several instances may read the same band
+// concurrently, as tile loads are serialized through a shared mutex.
+template <int TILE_SIZE> class GDALGeoLocConcurrentBandReader
+{
+    // Direct-mapped cache of 3x3 tiles, which covers the neighbourhood of
+    // the geolocation tile processed by a backmap generation job.
+    static constexpr int CACHE_DIM = 3;
+
+    struct CachedTile
+    {
+        int m_nTileX = -1;
+        int m_nTileY = -1;
+        std::vector<double> m_data{};
+    };
+
+    GDALRasterBand *m_poBand;
+    std::mutex &m_oMutex;
+    std::array<CachedTile, CACHE_DIM * CACHE_DIM> m_aCachedTiles{};
+
+    GDALGeoLocConcurrentBandReader(const GDALGeoLocConcurrentBandReader &) =
+        delete;
+    GDALGeoLocConcurrentBandReader &
+    operator=(const GDALGeoLocConcurrentBandReader &) = delete;
+
+    bool LoadTile(CachedTile &oTile, int nTileX, int nTileY)
+    {
+        const int nXOff = nTileX * TILE_SIZE;
+        const int nYOff = nTileY * TILE_SIZE;
+        const int nReqXSize =
+            std::min(m_poBand->GetXSize() - nXOff, TILE_SIZE);
+        const int nReqYSize =
+            std::min(m_poBand->GetYSize() - nYOff, TILE_SIZE);
+        oTile.m_data.resize(TILE_SIZE * TILE_SIZE);
+        oTile.m_nTileX = -1;
+        oTile.m_nTileY = -1;
+        std::lock_guard oLock(m_oMutex);
+        if (m_poBand->RasterIO(GF_Read, nXOff, nYOff, nReqXSize, nReqYSize,
+                               oTile.m_data.data(), nReqXSize, nReqYSize,
+                               GDT_Float64, sizeof(double),
+                               TILE_SIZE * sizeof(double),
+                               nullptr) != CE_None)
+        {
+            return false;
+        }
+        oTile.m_nTileX = nTileX;
+        oTile.m_nTileY = nTileY;
+        return true;
+    }
+
+  public:
+    GDALGeoLocConcurrentBandReader(GDALRasterBand *poBand, std::mutex &oMutex)
+        : m_poBand(poBand), m_oMutex(oMutex)
+    {
+    }
+
+    double Get(int nX, int nY, bool *pbSuccess = nullptr)
+    {
+        const int nTileX = nX / TILE_SIZE;
+        const int nTileY = nY / TILE_SIZE;
+        CachedTile &oTile =
+            m_aCachedTiles[(nTileY % CACHE_DIM) * CACHE_DIM +
+                           (nTileX % CACHE_DIM)];
+        const bool bOK = (oTile.m_nTileX == nTileX &&
+                          oTile.m_nTileY == nTileY) ||
+                         LoadTile(oTile, nTileX, nTileY);
+        if (pbSuccess)
+            *pbSuccess = bOK;
+        if (!bOK)
+            return 0;
+        return oTile.m_data[(nY % TILE_SIZE) * TILE_SIZE + (nX % TILE_SIZE)];
+    }
+};
+
 /************************************************************************/
 /*                        GDALGeoLocDatasetAccessors                    */
 /************************************************************************/
@@ -29,6 +111,8 @@ class GDALGeoLocDatasetAccessors
     GDALDataset *m_poGeolocTmpDataset = nullptr;
     GDALDataset *m_poBackmapTmpDataset = nullptr;
     GDALDataset *m_poBackmapWeightsTmpDataset = nullptr;
+    GDALRasterBand *m_poGeolocXBand = nullptr;
+    GDALRasterBand *m_poGeolocYBand = nullptr;
 
     GDALGeoLocDatasetAccessors(const GDALGeoLocDatasetAccessors &) = delete;
     GDALGeoLocDatasetAccessors &
@@ -46,6 +130,24 @@ class GDALGeoLocDatasetAccessors
     GDALCachedPixelAccessor<float, TILE_SIZE, TILE_COUNT> backMapYAccessor;
     GDALCachedPixelAccessor<float, TILE_SIZE, TILE_COUNT> backMapWeightAccessor;
 
+    // Backmap tiles are cached per accessor, so they cannot be updated by
+    // several threads.
+    static constexpr bool CONCURRENT_BACKMAP_ACCESS = false;
+
+    // Read-only access to the geolocation arrays, for a worker thread.
+    struct GeolocReader
+    {
+        GDALGeoLocConcurrentBandReader<TILE_SIZE> geolocXAccessor;
+        GDALGeoLocConcurrentBandReader<TILE_SIZE> geolocYAccessor;
+
+        GeolocReader(const GDALGeoLocDatasetAccessors &oAccessors,
+                     std::mutex &oMutex)
+            : geolocXAccessor(oAccessors.m_poGeolocXBand, oMutex),
+              geolocYAccessor(oAccessors.m_poGeolocYBand, oMutex)
+        {
+        }
+    };
+
     explicit GDALGeoLocDatasetAccessors(GDALGeoLocTransformInfo *psTransform)
         : m_psTransform(psTransform), geolocXAccessor(nullptr),
           geolocYAccessor(nullptr), backMapXAccessor(nullptr),
@@ -276,16 +378,16 @@ bool GDALGeoLocDatasetAccessors::LoadGeoloc(bool bIsRegularGrid)
         if (eErr != CE_None)
             return false;
 
-        geolocXAccessor.SetBand(poXBand);
-        geolocYAccessor.SetBand(poYBand);
+        m_poGeolocXBand = poXBand;
+        m_poGeolocYBand = poYBand;
     }
     else
     {
-        geolocXAccessor.SetBand(
-            GDALRasterBand::FromHandle(m_psTransform->hBand_X));
-        geolocYAccessor.SetBand(
-            GDALRasterBand::FromHandle(m_psTransform->hBand_Y));
+        m_poGeolocXBand = GDALRasterBand::FromHandle(m_psTransform->hBand_X);
+        m_poGeolocYBand = GDALRasterBand::FromHandle(m_psTransform->hBand_Y);
     }
+    geolocXAccessor.SetBand(m_poGeolocXBand);
+    geolocYAccessor.SetBand(m_poGeolocYBand);
 
     GDALGeoLoc<GDALGeoLocDatasetAccessors>::LoadGeolocFinish(m_psTransform);
     return true;
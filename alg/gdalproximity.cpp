@@ -18,13 +18,24 @@
 #include <cstdlib>
 
 #include <algorithm>
+#include <atomic>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
+#include "gdal_priv.h"
+#include "gdal_thread_pool.h"
+#include "gdalstripprocessing.h"
 
 static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
                                    int *panNearY, int bForward, int iLine,
@@ -33,6 +44,28 @@ static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
                                    double *pdfSrcNoDataValue, int nTargetValues,
                                    int *panTargetValues);
 
+namespace
+{
+struct GDALProximityEDTParams
+{
+    double dfMaxDist = 0;
+    double dfDistMult = 1;
+    const double *pdfSrcNoData = nullptr;
+    float fNoDataValue = 0;
+    bool bFixedBufVal = false;
+    double dfFixedBufVal = 0;
+    int nTargetValues = 0;
+    const int *panTargetValues = nullptr;
+};
+}  // namespace
+
+static CPLErr GDALComputeProximityEDT(GDALRasterBandH hSrcBand,
+                                      GDALRasterBandH hProximityBand,
+                                      const GDALProximityEDTParams &sParams,
+                                      int nThreads,
+                                      GDALProgressFunc pfnProgress,
+                                      void *pProgressArg);
+
 /************************************************************************/
 /*                        GDALComputeProximity()                        */
 /************************************************************************/
@@ -89,6 +122,20 @@ the proximity output.
 
 If this option is set, all pixels within the MAXDIST threshold are
 set to this fixed value instead of to a proximity distance.
+
+  ALGORITHM=[CLASSIC]/EDT
+
+(GDAL >= 3.12) Algorithm used to compute distances. CLASSIC propagates the
+nearest target pixel in a top-down and a bottom-up pass over scanlines.
+EDT computes an exact Euclidean distance transform in a pass over rows
+followed by a pass over columns, which can use several threads. EDT needs to
+hold 4 bytes per pixel of the raster in memory. When CLASSIC finds the nearest
+target pixel, both algorithms give the same result.
+
+  NUM_THREADS=n/ALL_CPUS
+
+(GDAL >= 3.12) Number of threads to use with ALGORITHM=EDT. Defaults to the
+value of the GDAL_NUM_THREADS configuration option, or 1.
 */
 
 CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
@@ -137,6 +184,27 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
         }
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Which algorithm do we use?                                      */
+    /* -------------------------------------------------------------------- */
+    bool bUseEDT = false;
+    pszOpt = CSLFetchNameValue(papszOptions, "ALGORITHM");
+    if (pszOpt)
+    {
+        if (EQUAL(pszOpt, "EDT"))
+        {
+            bUseEDT = true;
+        }
+        else if (!EQUAL(pszOpt, "CLASSIC"))
+        {
+            CPLError(
+                CE_Failure, CPLE_AppDefined,
+                "Unrecognized ALGORITHM value '%s', should be CLASSIC or EDT.",
+                pszOpt);
+            return CE_Failure;
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      What is our maxdist value?                                      */
     /* -------------------------------------------------------------------- */
@@ -235,6 +303,25 @@ CPLErr CPL_STDCALL GDALComputeProximity(GDALRasterBandH hSrcBand,
         return CE_Failure;
     }
 
+    if (bUseEDT)
+    {
+        GDALProximityEDTParams sParams;
+        sParams.dfMaxDist = dfMaxDist;
+        sParams.dfDistMult = dfDistMult;
+        sParams.pdfSrcNoData = pdfSrcNoData;
+        sParams.fNoDataValue = fNoDataValue;
+        sParams.bFixedBufVal = bFixedBufVal;
+        sParams.dfFixedBufVal = dfFixedBufVal;
+        sParams.nTargetValues = nTargetValues;
+        sParams.panTargetValues = panTargetValues;
+        const CPLErr eErr = GDALComputeProximityEDT(
+            hSrcBand, hProximityBand, sParams,
+            GDALGetNumThreads(papszOptions, "NUM_THREADS"), pfnProgress,
+            pProgressArg);
+        CPLFree(panTargetValues);
+        return eErr;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      We need a signed type for the working proximity values kept     */
     /*      on disk.  If our proximity band is not signed, then create a    */
@@ -575,3 +662,414 @@ static CPLErr ProcessProximityLine(GInt32 *panSrcScanline, int *panNearX,
 
     return CE_None;
 }
+
+/************************************************************************/
+/*                    Exact Euclidean distance transform                */
+/************************************************************************/
+
+// The row pass stores, for each pixel, the horizontal distance to the nearest
+// target pixel in its row in the 31 least significant bits of the work
+// buffer. The most significant bit flags non-target pixels at the source
+// nodata value. The column pass then replaces these values with the final
+// distance (as a float, -1 meaning no target within MAXDIST).
+constexpr GUInt32 EDT_INFINITE = 0x7FFFFFFFU;
+constexpr GUInt32 EDT_NODATA_FLAG = 0x80000000U;
+
+// Number of columns processed together by the column pass, so that reads
+// and writes of the work buffer are done by whole cache lines.
+constexpr int EDT_COLUMN_BLOCK = 16;
+
+static_assert(sizeof(float) == sizeof(GUInt32),
+              "float and GUInt32 should have the same size");
+
+/************************************************************************/
+/*                        GDALProximityIsTarget()                       */
+/************************************************************************/
+
+static inline bool GDALProximityIsTarget(GInt32 nValue,
+                                         const GDALProximityEDTParams &sParams)
+{
+    if (sParams.nTargetValues == 0)
+        return nValue != 0;
+    for (int i = 0; i < sParams.nTargetValues; i++)
+    {
+        if (nValue == sParams.panTargetValues[i])
+            return true;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                        GDALProximityEDTRows()                        */
+/************************************************************************/
+
+static bool GDALProximityEDTRows(GDALRasterBandH hSrcBand, std::mutex *poMutex,
+                                 int nXSize, int nYOff, int nYCount,
+                                 const GDALProximityEDTParams &sParams,
+                                 GUInt32 *panWork)
+{
+    std::vector<GInt32> anSrc(static_cast<size_t>(nXSize) * nYCount);
+    {
+        std::unique_ptr<std::lock_guard<std::mutex>> poLock;
+        if (poMutex)
+            poLock = std::make_unique<std::lock_guard<std::mutex>>(*poMutex);
+        if (GDALRasterIO(hSrcBand, GF_Read, 0, nYOff, nXSize, nYCount,
+                         anSrc.data(), nXSize, nYCount, GDT_Int32, 0,
+                         0) != CE_None)
+            return false;
+    }
+
+    for (int iLine = 0; iLine < nYCount; iLine++)
+    {
+        const GInt32 *panSrc =
+            anSrc.data() + static_cast<size_t>(iLine) * nXSize;
+        GUInt32 *panDist =
+            panWork + static_cast<size_t>(nYOff + iLine) * nXSize;
+
+        // Left to right.
+        GUInt32 nDist = EDT_INFINITE;
+        for (int i = 0; i < nXSize; i++)
+        {
+            if (GDALProximityIsTarget(panSrc[i], sParams))
+                nDist = 0;
+            else if (nDist != EDT_INFINITE)
+                nDist++;
+            panDist[i] = nDist;
+        }
+
+        // Right to left.
+        nDist = EDT_INFINITE;
+        for (int i = nXSize - 1; i >= 0; i--)
+        {
+            if (panDist[i] == 0)
+            {
+                nDist = 0;
+                continue;
+            }
+            if (nDist != EDT_INFINITE)
+            {
+                nDist++;
+                if (nDist < panDist[i])
+                    panDist[i] = nDist;
+            }
+            if (sParams.pdfSrcNoData != nullptr &&
+                panSrc[i] == *sParams.pdfSrcNoData)
+                panDist[i] |= EDT_NODATA_FLAG;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       GDALProximityEDTColumns()                      */
+/************************************************************************/
+
+// For each column, compute the lower envelope of the parabolas
+// y -> (y - q)^2 + G(q)^2, where G(q) is the horizontal distance computed by
+// the row pass, following "Distance Transforms of Sampled Functions"
+// (Felzenszwalb and Huttenlocher, 2012).
+
+static void GDALProximityEDTColumns(int nXSize, int nYSize, int nXOff,
+                                    int nXCount, double dfMaxDistSq,
+                                    GUInt32 *panWork)
+{
+    std::vector<GUInt32> anBlock(static_cast<size_t>(nYSize) *
+                                 EDT_COLUMN_BLOCK);
+    std::vector<int> anV(nYSize);
+    std::vector<double> adfF(nYSize);
+    std::vector<double> adfZ(static_cast<size_t>(nYSize) + 1);
+    constexpr double dfInf = std::numeric_limits<double>::infinity();
+
+    for (int nBlockXOff = nXOff; nBlockXOff < nXOff + nXCount;
+         nBlockXOff += EDT_COLUMN_BLOCK)
+    {
+        const int nCols =
+            std::min(EDT_COLUMN_BLOCK, nXOff + nXCount - nBlockXOff);
+        for (int iLine = 0; iLine < nYSize; iLine++)
+        {
+            memcpy(&anBlock[static_cast<size_t>(iLine) * EDT_COLUMN_BLOCK],
+                   panWork + static_cast<size_t>(iLine) * nXSize + nBlockXOff,
+                   nCols * sizeof(GUInt32));
+        }
+
+        for (int iCol = 0; iCol < nCols; iCol++)
+        {
+            GUInt32 *panCol = anBlock.data() + iCol;
+
+            // Build the lower envelope from the lines having a target.
+            int k = -1;
+            for (int q = 0; q < nYSize; q++)
+            {
+                const GUInt32 nDist =
+                    panCol[static_cast<size_t>(q) * EDT_COLUMN_BLOCK] &
+                    ~EDT_NODATA_FLAG;
+                if (nDist == EDT_INFINITE)
+                    continue;
+                const double dfF = static_cast<double>(nDist) * nDist;
+                if (k < 0)
+                {
+                    k = 0;
+                    anV[0] = q;
+                    adfF[0] = dfF;
+                    adfZ[0] = -dfInf;
+                    adfZ[1] = dfInf;
+                    continue;
+                }
+                const double dfFQ = dfF + static_cast<double>(q) * q;
+                double dfS;
+                while (true)
+                {
+                    const int v = anV[k];
+                    dfS = (dfFQ - (adfF[k] + static_cast<double>(v) * v)) /
+                          (2.0 * (q - v));
+                    if (dfS > adfZ[k])
+                        break;
+                    // adfZ[0] is -infinity, so k cannot become negative
+                    --k;
+                }
+                ++k;
+                anV[k] = q;
+                adfF[k] = dfF;
+                adfZ[k] = dfS;
+                adfZ[k + 1] = dfInf;
+            }
+
+            // Evaluate it.
+            int j = 0;
+            for (int q = 0; q < nYSize; q++)
+            {
+                GUInt32 &nVal =
+                    panCol[static_cast<size_t>(q) * EDT_COLUMN_BLOCK];
+                float fProximity = -1.0f;
+                if (k >= 0 && (nVal & EDT_NODATA_FLAG) == 0)
+                {
+                    while (adfZ[j + 1] < q)
+                        ++j;
+                    const double dfDY = static_cast<double>(q - anV[j]);
+                    const double dfDistSq = dfDY * dfDY + adfF[j];
+                    if (dfDistSq <= dfMaxDistSq)
+                        fProximity = static_cast<float>(sqrt(dfDistSq));
+                }
+                memcpy(&nVal, &fProximity, sizeof(float));
+            }
+        }
+
+        for (int iLine = 0; iLine < nYSize; iLine++)
+        {
+            memcpy(panWork + static_cast<size_t>(iLine) * nXSize + nBlockXOff,
+                   &anBlock[static_cast<size_t>(iLine) * EDT_COLUMN_BLOCK],
+                   nCols * sizeof(GUInt32));
+        }
+    }
+}
+
+/************************************************************************/
+/*                       GDALProximityEDTRunJobs()                      */
+/************************************************************************/
+
+static bool GDALProximityEDTRunJobs(CPLWorkerThreadPool *poThreadPool,
+                                    int nJobs,
+                                    const std::function<bool(int)> &oTask,
+                                    double dfProgressStart,
+                                    double dfProgressEnd,
+                                    GDALProgressFunc pfnProgress,
+                                    void *pProgressArg)
+{
+    if (poThreadPool == nullptr)
+    {
+        for (int iJob = 0; iJob < nJobs; iJob++)
+        {
+            if (!oTask(iJob))
+                return false;
+            if (!pfnProgress(dfProgressStart +
+                                 (dfProgressEnd - dfProgressStart) *
+                                     (iJob + 1) / nJobs,
+                             "", pProgressArg))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                return false;
+            }
+        }
+        return true;
+    }
+
+    CPLErrorAccumulator oErrorAccumulator;
+    std::atomic<bool> bError{false};
+    std::atomic<bool> bStop{false};
+    std::atomic<int> nDone{0};
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+    for (int iJob = 0; iJob < nJobs; iJob++)
+    {
+        const auto Job =
+            [iJob, &oTask, &oErrorAccumulator, &bError, &bStop, &nDone]()
+        {
+            auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+            try
+            {
+                if (!bError && !bStop && !oTask(iJob))
+                    bError = true;
+            }
+            catch (const std::bad_alloc &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory in GDALComputeProximity()");
+                bError = true;
+            }
+            ++nDone;
+        };
+        if (!poJobQueue->SubmitJob(Job))
+        {
+            bError = true;
+            break;
+        }
+    }
+    while (poJobQueue->WaitEvent())
+    {
+        if (!bStop &&
+            !pfnProgress(dfProgressStart + (dfProgressEnd - dfProgressStart) *
+                                               nDone / nJobs,
+                         "", pProgressArg))
+            bStop = true;
+    }
+    poJobQueue->WaitCompletion();
+    oErrorAccumulator.ReplayErrors();
+    if (bStop)
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return false;
+    }
+    return !bError;
+}
+
+/************************************************************************/
+/*                       GDALComputeProximityEDT()                      */
+/************************************************************************/
+
+static CPLErr GDALComputeProximityEDT(GDALRasterBandH hSrcBand,
+                                      GDALRasterBandH hProximityBand,
+                                      const GDALProximityEDTParams &sParams,
+                                      int nThreads,
+                                      GDALProgressFunc pfnProgress,
+                                      void *pProgressArg)
+{
+    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+
+    std::unique_ptr<GUInt32, VSIFreeReleaser> panWork(static_cast<GUInt32 *>(
+        VSI_MALLOC3_VERBOSE(sizeof(GUInt32), nXSize, nYSize)));
+    if (!panWork)
+        return CE_Failure;
+
+    CPLWorkerThreadPool *poThreadPool =
+        nThreads > 1 ? GDALGetGlobalThreadPool(nThreads) : nullptr;
+    if (!poThreadPool)
+        nThreads = 1;
+
+    /* -------------------------------------------------------------------- */
+    /*      Use a thread-safe instance of the source band if possible.      */
+    /*      Otherwise reads of the band are serialized.                     */
+    /* -------------------------------------------------------------------- */
+    GDALRasterBandH hReadBand = hSrcBand;
+    std::mutex *poMutex = nullptr;
+    std::unique_ptr<GDALThreadSafeSourceBands> poSourceBands;
+    if (poThreadPool)
+    {
+        poSourceBands = std::make_unique<GDALThreadSafeSourceBands>(
+            hSrcBand, nullptr, "GDALComputeProximity");
+        hReadBand = poSourceBands->GetSrcBand();
+        poMutex = poSourceBands->GetMutex();
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Row pass.                                                       */
+    /* -------------------------------------------------------------------- */
+    const int nLinesPerJob = std::max(
+        1, std::min(static_cast<int>(DIV_ROUND_UP(nYSize, nThreads * 4)),
+                    (1 << 22) / nXSize));
+    const int nRowJobs = static_cast<int>(DIV_ROUND_UP(nYSize, nLinesPerJob));
+    if (!GDALProximityEDTRunJobs(
+            poThreadPool, nRowJobs,
+            [&](int iJob)
+            {
+                const int nYOff = iJob * nLinesPerJob;
+                return GDALProximityEDTRows(
+                    hReadBand, poMutex, nXSize, nYOff,
+                    std::min(nLinesPerJob, nYSize - nYOff), sParams,
+                    panWork.get());
+            },
+            0.0, 0.4, pfnProgress, pProgressArg))
+    {
+        return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Column pass.                                                    */
+    /* -------------------------------------------------------------------- */
+    const int nColsPerJob =
+        static_cast<int>(DIV_ROUND_UP(
+            DIV_ROUND_UP(nXSize, nThreads * 4), EDT_COLUMN_BLOCK)) *
+        EDT_COLUMN_BLOCK;
+    const int nColJobs = static_cast<int>(DIV_ROUND_UP(nXSize, nColsPerJob));
+    const double dfMaxDistSq = sParams.dfMaxDist * sParams.dfMaxDist;
+    if (!GDALProximityEDTRunJobs(
+            poThreadPool, nColJobs,
+            [&](int iJob)
+            {
+                const int nXOff = iJob * nColsPerJob;
+                GDALProximityEDTColumns(
+                    nXSize, nYSize, nXOff,
+                    std::min(nColsPerJob, nXSize - nXOff), dfMaxDistSq,
+                    panWork.get());
+                return true;
+            },
+            0.4, 0.8, pfnProgress, pProgressArg))
+    {
+        return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Final post processing of distances, and write out results.      */
+    /* -------------------------------------------------------------------- */
+    const int nLinesPerChunk =
+        std::max(1, std::min(nYSize, (1 << 20) / nXSize));
+    std::vector<float> afProximity(static_cast<size_t>(nXSize) *
+                                   nLinesPerChunk);
+    const float fDistMult = static_cast<float>(sParams.dfDistMult);
+    const float fFixedBufVal = static_cast<float>(sParams.dfFixedBufVal);
+    for (int nYOff = 0; nYOff < nYSize; nYOff += nLinesPerChunk)
+    {
+        const int nLines = std::min(nLinesPerChunk, nYSize - nYOff);
+        const size_t nCount = static_cast<size_t>(nXSize) * nLines;
+        memcpy(afProximity.data(),
+               panWork.get() + static_cast<size_t>(nYOff) * nXSize,
+               nCount * sizeof(float));
+        for (size_t i = 0; i < nCount; i++)
+        {
+            if (afProximity[i] < 0.0f)
+                afProximity[i] = sParams.fNoDataValue;
+            else if (afProximity[i] > 0.0f)
+            {
+                if (sParams.bFixedBufVal)
+                    afProximity[i] = fFixedBufVal;
+                else
+                    afProximity[i] = afProximity[i] * fDistMult;
+            }
+        }
+
+        if (GDALRasterIO(hProximityBand, GF_Write, 0, nYOff, nXSize, nLines,
+                         afProximity.data(), nXSize, nLines, GDT_Float32, 0,
+                         0) != CE_None)
+            return CE_Failure;
+
+        if (!pfnProgress(0.8 + 0.2 * (nYOff + nLines) /
+                                   static_cast<double>(nYSize),
+                         "", pProgressArg))
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return CE_Failure;
+        }
+    }
+
+    return CE_None;
+}
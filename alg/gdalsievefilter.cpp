@@ -17,16 +17,25 @@
 #include <cstring>
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <set>
+#include <unordered_map>
 #include <vector>
 #include <utility>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_alg_priv.h"
+#include "gdal_priv.h"
+#include "gdal_thread_pool.h"
+#include "gdalstripprocessing.h"
 
 #define MY_MAX_INT 2147483647
 
@@ -125,6 +134,806 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
         anBigNeighbour[nPolyId2] = nPolyId1;
 }
 
+/************************************************************************/
+/*                          GDALSieveFilterMT                           */
+/*                                                                      */
+/*      Multi-threaded implementation of GDALSieveFilter().             */
+/*                                                                      */
+/*      The raster is split into horizontal strips. Each strip is       */
+/*      enumerated independently, and polygons touching a strip         */
+/*      boundary are merged with a union-find, which gives the same     */
+/*      polygons as the serial enumeration. The largest neighbour of    */
+/*      each polygon is collected per strip, and strips are then        */
+/*      combined in order, so that ties are resolved as in the serial   */
+/*      algorithm. Results are thus identical to the single-threaded   */
+/*      implementation.                                                 */
+/************************************************************************/
+
+namespace
+{
+struct GDALSieveStrip
+{
+    int nYOff = 0;
+    int nYSize = 0;
+
+    /** Global id of the polygon of id 0 of the strip enumerator. */
+    int nBaseId = 0;
+
+    std::unique_ptr<GDALRasterPolygonEnumerator> poEnum{};
+    std::vector<int> anPolySizes{};
+
+    /** Values and final polygon ids of the first and last lines. */
+    std::vector<std::int64_t> anFirstLineVal{};
+    std::vector<GInt32> anFirstLineId{};
+    std::vector<std::int64_t> anLastLineVal{};
+    std::vector<GInt32> anLastLineId{};
+
+    /** Largest neighbour of polygons, as seen from this strip, indexed by
+     * global polygon id. */
+    std::unordered_map<int, int> oMapBigNeighbour{};
+
+    /** Output values of the strip. */
+    std::vector<std::int64_t> anWriteVal{};
+};
+
+class GDALSieveFilterMT
+{
+  public:
+    GDALSieveFilterMT(GDALRasterBandH hSrcBand, GDALRasterBandH hMaskBand,
+                      std::mutex *poMutex, int nSizeThreshold,
+                      int nConnectedness, int nStripHeight)
+        : m_hSrcBand(hSrcBand), m_hMaskBand(hMaskBand), m_poMutex(poMutex),
+          m_nXSize(GDALGetRasterBandXSize(hSrcBand)),
+          m_nYSize(GDALGetRasterBandYSize(hSrcBand)),
+          m_nSizeThreshold(nSizeThreshold), m_nConnectedness(nConnectedness),
+          m_aoStrips(DIV_ROUND_UP(m_nYSize, nStripHeight))
+    {
+        for (int iStrip = 0; iStrip < static_cast<int>(m_aoStrips.size());
+             ++iStrip)
+        {
+            m_aoStrips[iStrip].nYOff = iStrip * nStripHeight;
+            m_aoStrips[iStrip].nYSize =
+                std::min(nStripHeight, m_nYSize - iStrip * nStripHeight);
+        }
+    }
+
+    CPLErr Run(CPLWorkerThreadPool *poThreadPool, int nThreads,
+               GDALRasterBandH hSrcBandForCopy, GDALRasterBandH hDstBand,
+               GDALProgressFunc pfnProgress, void *pProgressArg);
+
+  private:
+    const GDALRasterBandH m_hSrcBand;
+    const GDALRasterBandH m_hMaskBand;
+    std::mutex *const m_poMutex;
+    const int m_nXSize;
+    const int m_nYSize;
+    const int m_nSizeThreshold;
+    const int m_nConnectedness;
+    std::vector<GDALSieveStrip> m_aoStrips;
+
+    /** Indexed by global polygon id. */
+    std::vector<int> m_anRoot{};
+    std::vector<std::int64_t> m_anPolyValue{};
+    /** Indexed by root global polygon id. */
+    std::vector<int> m_anPolySizes{};
+    std::vector<int> m_anBigNeighbour{};
+
+    std::atomic<bool> m_bError{false};
+    std::atomic<bool> m_bStop{false};
+
+    bool ReadStrip(const GDALSieveStrip &oStrip,
+                   std::vector<std::int64_t> &anVal,
+                   std::vector<std::int64_t> *panRawVal) const;
+
+    template <class F>
+    bool EnumerateStrip(const GDALSieveStrip &oStrip,
+                        GDALRasterPolygonEnumerator &oEnum,
+                        std::vector<std::int64_t> &anVal, F &&oLineFunc) const;
+
+    bool CollectPolygons(GDALSieveStrip &oStrip);
+    void MergeStrips();
+    bool CollectNeighbours(int iStrip);
+    void ResolveMerges();
+    bool ComputeOutput(GDALSieveStrip &oStrip);
+
+    int FindRoot(int nId);
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALSieveFilterMT)
+};
+
+/************************************************************************/
+/*                    GDALSieveFilterMT::ReadStrip()                    */
+/************************************************************************/
+
+bool GDALSieveFilterMT::ReadStrip(const GDALSieveStrip &oStrip,
+                                  std::vector<std::int64_t> &anVal,
+                                  std::vector<std::int64_t> *panRawVal) const
+{
+    const size_t nCount = static_cast<size_t>(m_nXSize) * oStrip.nYSize;
+    anVal.resize(nCount);
+    std::vector<GByte> abyMask;
+    if (m_hMaskBand)
+        abyMask.resize(nCount);
+
+    {
+        std::unique_ptr<std::lock_guard<std::mutex>> poLock;
+        if (m_poMutex)
+            poLock = std::make_unique<std::lock_guard<std::mutex>>(*m_poMutex);
+        if (GDALRasterIO(m_hSrcBand, GF_Read, 0, oStrip.nYOff, m_nXSize,
+                         oStrip.nYSize, anVal.data(), m_nXSize, oStrip.nYSize,
+                         GDT_Int64, 0, 0) != CE_None)
+            return false;
+        if (m_hMaskBand &&
+            GDALRasterIO(m_hMaskBand, GF_Read, 0, oStrip.nYOff, m_nXSize,
+                         oStrip.nYSize, abyMask.data(), m_nXSize,
+                         oStrip.nYSize, GDT_Byte, 0, 0) != CE_None)
+            return false;
+    }
+
+    if (panRawVal)
+        *panRawVal = anVal;
+    if (m_hMaskBand)
+    {
+        for (size_t i = 0; i < nCount; ++i)
+        {
+            if (abyMask[i] == 0)
+                anVal[i] = GP_NODATA_MARKER;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                  GDALSieveFilterMT::EnumerateStrip()                 */
+/************************************************************************/
+
+template <class F>
+bool GDALSieveFilterMT::EnumerateStrip(const GDALSieveStrip &oStrip,
+                                       GDALRasterPolygonEnumerator &oEnum,
+                                       std::vector<std::int64_t> &anVal,
+                                       F &&oLineFunc) const
+{
+    std::vector<GInt32> anLastLineId(m_nXSize);
+    std::vector<GInt32> anThisLineId(m_nXSize);
+    for (int iLine = 0; iLine < oStrip.nYSize; ++iLine)
+    {
+        if (m_bError || m_bStop)
+            return false;
+        std::int64_t *panThisLineVal =
+            anVal.data() + static_cast<size_t>(iLine) * m_nXSize;
+        std::int64_t *panLastLineVal =
+            iLine == 0 ? nullptr : panThisLineVal - m_nXSize;
+        if (!oEnum.ProcessLine(panLastLineVal, panThisLineVal,
+                               iLine == 0 ? nullptr : anLastLineId.data(),
+                               anThisLineId.data(), m_nXSize))
+            return false;
+        oLineFunc(iLine, panThisLineVal, anThisLineId.data(),
+                  iLine == 0 ? nullptr : anLastLineId.data());
+        std::swap(anLastLineId, anThisLineId);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                 GDALSieveFilterMT::CollectPolygons()                 */
+/*                                                                      */
+/*      First pass: enumerate the polygons of a strip and accumulate    */
+/*      their sizes.                                                    */
+/************************************************************************/
+
+bool GDALSieveFilterMT::CollectPolygons(GDALSieveStrip &oStrip)
+{
+    std::vector<std::int64_t> anVal;
+    if (!ReadStrip(oStrip, anVal, nullptr))
+        return false;
+
+    oStrip.poEnum =
+        std::make_unique<GDALRasterPolygonEnumerator>(m_nConnectedness);
+    auto &oEnum = *(oStrip.poEnum);
+    auto &anPolySizes = oStrip.anPolySizes;
+    if (!EnumerateStrip(
+            oStrip, oEnum, anVal,
+            [this, &oStrip, &oEnum, &anPolySizes](int iLine,
+                                                  const std::int64_t *panVal,
+                                                  const GInt32 *panId,
+                                                  const GInt32 *)
+            {
+                if (oEnum.nNextPolygonId > static_cast<int>(anPolySizes.size()))
+                    anPolySizes.resize(oEnum.nNextPolygonId);
+                for (int iX = 0; iX < m_nXSize; iX++)
+                {
+                    const int iPoly = panId[iX];
+                    if (iPoly >= 0 && anPolySizes[iPoly] < MY_MAX_INT)
+                        anPolySizes[iPoly] += 1;
+                }
+                if (iLine == 0)
+                {
+                    oStrip.anFirstLineVal.assign(panVal, panVal + m_nXSize);
+                    oStrip.anFirstLineId.assign(panId, panId + m_nXSize);
+                }
+                if (iLine == oStrip.nYSize - 1)
+                {
+                    oStrip.anLastLineVal.assign(panVal, panVal + m_nXSize);
+                    oStrip.anLastLineId.assign(panId, panId + m_nXSize);
+                }
+            }))
+    {
+        return false;
+    }
+
+    if (oEnum.nNextPolygonId == 0)
+        return true;
+
+    oEnum.CompleteMerges();
+
+    for (int iPoly = 0; iPoly < oEnum.nNextPolygonId; iPoly++)
+    {
+        const int iFinal = oEnum.panPolyIdMap[iPoly];
+        if (iFinal != iPoly)
+        {
+            const GIntBig nSize = std::min<GIntBig>(
+                static_cast<GIntBig>(anPolySizes[iFinal]) + anPolySizes[iPoly],
+                MY_MAX_INT);
+            anPolySizes[iFinal] = static_cast<int>(nSize);
+            anPolySizes[iPoly] = 0;
+        }
+    }
+
+    for (auto *panIds : {&oStrip.anFirstLineId, &oStrip.anLastLineId})
+    {
+        for (auto &nId : *panIds)
+        {
+            if (nId >= 0)
+                nId = oEnum.panPolyIdMap[nId];
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                    GDALSieveFilterMT::FindRoot()                     */
+/************************************************************************/
+
+int GDALSieveFilterMT::FindRoot(int nId)
+{
+    while (m_anRoot[nId] != nId)
+    {
+        m_anRoot[nId] = m_anRoot[m_anRoot[nId]];
+        nId = m_anRoot[nId];
+    }
+    return nId;
+}
+
+/************************************************************************/
+/*                   GDALSieveFilterMT::MergeStrips()                   */
+/*                                                                      */
+/*      Merge polygons across strip boundaries, using the same          */
+/*      connectivity rules as GDALRasterPolygonEnumerator.              */
+/************************************************************************/
+
+void GDALSieveFilterMT::MergeStrips()
+{
+    const auto Union = [this](int nId1, int nId2)
+    {
+        nId1 = FindRoot(nId1);
+        nId2 = FindRoot(nId2);
+        if (nId1 < nId2)
+            m_anRoot[nId2] = nId1;
+        else if (nId2 < nId1)
+            m_anRoot[nId1] = nId2;
+    };
+
+    for (size_t iStrip = 1; iStrip < m_aoStrips.size(); ++iStrip)
+    {
+        const auto &oAbove = m_aoStrips[iStrip - 1];
+        const auto &oBelow = m_aoStrips[iStrip];
+        for (int iX = 0; iX < m_nXSize; ++iX)
+        {
+            const int nId = oBelow.anFirstLineId[iX];
+            if (nId < 0)
+                continue;
+            const std::int64_t nVal = oBelow.anFirstLineVal[iX];
+            for (int iOtherX = iX - 1; iOtherX <= iX + 1; ++iOtherX)
+            {
+                if (iOtherX < 0 || iOtherX >= m_nXSize ||
+                    (iOtherX != iX && m_nConnectedness != 8))
+                    continue;
+                const int nOtherId = oAbove.anLastLineId[iOtherX];
+                if (nOtherId >= 0 && oAbove.anLastLineVal[iOtherX] == nVal)
+                    Union(oAbove.nBaseId + nOtherId, oBelow.nBaseId + nId);
+            }
+        }
+    }
+
+    for (size_t nId = 0; nId < m_anRoot.size(); ++nId)
+        FindRoot(static_cast<int>(nId));
+
+    for (const auto &oStrip : m_aoStrips)
+    {
+        for (int iPoly = 0; iPoly < static_cast<int>(oStrip.anPolySizes.size());
+             ++iPoly)
+        {
+            if (oStrip.poEnum->panPolyIdMap[iPoly] != iPoly)
+                continue;
+            const int nRoot = m_anRoot[oStrip.nBaseId + iPoly];
+            m_anPolySizes[nRoot] = static_cast<int>(std::min<GIntBig>(
+                static_cast<GIntBig>(m_anPolySizes[nRoot]) +
+                    oStrip.anPolySizes[iPoly],
+                MY_MAX_INT));
+        }
+    }
+}
+
+/************************************************************************/
+/*                GDALSieveFilterMT::CollectNeighbours()                */
+/*                                                                      */
+/*      Second pass: identify the largest neighbour of polygons in a    */
+/*      strip, considering neighbouring pixels in the same order as     */
+/*      the serial algorithm.                                           */
+/************************************************************************/
+
+bool GDALSieveFilterMT::CollectNeighbours(int iStrip)
+{
+    auto &oStrip = m_aoStrips[iStrip];
+    std::vector<std::int64_t> anVal;
+    if (!ReadStrip(oStrip, anVal, nullptr))
+        return false;
+
+    const GInt32 *panPolyIdMap = oStrip.poEnum->panPolyIdMap;
+    auto &oMap = oStrip.oMapBigNeighbour;
+    const auto UpdateBigNeighbour = [this, &oMap](int nPolyId1, int nPolyId2)
+    {
+        auto oIter = oMap.find(nPolyId1);
+        if (oIter == oMap.end())
+            oMap[nPolyId1] = nPolyId2;
+        else if (m_anPolySizes[oIter->second] < m_anPolySizes[nPolyId2])
+            oIter->second = nPolyId2;
+    };
+    const auto CompareNeighbourMT =
+        [&UpdateBigNeighbour](int nPolyId1, int nPolyId2)
+    {
+        if (nPolyId1 < 0 || nPolyId2 < 0 || nPolyId1 == nPolyId2)
+            return;
+        UpdateBigNeighbour(nPolyId1, nPolyId2);
+        UpdateBigNeighbour(nPolyId2, nPolyId1);
+    };
+
+    // Root polygon ids of the last line of the previous strip.
+    std::vector<int> anLastLineRoot(m_nXSize, -1);
+    if (iStrip > 0)
+    {
+        const auto &oAbove = m_aoStrips[iStrip - 1];
+        for (int iX = 0; iX < m_nXSize; ++iX)
+        {
+            const int nId = oAbove.anLastLineId[iX];
+            if (nId >= 0)
+                anLastLineRoot[iX] = m_anRoot[oAbove.nBaseId + nId];
+        }
+    }
+    std::vector<int> anThisLineRoot(m_nXSize);
+
+    GDALRasterPolygonEnumerator oEnum(m_nConnectedness);
+    return EnumerateStrip(
+        oStrip, oEnum, anVal,
+        [this, iStrip, &oStrip, panPolyIdMap, &anLastLineRoot, &anThisLineRoot,
+         &CompareNeighbourMT](int iLine, const std::int64_t *,
+                              const GInt32 *panId, const GInt32 *)
+        {
+            for (int iX = 0; iX < m_nXSize; iX++)
+            {
+                anThisLineRoot[iX] =
+                    panId[iX] < 0
+                        ? -1
+                        : m_anRoot[oStrip.nBaseId + panPolyIdMap[panId[iX]]];
+            }
+
+            const bool bHasLastLine = iLine > 0 || iStrip > 0;
+            for (int iX = 0; iX < m_nXSize; iX++)
+            {
+                if (bHasLastLine)
+                {
+                    CompareNeighbourMT(anThisLineRoot[iX], anLastLineRoot[iX]);
+
+                    if (iX > 0 && m_nConnectedness == 8)
+                        CompareNeighbourMT(anThisLineRoot[iX],
+                                           anLastLineRoot[iX - 1]);
+
+                    if (iX < m_nXSize - 1 && m_nConnectedness == 8)
+                        CompareNeighbourMT(anThisLineRoot[iX],
+                                           anLastLineRoot[iX + 1]);
+                }
+
+                if (iX > 0)
+                    CompareNeighbourMT(anThisLineRoot[iX],
+                                       anThisLineRoot[iX - 1]);
+            }
+            std::swap(anLastLineRoot, anThisLineRoot);
+        });
+}
+
+/************************************************************************/
+/*                  GDALSieveFilterMT::ResolveMerges()                  */
+/*                                                                      */
+/*      Combine the largest neighbours found in each strip, and follow  */
+/*      them until a polygon large enough is found, as in the serial    */
+/*      algorithm.                                                      */
+/************************************************************************/
+
+void GDALSieveFilterMT::ResolveMerges()
+{
+    for (auto &oStrip : m_aoStrips)
+    {
+        for (const auto &[nPolyId, nNeighbourId] : oStrip.oMapBigNeighbour)
+        {
+            if (m_anBigNeighbour[nPolyId] == -1 ||
+                m_anPolySizes[m_anBigNeighbour[nPolyId]] <
+                    m_anPolySizes[nNeighbourId])
+                m_anBigNeighbour[nPolyId] = nNeighbourId;
+        }
+        oStrip.oMapBigNeighbour.clear();
+    }
+
+    int nFailedMerges = 0;
+    int nIsolatedSmall = 0;
+    int nSieveTargets = 0;
+
+    for (int iPoly = 0; iPoly < static_cast<int>(m_anRoot.size()); iPoly++)
+    {
+        if (m_anRoot[iPoly] != iPoly)
+            continue;
+
+        // Ignore nodata polygons.
+        if (m_anPolyValue[iPoly] == GP_NODATA_MARKER)
+            continue;
+
+        // Don't try to merge polygons larger than the threshold.
+        if (m_anPolySizes[iPoly] >= m_nSizeThreshold)
+        {
+            m_anBigNeighbour[iPoly] = -1;
+            continue;
+        }
+
+        nSieveTargets++;
+
+        // if we have no neighbours but we are small, what shall we do?
+        if (m_anBigNeighbour[iPoly] == -1)
+        {
+            nIsolatedSmall++;
+            continue;
+        }
+
+        std::set<int> oSetVisitedPoly;
+        oSetVisitedPoly.insert(iPoly);
+
+        // Walk through our neighbours until we find a polygon large enough.
+        int iFinalId = iPoly;
+        bool bFoundBigEnoughPoly = false;
+        while (true)
+        {
+            iFinalId = m_anBigNeighbour[iFinalId];
+            if (iFinalId < 0)
+            {
+                break;
+            }
+            // If the biggest neighbour is larger than the threshold
+            // then we are golden.
+            if (m_anPolySizes[iFinalId] >= m_nSizeThreshold)
+            {
+                bFoundBigEnoughPoly = true;
+                break;
+            }
+            // Check that we don't cycle on an already visited polygon.
+            if (oSetVisitedPoly.find(iFinalId) != oSetVisitedPoly.end())
+                break;
+            oSetVisitedPoly.insert(iFinalId);
+        }
+
+        if (!bFoundBigEnoughPoly)
+        {
+            nFailedMerges++;
+            m_anBigNeighbour[iPoly] = -1;
+            continue;
+        }
+
+        // Map the whole intermediate chain to it.
+        int iPolyCur = iPoly;
+        while (m_anBigNeighbour[iPolyCur] != iFinalId)
+        {
+            int iNextPoly = m_anBigNeighbour[iPolyCur];
+            m_anBigNeighbour[iPolyCur] = iFinalId;
+            iPolyCur = iNextPoly;
+        }
+    }
+
+    CPLDebug("GDALSieveFilter",
+             "Small Polygons: %d, Isolated: %d, Unmergable: %d", nSieveTargets,
+             nIsolatedSmall, nFailedMerges);
+}
+
+/************************************************************************/
+/*                  GDALSieveFilterMT::ComputeOutput()                  */
+/*                                                                      */
+/*      Third pass: compute the output values of a strip.               */
+/************************************************************************/
+
+bool GDALSieveFilterMT::ComputeOutput(GDALSieveStrip &oStrip)
+{
+    std::vector<std::int64_t> anVal;
+    if (!ReadStrip(oStrip, anVal, &oStrip.anWriteVal))
+        return false;
+
+    const GInt32 *panPolyIdMap = oStrip.poEnum->panPolyIdMap;
+    GDALRasterPolygonEnumerator oEnum(m_nConnectedness);
+    return EnumerateStrip(
+        oStrip, oEnum, anVal,
+        [this, &oStrip, panPolyIdMap](int iLine, const std::int64_t *,
+                                      const GInt32 *panId, const GInt32 *)
+        {
+            std::int64_t *panWriteVal =
+                oStrip.anWriteVal.data() +
+                static_cast<size_t>(iLine) * m_nXSize;
+            for (int iX = 0; iX < m_nXSize; iX++)
+            {
+                if (panId[iX] >= 0)
+                {
+                    const int iThisPoly =
+                        m_anRoot[oStrip.nBaseId + panPolyIdMap[panId[iX]]];
+                    if (m_anBigNeighbour[iThisPoly] != -1)
+                    {
+                        panWriteVal[iX] =
+                            m_anPolyValue[m_anBigNeighbour[iThisPoly]];
+                    }
+                }
+            }
+        });
+}
+
+/************************************************************************/
+/*                       GDALSieveFilterMT::Run()                       */
+/************************************************************************/
+
+CPLErr GDALSieveFilterMT::Run(CPLWorkerThreadPool *poThreadPool, int nThreads,
+                              GDALRasterBandH hSrcBandForCopy,
+                              GDALRasterBandH hDstBand,
+                              GDALProgressFunc pfnProgress, void *pProgressArg)
+{
+    const int nStrips = static_cast<int>(m_aoStrips.size());
+    CPLErrorAccumulator oErrorAccumulator;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+
+    const auto SubmitJob = [this, &poJobQueue, &oErrorAccumulator](
+                               std::function<bool()> oTask,
+                               std::atomic<bool> *pbDone)
+    {
+        const auto Job = [this, &oErrorAccumulator, oTask, pbDone]()
+        {
+            auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+            try
+            {
+                if (!m_bError && !m_bStop && !oTask())
+                    m_bError = true;
+            }
+            catch (const std::bad_alloc &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory in GDALSieveFilter()");
+                m_bError = true;
+            }
+            *pbDone = true;
+        };
+        if (!poJobQueue->SubmitJob(Job))
+        {
+            m_bError = true;
+            *pbDone = true;
+        }
+    };
+
+    const auto RunPass =
+        [this, nStrips, &poJobQueue, &SubmitJob, pfnProgress, pProgressArg](
+            const std::function<bool(int)> &oTask, double dfProgressStart,
+            double dfProgressEnd)
+    {
+        std::vector<std::atomic<bool>> abDone(nStrips);
+        for (int iStrip = 0; iStrip < nStrips; ++iStrip)
+        {
+            SubmitJob([&oTask, iStrip]() { return oTask(iStrip); },
+                      &abDone[iStrip]);
+        }
+        while (poJobQueue->WaitEvent())
+        {
+            int nDone = 0;
+            for (int iStrip = 0; iStrip < nStrips; ++iStrip)
+                nDone += abDone[iStrip] ? 1 : 0;
+            const double dfRatio = static_cast<double>(nDone) / nStrips;
+            if (!m_bStop &&
+                !pfnProgress(dfProgressStart +
+                                 (dfProgressEnd - dfProgressStart) * dfRatio,
+                             "", pProgressArg))
+                m_bStop = true;
+        }
+    };
+
+    const auto Finish = [this, &poJobQueue, &oErrorAccumulator]()
+    {
+        poJobQueue->WaitCompletion();
+        oErrorAccumulator.ReplayErrors();
+        if (m_bStop)
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return CE_Failure;
+        }
+        return m_bError ? CE_Failure : CE_None;
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      First pass: enumerate polygons of each strip.                   */
+    /* -------------------------------------------------------------------- */
+    RunPass([this](int iStrip) { return CollectPolygons(m_aoStrips[iStrip]); },
+            0.0, 0.25);
+    if (Finish() != CE_None)
+        return CE_Failure;
+
+    GIntBig nTotalPolygons = 0;
+    for (auto &oStrip : m_aoStrips)
+    {
+        oStrip.nBaseId = static_cast<int>(nTotalPolygons);
+        nTotalPolygons += oStrip.poEnum->nNextPolygonId;
+        if (nTotalPolygons > MY_MAX_INT)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "GDALSieveFilter(): too many polygons");
+            return CE_Failure;
+        }
+    }
+
+    if (nTotalPolygons == 0)
+    {
+        // Can happen if all pixels are masked
+        if (hSrcBandForCopy == hDstBand)
+        {
+            pfnProgress(1.0, "", pProgressArg);
+            return CE_None;
+        }
+        return GDALRasterBandCopyWholeRaster(hSrcBandForCopy, hDstBand, nullptr,
+                                             pfnProgress, pProgressArg);
+    }
+
+    try
+    {
+        m_anRoot.resize(static_cast<size_t>(nTotalPolygons));
+        m_anPolyValue.resize(static_cast<size_t>(nTotalPolygons));
+        m_anPolySizes.resize(static_cast<size_t>(nTotalPolygons));
+        m_anBigNeighbour.resize(static_cast<size_t>(nTotalPolygons), -1);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s: Out of memory",
+                 __FUNCTION__);
+        return CE_Failure;
+    }
+    for (const auto &oStrip : m_aoStrips)
+    {
+        const auto &oEnum = *(oStrip.poEnum);
+        for (int iPoly = 0; iPoly < oEnum.nNextPolygonId; ++iPoly)
+        {
+            m_anRoot[oStrip.nBaseId + iPoly] =
+                oStrip.nBaseId + oEnum.panPolyIdMap[iPoly];
+            m_anPolyValue[oStrip.nBaseId + iPoly] = oEnum.panPolyValue[iPoly];
+        }
+    }
+    MergeStrips();
+
+    /* -------------------------------------------------------------------- */
+    /*      Second pass: identify the largest neighbour of each polygon.    */
+    /* -------------------------------------------------------------------- */
+    RunPass([this](int iStrip) { return CollectNeighbours(iStrip); }, 0.25,
+            0.5);
+    if (Finish() != CE_None)
+        return CE_Failure;
+
+    ResolveMerges();
+
+    /* -------------------------------------------------------------------- */
+    /*      Third pass: compute output values. Strips are written in        */
+    /*      order, with a bounded number of strips in flight.               */
+    /* -------------------------------------------------------------------- */
+    const int nMaxInFlight = 2 * nThreads;
+    std::vector<std::atomic<bool>> abDone(nStrips);
+    int nSubmitted = 0;
+    const auto SubmitNext = [this, &nSubmitted, &abDone, &SubmitJob]()
+    {
+        const int iStrip = nSubmitted++;
+        SubmitJob([this, iStrip]()
+                  { return ComputeOutput(m_aoStrips[iStrip]); },
+                  &abDone[iStrip]);
+    };
+    while (nSubmitted < std::min(nStrips, nMaxInFlight))
+        SubmitNext();
+
+    CPLErr eErr = CE_None;
+    for (int iStrip = 0; iStrip < nStrips && eErr == CE_None; ++iStrip)
+    {
+        while (!abDone[iStrip])
+            poJobQueue->WaitEvent();
+        if (m_bError)
+        {
+            eErr = CE_Failure;
+            break;
+        }
+
+        auto &oStrip = m_aoStrips[iStrip];
+        {
+            std::unique_ptr<std::lock_guard<std::mutex>> poLock;
+            if (m_poMutex)
+                poLock =
+                    std::make_unique<std::lock_guard<std::mutex>>(*m_poMutex);
+            eErr = GDALRasterIO(hDstBand, GF_Write, 0, oStrip.nYOff, m_nXSize,
+                                oStrip.nYSize, oStrip.anWriteVal.data(),
+                                m_nXSize, oStrip.nYSize, GDT_Int64, 0, 0);
+        }
+        oStrip.anWriteVal.clear();
+        oStrip.anWriteVal.shrink_to_fit();
+        oStrip.poEnum.reset();
+
+        if (nSubmitted < nStrips)
+            SubmitNext();
+
+        if (eErr == CE_None &&
+            !pfnProgress(0.5 + 0.5 * (iStrip + 1) / nStrips, "", pProgressArg))
+        {
+            m_bStop = true;
+            eErr = CE_Failure;
+        }
+    }
+    if (eErr != CE_None)
+        m_bError = true;
+
+    if (Finish() != CE_None)
+        return CE_Failure;
+    return eErr;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                    GDALSieveFilterMultiThreaded()                    */
+/************************************************************************/
+
+static CPLErr GDALSieveFilterMultiThreaded(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hMaskBand,
+    GDALRasterBandH hDstBand, int nSizeThreshold, int nConnectedness,
+    int nThreads, int nStripHeight, GDALProgressFunc pfnProgress,
+    void *pProgressArg)
+{
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return CE_Failure;
+
+    /* -------------------------------------------------------------------- */
+    /*      Use thread-safe instances of the bands if possible. Otherwise   */
+    /*      accesses to the bands are serialized.                           */
+    /* -------------------------------------------------------------------- */
+    GDALThreadSafeSourceBands oSourceBands(hSrcBand, hMaskBand,
+                                           "GDALSieveFilter");
+
+    try
+    {
+        GDALSieveFilterMT oSieve(
+            oSourceBands.GetSrcBand(), oSourceBands.GetMaskBand(),
+            oSourceBands.GetMutex(), nSizeThreshold, nConnectedness,
+            nStripHeight);
+        return oSieve.Run(poThreadPool, nThreads, hSrcBand, hDstBand,
+                          pfnProgress, pProgressArg);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALSieveFilter()");
+        return CE_Failure;
+    }
+}
+
 /************************************************************************/
 /*                          GDALSieveFilter()                           */
 /************************************************************************/
@@ -166,8 +975,13 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
  * @param nConnectedness either 4 indicating that diagonal pixels are not
  * considered directly adjacent for polygon membership purposes or 8
  * indicating they are.
- * @param papszOptions algorithm options in name=value list form.  None
- * currently supported.
+ * @param papszOptions algorithm options in name=value list form.
+ * <ul>
+ * <li>NUM_THREADS=num|ALL_CPUS: (GDAL >= 3.12) Number of threads to use.
+ * Defaults to the value of the GDAL_NUM_THREADS configuration option, or 1.
+ * When more than one thread is used, the raster is processed by horizontal
+ * strips, and the result is identical to the single-threaded one.</li>
+ * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
  * @param pProgressArg callback argument passed to pfnProgress.
@@ -178,8 +992,7 @@ static inline void CompareNeighbour(int nPolyId1, int nPolyId2,
 CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
                                    GDALRasterBandH hMaskBand,
                                    GDALRasterBandH hDstBand, int nSizeThreshold,
-                                   int nConnectedness,
-                                   CPL_UNUSED char **papszOptions,
+                                   int nConnectedness, char **papszOptions,
                                    GDALProgressFunc pfnProgress,
                                    void *pProgressArg)
 {
@@ -189,11 +1002,29 @@ CPLErr CPL_STDCALL GDALSieveFilter(GDALRasterBandH hSrcBand,
     if (pfnProgress == nullptr)
         pfnProgress = GDALDummyProgress;
 
+    int nXSize = GDALGetRasterBandXSize(hSrcBand);
+    int nYSize = GDALGetRasterBandYSize(hSrcBand);
+
+    /* -------------------------------------------------------------------- */
+    /*      Use the multi-threaded implementation if requested and if the   */
+    /*      raster is large enough.                                         */
+    /* -------------------------------------------------------------------- */
+    const int nThreads = GDALGetNumThreads(papszOptions, "NUM_THREADS");
+    if (nThreads > 1)
+    {
+        const int nStripHeight = GDALGetProcessingStripHeight(
+            nXSize, nYSize, nThreads, "GDAL_SIEVE_MIN_STRIP_HEIGHT");
+        if (nYSize > nStripHeight)
+        {
+            return GDALSieveFilterMultiThreaded(
+                hSrcBand, hMaskBand, hDstBand, nSizeThreshold, nConnectedness,
+                nThreads, nStripHeight, pfnProgress, pProgressArg);
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      Allocate working buffers.                                       */
     /* -------------------------------------------------------------------- */
-    int nXSize = GDALGetRasterBandXSize(hSrcBand);
-    int nYSize = GDALGetRasterBandYSize(hSrcBand);
     auto panLastLineValKeeper = std::unique_ptr<std::int64_t, VSIFreeReleaser>(
         static_cast<std::int64_t *>(
             VSI_MALLOC2_VERBOSE(sizeof(std::int64_t), nXSize)));
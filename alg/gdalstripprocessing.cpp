@@ -0,0 +1,91 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Helpers for algorithms processing horizontal strips of a raster
+ *           in parallel.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "gdalstripprocessing.h"
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "gdal_cpp_functions.h"
+
+/************************************************************************/
+/*                     GDALThreadSafeSourceBands()                      */
+/************************************************************************/
+
+// hMaskBand may be nullptr, hSrcBand itself, the mask band of hSrcBand, or
+// another band of its dataset. pszDebugKey is used for the debug message
+// emitted when accesses must be serialized.
+GDALThreadSafeSourceBands::GDALThreadSafeSourceBands(GDALRasterBandH hSrcBand,
+                                                     GDALRasterBandH hMaskBand,
+                                                     const char *pszDebugKey)
+    : m_hSrcBand(hSrcBand), m_hMaskBand(hMaskBand)
+{
+    auto poSrcBand = GDALRasterBand::FromHandle(hSrcBand);
+    auto poMaskBand = GDALRasterBand::FromHandle(hMaskBand);
+    auto poSrcDS = poSrcBand->GetDataset();
+    // Overview bands may belong to a dataset that would be reopened as the
+    // full resolution one.
+    if (poSrcDS && poSrcBand->GetBand() > 0 &&
+        poSrcDS->GetAccess() == GA_ReadOnly &&
+        poSrcDS->GetRasterXSize() == poSrcBand->GetXSize() &&
+        poSrcDS->GetRasterYSize() == poSrcBand->GetYSize())
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        m_poTSDS.reset(GDALGetThreadSafeDataset(poSrcDS, GDAL_OF_RASTER));
+    }
+    if (m_poTSDS && m_poTSDS->GetRasterCount() == poSrcDS->GetRasterCount())
+    {
+        auto poTSBand = m_poTSDS->GetRasterBand(poSrcBand->GetBand());
+        GDALRasterBand *poTSMaskBand = nullptr;
+        if (poMaskBand == poSrcBand)
+            poTSMaskBand = poTSBand;
+        else if (poMaskBand == poSrcBand->GetMaskBand())
+            poTSMaskBand = poTSBand->GetMaskBand();
+        else if (poMaskBand && poMaskBand->GetDataset() == poSrcDS &&
+                 poMaskBand->GetBand() > 0)
+            poTSMaskBand = m_poTSDS->GetRasterBand(poMaskBand->GetBand());
+        if (!poMaskBand || poTSMaskBand)
+        {
+            m_hSrcBand = GDALRasterBand::ToHandle(poTSBand);
+            m_hMaskBand = GDALRasterBand::ToHandle(poTSMaskBand);
+            return;
+        }
+    }
+    m_poTSDS.reset();
+    CPLDebug(pszDebugKey, "Source band cannot be accessed from several "
+                          "threads. Serializing accesses");
+}
+
+/************************************************************************/
+/*                    GDALGetProcessingStripHeight()                    */
+/************************************************************************/
+
+// Return the height of the horizontal strips of a raster of nXSize x nYSize
+// pixels processed in parallel by nThreads threads. Strips are at least
+// pszMinStripHeightConfigOption lines high (256 by default, smaller values
+// being only for testing purposes), and are limited to about 4 million
+// pixels, to bound the memory used by strips being processed. Parallel
+// processing is only worth it if nYSize is larger than the returned value.
+int GDALGetProcessingStripHeight(int nXSize, int nYSize, int nThreads,
+                                 const char *pszMinStripHeightConfigOption)
+{
+    const int nMinStripHeight = std::max(
+        1, atoi(CPLGetConfigOption(pszMinStripHeightConfigOption, "256")));
+    const int nMaxStripHeight =
+        std::max(nMinStripHeight, (1 << 22) / std::max(1, nXSize));
+    return std::min(nMaxStripHeight,
+                    std::max(nMinStripHeight,
+                             DIV_ROUND_UP(nYSize, 2 * std::max(1, nThreads))));
+}
@@ -0,0 +1,72 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Helpers for algorithms processing horizontal strips of a raster
+ *           in parallel.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef GDALSTRIPPROCESSING_H_INCLUDED
+#define GDALSTRIPPROCESSING_H_INCLUDED
+
+/*! @cond Doxygen_Suppress */
+
+#include "gdal.h"
+#include "gdal_priv.h"
+
+#include <memory>
+#include <mutex>
+
+/************************************************************************/
+/*                     GDALThreadSafeSourceBands                        */
+/************************************************************************/
+
+// Source band, and optional mask band, to be read from several worker
+// threads.
+//
+// Thread-safe instances of the bands (see GDALGetThreadSafeDataset()) are
+// used when possible. Otherwise the original bands are used, and their
+// accesses must be serialized with the mutex returned by GetMutex().
+class GDALThreadSafeSourceBands
+{
+  public:
+    GDALThreadSafeSourceBands(GDALRasterBandH hSrcBand,
+                              GDALRasterBandH hMaskBand,
+                              const char *pszDebugKey);
+
+    GDALRasterBandH GetSrcBand() const
+    {
+        return m_hSrcBand;
+    }
+
+    GDALRasterBandH GetMaskBand() const
+    {
+        return m_hMaskBand;
+    }
+
+    // Mutex to hold while accessing the bands, or nullptr if they can be
+    // read concurrently.
+    std::mutex *GetMutex()
+    {
+        return m_poTSDS ? nullptr : &m_oMutex;
+    }
+
+  private:
+    std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser> m_poTSDS{};
+    GDALRasterBandH m_hSrcBand = nullptr;
+    GDALRasterBandH m_hMaskBand = nullptr;
+    std::mutex m_oMutex{};
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALThreadSafeSourceBands)
+};
+
+int GDALGetProcessingStripHeight(int nXSize, int nYSize, int nThreads,
+                                 const char *pszMinStripHeightConfigOption);
+
+/*! @endcond */
+
+#endif /* GDALSTRIPPROCESSING_H_INCLUDED */
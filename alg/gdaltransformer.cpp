@@ -47,6 +47,7 @@ void *GDALDeserializeTPSTransformer(CPLXMLNode *psTree);
 void *GDALDeserializeGeoLocTransformer(CPLXMLNode *psTree);
 void *GDALDeserializeRPCTransformer(CPLXMLNode *psTree);
 void *GDALDeserializeHomographyTransformer(CPLXMLNode *psTree);
+void *GDALDeserializeWarpPlanTransformer(CPLXMLNode *psTree);
 CPL_C_END
 
 static CPLXMLNode *GDALSerializeReprojectionTransformer(void *pTransformArg);
@@ -2171,6 +2172,11 @@ const char *GDALGetGenImgProjTranformerOptionList(void)
  * the backmap. The default is NO, that is to use in-memory arrays, unless the
  * number of pixels of the geolocation array is greater than 16 megapixels.
  * </li>
+ * <li> NUM_THREADS=number_of_threads/ALL_CPUS. Number of threads to use.
+ * (GDAL &gt;= 3.12) For geolocation array transformers, this is used to
+ * build the backmap in parallel. Defaults to the GDAL_NUM_THREADS
+ * configuration option, or 1.
+ * </li>
  * <li>
  * GEOLOC_ARRAY/SRC_GEOLOC_ARRAY=filename. (GDAL &gt;= 3.5.2) Name of a GDAL
  * dataset containing a geolocation array and associated metadata. This is an
@@ -4755,6 +4761,11 @@ CPLErr GDALDeserializeTransformer(CPLXMLNode *psTree,
         *ppfnFunc = GDALHomographyTransform;
         *ppTransformArg = GDALDeserializeHomographyTransformer(psTree);
     }
+    else if (EQUAL(psTree->pszValue, "WarpPlanTransformer"))
+    {
+        *ppfnFunc = GDALWarpPlanTransform;
+        *ppTransformArg = GDALDeserializeWarpPlanTransformer(psTree);
+    }
     else
     {
         GDALTransformDeserializeFunc pfnDeserializeFunc = nullptr;
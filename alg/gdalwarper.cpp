@@ -1255,6 +1255,12 @@ const char *GDALWarpGetOptionList(void)
            "NODATA_VALUES_PCT_THRESHOLD is taken into account before "
            "EXCLUDED_VALUES_PCT_THRESHOLD. Only taken into account by Average "
            "currently.' default='100'/>"
+           "<Option name='SEPARABLE_RESAMPLING' type='boolean' "
+           "description='"
+           "Whether bilinear, cubic, cubicspline and lanczos resampling can "
+           "be done as a horizontal pass followed by a vertical pass, when "
+           "the transformation between the source and target rasters is a "
+           "scaling and translation.' default='YES'/>"
            "<Option name='MODE_TIES' type='string-select' "
            "description='"
            "Strategy to use when breaking ties with MODE resampling. "
@@ -1503,6 +1509,14 @@ const char *GDALWarpGetOptionList(void)
  * ties with MODE resampling. By default, the first value encountered will be used.
  * Alternatively, the minimum or maximum value can be selected.</li>
  *
+ * <li>SEPARABLE_RESAMPLING=YES/NO: (GDAL >= 3.12) Whether bilinear, cubic,
+ * cubicspline and lanczos resampling can be done as a horizontal pass followed
+ * by a vertical pass, when the source column of a target pixel only depends
+ * on its target column, and its source line only depends on its target line
+ * (typically when the source and target rasters are north-up rasters in the
+ * same CRS). This is much faster, especially when downsampling, and gives
+ * the same results, up to floating-point rounding. Defaults to YES.</li>
+ *
  * </ul>
  */
 
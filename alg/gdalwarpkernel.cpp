@@ -169,6 +169,8 @@ FilterFunc4ValuesType GWKGetFilterFunc4Values(GDALResampleAlg eResampleAlg)
 
 static CPLErr GWKGeneralCase(GDALWarpKernel *);
 static CPLErr GWKRealCase(GDALWarpKernel *poWK);
+static bool GWKCanUseSeparableResampling(GDALWarpKernel *poWK);
+static CPLErr GWKSeparableResample(GDALWarpKernel *poWK);
 static CPLErr GWKNearestNoMasksOrDstDensityOnlyByte(GDALWarpKernel *poWK);
 static CPLErr GWKBilinearNoMasksOrDstDensityOnlyByte(GDALWarpKernel *poWK);
 static CPLErr GWKCubicNoMasksOrDstDensityOnlyByte(GDALWarpKernel *poWK);
@@ -1202,6 +1204,9 @@ CPLErr GDALWarpKernel::PerformWarp()
     if (CPLFetchBool(papszWarpOptions, "USE_GENERAL_CASE", false))
         return GWKGeneralCase(this);
 
+    if (GWKCanUseSeparableResampling(this))
+        return GWKSeparableResample(this);
+
     const bool bNoMasksOrDstDensityOnly =
         papanBandSrcValid == nullptr && panUnifiedSrcValid == nullptr &&
         pafUnifiedSrcDensity == nullptr && panDstValid == nullptr;
@@ -5822,6 +5827,623 @@ static CPLErr GWKRealCase(GDALWarpKernel *poWK)
     return GWKRun(poWK, "GWKRealCase", GWKRealCaseThread);
 }
 
+/************************************************************************/
+/*                  GWKSeparableCheckSrcCoordinate()                    */
+/************************************************************************/
+
+// Single axis version of the checks done by GWKCheckAndComputeSrcOffsets().
+// Returns 0 if the coordinate is inside the source window, 1 if it is
+// slightly outside of it (and worth being retransformed alone), 2 otherwise.
+static int GWKSeparableCheckSrcCoordinate(double dfVal, int nOff, int nSize)
+{
+    if (std::isnan(dfVal))
+        return 2;
+    if (dfVal < nOff)
+        return dfVal > nOff - 1 ? 1 : 2;
+    if (dfVal + 1e-10 > nSize + nOff)
+        return dfVal < nSize + nOff + 1 ? 1 : 2;
+    return 0;
+}
+
+/************************************************************************/
+/*                   GWKCanUseSeparableResampling()                     */
+/************************************************************************/
+
+// Check if the destination to source transformation is "axis aligned", that
+// is the source column only depends on the destination column, and the
+// source line only depends on the destination line, as this is the case for
+// a scale+translate transformation between north-up rasters in the same CRS.
+// In that situation, the weights of the resampling kernel are the same for
+// all pixels of a destination column (resp. line), and the 2D convolution
+// can be computed as a horizontal pass followed by a vertical pass.
+static bool GWKCanUseSeparableResampling(GDALWarpKernel *poWK)
+{
+    if (!CPLFetchBool(poWK->papszWarpOptions, "SEPARABLE_RESAMPLING", true))
+        return false;
+
+    const bool bUse4SamplesFormula =
+        poWK->dfXScale >= 0.95 && poWK->dfYScale >= 0.95;
+    if (((poWK->eResample != GRA_Bilinear && poWK->eResample != GRA_Cubic) ||
+         bUse4SamplesFormula) &&
+        poWK->eResample != GRA_CubicSpline && poWK->eResample != GRA_Lanczos)
+    {
+        return false;
+    }
+
+    if (GDALDataTypeIsComplex(poWK->eWorkingDataType) ||
+        poWK->bApplyVerticalShift || poWK->nSrcXSize <= 1 ||
+        poWK->nSrcYSize <= 1 || poWK->nDstXSize <= 0 || poWK->nDstYSize <= 0)
+    {
+        return false;
+    }
+
+    if (CPLAtof(CSLFetchNameValueDef(poWK->papszWarpOptions,
+                                     "SRC_COORD_PRECISION", "0")) > 0.0)
+    {
+        return false;
+    }
+
+    // Same test as GWKOneSourceCornerFailsToReproject(), which we need to be
+    // false for the edge adjustment logic of GWKRealCase() to be unneeded.
+    for (int iY = 0; iY <= 1; ++iY)
+    {
+        for (int iX = 0; iX <= 1; ++iX)
+        {
+            double dfXTmp = poWK->nSrcXOff + iX * poWK->nSrcXSize;
+            double dfYTmp = poWK->nSrcYOff + iY * poWK->nSrcYSize;
+            double dfZTmp = 0;
+            int nSuccess = FALSE;
+            poWK->pfnTransformer(poWK->pTransformerArg, FALSE, 1, &dfXTmp,
+                                 &dfYTmp, &dfZTmp, &nSuccess);
+            if (!nSuccess)
+                return false;
+        }
+    }
+
+    // Transform a few full destination lines and columns, and check that
+    // they are consistent with each other.
+    constexpr double EPSILON = 1e-8;
+    constexpr int NUM_SAMPLES = 5;
+    const int nDstXSize = poWK->nDstXSize;
+    const int nDstYSize = poWK->nDstYSize;
+    const int nMaxSize = std::max(nDstXSize, nDstYSize);
+    std::vector<double> adfX(nMaxSize);
+    std::vector<double> adfY(nMaxSize);
+    std::vector<double> adfZ(nMaxSize);
+    std::vector<int> abSuccess(nMaxSize);
+    std::vector<double> adfRef(nMaxSize);
+
+    for (int iLine = 0; iLine < 2; ++iLine)
+    {
+        // iLine == 0: sample destination lines. iLine == 1: columns
+        const int nSize = iLine == 0 ? nDstXSize : nDstYSize;
+        const int nOtherSize = iLine == 0 ? nDstYSize : nDstXSize;
+        int iLastOther = -1;
+        for (int iSample = 0; iSample < NUM_SAMPLES; ++iSample)
+        {
+            const int iOther = static_cast<int>(
+                static_cast<int64_t>(iSample) * (nOtherSize - 1) /
+                (NUM_SAMPLES - 1));
+            if (iOther == iLastOther)
+                continue;
+
+            for (int i = 0; i < nSize; ++i)
+            {
+                if (iLine == 0)
+                {
+                    adfX[i] = i + 0.5 + poWK->nDstXOff;
+                    adfY[i] = iOther + 0.5 + poWK->nDstYOff;
+                }
+                else
+                {
+                    adfX[i] = iOther + 0.5 + poWK->nDstXOff;
+                    adfY[i] = i + 0.5 + poWK->nDstYOff;
+                }
+                adfZ[i] = 0;
+            }
+            poWK->pfnTransformer(poWK->pTransformerArg, TRUE, nSize,
+                                 adfX.data(), adfY.data(), adfZ.data(),
+                                 abSuccess.data());
+
+            // Coordinate that must vary along the line, and the one that
+            // must remain constant.
+            const double *padfVarying =
+                iLine == 0 ? adfX.data() : adfY.data();
+            const double *padfConstant =
+                iLine == 0 ? adfY.data() : adfX.data();
+            for (int i = 0; i < nSize; ++i)
+            {
+                if (!abSuccess[i] || std::isnan(padfVarying[i]) ||
+                    std::isnan(padfConstant[i]) ||
+                    !(std::fabs(padfConstant[i] - padfConstant[0]) <=
+                      EPSILON))
+                {
+                    return false;
+                }
+                if (iLastOther < 0)
+                    adfRef[i] = padfVarying[i];
+                else if (!(std::fabs(padfVarying[i] - adfRef[i]) <= EPSILON))
+                    return false;
+            }
+            iLastOther = iOther;
+        }
+    }
+
+    return true;
+}
+
+/************************************************************************/
+/*                     GWKSeparableResampleThread()                     */
+/************************************************************************/
+
+// Separable equivalent of the GWKResample() code path of GWKRealCaseThread(),
+// when GWKCanUseSeparableResampling() is true. The accumulations are done in
+// the same order as GWKResample(), but the source coordinates and kernel
+// weights are computed once per target column and target line instead of
+// once per target pixel, so results are the same up to floating-point
+// rounding.
+static void GWKSeparableResampleThread(void *pData)
+
+{
+    GWKJobStruct *psJob = static_cast<GWKJobStruct *>(pData);
+    GDALWarpKernel *poWK = psJob->poWK;
+    const int iYMin = psJob->iYMin;
+    const int iYMax = psJob->iYMax;
+
+    const int nDstXSize = poWK->nDstXSize;
+    const int nSrcXSize = poWK->nSrcXSize;
+    const int nSrcYSize = poWK->nSrcYSize;
+    const bool bIsLanczos = poWK->eResample == GRA_Lanczos;
+    const FilterFuncType pfnGetWeight = apfGWKFilter[poWK->eResample];
+    CPLAssert(pfnGetWeight);
+
+    const bool bHasSrcMask = poWK->pafUnifiedSrcDensity != nullptr ||
+                             poWK->panUnifiedSrcValid != nullptr ||
+                             poWK->papanBandSrcValid != nullptr;
+
+    /* -------------------------------------------------------------------- */
+    /*      Compute the source coordinates of one destination line, and of  */
+    /*      one destination column.                                         */
+    /* -------------------------------------------------------------------- */
+    const int nLines = iYMax - iYMin;
+    const int nMaxSize = std::max(nDstXSize, nLines);
+    std::vector<double> adfX(nMaxSize);
+    std::vector<double> adfY(nMaxSize);
+    std::vector<double> adfZ(nMaxSize);
+    std::vector<int> abSuccess(nMaxSize);
+
+    // Returns the source coordinate along one axis, or NaN if the
+    // destination pixel must be skipped.
+    const auto GetSrcCoordinate = [psJob, poWK, &adfX, &adfY, &abSuccess](
+                                      bool bXAxis, int i, int iDstX, int iDstY)
+    {
+        double dfVal = bXAxis ? adfX[i] : adfY[i];
+        const int nOff = bXAxis ? poWK->nSrcXOff : poWK->nSrcYOff;
+        const int nSize = bXAxis ? poWK->nSrcXSize : poWK->nSrcYSize;
+        if (!abSuccess[i])
+            return std::numeric_limits<double>::quiet_NaN();
+        int nStatus = GWKSeparableCheckSrcCoordinate(dfVal, nOff, nSize);
+        if (nStatus == 1)
+        {
+            // If the source coordinate is slightly outside of the source
+            // raster retry to transform it alone, so that the exact
+            // coordinate transformer is used.
+            double dfXTmp = iDstX + 0.5 + poWK->nDstXOff;
+            double dfYTmp = iDstY + 0.5 + poWK->nDstYOff;
+            double dfZTmp = 0;
+            int nSuccess = FALSE;
+            poWK->pfnTransformer(psJob->pTransformerArg, TRUE, 1, &dfXTmp,
+                                 &dfYTmp, &dfZTmp, &nSuccess);
+            dfVal = bXAxis ? dfXTmp : dfYTmp;
+            nStatus = nSuccess
+                          ? GWKSeparableCheckSrcCoordinate(dfVal, nOff, nSize)
+                          : 2;
+        }
+        return nStatus == 0 ? dfVal : std::numeric_limits<double>::quiet_NaN();
+    };
+
+    // Per valid destination column: center source pixel, first source pixel
+    // of the kernel, number of kernel taps and kernel weights.
+    const int nXTaps = poWK->nXRadius - poWK->nFiltInitX + 1;
+    const double dfXScale = std::min(poWK->dfXScale, 1.0);
+    std::vector<int> anCols;
+    std::vector<int> anColCenter;
+    std::vector<int> anColStart;
+    std::vector<int> anColTaps;
+    std::vector<double> adfColWeights;
+    std::vector<double> adfColWeightSum;
+
+    for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+    {
+        adfX[iDstX] = iDstX + 0.5 + poWK->nDstXOff;
+        adfY[iDstX] = iYMin + 0.5 + poWK->nDstYOff;
+        adfZ[iDstX] = 0;
+    }
+    poWK->pfnTransformer(psJob->pTransformerArg, TRUE, nDstXSize, adfX.data(),
+                         adfY.data(), adfZ.data(), abSuccess.data());
+    for (int iDstX = 0; iDstX < nDstXSize; iDstX++)
+    {
+        const double dfX = GetSrcCoordinate(true, iDstX, iDstX, iYMin);
+        if (std::isnan(dfX))
+            continue;
+
+        int iCenter = static_cast<int>(dfX + 1.0e-10) - poWK->nSrcXOff;
+        if (iCenter == nSrcXSize)
+            iCenter--;
+
+        const double dfSrcX = dfX - poWK->nSrcXOff;
+        const int iSrcX = static_cast<int>(floor(dfSrcX - 0.5));
+        const double dfDeltaX = dfSrcX - 0.5 - iSrcX;
+
+        // Skip sampling over edge of image.
+        int iMin = poWK->nFiltInitX;
+        int iMax = poWK->nXRadius;
+        if (iSrcX + iMin < 0)
+            iMin = -iSrcX;
+        if (iSrcX + iMax >= nSrcXSize)
+            iMax = nSrcXSize - iSrcX - 1;
+        if (bIsLanczos)
+        {
+            while ((iMin - dfDeltaX) * dfXScale < -3.0)
+                iMin++;
+            while ((iMax - dfDeltaX) * dfXScale > 3.0)
+                iMax--;
+        }
+
+        anCols.push_back(iDstX);
+        anColCenter.push_back(iCenter);
+        anColStart.push_back(iSrcX + iMin);
+        anColTaps.push_back(std::max(0, iMax - iMin + 1));
+        double dfWeightSum = 0;
+        for (int i = iMin; i < iMin + nXTaps; ++i)
+        {
+            const double dfWeight =
+                i <= iMax ? pfnGetWeight((i - dfDeltaX) * dfXScale) : 0.0;
+            adfColWeights.push_back(dfWeight);
+            dfWeightSum += dfWeight;
+        }
+        adfColWeightSum.push_back(dfWeightSum);
+    }
+
+    // Same per destination line.
+    const int nYTaps = poWK->nYRadius - poWK->nFiltInitY + 1;
+    const double dfYScale = std::min(poWK->dfYScale, 1.0);
+    std::vector<bool> abLineValid(nLines);
+    std::vector<int> anLineCenter(nLines);
+    std::vector<int> anLineStart(nLines);
+    std::vector<int> anLineTaps(nLines);
+    std::vector<double> adfLineWeights(static_cast<size_t>(nLines) * nYTaps);
+
+    // The source line does not depend on the destination column, so
+    // transform the one of the first valid column (if any).
+    const int iRefDstX = anCols.empty() ? 0 : anCols[0];
+    for (int iDstY = iYMin; iDstY < iYMax; iDstY++)
+    {
+        adfX[iDstY - iYMin] = iRefDstX + 0.5 + poWK->nDstXOff;
+        adfY[iDstY - iYMin] = iDstY + 0.5 + poWK->nDstYOff;
+        adfZ[iDstY - iYMin] = 0;
+    }
+    poWK->pfnTransformer(psJob->pTransformerArg, TRUE, nLines, adfX.data(),
+                         adfY.data(), adfZ.data(), abSuccess.data());
+    for (int iLine = 0; iLine < nLines; iLine++)
+    {
+        const double dfY =
+            GetSrcCoordinate(false, iLine, iRefDstX, iYMin + iLine);
+        if (std::isnan(dfY))
+            continue;
+
+        int iCenter = static_cast<int>(dfY + 1.0e-10) - poWK->nSrcYOff;
+        if (iCenter == nSrcYSize)
+            iCenter--;
+
+        const double dfSrcY = dfY - poWK->nSrcYOff;
+        const int iSrcY = static_cast<int>(floor(dfSrcY - 0.5));
+        const double dfDeltaY = dfSrcY - 0.5 - iSrcY;
+
+        int jMin = poWK->nFiltInitY;
+        int jMax = poWK->nYRadius;
+        if (iSrcY + jMin < 0)
+            jMin = -iSrcY;
+        if (iSrcY + jMax >= nSrcYSize)
+            jMax = nSrcYSize - iSrcY - 1;
+        if (bIsLanczos)
+        {
+            while ((jMin - dfDeltaY) * dfYScale < -3.0)
+                jMin++;
+            while ((jMax - dfDeltaY) * dfYScale > 3.0)
+                jMax--;
+        }
+
+        abLineValid[iLine] = true;
+        anLineCenter[iLine] = iCenter;
+        anLineStart[iLine] = iSrcY + jMin;
+        anLineTaps[iLine] = std::max(0, jMax - jMin + 1);
+        for (int j = jMin; j <= jMax; ++j)
+        {
+            adfLineWeights[static_cast<size_t>(iLine) * nYTaps + j - jMin] =
+                pfnGetWeight((j - dfDeltaY) * dfYScale);
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Allocate working buffers.                                       */
+    /* -------------------------------------------------------------------- */
+    const int nCols = static_cast<int>(anCols.size());
+
+    // Horizontally resampled source lines are cached in a ring buffer,
+    // with source line iSrcY stored in slot iSrcY % nSlots. As the kernel of
+    // a destination line spans at most nYTaps consecutive source lines, they
+    // never evict each other.
+    const int nSlots = nYTaps;
+    std::vector<int> anSlotSrcLine(nSlots);
+    std::vector<bool> abSlotEmpty(nSlots);
+    std::vector<double> adfSlotReal(static_cast<size_t>(nSlots) * nCols);
+    std::vector<double> adfSlotDensity(
+        bHasSrcMask ? static_cast<size_t>(nSlots) * nCols : 0);
+    std::vector<double> adfSlotWeight(
+        bHasSrcMask ? static_cast<size_t>(nSlots) * nCols : 0);
+
+    // GWKGetPixelRow() works on an even number of pixels, and the source
+    // arrays have WARP_EXTRA_ELTS extra elements at their end.
+    const int nHalfSrcLen = (nSrcXSize + 1) / 2;
+    std::vector<double> adfRowReal(2 * nHalfSrcLen);
+    std::vector<double> adfRowDensity(bHasSrcMask ? 2 * nHalfSrcLen : 0);
+
+    std::vector<double> adfAccReal(nCols);
+    std::vector<double> adfAccDensity(nCols);
+    std::vector<double> adfAccWeight(nCols);
+
+    // Bands are processed in turn for a block of destination lines, so
+    // that the line cache only holds a single band.
+    constexpr int BLOCK_LINES = 128;
+    std::vector<GByte> abyFoundDensity(static_cast<size_t>(BLOCK_LINES) *
+                                       nCols);
+
+    // Resample horizontally a source line into the cache.
+    const auto ComputeSlot =
+        [poWK, nSrcXSize, nHalfSrcLen, nCols, nXTaps, bHasSrcMask, &anColStart,
+         &anColTaps, &adfColWeights, &adfRowReal, &adfRowDensity,
+         &abSlotEmpty, &adfSlotReal, &adfSlotDensity,
+         &adfSlotWeight](int iBand, int iSrcY, int iSlot)
+    {
+        abSlotEmpty[iSlot] = !GWKGetPixelRow(
+            poWK, iBand, static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize,
+            nHalfSrcLen, bHasSrcMask ? adfRowDensity.data() : nullptr,
+            adfRowReal.data(), nullptr);
+        if (abSlotEmpty[iSlot])
+            return;
+
+        double *padfReal =
+            adfSlotReal.data() + static_cast<size_t>(iSlot) * nCols;
+        if (!bHasSrcMask)
+        {
+            for (int iCol = 0; iCol < nCols; ++iCol)
+            {
+                const double *padfSrc = adfRowReal.data() + anColStart[iCol];
+                const double *padfWeights =
+                    adfColWeights.data() + static_cast<size_t>(iCol) * nXTaps;
+                const int nTaps = anColTaps[iCol];
+                double dfAccumulatorReal = 0.0;
+                for (int i = 0; i < nTaps; ++i)
+                    dfAccumulatorReal += padfSrc[i] * padfWeights[i];
+                padfReal[iCol] = dfAccumulatorReal;
+            }
+            return;
+        }
+
+        double *padfDensity =
+            adfSlotDensity.data() + static_cast<size_t>(iSlot) * nCols;
+        double *padfWeight =
+            adfSlotWeight.data() + static_cast<size_t>(iSlot) * nCols;
+        for (int iCol = 0; iCol < nCols; ++iCol)
+        {
+            const double *padfSrc = adfRowReal.data() + anColStart[iCol];
+            const double *padfSrcDensity =
+                adfRowDensity.data() + anColStart[iCol];
+            const double *padfWeights =
+                adfColWeights.data() + static_cast<size_t>(iCol) * nXTaps;
+            const int nTaps = anColTaps[iCol];
+            double dfAccumulatorReal = 0.0;
+            double dfAccumulatorDensity = 0.0;
+            double dfAccumulatorWeight = 0.0;
+            for (int i = 0; i < nTaps; ++i)
+            {
+                // Skip sampling if pixel has zero density.
+                if (padfSrcDensity[i] < SRC_DENSITY_THRESHOLD_DOUBLE)
+                    continue;
+                dfAccumulatorReal += padfSrc[i] * padfWeights[i];
+                dfAccumulatorDensity += padfSrcDensity[i] * padfWeights[i];
+                dfAccumulatorWeight += padfWeights[i];
+            }
+            padfReal[iCol] = dfAccumulatorReal;
+            padfDensity[iCol] = dfAccumulatorDensity;
+            padfWeight[iCol] = dfAccumulatorWeight;
+        }
+    };
+
+    // Returns false if the source pixel at the center of the kernel is
+    // transparent, in which case the destination pixel is not touched.
+    const auto GetCenterDensity = [poWK, nSrcXSize](int iSrcX, int iSrcY,
+                                                    double &dfDensity)
+    {
+        const GPtrDiff_t iSrcOffset =
+            iSrcX + static_cast<GPtrDiff_t>(iSrcY) * nSrcXSize;
+        dfDensity = 1.0;
+        if (poWK->pafUnifiedSrcDensity != nullptr)
+        {
+            dfDensity = double(poWK->pafUnifiedSrcDensity[iSrcOffset]);
+            if (dfDensity < SRC_DENSITY_THRESHOLD_DOUBLE)
+                return false;
+        }
+        return poWK->panUnifiedSrcValid == nullptr ||
+               CPLMaskGet(poWK->panUnifiedSrcValid, iSrcOffset);
+    };
+
+    /* ==================================================================== */
+    /*      Loop over blocks of output lines.                               */
+    /* ==================================================================== */
+    bool bStop = false;
+    for (int iBlockY = iYMin; iBlockY < iYMax && !bStop;
+         iBlockY += BLOCK_LINES)
+    {
+        const int iBlockYMax = std::min(iYMax, iBlockY + BLOCK_LINES);
+        std::fill(abyFoundDensity.begin(), abyFoundDensity.end(),
+                  static_cast<GByte>(0));
+
+        for (int iBand = 0; iBand < poWK->nBands; iBand++)
+        {
+            std::fill(anSlotSrcLine.begin(), anSlotSrcLine.end(), -1);
+
+            for (int iDstY = iBlockY; iDstY < iBlockYMax; iDstY++)
+            {
+                const int iLine = iDstY - iYMin;
+                if (!abLineValid[iLine])
+                    continue;
+
+                /* ------------------------------------------------------------
+                 */
+                /*      Vertical pass over the horizontally resampled lines. */
+                /* ------------------------------------------------------------
+                 */
+                std::fill(adfAccReal.begin(), adfAccReal.end(), 0.0);
+                std::fill(adfAccDensity.begin(), adfAccDensity.end(), 0.0);
+                std::fill(adfAccWeight.begin(), adfAccWeight.end(), 0.0);
+                const double *padfWeightsY =
+                    adfLineWeights.data() +
+                    static_cast<size_t>(iLine) * nYTaps;
+                for (int j = 0; j < anLineTaps[iLine]; ++j)
+                {
+                    const int iSrcY = anLineStart[iLine] + j;
+                    const int iSlot = iSrcY % nSlots;
+                    if (anSlotSrcLine[iSlot] != iSrcY)
+                    {
+                        ComputeSlot(iBand, iSrcY, iSlot);
+                        anSlotSrcLine[iSlot] = iSrcY;
+                    }
+                    if (abSlotEmpty[iSlot])
+                        continue;
+
+                    const double dfWeight1 = padfWeightsY[j];
+                    const size_t nSlotOffset =
+                        static_cast<size_t>(iSlot) * nCols;
+                    const double *padfReal = adfSlotReal.data() + nSlotOffset;
+                    for (int iCol = 0; iCol < nCols; ++iCol)
+                        adfAccReal[iCol] += padfReal[iCol] * dfWeight1;
+                    if (bHasSrcMask)
+                    {
+                        const double *padfDensity =
+                            adfSlotDensity.data() + nSlotOffset;
+                        const double *padfWeight =
+                            adfSlotWeight.data() + nSlotOffset;
+                        for (int iCol = 0; iCol < nCols; ++iCol)
+                        {
+                            adfAccDensity[iCol] +=
+                                padfDensity[iCol] * dfWeight1;
+                            adfAccWeight[iCol] += padfWeight[iCol] * dfWeight1;
+                        }
+                    }
+                    else
+                    {
+                        for (int iCol = 0; iCol < nCols; ++iCol)
+                            adfAccWeight[iCol] +=
+                                adfColWeightSum[iCol] * dfWeight1;
+                    }
+                }
+
+                /* ------------------------------------------------------------
+                 */
+                /*      Apply the computed values to the destination. */
+                /* ------------------------------------------------------------
+                 */
+                for (int iCol = 0; iCol < nCols; ++iCol)
+                {
+                    double dfDensity = 1.0;
+                    if (bHasSrcMask &&
+                        !GetCenterDensity(anColCenter[iCol],
+                                          anLineCenter[iLine], dfDensity))
+                    {
+                        continue;
+                    }
+
+                    const double dfAccumulatorWeight = adfAccWeight[iCol];
+                    const double dfAccumulatorDensity = adfAccDensity[iCol];
+                    if (dfAccumulatorWeight < 0.000001 ||
+                        (bHasSrcMask && dfAccumulatorDensity < 0.000001))
+                    {
+                        continue;
+                    }
+
+                    // Calculate the output taking into account weighting.
+                    double dfValueReal = adfAccReal[iCol];
+                    double dfBandDensity =
+                        bHasSrcMask ? dfAccumulatorDensity : 1.0;
+                    if (dfAccumulatorWeight < 0.99999 ||
+                        dfAccumulatorWeight > 1.00001)
+                    {
+                        dfValueReal /= dfAccumulatorWeight;
+                        if (bHasSrcMask)
+                            dfBandDensity /= dfAccumulatorWeight;
+                    }
+
+                    // If we didn't find any valid inputs skip to next band.
+                    if (dfBandDensity < BAND_DENSITY_THRESHOLD)
+                        continue;
+
+                    const GPtrDiff_t iDstOffset =
+                        anCols[iCol] +
+                        static_cast<GPtrDiff_t>(iDstY) * nDstXSize;
+                    GWKSetPixelValueReal(poWK, iBand, iDstOffset,
+                                         dfBandDensity, dfValueReal);
+                    abyFoundDensity[static_cast<size_t>(iDstY - iBlockY) *
+                                        nCols +
+                                    iCol] = 1;
+                }
+            }
+        }
+
+        /* ---------------------------------------------------------------- */
+        /*      Update destination density/validity masks.                  */
+        /* ---------------------------------------------------------------- */
+        for (int iDstY = iBlockY; iDstY < iBlockYMax; iDstY++)
+        {
+            const int iLine = iDstY - iYMin;
+            for (int iCol = 0; abLineValid[iLine] && iCol < nCols; ++iCol)
+            {
+                if (!abyFoundDensity[static_cast<size_t>(iDstY - iBlockY) *
+                                         nCols +
+                                     iCol])
+                    continue;
+
+                double dfDensity = 1.0;
+                GetCenterDensity(anColCenter[iCol], anLineCenter[iLine],
+                                 dfDensity);
+                const GPtrDiff_t iDstOffset =
+                    anCols[iCol] + static_cast<GPtrDiff_t>(iDstY) * nDstXSize;
+                GWKOverlayDensity(poWK, iDstOffset, dfDensity);
+
+                if (poWK->panDstValid != nullptr)
+                {
+                    CPLMaskSet(poWK->panDstValid, iDstOffset);
+                }
+            }
+
+            /* ------------------------------------------------------------ */
+            /*      Report progress to the user, and optionally cancel out. */
+            /* ------------------------------------------------------------ */
+            if (psJob->pfnProgress && psJob->pfnProgress(psJob))
+            {
+                bStop = true;
+                break;
+            }
+        }
+    }
+}
+
+static CPLErr GWKSeparableResample(GDALWarpKernel *poWK)
+{
+    return GWKRun(poWK, "GWKSeparableResample", GWKSeparableResampleThread);
+}
+
 /************************************************************************/
 /*                 GWKCubicResampleNoMasks4MultiBandT()                 */
 /************************************************************************/
@@ -0,0 +1,1080 @@
+/******************************************************************************
+ *
+ * Project:  GDAL
+ * Purpose:  Warp plan transformer: precomputed grids of coordinates that
+ *           can be saved and reused to warp rasters sharing the same
+ *           source and destination grids.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include "cpl_conv.h"
+#include "cpl_error.h"
+#include "cpl_minixml.h"
+#include "cpl_string.h"
+#include "gdal_alg.h"
+#include "gdal_alg_priv.h"
+
+CPL_C_START
+CPLXMLNode *GDALSerializeWarpPlanTransformer(void *pTransformArg);
+void *GDALDeserializeWarpPlanTransformer(CPLXMLNode *psTree);
+CPL_C_END
+
+namespace
+{
+
+// Maximum number of sub-cells, along each axis, a cell can be divided into
+constexpr int MAX_SUBDIVISION = 64;
+
+/************************************************************************/
+/*                           WarpPlanGrid                               */
+/************************************************************************/
+
+// Regular grid of nodes, spaced by dfStepX x dfStepY in the input space
+// of the transformation, holding the (x,y) output coordinates of each node.
+// Each cell of the grid is either bilinearly interpolated from its corners,
+// divided into n x n sub-cells whose nodes are stored in adfRefinedValues,
+// or transformed with the base transformer.
+struct WarpPlanGrid
+{
+    double dfStepX = 0;
+    double dfStepY = 0;
+    int nNodesX = 0;
+    int nNodesY = 0;
+    std::vector<double> adfValues{};
+
+    // Per cell: 0 = base transformer, 1 = interpolation between the corners
+    // of the cell, n > 1 = interpolation between the (n+1) x (n+1) nodes
+    // starting at anCellOffset[] in adfRefinedValues
+    std::vector<int> anCellSubdiv{};
+    std::vector<size_t> anCellOffset{};
+    std::vector<double> adfRefinedValues{};
+
+    bool ComputeCellOffsets();
+
+    bool Interpolate(double dfX, double dfY, double &dfOutX, double &dfOutY,
+                     bool &bUseBaseTransformer) const;
+};
+
+/************************************************************************/
+/*                         BilinearInterpolate()                        */
+/************************************************************************/
+
+// Interpolate at (dfTX, dfTY), in [0,1]x[0,1] except for extrapolation,
+// between the nodes padf00, its right neighbor and the two nodes
+// nLineStride nodes further.
+inline void BilinearInterpolate(const double *padf00, size_t nLineStride,
+                                double dfTX, double dfTY, double &dfOutX,
+                                double &dfOutY)
+{
+    const double *padf10 = padf00 + 2;
+    const double *padf01 = padf00 + 2 * nLineStride;
+    const double *padf11 = padf01 + 2;
+    dfOutX = (1 - dfTY) * ((1 - dfTX) * padf00[0] + dfTX * padf10[0]) +
+             dfTY * ((1 - dfTX) * padf01[0] + dfTX * padf11[0]);
+    dfOutY = (1 - dfTY) * ((1 - dfTX) * padf00[1] + dfTX * padf10[1]) +
+             dfTY * ((1 - dfTX) * padf01[1] + dfTX * padf11[1]);
+}
+
+/************************************************************************/
+/*                  WarpPlanGrid::ComputeCellOffsets()                  */
+/************************************************************************/
+
+// Compute anCellOffset[] from anCellSubdiv[], and check that it is
+// consistent with the size of adfRefinedValues.
+bool WarpPlanGrid::ComputeCellOffsets()
+{
+    anCellOffset.resize(anCellSubdiv.size());
+    size_t nOffset = 0;
+    for (size_t i = 0; i < anCellSubdiv.size(); ++i)
+    {
+        const int nSubdiv = anCellSubdiv[i];
+        if (nSubdiv < 0 || nSubdiv > MAX_SUBDIVISION)
+            return false;
+        anCellOffset[i] = nOffset;
+        if (nSubdiv > 1)
+            nOffset += 2 * static_cast<size_t>(nSubdiv + 1) * (nSubdiv + 1);
+    }
+    return nOffset == adfRefinedValues.size();
+}
+
+/************************************************************************/
+/*                     WarpPlanGrid::Interpolate()                      */
+/************************************************************************/
+
+// Bilinear interpolation within the cell containing (dfX, dfY).
+// Points outside of the grid are extrapolated from the nearest cell.
+// Returns false with bUseBaseTransformer set if the point is in a cell
+// that must be transformed with the base transformer.
+bool WarpPlanGrid::Interpolate(double dfX, double dfY, double &dfOutX,
+                               double &dfOutY, bool &bUseBaseTransformer) const
+{
+    bUseBaseTransformer = false;
+    if (!std::isfinite(dfX) || !std::isfinite(dfY))
+        return false;
+    const double dfFracX = dfX / dfStepX;
+    const double dfFracY = dfY / dfStepY;
+    const int iX = static_cast<int>(std::clamp(
+        std::floor(dfFracX), 0.0, static_cast<double>(nNodesX - 2)));
+    const int iY = static_cast<int>(std::clamp(
+        std::floor(dfFracY), 0.0, static_cast<double>(nNodesY - 2)));
+    double dfTX = dfFracX - iX;
+    double dfTY = dfFracY - iY;
+
+    const size_t iCell = static_cast<size_t>(iY) * (nNodesX - 1) + iX;
+    const int nSubdiv = anCellSubdiv[iCell];
+    if (nSubdiv == 0)
+    {
+        bUseBaseTransformer = true;
+        return false;
+    }
+    if (nSubdiv == 1)
+    {
+        BilinearInterpolate(adfValues.data() +
+                                2 * (static_cast<size_t>(iY) * nNodesX + iX),
+                            nNodesX, dfTX, dfTY, dfOutX, dfOutY);
+    }
+    else
+    {
+        const double dfSubX = dfTX * nSubdiv;
+        const double dfSubY = dfTY * nSubdiv;
+        const int iSubX = static_cast<int>(std::clamp(
+            std::floor(dfSubX), 0.0, static_cast<double>(nSubdiv - 1)));
+        const int iSubY = static_cast<int>(std::clamp(
+            std::floor(dfSubY), 0.0, static_cast<double>(nSubdiv - 1)));
+        dfTX = dfSubX - iSubX;
+        dfTY = dfSubY - iSubY;
+        BilinearInterpolate(
+            adfRefinedValues.data() + anCellOffset[iCell] +
+                2 * (static_cast<size_t>(iSubY) * (nSubdiv + 1) + iSubX),
+            nSubdiv + 1, dfTX, dfTY, dfOutX, dfOutY);
+    }
+    return !std::isnan(dfOutX) && !std::isnan(dfOutY);
+}
+
+/************************************************************************/
+/*                          BuildWarpPlanGrid()                         */
+/************************************************************************/
+
+// Sample the base transformer on a regular grid covering a raster of
+// nXSize x nYSize pixels, with nodes dfInitialStep pixels apart. Each cell
+// whose interpolation, checked at the center of the cell, does not reproduce
+// the base transformer within dfMaxError is then divided into 2 x 2, 4 x 4,
+// ... sub-cells, independently of the other cells, until it does. Cells
+// that still fail with sub-cells of one pixel, or MAX_SUBDIVISION sub-cells
+// per axis, and cells where the base transformer fails at a node, are
+// transformed with the base transformer.
+std::unique_ptr<WarpPlanGrid>
+BuildWarpPlanGrid(GDALTransformerFunc pfnTransformer, void *pTransformArg,
+                  int bDstToSrc, int nXSize, int nYSize, double dfMaxError,
+                  double dfInitialStep)
+{
+    const double dfMaxStep = std::max(1.0, std::max(nXSize, nYSize) / 2.0);
+    const double dfStep = std::clamp(dfInitialStep, 1.0, dfMaxStep);
+    auto poGrid = std::make_unique<WarpPlanGrid>();
+    poGrid->dfStepX = dfStep;
+    poGrid->dfStepY = dfStep;
+    poGrid->nNodesX =
+        std::max(2, static_cast<int>(std::ceil(nXSize / dfStep)) + 1);
+    poGrid->nNodesY =
+        std::max(2, static_cast<int>(std::ceil(nYSize / dfStep)) + 1);
+    const int nNodesX = poGrid->nNodesX;
+    const int nNodesY = poGrid->nNodesY;
+    const int nCellsX = nNodesX - 1;
+    const int nCellsY = nNodesY - 1;
+    try
+    {
+        poGrid->adfValues.resize(2 * static_cast<size_t>(nNodesX) * nNodesY);
+        poGrid->anCellSubdiv.resize(static_cast<size_t>(nCellsX) * nCellsY,
+                                    1);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate warp plan grid of %d x %d nodes", nNodesX,
+                 nNodesY);
+        return nullptr;
+    }
+
+    // Transform the points of adfX/adfY in place. Failed points are set to
+    // NaN.
+    std::vector<double> adfX;
+    std::vector<double> adfY;
+    std::vector<double> adfZ;
+    std::vector<int> abSuccess;
+    const auto Transform = [&]()
+    {
+        adfZ.assign(adfX.size(), 0);
+        abSuccess.resize(adfX.size());
+        pfnTransformer(pTransformArg, bDstToSrc, static_cast<int>(adfX.size()),
+                       adfX.data(), adfY.data(), adfZ.data(),
+                       abSuccess.data());
+        for (size_t i = 0; i < adfX.size(); ++i)
+        {
+            if (!abSuccess[i])
+            {
+                adfX[i] = std::numeric_limits<double>::quiet_NaN();
+                adfY[i] = std::numeric_limits<double>::quiet_NaN();
+            }
+        }
+    };
+
+    for (int iY = 0; iY < nNodesY; ++iY)
+    {
+        adfX.resize(nNodesX);
+        adfY.resize(nNodesX);
+        for (int iX = 0; iX < nNodesX; ++iX)
+        {
+            adfX[iX] = iX * dfStep;
+            adfY[iX] = iY * dfStep;
+        }
+        Transform();
+        double *padfRow =
+            poGrid->adfValues.data() + 2 * static_cast<size_t>(iY) * nNodesX;
+        for (int iX = 0; iX < nNodesX; ++iX)
+        {
+            padfRow[2 * iX] = adfX[iX];
+            padfRow[2 * iX + 1] = adfY[iX];
+        }
+    }
+
+    // Refine the cells of each row of cells
+    int nRefinedCells = 0;
+    int nBaseTransformerCells = 0;
+    for (int iY = 0; iY < nCellsY; ++iY)
+    {
+        // Cells of the row not validated yet, with their current nodes
+        struct PendingCell
+        {
+            int iX = 0;
+            std::vector<double> adfNodes{};
+        };
+
+        std::vector<PendingCell> aoPending;
+        for (int iX = 0; iX < nCellsX; ++iX)
+        {
+            PendingCell oCell;
+            oCell.iX = iX;
+            oCell.adfNodes.resize(8);
+            for (int j = 0; j < 2; ++j)
+            {
+                const double *padfSrc =
+                    poGrid->adfValues.data() +
+                    2 * (static_cast<size_t>(iY + j) * nNodesX + iX);
+                std::copy(padfSrc, padfSrc + 4, oCell.adfNodes.begin() + 4 * j);
+            }
+            aoPending.push_back(std::move(oCell));
+        }
+
+        const auto SetUseBaseTransformer = [&](const PendingCell &oCell)
+        {
+            poGrid->anCellSubdiv[static_cast<size_t>(iY) * nCellsX + oCell.iX] =
+                0;
+            ++nBaseTransformerCells;
+        };
+
+        int nSubdiv = 1;
+        while (!aoPending.empty())
+        {
+            const double dfSubStep = dfStep / nSubdiv;
+            const int nNodesPerAxis = nSubdiv + 1;
+
+            // Cells with a failed node
+            std::vector<PendingCell> aoValid;
+            for (auto &oCell : aoPending)
+            {
+                if (std::any_of(oCell.adfNodes.begin(), oCell.adfNodes.end(),
+                                [](double dfVal) { return std::isnan(dfVal); }))
+                    SetUseBaseTransformer(oCell);
+                else
+                    aoValid.push_back(std::move(oCell));
+            }
+            aoPending = std::move(aoValid);
+
+            // Transform the centers of the sub-cells of all pending cells
+            adfX.clear();
+            adfY.clear();
+            for (const auto &oCell : aoPending)
+            {
+                for (int iSubY = 0; iSubY < nSubdiv; ++iSubY)
+                {
+                    for (int iSubX = 0; iSubX < nSubdiv; ++iSubX)
+                    {
+                        adfX.push_back(oCell.iX * dfStep +
+                                       (iSubX + 0.5) * dfSubStep);
+                        adfY.push_back(iY * dfStep + (iSubY + 0.5) * dfSubStep);
+                    }
+                }
+            }
+            if (!adfX.empty())
+                Transform();
+
+            // Keep the cells interpolated within dfMaxError
+            std::vector<PendingCell> aoFailing;
+            size_t iPoint = 0;
+            for (auto &oCell : aoPending)
+            {
+                double dfError = 0;
+                for (int iSubY = 0; iSubY < nSubdiv; ++iSubY)
+                {
+                    for (int iSubX = 0; iSubX < nSubdiv; ++iSubX, ++iPoint)
+                    {
+                        double dfInterpX = 0;
+                        double dfInterpY = 0;
+                        BilinearInterpolate(
+                            oCell.adfNodes.data() +
+                                2 * (static_cast<size_t>(iSubY) *
+                                         nNodesPerAxis +
+                                     iSubX),
+                            nNodesPerAxis, 0.5, 0.5, dfInterpX, dfInterpY);
+                        // NaN when the base transformer failed
+                        const double dfPointError =
+                            std::max(std::fabs(dfInterpX - adfX[iPoint]),
+                                     std::fabs(dfInterpY - adfY[iPoint]));
+                        if (!(dfPointError <= dfError))
+                            dfError = dfPointError;
+                    }
+                }
+                if (dfError <= dfMaxError)
+                {
+                    if (nSubdiv > 1)
+                    {
+                        poGrid->anCellSubdiv[static_cast<size_t>(iY) *
+                                                 nCellsX +
+                                             oCell.iX] = nSubdiv;
+                        poGrid->adfRefinedValues.insert(
+                            poGrid->adfRefinedValues.end(),
+                            oCell.adfNodes.begin(), oCell.adfNodes.end());
+                        ++nRefinedCells;
+                    }
+                }
+                else if (nSubdiv * 2 > MAX_SUBDIVISION ||
+                         dfSubStep / 2 < 1.0)
+                {
+                    SetUseBaseTransformer(oCell);
+                }
+                else
+                {
+                    aoFailing.push_back(std::move(oCell));
+                }
+            }
+            aoPending = std::move(aoFailing);
+            if (aoPending.empty())
+                break;
+
+            // Divide the failing cells further
+            nSubdiv *= 2;
+            const double dfNewSubStep = dfStep / nSubdiv;
+            adfX.clear();
+            adfY.clear();
+            for (const auto &oCell : aoPending)
+            {
+                for (int iSubY = 0; iSubY <= nSubdiv; ++iSubY)
+                {
+                    for (int iSubX = 0; iSubX <= nSubdiv; ++iSubX)
+                    {
+                        adfX.push_back(oCell.iX * dfStep +
+                                       iSubX * dfNewSubStep);
+                        adfY.push_back(iY * dfStep + iSubY * dfNewSubStep);
+                    }
+                }
+            }
+            Transform();
+            const size_t nNodesPerCell =
+                static_cast<size_t>(nSubdiv + 1) * (nSubdiv + 1);
+            for (size_t i = 0; i < aoPending.size(); ++i)
+            {
+                auto &adfNodes = aoPending[i].adfNodes;
+                adfNodes.resize(2 * nNodesPerCell);
+                for (size_t j = 0; j < nNodesPerCell; ++j)
+                {
+                    adfNodes[2 * j] = adfX[i * nNodesPerCell + j];
+                    adfNodes[2 * j + 1] = adfY[i * nNodesPerCell + j];
+                }
+            }
+        }
+    }
+
+    if (!poGrid->ComputeCellOffsets())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Inconsistent warp plan grid");
+        return nullptr;
+    }
+
+    CPLDebug("WARP",
+             "Warp plan: grid of %d x %d nodes with step %g, %d refined "
+             "cell(s), %d cell(s) using the base transformer",
+             nNodesX, nNodesY, dfStep, nRefinedCells, nBaseTransformerCells);
+
+    return poGrid;
+}
+
+/************************************************************************/
+/*                          ScaleWarpPlanGrid()                         */
+/************************************************************************/
+
+// Return a grid adapted to a source raster subsampled by dfRatioX x dfRatioY.
+// For a grid in the destination space (bDstToSrc), the output coordinates
+// are scaled. Otherwise the spacing of nodes is.
+std::shared_ptr<const WarpPlanGrid>
+ScaleWarpPlanGrid(const WarpPlanGrid &oGrid, bool bDstToSrc, double dfRatioX,
+                  double dfRatioY)
+{
+    auto poGrid = std::make_shared<WarpPlanGrid>(oGrid);
+    if (bDstToSrc)
+    {
+        for (auto *padfValues :
+             {&poGrid->adfValues, &poGrid->adfRefinedValues})
+        {
+            for (size_t i = 0; i < padfValues->size(); i += 2)
+            {
+                (*padfValues)[i] /= dfRatioX;
+                (*padfValues)[i + 1] /= dfRatioY;
+            }
+        }
+    }
+    else
+    {
+        poGrid->dfStepX /= dfRatioX;
+        poGrid->dfStepY /= dfRatioY;
+    }
+    return poGrid;
+}
+
+/************************************************************************/
+/*                       WarpPlanTransformInfo                          */
+/************************************************************************/
+
+struct WarpPlanTransformInfo
+{
+    GDALTransformerInfo sTI{};
+
+    double dfMaxError = 0;
+    int nSrcXSize = 0;
+    int nSrcYSize = 0;
+    int nDstXSize = 0;
+    int nDstYSize = 0;
+
+    // Grids are immutable once built, so they can be shared between clones
+    std::shared_ptr<const WarpPlanGrid> poDstToSrc{};
+    std::shared_ptr<const WarpPlanGrid> poSrcToDst{};
+
+    // Owned base transformer, for cells that cannot be interpolated.
+    // May be null if the base transformer was not cloneable and all cells
+    // can be interpolated.
+    GDALTransformerFunc pfnBaseTransformer = nullptr;
+    void *pBaseTransformArg = nullptr;
+
+    WarpPlanTransformInfo() = default;
+    WarpPlanTransformInfo(const WarpPlanTransformInfo &) = delete;
+    WarpPlanTransformInfo &operator=(const WarpPlanTransformInfo &) = delete;
+
+    ~WarpPlanTransformInfo()
+    {
+        if (pBaseTransformArg)
+            GDALDestroyTransformer(pBaseTransformArg);
+    }
+
+    bool UsesBaseTransformer() const
+    {
+        const auto UsesBase = [](const WarpPlanGrid &oGrid)
+        {
+            return std::find(oGrid.anCellSubdiv.begin(),
+                             oGrid.anCellSubdiv.end(),
+                             0) != oGrid.anCellSubdiv.end();
+        };
+        return UsesBase(*poDstToSrc) || UsesBase(*poSrcToDst);
+    }
+};
+
+}  // namespace
+
+static void *GDALCreateSimilarWarpPlanTransformer(void *hTransformArg,
+                                                  double dfRatioX,
+                                                  double dfRatioY);
+
+/************************************************************************/
+/*                  GDALCreateWarpPlanTransformerInfo()                 */
+/************************************************************************/
+
+static WarpPlanTransformInfo *GDALCreateWarpPlanTransformerInfo()
+{
+    WarpPlanTransformInfo *psInfo = new WarpPlanTransformInfo();
+
+    memcpy(psInfo->sTI.abySignature, GDAL_GTI2_SIGNATURE,
+           strlen(GDAL_GTI2_SIGNATURE));
+    psInfo->sTI.pszClassName = "GDALWarpPlanTransformer";
+    psInfo->sTI.pfnTransform = GDALWarpPlanTransform;
+    psInfo->sTI.pfnCleanup = GDALDestroyWarpPlanTransformer;
+    psInfo->sTI.pfnSerialize = GDALSerializeWarpPlanTransformer;
+    psInfo->sTI.pfnCreateSimilar = GDALCreateSimilarWarpPlanTransformer;
+
+    return psInfo;
+}
+
+/************************************************************************/
+/*                GDALCreateSimilarWarpPlanTransformer()                */
+/************************************************************************/
+
+static void *GDALCreateSimilarWarpPlanTransformer(void *hTransformArg,
+                                                  double dfRatioX,
+                                                  double dfRatioY)
+{
+    VALIDATE_POINTER1(hTransformArg, "GDALCreateSimilarWarpPlanTransformer",
+                      nullptr);
+
+    const WarpPlanTransformInfo *psInfo =
+        static_cast<const WarpPlanTransformInfo *>(hTransformArg);
+
+    void *pBaseTransformArg = nullptr;
+    if (psInfo->pBaseTransformArg)
+    {
+        pBaseTransformArg = GDALCreateSimilarTransformer(
+            psInfo->pBaseTransformArg, dfRatioX, dfRatioY);
+        if (pBaseTransformArg == nullptr)
+            return nullptr;
+    }
+
+    WarpPlanTransformInfo *psNewInfo = GDALCreateWarpPlanTransformerInfo();
+    psNewInfo->pfnBaseTransformer = psInfo->pfnBaseTransformer;
+    psNewInfo->pBaseTransformArg = pBaseTransformArg;
+    psNewInfo->dfMaxError = psInfo->dfMaxError;
+    psNewInfo->nDstXSize = psInfo->nDstXSize;
+    psNewInfo->nDstYSize = psInfo->nDstYSize;
+    if (dfRatioX == 1.0 && dfRatioY == 1.0)
+    {
+        psNewInfo->nSrcXSize = psInfo->nSrcXSize;
+        psNewInfo->nSrcYSize = psInfo->nSrcYSize;
+        psNewInfo->poDstToSrc = psInfo->poDstToSrc;
+        psNewInfo->poSrcToDst = psInfo->poSrcToDst;
+    }
+    else
+    {
+        psNewInfo->nSrcXSize =
+            static_cast<int>(std::ceil(psInfo->nSrcXSize / dfRatioX));
+        psNewInfo->nSrcYSize =
+            static_cast<int>(std::ceil(psInfo->nSrcYSize / dfRatioY));
+        psNewInfo->poDstToSrc = ScaleWarpPlanGrid(*(psInfo->poDstToSrc), true,
+                                                  dfRatioX, dfRatioY);
+        psNewInfo->poSrcToDst = ScaleWarpPlanGrid(*(psInfo->poSrcToDst), false,
+                                                  dfRatioX, dfRatioY);
+    }
+
+    return psNewInfo;
+}
+
+/************************************************************************/
+/*                    GDALCreateWarpPlanTransformer()                   */
+/************************************************************************/
+
+/**
+ * Create a warp plan transformer.
+ *
+ * A warp plan samples a base transformer, typically a GenImgProj
+ * transformer, on a regular grid of nodes covering the destination raster
+ * (for destination to source transformations), and on another one covering
+ * the source raster (for source to destination transformations).
+ * Coordinates are then bilinearly interpolated between nodes, which is much
+ * cheaper than the base transformation. Cells of the grids whose
+ * interpolation error, measured at their center, is above dfMaxError are
+ * divided into smaller cells, independently of each other. Like
+ * GDALApproxTransform(), points in cells where the base transformer fails at
+ * a node, or where the error cannot be reduced below dfMaxError, are
+ * transformed with the base transformer.
+ *
+ * Warp plans are serializable, so that the cost of computing them can be
+ * paid once for a set of rasters sharing the same source and destination
+ * grids (e.g. a time series), and they can be cloned cheaply, the grids being
+ * shared between clones. The base transformer is serialized within the plan.
+ *
+ * The following options are supported:
+ * <ul>
+ * <li>STEP=integer: initial spacing, in pixels, between nodes of the grids.
+ * Defaults to 64.</li>
+ * </ul>
+ *
+ * @param pfnBaseTransformer the base transformer to sample.
+ * @param pBaseTransformArg the callback argument for the base transformer.
+ * The warp plan does not take ownership of it, but keeps a clone of it if it
+ * is a GDAL transformer. This is required when some cells cannot be
+ * interpolated.
+ * @param nSrcXSize width of the source raster.
+ * @param nSrcYSize height of the source raster.
+ * @param nDstXSize width of the destination raster.
+ * @param nDstYSize height of the destination raster.
+ * @param dfMaxError the maximum cartesian error, in pixels, allowed when
+ * interpolating between nodes.
+ * @param papszOptions list of options, or NULL.
+ *
+ * @return the transform argument or NULL if creation fails.
+ * @since GDAL 3.12
+ */
+
+void *GDALCreateWarpPlanTransformer(GDALTransformerFunc pfnBaseTransformer,
+                                    void *pBaseTransformArg, int nSrcXSize,
+                                    int nSrcYSize, int nDstXSize, int nDstYSize,
+                                    double dfMaxError,
+                                    CSLConstList papszOptions)
+{
+    VALIDATE_POINTER1(pfnBaseTransformer, "GDALCreateWarpPlanTransformer",
+                      nullptr);
+
+    if (nSrcXSize <= 0 || nSrcYSize <= 0 || nDstXSize <= 0 || nDstYSize <= 0)
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "GDALCreateWarpPlanTransformer(): invalid raster dimensions");
+        return nullptr;
+    }
+
+    const double dfStep =
+        CPLAtof(CSLFetchNameValueDef(papszOptions, "STEP", "64"));
+    if (!(dfStep >= 1))
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "GDALCreateWarpPlanTransformer(): invalid STEP value");
+        return nullptr;
+    }
+
+    std::shared_ptr<const WarpPlanGrid> poDstToSrc =
+        BuildWarpPlanGrid(pfnBaseTransformer, pBaseTransformArg, TRUE,
+                          nDstXSize, nDstYSize, dfMaxError, dfStep);
+    if (!poDstToSrc)
+        return nullptr;
+    std::shared_ptr<const WarpPlanGrid> poSrcToDst =
+        BuildWarpPlanGrid(pfnBaseTransformer, pBaseTransformArg, FALSE,
+                          nSrcXSize, nSrcYSize, dfMaxError, dfStep);
+    if (!poSrcToDst)
+        return nullptr;
+
+    auto psInfo = std::unique_ptr<WarpPlanTransformInfo, void (*)(void *)>(
+        GDALCreateWarpPlanTransformerInfo(), GDALDestroyWarpPlanTransformer);
+    psInfo->dfMaxError = dfMaxError;
+    psInfo->nSrcXSize = nSrcXSize;
+    psInfo->nSrcYSize = nSrcYSize;
+    psInfo->nDstXSize = nDstXSize;
+    psInfo->nDstYSize = nDstYSize;
+    psInfo->poDstToSrc = std::move(poDstToSrc);
+    psInfo->poSrcToDst = std::move(poSrcToDst);
+
+    const GDALTransformerInfo *psBaseInfo =
+        static_cast<const GDALTransformerInfo *>(pBaseTransformArg);
+    if (psBaseInfo != nullptr &&
+        memcmp(psBaseInfo->abySignature, GDAL_GTI2_SIGNATURE,
+               strlen(GDAL_GTI2_SIGNATURE)) == 0)
+    {
+        psInfo->pfnBaseTransformer = pfnBaseTransformer;
+        psInfo->pBaseTransformArg = GDALCloneTransformer(pBaseTransformArg);
+    }
+    if (psInfo->pBaseTransformArg == nullptr && psInfo->UsesBaseTransformer())
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "GDALCreateWarpPlanTransformer(): some cells cannot be "
+                 "interpolated, and the base transformer cannot be cloned");
+        return nullptr;
+    }
+
+    return psInfo.release();
+}
+
+/************************************************************************/
+/*                   GDALDestroyWarpPlanTransformer()                   */
+/************************************************************************/
+
+/**
+ * Destroy a warp plan transformer.
+ *
+ * @param pTransformArg the transform arg previously returned by
+ * GDALCreateWarpPlanTransformer().
+ * @since GDAL 3.12
+ */
+
+void GDALDestroyWarpPlanTransformer(void *pTransformArg)
+
+{
+    delete static_cast<WarpPlanTransformInfo *>(pTransformArg);
+}
+
+/************************************************************************/
+/*                        GDALWarpPlanTransform()                       */
+/************************************************************************/
+
+/**
+ * Transforms points with a warp plan.
+ *
+ * This function matches the GDALTransformerFunc signature, and can be
+ * used to transform one or more points from destination pixel/line
+ * coordinates to source pixel/line coordinates (bDstToSrc = TRUE) or
+ * vice versa. Z values are left unmodified, except for points transformed
+ * by the base transformer.
+ *
+ * @param pTransformArg return value from GDALCreateWarpPlanTransformer().
+ * @param bDstToSrc TRUE if transformation is from the destination to the
+ * source pixel/line coordinates.
+ * @param nPointCount the number of values in the x, y and z arrays.
+ * @param x array containing the X values to be transformed.
+ * @param y array containing the Y values to be transformed.
+ * @param z array containing the Z values to be transformed.
+ * @param panSuccess array in which a flag indicating success (TRUE) or
+ * failure (FALSE) of the transformation are placed.
+ *
+ * @return TRUE if all points have been successfully transformed.
+ * @since GDAL 3.12
+ */
+
+int GDALWarpPlanTransform(void *pTransformArg, int bDstToSrc, int nPointCount,
+                          double *x, double *y, double *z, int *panSuccess)
+{
+    VALIDATE_POINTER1(pTransformArg, "GDALWarpPlanTransform", 0);
+
+    const WarpPlanTransformInfo *psInfo =
+        static_cast<const WarpPlanTransformInfo *>(pTransformArg);
+    const WarpPlanGrid &oGrid =
+        bDstToSrc ? *(psInfo->poDstToSrc) : *(psInfo->poSrcToDst);
+
+    int bRet = TRUE;
+    std::vector<int> anBaseIdx;
+    for (int i = 0; i < nPointCount; i++)
+    {
+        double dfX = 0;
+        double dfY = 0;
+        bool bUseBaseTransformer = false;
+        if (oGrid.Interpolate(x[i], y[i], dfX, dfY, bUseBaseTransformer))
+        {
+            x[i] = dfX;
+            y[i] = dfY;
+            panSuccess[i] = TRUE;
+        }
+        else if (bUseBaseTransformer && psInfo->pBaseTransformArg)
+        {
+            anBaseIdx.push_back(i);
+        }
+        else
+        {
+            x[i] = HUGE_VAL;
+            y[i] = HUGE_VAL;
+            panSuccess[i] = FALSE;
+            bRet = FALSE;
+        }
+    }
+
+    if (!anBaseIdx.empty())
+    {
+        // Transform in a single call the points of cells that cannot be
+        // interpolated
+        const size_t nCount = anBaseIdx.size();
+        std::vector<double> adfX(nCount);
+        std::vector<double> adfY(nCount);
+        std::vector<double> adfZ(nCount);
+        std::vector<int> abSuccess(nCount);
+        for (size_t j = 0; j < nCount; ++j)
+        {
+            adfX[j] = x[anBaseIdx[j]];
+            adfY[j] = y[anBaseIdx[j]];
+            adfZ[j] = z ? z[anBaseIdx[j]] : 0;
+        }
+        psInfo->pfnBaseTransformer(psInfo->pBaseTransformArg, bDstToSrc,
+                                   static_cast<int>(nCount), adfX.data(),
+                                   adfY.data(), adfZ.data(), abSuccess.data());
+        for (size_t j = 0; j < nCount; ++j)
+        {
+            const int i = anBaseIdx[j];
+            x[i] = adfX[j];
+            y[i] = adfY[j];
+            if (z)
+                z[i] = adfZ[j];
+            panSuccess[i] = abSuccess[j];
+            if (!abSuccess[j])
+                bRet = FALSE;
+        }
+    }
+
+    return bRet;
+}
+
+/************************************************************************/
+/*                         SerializeWarpPlanArray()                     */
+/************************************************************************/
+
+// Arrays are compressed with zlib and base64 encoded.
+static bool SerializeWarpPlanArray(CPLXMLNode *psParent, const char *pszName,
+                                   const void *pData, size_t nBytes)
+{
+    size_t nCompressedSize = 0;
+    void *pCompressed =
+        CPLZLibDeflate(pData, nBytes, -1, nullptr, 0, &nCompressedSize);
+    if (pCompressed == nullptr ||
+        nCompressedSize > static_cast<size_t>(INT_MAX))
+    {
+        CPLFree(pCompressed);
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot compress warp plan grid");
+        return false;
+    }
+    char *pszBase64 = CPLBase64Encode(static_cast<int>(nCompressedSize),
+                                      static_cast<const GByte *>(pCompressed));
+    CPLFree(pCompressed);
+    CPLCreateXMLElementAndValue(psParent, pszName, pszBase64);
+    CPLFree(pszBase64);
+    return true;
+}
+
+/************************************************************************/
+/*                         SerializeWarpPlanGrid()                      */
+/************************************************************************/
+
+// Node values are stored as little-endian doubles, and the subdivision of
+// cells as little-endian 32-bit integers.
+static bool SerializeWarpPlanGrid(CPLXMLNode *psParent, const char *pszName,
+                                  const WarpPlanGrid &oGrid)
+{
+    std::vector<double> adfValues(oGrid.adfValues);
+    std::vector<double> adfRefinedValues(oGrid.adfRefinedValues);
+    std::vector<GInt32> anCellSubdiv(oGrid.anCellSubdiv.begin(),
+                                     oGrid.anCellSubdiv.end());
+#ifdef CPL_MSB
+    for (double &dfVal : adfValues)
+        CPL_LSBPTR64(&dfVal);
+    for (double &dfVal : adfRefinedValues)
+        CPL_LSBPTR64(&dfVal);
+    for (GInt32 &nVal : anCellSubdiv)
+        CPL_LSBPTR32(&nVal);
+#endif
+
+    CPLXMLNode *psGrid = CPLCreateXMLNode(psParent, CXT_Element, pszName);
+    CPLAddXMLAttributeAndValue(psGrid, "stepX",
+                               CPLSPrintf("%.17g", oGrid.dfStepX));
+    CPLAddXMLAttributeAndValue(psGrid, "stepY",
+                               CPLSPrintf("%.17g", oGrid.dfStepY));
+    CPLAddXMLAttributeAndValue(psGrid, "nodesX",
+                               CPLSPrintf("%d", oGrid.nNodesX));
+    CPLAddXMLAttributeAndValue(psGrid, "nodesY",
+                               CPLSPrintf("%d", oGrid.nNodesY));
+    CPLAddXMLAttributeAndValue(
+        psGrid, "refinedValues",
+        CPLSPrintf("%" PRIu64,
+                   static_cast<uint64_t>(adfRefinedValues.size())));
+    return SerializeWarpPlanArray(psGrid, "Nodes", adfValues.data(),
+                                  adfValues.size() * sizeof(double)) &&
+           SerializeWarpPlanArray(psGrid, "Cells", anCellSubdiv.data(),
+                                  anCellSubdiv.size() * sizeof(GInt32)) &&
+           (adfRefinedValues.empty() ||
+            SerializeWarpPlanArray(psGrid, "RefinedNodes",
+                                   adfRefinedValues.data(),
+                                   adfRefinedValues.size() * sizeof(double)));
+}
+
+/************************************************************************/
+/*                  GDALSerializeWarpPlanTransformer()                  */
+/************************************************************************/
+
+CPLXMLNode *GDALSerializeWarpPlanTransformer(void *pTransformArg)
+
+{
+    VALIDATE_POINTER1(pTransformArg, "GDALSerializeWarpPlanTransformer",
+                      nullptr);
+
+    const WarpPlanTransformInfo *psInfo =
+        static_cast<const WarpPlanTransformInfo *>(pTransformArg);
+
+    CPLXMLNode *psTree =
+        CPLCreateXMLNode(nullptr, CXT_Element, "WarpPlanTransformer");
+
+    CPLCreateXMLElementAndValue(psTree, "MaxError",
+                                CPLSPrintf("%.17g", psInfo->dfMaxError));
+    CPLCreateXMLElementAndValue(psTree, "SrcXSize",
+                                CPLSPrintf("%d", psInfo->nSrcXSize));
+    CPLCreateXMLElementAndValue(psTree, "SrcYSize",
+                                CPLSPrintf("%d", psInfo->nSrcYSize));
+    CPLCreateXMLElementAndValue(psTree, "DstXSize",
+                                CPLSPrintf("%d", psInfo->nDstXSize));
+    CPLCreateXMLElementAndValue(psTree, "DstYSize",
+                                CPLSPrintf("%d", psInfo->nDstYSize));
+
+    if (psInfo->pBaseTransformArg)
+    {
+        CPLXMLNode *psTransformer = GDALSerializeTransformer(
+            psInfo->pfnBaseTransformer, psInfo->pBaseTransformArg);
+        if (psTransformer == nullptr)
+        {
+            CPLDestroyXMLNode(psTree);
+            return nullptr;
+        }
+        CPLXMLNode *psTransformerContainer =
+            CPLCreateXMLNode(psTree, CXT_Element, "BaseTransformer");
+        CPLAddXMLChild(psTransformerContainer, psTransformer);
+    }
+
+    if (!SerializeWarpPlanGrid(psTree, "DstToSrcGrid",
+                               *(psInfo->poDstToSrc)) ||
+        !SerializeWarpPlanGrid(psTree, "SrcToDstGrid", *(psInfo->poSrcToDst)))
+    {
+        CPLDestroyXMLNode(psTree);
+        return nullptr;
+    }
+
+    return psTree;
+}
+
+/************************************************************************/
+/*                       DeserializeWarpPlanArray()                     */
+/************************************************************************/
+
+static bool DeserializeWarpPlanArray(const CPLXMLNode *psGrid,
+                                     const char *pszGridName,
+                                     const char *pszName, void *pData,
+                                     size_t nExpectedSize)
+{
+    std::string osBase64(CPLGetXMLValue(psGrid, pszName, ""));
+    const int nCompressedSize = CPLBase64DecodeInPlace(
+        reinterpret_cast<GByte *>(osBase64.data()));
+    size_t nOutBytes = 0;
+    if (CPLZLibInflate(osBase64.data(), nCompressedSize, pData, nExpectedSize,
+                       &nOutBytes) == nullptr ||
+        nOutBytes != nExpectedSize)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Corrupted %s.%s content",
+                 pszGridName, pszName);
+        return false;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                       DeserializeWarpPlanGrid()                      */
+/************************************************************************/
+
+static std::shared_ptr<const WarpPlanGrid>
+DeserializeWarpPlanGrid(const CPLXMLNode *psTree, const char *pszName)
+{
+    const CPLXMLNode *psGrid = CPLGetXMLNode(psTree, pszName);
+    if (psGrid == nullptr)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Missing %s element", pszName);
+        return nullptr;
+    }
+
+    auto poGrid = std::make_shared<WarpPlanGrid>();
+    poGrid->dfStepX = CPLAtof(CPLGetXMLValue(psGrid, "stepX", "0"));
+    poGrid->dfStepY = CPLAtof(CPLGetXMLValue(psGrid, "stepY", "0"));
+    poGrid->nNodesX = atoi(CPLGetXMLValue(psGrid, "nodesX", "0"));
+    poGrid->nNodesY = atoi(CPLGetXMLValue(psGrid, "nodesY", "0"));
+    const uint64_t nRefinedValues = std::strtoull(
+        CPLGetXMLValue(psGrid, "refinedValues", "0"), nullptr, 10);
+    if (!(poGrid->dfStepX > 0) || !(poGrid->dfStepY > 0) ||
+        poGrid->nNodesX < 2 || poGrid->nNodesY < 2 ||
+        static_cast<uint64_t>(poGrid->nNodesX) * poGrid->nNodesY >
+            std::numeric_limits<size_t>::max() / (2 * sizeof(double)) ||
+        nRefinedValues >
+            std::numeric_limits<size_t>::max() / sizeof(double))
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Invalid attributes for %s",
+                 pszName);
+        return nullptr;
+    }
+
+    const size_t nCells = static_cast<size_t>(poGrid->nNodesX - 1) *
+                          (poGrid->nNodesY - 1);
+    std::vector<GInt32> anCellSubdiv;
+    try
+    {
+        poGrid->adfValues.resize(2 * static_cast<size_t>(poGrid->nNodesX) *
+                                 poGrid->nNodesY);
+        poGrid->adfRefinedValues.resize(static_cast<size_t>(nRefinedValues));
+        anCellSubdiv.resize(nCells);
+    }
+    catch (const std::exception &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Cannot allocate warp plan grid of %d x %d nodes",
+                 poGrid->nNodesX, poGrid->nNodesY);
+        return nullptr;
+    }
+    if (!DeserializeWarpPlanArray(psGrid, pszName, "Nodes",
+                                  poGrid->adfValues.data(),
+                                  poGrid->adfValues.size() * sizeof(double)) ||
+        !DeserializeWarpPlanArray(psGrid, pszName, "Cells",
+                                  anCellSubdiv.data(),
+                                  nCells * sizeof(GInt32)) ||
+        (nRefinedValues > 0 &&
+         !DeserializeWarpPlanArray(
+             psGrid, pszName, "RefinedNodes", poGrid->adfRefinedValues.data(),
+             poGrid->adfRefinedValues.size() * sizeof(double))))
+    {
+        return nullptr;
+    }
+#ifdef CPL_MSB
+    for (double &dfVal : poGrid->adfValues)
+        CPL_LSBPTR64(&dfVal);
+    for (double &dfVal : poGrid->adfRefinedValues)
+        CPL_LSBPTR64(&dfVal);
+    for (GInt32 &nVal : anCellSubdiv)
+        CPL_LSBPTR32(&nVal);
+#endif
+    poGrid->anCellSubdiv.assign(anCellSubdiv.begin(), anCellSubdiv.end());
+    if (!poGrid->ComputeCellOffsets())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined, "Corrupted %s content",
+                 pszName);
+        return nullptr;
+    }
+
+    return poGrid;
+}
+
+/************************************************************************/
+/*                 GDALDeserializeWarpPlanTransformer()                 */
+/************************************************************************/
+
+void *GDALDeserializeWarpPlanTransformer(CPLXMLNode *psTree)
+
+{
+    auto poDstToSrc = DeserializeWarpPlanGrid(psTree, "DstToSrcGrid");
+    if (!poDstToSrc)
+        return nullptr;
+    auto poSrcToDst = DeserializeWarpPlanGrid(psTree, "SrcToDstGrid");
+    if (!poSrcToDst)
+        return nullptr;
+
+    auto psInfo = std::unique_ptr<WarpPlanTransformInfo, void (*)(void *)>(
+        GDALCreateWarpPlanTransformerInfo(), GDALDestroyWarpPlanTransformer);
+    psInfo->dfMaxError = CPLAtof(CPLGetXMLValue(psTree, "MaxError", "0"));
+    psInfo->nSrcXSize = atoi(CPLGetXMLValue(psTree, "SrcXSize", "0"));
+    psInfo->nSrcYSize = atoi(CPLGetXMLValue(psTree, "SrcYSize", "0"));
+    psInfo->nDstXSize = atoi(CPLGetXMLValue(psTree, "DstXSize", "0"));
+    psInfo->nDstYSize = atoi(CPLGetXMLValue(psTree, "DstYSize", "0"));
+    psInfo->poDstToSrc = std::move(poDstToSrc);
+    psInfo->poSrcToDst = std::move(poSrcToDst);
+
+    CPLXMLNode *psContainer = CPLGetXMLNode(psTree, "BaseTransformer");
+    if (psContainer != nullptr && psContainer->psChild != nullptr)
+    {
+        GDALDeserializeTransformer(psContainer->psChild,
+                                   &psInfo->pfnBaseTransformer,
+                                   &psInfo->pBaseTransformArg);
+    }
+    if (psInfo->pBaseTransformArg == nullptr && psInfo->UsesBaseTransformer())
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Cannot get base transform for warp plan transformer.");
+        return nullptr;
+    }
+
+    return psInfo.release();
+}
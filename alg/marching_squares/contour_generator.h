@@ -54,6 +54,15 @@ class ContourGenerator
         return CE_None;
     }
 
+    // Start processing at line lineIdx instead of the first line, previousLine
+    // being the content of line lineIdx - 1.
+    // This is used to process horizontal strips of a raster independently.
+    void startAtLine(size_t lineIdx, const double *previousLine)
+    {
+        lineIdx_ = lineIdx;
+        std::copy(previousLine, previousLine + width_, previousLine_.begin());
+    }
+
   private:
     size_t width_;
     size_t height_;
@@ -17,12 +17,17 @@
 
 #include <list>
 #include <map>
+#include <utility>
+#include <vector>
 
 #include <iostream>
 
 namespace marching_squares
 {
 
+// Linestrings associated with the index of their level
+typedef std::vector<std::pair<int, LineString>> LevelLineStrings;
+
 // SegmentMerger: join segments into linestrings and possibly into rings of
 // polygons
 template <typename LineWriter, typename LevelGenerator> struct SegmentMerger
@@ -114,7 +119,7 @@ template <typename LineWriter, typename LevelGenerator> struct SegmentMerger
             auto it = l.second.begin();
             while (it != l.second.end())
             {
-                if (!it->isMerged)
+                if (!it->isMerged && !touchesStripTop_(it->ls))
                 {
                     // Note that emitLine_ erases `it` and returns an iterator
                     // advanced to the next element.
@@ -150,6 +155,67 @@ template <typename LineWriter, typename LevelGenerator> struct SegmentMerger
         m_anSkipLevels = anSkipLevels;
     }
 
+    /**
+     * @brief setStripTopY sets the ordinate of the upper border of the
+     *        horizontal strip of the raster processed by this merger, when
+     *        the raster is processed by strips. Lines that end on this border
+     *        are continued by the strip above, and are never emitted by
+     *        endOfLine().
+     * @param y ordinate of the upper border.
+     */
+    void setStripTopY(double y)
+    {
+        stripTopY_ = y;
+    }
+
+    /**
+     * @brief takeUnfinishedLines removes the lines that have not been emitted
+     *        yet, so that they can be joined with the lines of other strips
+     *        by joinUnfinishedLines().
+     * @return the unfinished lines.
+     */
+    LevelLineStrings takeUnfinishedLines()
+    {
+        LevelLineStrings res;
+        for (auto &l : lines_)
+        {
+            for (auto &ls : l.second)
+            {
+                res.emplace_back(l.first, LineString());
+                res.back().second.swap(ls.ls);
+            }
+        }
+        lines_.clear();
+        return res;
+    }
+
+    /**
+     * @brief discardUnfinishedLines removes the lines that have not been
+     *        emitted yet, so that the destructor does not write them. To be
+     *        used when processing is interrupted, by an error or on user
+     *        request, to avoid writing partial lines.
+     */
+    void discardUnfinishedLines()
+    {
+        lines_.clear();
+    }
+
+    /**
+     * @brief joinUnfinishedLines joins the unfinished lines of a strip, as
+     *        returned by takeUnfinishedLines(), with the lines of this merger
+     *        sharing one of their end points. Strips must be joined in order.
+     * @param lines lines to join. Emptied on return.
+     */
+    void joinUnfinishedLines(LevelLineStrings &lines)
+    {
+        for (auto &l : lines)
+        {
+            if (!l.second.empty())
+                addLineString_(l.first, l.second);
+        }
+        lines.clear();
+    }
+
     const bool polygonize;
 
   private:
@@ -161,6 +227,14 @@ template <typename LineWriter, typename LevelGenerator> struct SegmentMerger
     // Store 0-indexed levels to skip when polygonize option is set
     std::vector<int> m_anSkipLevels;
 
+    // Upper border of the processed strip, if any
+    double stripTopY_ = NaN;
+
+    bool touchesStripTop_(const LineString &ls) const
+    {
+        return ls.front().y == stripTopY_ || ls.back().y == stripTopY_;
+    }
+
     void addSegment_(int levelIdx, const Point &start, const Point &end)
     {
 
@@ -222,63 +296,131 @@ template <typename LineWriter, typename LevelGenerator> struct SegmentMerger
             // there is no need to test previous elements
             // also: a segment merges at most two lines, no need to stall here
             // ;)
-            auto other = it;
-            ++other;
-            for (; other != lines.end(); ++other)
+            mergeWithNextLines_(levelIdx, it);
+        }
+    }
+
+    // Add a linestring, attaching it to an existing line sharing one of its
+    // end points, as addSegment_() does for a segment.
+    void addLineString_(int levelIdx, LineString &ls)
+    {
+        Lines &lines = lines_[levelIdx];
+
+        auto it = lines.begin();
+        // a closed linestring cannot be joined with another line
+        if (ls.front() == ls.back())
+            it = lines.end();
+        for (; it != lines.end(); ++it)
+        {
+            if (it->ls.back() == ls.front())
             {
-                if (it->ls.back() == other->ls.front())
-                {
-                    it->ls.pop_back();
-                    it->ls.splice(it->ls.end(), other->ls);
-                    it->isMerged = true;
-                    lines.erase(other);
-                    // if that makes a closed ring, returns it
-                    if (it->ls.front() == it->ls.back())
-                        emitLine_(levelIdx, it, /* closed */ true);
-                    break;
-                }
-                else if (other->ls.back() == it->ls.front())
-                {
-                    it->ls.pop_front();
-                    other->ls.splice(other->ls.end(), it->ls);
-                    other->isMerged = true;
-                    lines.erase(it);
-                    // if that makes a closed ring, returns it
-                    if (other->ls.front() == other->ls.back())
-                        emitLine_(levelIdx, other, /* closed */ true);
-                    break;
-                }
-                // two lists must be merged but one is in the opposite direction
-                else if (it->ls.back() == other->ls.back())
+                ls.pop_front();
+                it->ls.splice(it->ls.end(), ls);
+                break;
+            }
+            if (it->ls.front() == ls.back())
+            {
+                ls.pop_back();
+                it->ls.splice(it->ls.begin(), ls);
+                break;
+            }
+            if (it->ls.back() == ls.back())
+            {
+                ls.pop_back();
+                ls.reverse();
+                it->ls.splice(it->ls.end(), ls);
+                break;
+            }
+            if (it->ls.front() == ls.front())
+            {
+                ls.pop_front();
+                ls.reverse();
+                it->ls.splice(it->ls.begin(), ls);
+                break;
+            }
+        }
+
+        if (it == lines.end())
+        {
+            lines.push_back(LineStringEx());
+            lines.back().ls.swap(ls);
+            lines.back().isMerged = true;
+        }
+        else if (it->ls.front() == it->ls.back())
+        {
+            // ring closed
+            emitLine_(levelIdx, it, /* closed */ true);
+        }
+        else
+        {
+            // the linestring may join two lines. As in addSegment_(), there
+            // is no need to test lines before the first match.
+            it->isMerged = true;
+            mergeWithNextLines_(levelIdx, it);
+        }
+    }
+
+    // Merge the line "it" with a following line sharing one of its end
+    // points, if any.
+    void mergeWithNextLines_(int levelIdx, typename Lines::iterator it)
+    {
+        Lines &lines = lines_[levelIdx];
+        auto other = it;
+        ++other;
+        for (; other != lines.end(); ++other)
+        {
+            if (it->ls.back() == other->ls.front())
+            {
+                it->ls.pop_back();
+                it->ls.splice(it->ls.end(), other->ls);
+                it->isMerged = true;
+                lines.erase(other);
+                // if that makes a closed ring, returns it
+                if (it->ls.front() == it->ls.back())
+                    emitLine_(levelIdx, it, /* closed */ true);
+                break;
+            }
+            else if (other->ls.back() == it->ls.front())
+            {
+                it->ls.pop_front();
+                other->ls.splice(other->ls.end(), it->ls);
+                other->isMerged = true;
+                lines.erase(it);
+                // if that makes a closed ring, returns it
+                if (other->ls.front() == other->ls.back())
+                    emitLine_(levelIdx, other, /* closed */ true);
+                break;
+            }
+            // two lists must be merged but one is in the opposite direction
+            else if (it->ls.back() == other->ls.back())
+            {
+                it->ls.pop_back();
+                for (auto rit = other->ls.rbegin(); rit != other->ls.rend();
+                     ++rit)
                 {
-                    it->ls.pop_back();
-                    for (auto rit = other->ls.rbegin(); rit != other->ls.rend();
-                         ++rit)
-                    {
-                        it->ls.push_back(*rit);
-                    }
-                    it->isMerged = true;
-                    lines.erase(other);
-                    // if that makes a closed ring, returns it
-                    if (it->ls.front() == it->ls.back())
-                        emitLine_(levelIdx, it, /* closed */ true);
-                    break;
+                    it->ls.push_back(*rit);
                 }
-                else if (it->ls.front() == other->ls.front())
+                it->isMerged = true;
+                lines.erase(other);
+                // if that makes a closed ring, returns it
+                if (it->ls.front() == it->ls.back())
+                    emitLine_(levelIdx, it, /* closed */ true);
+                break;
+            }
+            else if (it->ls.front() == other->ls.front())
+            {
+                it->ls.pop_front();
+                for (auto rit = other->ls.begin(); rit != other->ls.end();
+                     ++rit)
                 {
-                    it->ls.pop_front();
-                    for (auto rit = other->ls.begin(); rit != other->ls.end();
-                         ++rit)
-                    {
-                        it->ls.push_front(*rit);
-                    }
-                    it->isMerged = true;
-                    lines.erase(other);
-                    // if that makes a closed ring, returns it
-                    if (it->ls.front() == it->ls.back())
-                        emitLine_(levelIdx, it, /* closed */ true);
-                    break;
+                    it->ls.push_front(*rit);
                 }
+                it->isMerged = true;
+                lines.erase(other);
+                // if that makes a closed ring, returns it
+                if (it->ls.front() == it->ls.back())
+                    emitLine_(levelIdx, it, /* closed */ true);
+                break;
             }
         }
     }
@@ -19,18 +19,24 @@
 #include <string.h>
 
 #include <algorithm>
+#include <atomic>
+#include <functional>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
 #include <utility>
 #include <vector>
 
 #include "gdal_alg_priv.h"
 #include "gdal.h"
+#include "gdal_thread_pool.h"
+#include "gdalstripprocessing.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
@@ -65,6 +71,697 @@ static CPLErr GPMaskImageData(GDALRasterBandH hMaskBand, GByte *pabyMaskLine,
     return CE_None;
 }
 
+/************************************************************************/
+/*                            GPLineReader                              */
+/************************************************************************/
+
+/** Reads lines of the source band, masked by the mask band, from several
+ * threads. Reads are serialized, unless the bands are thread-safe.
+ */
+struct GPLineReader
+{
+    GDALRasterBandH hSrcBand = nullptr;
+    GDALRasterBandH hMaskBand = nullptr;
+    GDALDataType eDT = GDT_Unknown;
+    std::mutex *poMutex = nullptr;
+
+    template <class DataType>
+    CPLErr ReadLine(int iY, int nXSize, DataType *panLineVal,
+                    GByte *pabyMaskLine) const
+    {
+        std::unique_lock<std::mutex> oLock;
+        if (poMutex)
+            oLock = std::unique_lock<std::mutex>(*poMutex);
+        CPLErr eErr = GDALRasterIO(hSrcBand, GF_Read, 0, iY, nXSize, 1,
+                                   panLineVal, nXSize, 1, eDT, 0, 0);
+        if (eErr == CE_None && hMaskBand != nullptr)
+            eErr = GPMaskImageData(hMaskBand, pabyMaskLine, iY, nXSize,
+                                   panLineVal);
+        return eErr;
+    }
+};
+
+/************************************************************************/
+/*                         GDALPolygonizeMT                             */
+/************************************************************************/
+
+/** Multi-threaded polygonization.
+ *
+ * The raster is split into horizontal strips of consecutive lines.
+ *
+ * In the first pass, polygon ids of each strip are enumerated independently
+ * by worker threads. The fragments of each strip are then given a global id,
+ * and fragments touching each other across strip boundaries are merged, by
+ * applying the same merging rules as GDALRasterPolygonEnumeratorT::
+ * ProcessLine() does between two consecutive lines. The result is the same
+ * partition of pixels into polygons as the one of the single-threaded pass.
+ *
+ * In the second pass, the edges of each strip are traced independently, with
+ * the global polygon ids. The geometry of a polygon only depends on the ids
+ * of the lines between the one above its first line and the one below its
+ * last line, so a strip job emits exactly the same geometry as the
+ * single-threaded pass for polygons that are fully inside the strip.
+ * Polygons that touch the first line of a strip (except the first strip)
+ * are emitted by stitching jobs, which trace the range of lines they span,
+ * and only emit them.
+ *
+ * Output features are written in the order of jobs, which does not depend
+ * on thread scheduling, but differs from the order of the single-threaded
+ * pass.
+ */
+template <class DataType, class EqualityTest> class GDALPolygonizeMT
+{
+    using PolygonizerType = Polygonizer<GInt32, DataType>;
+
+    const GPLineReader &m_oReader;
+    const int m_nXSize;
+    const int m_nYSize;
+    const int m_nConnectedness;
+    const int m_nStripHeight;
+    const int m_nStrips;
+    const GDALGeoTransform m_gt;
+
+    //! Global id of the first fragment of each strip
+    std::vector<GInt32> m_anStripBaseId{};
+    //! Final global polygon id of each global fragment id
+    std::vector<GInt32> m_anGlobalIdMap{};
+    //! First and last line of each polygon, indexed by final global id
+    std::vector<int> m_anMinRow{};
+    std::vector<int> m_anMaxRow{};
+
+    std::atomic<bool> m_bError{false};
+    std::atomic<bool> m_bStop{false};
+
+    struct StripEnum
+    {
+        std::vector<GInt32> anIdMap{};
+        std::vector<int> anMinRow{};
+        std::vector<int> anMaxRow{};
+        std::vector<DataType> anFirstLineVal{};
+        std::vector<GInt32> anFirstLineId{};
+        std::vector<DataType> anLastLineVal{};
+        std::vector<GInt32> anLastLineId{};
+    };
+
+    int GetStripStart(int iStrip) const
+    {
+        return iStrip * m_nStripHeight;
+    }
+
+    int GetStripEnd(int iStrip) const
+    {
+        return std::min(m_nYSize, (iStrip + 1) * m_nStripHeight);
+    }
+
+    GInt32 FindGlobalId(GInt32 nId)
+    {
+        while (m_anGlobalIdMap[nId] != nId)
+        {
+            m_anGlobalIdMap[nId] = m_anGlobalIdMap[m_anGlobalIdMap[nId]];
+            nId = m_anGlobalIdMap[nId];
+        }
+        return nId;
+    }
+
+    void MergeGlobalIds(GInt32 nSrcId, GInt32 nDstId)
+    {
+        if (nSrcId < 0 || nDstId < 0)
+            return;
+        nSrcId = FindGlobalId(nSrcId);
+        nDstId = FindGlobalId(nDstId);
+        if (nSrcId != nDstId)
+            m_anGlobalIdMap[nSrcId] = nDstId;
+    }
+
+    /** Return the index of the stitching job that emits a polygon, or 0 if
+     * it is emitted by a strip job. */
+    int GetStitchingGroup(GInt32 nId) const
+    {
+        const int nMinRow = m_anMinRow[nId];
+        const int iStrip =
+            std::max(1, (nMinRow + m_nStripHeight - 1) / m_nStripHeight);
+        if (iStrip < m_nStrips && GetStripStart(iStrip) <= m_anMaxRow[nId])
+            return iStrip;
+        return 0;
+    }
+
+    bool EnumerateStrip(int iStrip, StripEnum &oStrip);
+    void MergeStrips(const StripEnum &oAbove, const StripEnum &oBelow,
+                     GInt32 nAboveBaseId, GInt32 nBelowBaseId);
+    bool TraceLines(int nFirstTracedLine, int nEndLine,
+                    const typename PolygonizerType::PolygonFilter &oFilter,
+                    OGRPolygonCollector<DataType> &oCollector);
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALPolygonizeMT)
+
+  public:
+    GDALPolygonizeMT(const GPLineReader &oReader, int nXSize, int nYSize,
+                     int nConnectedness, int nStripHeight,
+                     const GDALGeoTransform &gt)
+        : m_oReader(oReader), m_nXSize(nXSize), m_nYSize(nYSize),
+          m_nConnectedness(nConnectedness), m_nStripHeight(nStripHeight),
+          m_nStrips((nYSize + nStripHeight - 1) / nStripHeight), m_gt(gt)
+    {
+    }
+
+    CPLErr Run(CPLWorkerThreadPool *poThreadPool,
+               OGRPolygonWriter<DataType> &oPolygonWriter,
+               GDALProgressFunc pfnProgress, void *pProgressArg);
+};
+
+/************************************************************************/
+/*                 GDALPolygonizeMT::EnumerateStrip()                   */
+/************************************************************************/
+
+/** First pass on a strip: enumerate its polygon fragments, and record the
+ * lines they span, as well as the first and last lines of the strip. */
+template <class DataType, class EqualityTest>
+bool GDALPolygonizeMT<DataType, EqualityTest>::EnumerateStrip(
+    int iStrip, StripEnum &oStrip)
+{
+    GDALRasterPolygonEnumeratorT<DataType, EqualityTest> oEnum(
+        m_nConnectedness);
+
+    std::vector<DataType> anLastLineVal(m_nXSize);
+    std::vector<DataType> anThisLineVal(m_nXSize);
+    std::vector<GInt32> anLastLineId(m_nXSize);
+    std::vector<GInt32> anThisLineId(m_nXSize);
+    std::vector<GByte> abyMaskLine(m_nXSize);
+
+    const int nStartLine = GetStripStart(iStrip);
+    const int nEndLine = GetStripEnd(iStrip);
+    for (int iY = nStartLine; iY < nEndLine; ++iY)
+    {
+        if (m_bError || m_bStop)
+            return false;
+        if (m_oReader.ReadLine(iY, m_nXSize, anThisLineVal.data(),
+                               abyMaskLine.data()) != CE_None)
+            return false;
+
+        if (!oEnum.ProcessLine(iY == nStartLine ? nullptr
+                                                : anLastLineVal.data(),
+                               anThisLineVal.data(),
+                               iY == nStartLine ? nullptr : anLastLineId.data(),
+                               anThisLineId.data(), m_nXSize))
+            return false;
+
+        oStrip.anMinRow.resize(oEnum.nNextPolygonId,
+                               std::numeric_limits<int>::max());
+        oStrip.anMaxRow.resize(oEnum.nNextPolygonId, -1);
+        for (int iX = 0; iX < m_nXSize; ++iX)
+        {
+            const GInt32 nId = anThisLineId[iX];
+            if (nId >= 0 && (iX == 0 || nId != anThisLineId[iX - 1]))
+            {
+                oStrip.anMinRow[nId] = std::min(oStrip.anMinRow[nId], iY);
+                oStrip.anMaxRow[nId] = iY;
+            }
+        }
+
+        if (iY == nStartLine)
+        {
+            oStrip.anFirstLineVal = anThisLineVal;
+            oStrip.anFirstLineId = anThisLineId;
+        }
+
+        std::swap(anLastLineVal, anThisLineVal);
+        std::swap(anLastLineId, anThisLineId);
+    }
+
+    oEnum.CompleteMerges();
+    oStrip.anIdMap.assign(oEnum.panPolyIdMap,
+                          oEnum.panPolyIdMap + oEnum.nNextPolygonId);
+    oStrip.anLastLineVal = std::move(anLastLineVal);
+    oStrip.anLastLineId = std::move(anLastLineId);
+    return true;
+}
+
+/************************************************************************/
+/*                   GDALPolygonizeMT::MergeStrips()                    */
+/************************************************************************/
+
+/** Merge the global ids of the fragments of the last line of a strip with
+ * the ones of the first line of the next strip, with the same rules as
+ * GDALRasterPolygonEnumeratorT::ProcessLine(). */
+template <class DataType, class EqualityTest>
+void GDALPolygonizeMT<DataType, EqualityTest>::MergeStrips(
+    const StripEnum &oAbove, const StripEnum &oBelow, GInt32 nAboveBaseId,
+    GInt32 nBelowBaseId)
+{
+    EqualityTest eq;
+
+    const auto &anLastLineVal = oAbove.anLastLineVal;
+    const auto &anThisLineVal = oBelow.anFirstLineVal;
+    const auto LastLineId = [&oAbove, nAboveBaseId](int iX)
+    {
+        const GInt32 nId = oAbove.anLastLineId[iX];
+        return nId < 0 ? -1 : nAboveBaseId + nId;
+    };
+    const auto ThisLineId = [&oBelow, nBelowBaseId](int iX)
+    {
+        const GInt32 nId = oBelow.anFirstLineId[iX];
+        return nId < 0 ? -1 : nBelowBaseId + nId;
+    };
+
+    for (int i = 0; i < m_nXSize; i++)
+    {
+        if (anThisLineVal[i] == GP_NODATA_MARKER)
+        {
+            continue;
+        }
+        else if (i > 0 && eq(anThisLineVal[i], anThisLineVal[i - 1]))
+        {
+            if (eq(anLastLineVal[i], anThisLineVal[i]))
+                MergeGlobalIds(LastLineId(i), ThisLineId(i));
+
+            if (m_nConnectedness == 8 &&
+                eq(anLastLineVal[i - 1], anThisLineVal[i]))
+                MergeGlobalIds(LastLineId(i - 1), ThisLineId(i));
+
+            if (m_nConnectedness == 8 && i < m_nXSize - 1 &&
+                eq(anLastLineVal[i + 1], anThisLineVal[i]))
+                MergeGlobalIds(LastLineId(i + 1), ThisLineId(i));
+        }
+        else if (eq(anLastLineVal[i], anThisLineVal[i]))
+        {
+            MergeGlobalIds(LastLineId(i), ThisLineId(i));
+        }
+        else if (i > 0 && m_nConnectedness == 8 &&
+                 eq(anLastLineVal[i - 1], anThisLineVal[i]))
+        {
+            MergeGlobalIds(LastLineId(i - 1), ThisLineId(i));
+
+            if (i < m_nXSize - 1 && eq(anLastLineVal[i + 1], anThisLineVal[i]))
+                MergeGlobalIds(LastLineId(i + 1), ThisLineId(i));
+        }
+        else if (i < m_nXSize - 1 && m_nConnectedness == 8 &&
+                 eq(anLastLineVal[i + 1], anThisLineVal[i]))
+        {
+            MergeGlobalIds(LastLineId(i + 1), ThisLineId(i));
+        }
+    }
+}
+
+/************************************************************************/
+/*                   GDALPolygonizeMT::TraceLines()                     */
+/************************************************************************/
+
+/** Second pass: trace the edges of polygons from line nFirstTracedLine to
+ * line nEndLine (which is the line below the last traced line, or
+ * m_nYSize), and emit completed polygons accepted by oFilter.
+ *
+ * Global ids are obtained by enumerating again lines from the start of the
+ * strip of nFirstTracedLine, which gives the same fragment ids as in the
+ * first pass.
+ */
+template <class DataType, class EqualityTest>
+bool GDALPolygonizeMT<DataType, EqualityTest>::TraceLines(
+    int nFirstTracedLine, int nEndLine,
+    const typename PolygonizerType::PolygonFilter &oFilter,
+    OGRPolygonCollector<DataType> &oCollector)
+{
+    GDALRasterPolygonEnumeratorT<DataType, EqualityTest> oEnum(
+        m_nConnectedness);
+
+    PolygonizerType oPolygonizer{-1, &oCollector};
+    oPolygonizer.setPolygonFilter(oFilter);
+
+    std::vector<DataType> anLastLineVal(m_nXSize);
+    std::vector<DataType> anThisLineVal(m_nXSize);
+    std::vector<GInt32> anLastLineId(m_nXSize);
+    std::vector<GInt32> anThisLineId(m_nXSize);
+    std::vector<GInt32> anThisLineGlobalId(m_nXSize);
+    std::vector<GByte> abyMaskLine(m_nXSize);
+    std::vector<TwoArm> aoLastLineArm(m_nXSize + 2);
+    std::vector<TwoArm> aoThisLineArm(m_nXSize + 2);
+    for (auto &oArm : aoLastLineArm)
+        oArm.poPolyInside = oPolygonizer.getTheOuterPolygon();
+
+    int iStrip = nFirstTracedLine / m_nStripHeight;
+    for (int iY = GetStripStart(iStrip); iY <= nEndLine; ++iY)
+    {
+        if (m_bError || m_bStop)
+            return false;
+
+        if (iY == m_nYSize)
+        {
+            std::fill(anThisLineGlobalId.begin(), anThisLineGlobalId.end(),
+                      PolygonizerType::THE_OUTER_POLYGON_ID);
+        }
+        else
+        {
+            if (m_oReader.ReadLine(iY, m_nXSize, anThisLineVal.data(),
+                                   abyMaskLine.data()) != CE_None)
+                return false;
+
+            const bool bFirstLineOfStrip = (iY % m_nStripHeight) == 0;
+            if (bFirstLineOfStrip)
+            {
+                iStrip = iY / m_nStripHeight;
+                oEnum.Clear();
+            }
+            if (!oEnum.ProcessLine(
+                    bFirstLineOfStrip ? nullptr : anLastLineVal.data(),
+                    anThisLineVal.data(),
+                    bFirstLineOfStrip ? nullptr : anLastLineId.data(),
+                    anThisLineId.data(), m_nXSize))
+                return false;
+
+            const GInt32 *panIdMap =
+                m_anGlobalIdMap.data() + m_anStripBaseId[iStrip];
+            for (int iX = 0; iX < m_nXSize; ++iX)
+            {
+                const GInt32 nId = anThisLineId[iX];
+                anThisLineGlobalId[iX] = nId < 0 ? -1 : panIdMap[nId];
+            }
+        }
+
+        if (iY >= nFirstTracedLine)
+        {
+            if (!oPolygonizer.processLine(
+                    anThisLineGlobalId.data(), anLastLineVal.data(),
+                    aoThisLineArm.data(), aoLastLineArm.data(), iY, m_nXSize))
+                return false;
+            if (oCollector.getErr() != CE_None)
+                return false;
+            std::swap(aoThisLineArm, aoLastLineArm);
+        }
+
+        std::swap(anLastLineVal, anThisLineVal);
+        std::swap(anLastLineId, anThisLineId);
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                      GDALPolygonizeMT::Run()                         */
+/************************************************************************/
+
+template <class DataType, class EqualityTest>
+CPLErr GDALPolygonizeMT<DataType, EqualityTest>::Run(
+    CPLWorkerThreadPool *poThreadPool,
+    OGRPolygonWriter<DataType> &oPolygonWriter, GDALProgressFunc pfnProgress,
+    void *pProgressArg)
+{
+    CPLErrorAccumulator oErrorAccumulator;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+
+    const auto SubmitJob = [this, &poJobQueue, &oErrorAccumulator](
+                               std::function<bool()> oTask,
+                               std::atomic<bool> *pbDone)
+    {
+        const auto Job = [this, &oErrorAccumulator, oTask, pbDone]()
+        {
+            auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+            try
+            {
+                if (!m_bError && !m_bStop && !oTask())
+                    m_bError = true;
+            }
+            catch (const std::bad_alloc &)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory,
+                         "Out of memory in GDALPolygonize()");
+                m_bError = true;
+            }
+            *pbDone = true;
+        };
+        if (!poJobQueue->SubmitJob(Job))
+        {
+            m_bError = true;
+            *pbDone = true;
+        }
+    };
+
+    const auto Finish = [this, &poJobQueue, &oErrorAccumulator]()
+    {
+        poJobQueue->WaitCompletion();
+        oErrorAccumulator.ReplayErrors();
+        if (m_bStop)
+        {
+            CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+            return CE_Failure;
+        }
+        return m_bError ? CE_Failure : CE_None;
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      First pass: enumerate the polygon fragments of each strip.      */
+    /* -------------------------------------------------------------------- */
+    std::vector<StripEnum> aoStrips(m_nStrips);
+    {
+        std::vector<std::atomic<bool>> abDone(m_nStrips);
+        for (int iStrip = 0; iStrip < m_nStrips; ++iStrip)
+        {
+            SubmitJob([this, iStrip, &aoStrips]()
+                      { return EnumerateStrip(iStrip, aoStrips[iStrip]); },
+                      &abDone[iStrip]);
+        }
+        while (poJobQueue->WaitEvent())
+        {
+            int nDone = 0;
+            for (int iStrip = 0; iStrip < m_nStrips; ++iStrip)
+                nDone += abDone[iStrip] ? 1 : 0;
+            if (!m_bStop &&
+                !pfnProgress(0.10 * nDone / m_nStrips, "", pProgressArg))
+                m_bStop = true;
+        }
+        if (Finish() != CE_None)
+            return CE_Failure;
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Assign global ids to fragments, and merge them across strip     */
+    /*      boundaries.                                                     */
+    /* -------------------------------------------------------------------- */
+    m_anStripBaseId.resize(m_nStrips + 1);
+    GIntBig nTotalFragments = 0;
+    for (int iStrip = 0; iStrip < m_nStrips; ++iStrip)
+    {
+        m_anStripBaseId[iStrip] = static_cast<GInt32>(nTotalFragments);
+        nTotalFragments += aoStrips[iStrip].anIdMap.size();
+        // THE_OUTER_POLYGON_ID is reserved
+        if (nTotalFragments >= PolygonizerType::THE_OUTER_POLYGON_ID)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "GDALPolygonize(): maximum number of polygons reached");
+            return CE_Failure;
+        }
+    }
+    m_anStripBaseId[m_nStrips] = static_cast<GInt32>(nTotalFragments);
+
+    m_anGlobalIdMap.resize(static_cast<size_t>(nTotalFragments));
+    m_anMinRow.resize(static_cast<size_t>(nTotalFragments));
+    m_anMaxRow.resize(static_cast<size_t>(nTotalFragments));
+    for (int iStrip = 0; iStrip < m_nStrips; ++iStrip)
+    {
+        const auto &oStrip = aoStrips[iStrip];
+        const GInt32 nBaseId = m_anStripBaseId[iStrip];
+        for (size_t i = 0; i < oStrip.anIdMap.size(); ++i)
+        {
+            m_anGlobalIdMap[nBaseId + i] = nBaseId + oStrip.anIdMap[i];
+            m_anMinRow[nBaseId + i] = oStrip.anMinRow[i];
+            m_anMaxRow[nBaseId + i] = oStrip.anMaxRow[i];
+        }
+    }
+    for (int iStrip = 1; iStrip < m_nStrips; ++iStrip)
+    {
+        MergeStrips(aoStrips[iStrip - 1], aoStrips[iStrip],
+                    m_anStripBaseId[iStrip - 1], m_anStripBaseId[iStrip]);
+    }
+    aoStrips.clear();
+
+    for (GInt32 nId = 0; nId < static_cast<GInt32>(nTotalFragments); ++nId)
+    {
+        const GInt32 nFinalId = FindGlobalId(nId);
+        m_anGlobalIdMap[nId] = nFinalId;
+        m_anMinRow[nFinalId] = std::min(m_anMinRow[nFinalId], m_anMinRow[nId]);
+        m_anMaxRow[nFinalId] = std::max(m_anMaxRow[nFinalId], m_anMaxRow[nId]);
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Determine the lines spanned by the polygons of each stitching   */
+    /*      job.                                                            */
+    /* -------------------------------------------------------------------- */
+    std::vector<int> anStitchMinRow(m_nStrips, std::numeric_limits<int>::max());
+    std::vector<int> anStitchMaxRow(m_nStrips, -1);
+    for (GInt32 nId = 0; nId < static_cast<GInt32>(nTotalFragments); ++nId)
+    {
+        if (m_anGlobalIdMap[nId] == nId)
+        {
+            const int iGroup = GetStitchingGroup(nId);
+            if (iGroup > 0)
+            {
+                anStitchMinRow[iGroup] =
+                    std::min(anStitchMinRow[iGroup], m_anMinRow[nId]);
+                anStitchMaxRow[iGroup] =
+                    std::max(anStitchMaxRow[iGroup], m_anMaxRow[nId]);
+            }
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Second pass: trace strips, and then polygons spanning several   */
+    /*      strips.                                                         */
+    /* -------------------------------------------------------------------- */
+    struct TraceJob
+    {
+        int nFirstTracedLine = 0;
+        int nEndLine = 0;
+        typename PolygonizerType::PolygonFilter oFilter{};
+        std::unique_ptr<OGRPolygonCollector<DataType>> poCollector{};
+    };
+
+    std::vector<TraceJob> aoJobs;
+    for (int iStrip = 0; iStrip < m_nStrips; ++iStrip)
+    {
+        TraceJob oJob;
+        oJob.nFirstTracedLine = GetStripStart(iStrip);
+        oJob.nEndLine = GetStripEnd(iStrip);
+        if (iStrip > 0)
+        {
+            const int nStartLine = oJob.nFirstTracedLine;
+            oJob.oFilter = [this, nStartLine](GInt32 nId)
+            { return m_anMinRow[nId] > nStartLine; };
+        }
+        aoJobs.push_back(std::move(oJob));
+    }
+    for (int iGroup = 1; iGroup < m_nStrips; ++iGroup)
+    {
+        if (anStitchMaxRow[iGroup] < 0)
+            continue;
+        TraceJob oJob;
+        // Start tracing on the line above the first line of the polygons, so
+        // that the fake outer polygon above that line does not alter them.
+        oJob.nFirstTracedLine = std::max(0, anStitchMinRow[iGroup] - 1);
+        oJob.nEndLine = anStitchMaxRow[iGroup] + 1;
+        oJob.oFilter = [this, iGroup](GInt32 nId)
+        { return GetStitchingGroup(nId) == iGroup; };
+        aoJobs.push_back(std::move(oJob));
+    }
+    CPLDebug("GDALPolygonize", "%d strips, %d stitching jobs", m_nStrips,
+             static_cast<int>(aoJobs.size()) - m_nStrips);
+
+    // Polygons collected by a job are kept in memory until they are written,
+    // so limit the number of jobs being processed or waiting to be written.
+    const size_t nMaxJobsInFlight =
+        2 * static_cast<size_t>(poThreadPool->GetThreadCount());
+    std::vector<std::atomic<bool>> abJobDone(aoJobs.size());
+    size_t iNextSubmittedJob = 0;
+    const auto SubmitTraceJobs = [&](size_t nEndJob)
+    {
+        for (; iNextSubmittedJob < std::min(nEndJob, aoJobs.size());
+             ++iNextSubmittedJob)
+        {
+            TraceJob *poJob = &aoJobs[iNextSubmittedJob];
+            poJob->poCollector =
+                std::make_unique<OGRPolygonCollector<DataType>>(m_gt);
+            SubmitJob(
+                [this, poJob]()
+                {
+                    return TraceLines(poJob->nFirstTracedLine,
+                                      poJob->nEndLine, poJob->oFilter,
+                                      *(poJob->poCollector));
+                },
+                &abJobDone[iNextSubmittedJob]);
+        }
+    };
+
+    // Write polygons in the order of jobs, as soon as they are available.
+    size_t iNextJob = 0;
+    SubmitTraceJobs(nMaxJobsInFlight);
+    while (iNextJob < aoJobs.size() && !m_bError && !m_bStop)
+    {
+        if (!abJobDone[iNextJob])
+        {
+            poJobQueue->WaitEvent();
+            continue;
+        }
+        auto &oJob = aoJobs[iNextJob];
+        for (auto &oPolygon : oJob.poCollector->getPolygons())
+        {
+            oPolygonWriter.writePolygon(std::move(oPolygon.first),
+                                        oPolygon.second);
+            if (oPolygonWriter.getErr() != CE_None)
+            {
+                m_bError = true;
+                break;
+            }
+        }
+        oJob.poCollector.reset();
+        ++iNextJob;
+        SubmitTraceJobs(iNextJob + nMaxJobsInFlight);
+
+        if (!m_bStop &&
+            !pfnProgress(0.10 + 0.90 * static_cast<double>(iNextJob) /
+                                    static_cast<double>(aoJobs.size()),
+                         "", pProgressArg))
+        {
+            m_bStop = true;
+        }
+    }
+
+    return Finish();
+}
+
+/************************************************************************/
+/*                   GDALPolygonizeMultiThreadedT()                     */
+/************************************************************************/
+
+template <class DataType, class EqualityTest>
+static CPLErr GDALPolygonizeMultiThreadedT(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hMaskBand, OGRLayerH hOutLayer,
+    int iPixValField, CSLConstList papszOptions, GDALProgressFunc pfnProgress,
+    void *pProgressArg, GDALDataType eDT, int nThreads, int nStripHeight,
+    const GDALGeoTransform &gt)
+{
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return CE_Failure;
+
+    /* -------------------------------------------------------------------- */
+    /*      Use thread-safe instances of the bands if possible. Otherwise   */
+    /*      reads of the bands are serialized.                              */
+    /* -------------------------------------------------------------------- */
+    GDALThreadSafeSourceBands oSourceBands(hSrcBand, hMaskBand,
+                                           "GDALPolygonize");
+    GPLineReader oReader;
+    oReader.hSrcBand = oSourceBands.GetSrcBand();
+    oReader.hMaskBand = oSourceBands.GetMaskBand();
+    oReader.eDT = eDT;
+    oReader.poMutex = oSourceBands.GetMutex();
+
+    OGRPolygonWriter<DataType> oPolygonWriter{
+        hOutLayer, iPixValField, gt,
+        atoi(CSLFetchNameValueDef(papszOptions, "COMMIT_INTERVAL", "100000"))};
+
+    const int nConnectedness =
+        CSLFetchNameValue(papszOptions, "8CONNECTED") ? 8 : 4;
+    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+
+    CPLErr eErr = CE_None;
+    try
+    {
+        GDALPolygonizeMT<DataType, EqualityTest> oPolygonizeMT(
+            oReader, GDALGetRasterBandXSize(hSrcBand), nYSize, nConnectedness,
+            nStripHeight, gt);
+        eErr = oPolygonizeMT.Run(poThreadPool, oPolygonWriter, pfnProgress,
+                                 pProgressArg);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in GDALPolygonize()");
+        eErr = CE_Failure;
+    }
+
+    if (!oPolygonWriter.Finalize())
+        eErr = CE_Failure;
+
+    return eErr;
+}
+
 /************************************************************************/
 /*                           GDALPolygonizeT()                          */
 /************************************************************************/
@@ -97,9 +794,6 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
         return CE_Failure;
     }
 
-    /* -------------------------------------------------------------------- */
-    /*      Allocate working buffers.                                       */
-    /* -------------------------------------------------------------------- */
     const int nXSize = GDALGetRasterBandXSize(hSrcBand);
     const int nYSize = GDALGetRasterBandYSize(hSrcBand);
     if (nXSize > std::numeric_limits<int>::max() - 2)
@@ -108,29 +802,6 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
         return CE_Failure;
     }
 
-    DataType *panLastLineVal =
-        static_cast<DataType *>(VSI_MALLOC2_VERBOSE(sizeof(DataType), nXSize));
-    DataType *panThisLineVal =
-        static_cast<DataType *>(VSI_MALLOC2_VERBOSE(sizeof(DataType), nXSize));
-    GInt32 *panLastLineId =
-        static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize));
-    GInt32 *panThisLineId =
-        static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize));
-
-    GByte *pabyMaskLine = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nXSize));
-
-    if (panLastLineVal == nullptr || panThisLineVal == nullptr ||
-        panLastLineId == nullptr || panThisLineId == nullptr ||
-        pabyMaskLine == nullptr)
-    {
-        CPLFree(panThisLineId);
-        CPLFree(panLastLineId);
-        CPLFree(panThisLineVal);
-        CPLFree(panLastLineVal);
-        CPLFree(pabyMaskLine);
-        return CE_Failure;
-    }
-
     /* -------------------------------------------------------------------- */
     /*      Get the geotransform, if there is one, so we can convert the    */
     /*      vectors into georeferenced coordinates.                         */
@@ -161,6 +832,49 @@ static CPLErr GDALPolygonizeT(GDALRasterBandH hSrcBand,
         gt = GDALGeoTransform();
     }
 
+    /* -------------------------------------------------------------------- */
+    /*      Use the multi-threaded implementation if several threads are    */
+    /*      requested, and the raster is tall enough.                       */
+    /* -------------------------------------------------------------------- */
+    const int nThreads = GDALGetNumThreads(papszOptions, "NUM_THREADS");
+    if (nThreads > 1)
+    {
+        const int nStripHeight = GDALGetProcessingStripHeight(
+            nXSize, nYSize, nThreads, "GDAL_POLYGONIZE_MIN_STRIP_HEIGHT");
+        if (nYSize > nStripHeight)
+        {
+            return GDALPolygonizeMultiThreadedT<DataType, EqualityTest>(
+                hSrcBand, hMaskBand, hOutLayer, iPixValField, papszOptions,
+                pfnProgress, pProgressArg, eDT, nThreads, nStripHeight, gt);
+        }
+    }
+
+    /* -------------------------------------------------------------------- */
+    /*      Allocate working buffers.                                       */
+    /* -------------------------------------------------------------------- */
+    DataType *panLastLineVal =
+        static_cast<DataType *>(VSI_MALLOC2_VERBOSE(sizeof(DataType), nXSize));
+    DataType *panThisLineVal =
+        static_cast<DataType *>(VSI_MALLOC2_VERBOSE(sizeof(DataType), nXSize));
+    GInt32 *panLastLineId =
+        static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize));
+    GInt32 *panThisLineId =
+        static_cast<GInt32 *>(VSI_MALLOC2_VERBOSE(sizeof(GInt32), nXSize));
+
+    GByte *pabyMaskLine = static_cast<GByte *>(VSI_MALLOC_VERBOSE(nXSize));
+
+    if (panLastLineVal == nullptr || panThisLineVal == nullptr ||
+        panLastLineId == nullptr || panThisLineId == nullptr ||
+        pabyMaskLine == nullptr)
+    {
+        CPLFree(panThisLineId);
+        CPLFree(panLastLineId);
+        CPLFree(panThisLineVal);
+        CPLFree(panLastLineVal);
+        CPLFree(pabyMaskLine);
+        return CE_Failure;
+    }
+
     /* -------------------------------------------------------------------- */
     /*      The first pass over the raster is only used to build up the     */
     /*      polygon id map so we will know in advance what polygons are     */
@@ -496,6 +1210,12 @@ GBool GDALFloatEquals(float A, float B)
  * The function takes care of issuing the starting transaction and committing
  * the final one.
  * </li>
+ * <li>NUM_THREADS=num|ALL_CPUS: (GDAL >= 3.12) Number of threads to use.
+ * Defaults to the value of the GDAL_NUM_THREADS configuration option, or 1.
+ * When several threads are used, the raster is split into horizontal strips
+ * that are processed in parallel. Output geometries are the same as with a
+ * single thread, but features are written in a different order.
+ * </li>
  * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
@@ -578,6 +1298,12 @@ CPLErr CPL_STDCALL GDALPolygonize(GDALRasterBandH hSrcBand,
  * The function takes care of issuing the starting transaction and committing
  * the final one.
  * </li>
+ * <li>NUM_THREADS=num|ALL_CPUS: (GDAL >= 3.12) Number of threads to use.
+ * Defaults to the value of the GDAL_NUM_THREADS configuration option, or 1.
+ * When several threads are used, the raster is split into horizontal strips
+ * that are processed in parallel. Output geometries are the same as with a
+ * single thread, but features are written in a different order.
+ * </li>
  * </ul>
  * @param pfnProgress callback for reporting algorithm progress matching the
  * GDALProgressFunc() semantics.  May be NULL.
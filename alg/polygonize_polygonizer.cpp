@@ -423,7 +423,8 @@ bool Polygonizer<PolyIdType, DataType>::processLine(
             RPolygon *poPolygon = entry.second;
 
             // emit valid polygon only
-            if (nPolyId != nInvalidPolyId_)
+            if (nPolyId != nInvalidPolyId_ &&
+                (!oPolygonFilter_ || oPolygonFilter_(nPolyId)))
             {
                 poPolygonReceiver_->receive(
                     poPolygon, panLastLineVal[poPolygon->iBottomRightCol]);
@@ -482,26 +483,25 @@ template <typename DataType> bool OGRPolygonWriter<DataType>::Finalize()
     return true;
 }
 
-template <typename DataType>
-void OGRPolygonWriter<DataType>::receive(RPolygon *poPolygon,
-                                         DataType nPolygonCellValue)
+bool BuildOGRPolygon(const RPolygon *poPolygon, const GDALGeoTransform &gt,
+                     OGRPolygon *poOGRPolygon)
 {
     std::vector<bool> oAccessedArc(poPolygon->oArcs.size(), false);
 
-    OGRLinearRing *poFirstRing = poPolygon_->getExteriorRing();
-    if (poFirstRing && poPolygon_->getNumInteriorRings() == 0)
+    OGRLinearRing *poFirstRing = poOGRPolygon->getExteriorRing();
+    if (poFirstRing && poOGRPolygon->getNumInteriorRings() == 0)
     {
         poFirstRing->empty();
     }
     else
     {
         poFirstRing = nullptr;
-        poPolygon_->empty();
+        poOGRPolygon->empty();
     }
 
     auto AddRingToPolygon =
-        [this, &poPolygon, &oAccessedArc](std::size_t iFirstArcIndex,
-                                          OGRLinearRing *poRing)
+        [&gt, poPolygon, poOGRPolygon,
+         &oAccessedArc](std::size_t iFirstArcIndex, OGRLinearRing *poRing)
     {
         std::unique_ptr<OGRLinearRing> poNewRing;
         if (!poRing)
@@ -510,7 +510,7 @@ void OGRPolygonWriter<DataType>::receive(RPolygon *poPolygon,
             poRing = poNewRing.get();
         }
 
-        auto AddArcToRing = [this, &poPolygon, poRing](std::size_t iArcIndex)
+        auto AddArcToRing = [&gt, poPolygon, poRing](std::size_t iArcIndex)
         {
             const auto &oArc = poPolygon->oArcs[iArcIndex];
             const bool bArcFollowRighthand = oArc.bFollowRighthand;
@@ -529,7 +529,7 @@ void OGRPolygonWriter<DataType>::receive(RPolygon *poPolygon,
                                       ? i
                                       : (nArcPointCount - i - 1)];
 
-                const auto oGeoreferenced = gt_.Apply(oPixel[1], oPixel[0]);
+                const auto oGeoreferenced = gt.Apply(oPixel[1], oPixel[0]);
                 poRing->setPoint(nDstPointIdx, oGeoreferenced.first,
                                  oGeoreferenced.second);
                 ++nDstPointIdx;
@@ -560,7 +560,7 @@ void OGRPolygonWriter<DataType>::receive(RPolygon *poPolygon,
         poRing->closeRings();
 
         if (poNewRing)
-            poPolygon_->addRingDirectly(poNewRing.release());
+            poOGRPolygon->addRingDirectly(poNewRing.release());
         return true;
     };
 
@@ -570,13 +570,60 @@ void OGRPolygonWriter<DataType>::receive(RPolygon *poPolygon,
         {
             if (!AddRingToPolygon(i, poFirstRing))
             {
-                eErr_ = CE_Failure;
-                return;
+                return false;
             }
             poFirstRing = nullptr;
         }
     }
+    return true;
+}
+
+template <typename DataType>
+void OGRPolygonCollector<DataType>::receive(RPolygon *poPolygon,
+                                            DataType nPolygonCellValue)
+{
+    try
+    {
+        auto poOGRPolygon = std::make_unique<OGRPolygon>();
+        if (!BuildOGRPolygon(poPolygon, gt_, poOGRPolygon.get()))
+        {
+            eErr_ = CE_Failure;
+            return;
+        }
+        aoPolygons_.emplace_back(std::move(poOGRPolygon), nPolygonCellValue);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in OGRPolygonCollector::receive");
+        eErr_ = CE_Failure;
+    }
+}
+
+template <typename DataType>
+void OGRPolygonWriter<DataType>::receive(RPolygon *poPolygon,
+                                         DataType nPolygonCellValue)
+{
+    if (!BuildOGRPolygon(poPolygon, gt_, poPolygon_))
+    {
+        eErr_ = CE_Failure;
+        return;
+    }
+    writeFeature(nPolygonCellValue);
+}
 
+template <typename DataType>
+void OGRPolygonWriter<DataType>::writePolygon(
+    std::unique_ptr<OGRPolygon> poPolygon, DataType nPolygonCellValue)
+{
+    poPolygon_ = poPolygon.release();
+    poFeature_->SetGeometryDirectly(poPolygon_);
+    writeFeature(nPolygonCellValue);
+}
+
+template <typename DataType>
+void OGRPolygonWriter<DataType>::writeFeature(DataType nPolygonCellValue)
+{
     // Create the feature object
     poFeature_->SetFID(OGRNullFID);
     if (iPixValField_ >= 0)
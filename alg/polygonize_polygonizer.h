@@ -19,9 +19,12 @@
 
 #include <array>
 #include <cstdint>
+#include <functional>
 #include <vector>
 #include <limits>
 #include <map>
+#include <memory>
+#include <utility>
 
 #include "cpl_error.h"
 #include "ogr_api.h"
@@ -139,6 +142,12 @@ template <typename PolyIdType, typename DataType> class Polygonizer
     static constexpr PolyIdType THE_OUTER_POLYGON_ID =
         std::numeric_limits<PolyIdType>::max();
 
+    /**
+     * Function returning whether the completed polygon of the specified id
+     * must be sent to the receiver.
+     */
+    using PolygonFilter = std::function<bool(PolyIdType)>;
+
   private:
     using PolygonMap = std::map<PolyIdType, RPolygon *>;
     using PolygonMapEntry = typename PolygonMap::value_type;
@@ -148,6 +157,7 @@ template <typename PolyIdType, typename DataType> class Polygonizer
     PolygonMap oPolygonMap_{};
 
     PolygonReceiver<DataType> *poPolygonReceiver_;
+    PolygonFilter oPolygonFilter_{};
 
     RPolygon *getPolygon(PolyIdType nPolygonId);
 
@@ -171,12 +181,57 @@ template <typename PolyIdType, typename DataType> class Polygonizer
         return poTheOuterPolygon_;
     }
 
+    void setPolygonFilter(PolygonFilter oFilter)
+    {
+        oPolygonFilter_ = std::move(oFilter);
+    }
+
     bool processLine(const PolyIdType *panThisLineId,
                      const DataType *panLastLineVal, TwoArm *poThisLineArm,
                      TwoArm *poLastLineArm, IndexType nCurrentRow,
                      IndexType nCols);
 };
 
+/**
+ * Build the rings of a raster polygon object into an OGR polygon, in
+ * georeferenced coordinates.
+ *
+ * If poOGRPolygon has a single ring, it is reused.
+ */
+bool BuildOGRPolygon(const RPolygon *poPolygon, const GDALGeoTransform &gt,
+                     OGRPolygon *poOGRPolygon);
+
+/**
+ * Collect raster polygon objects as OGR polygons, for later writing
+ * with OGRPolygonWriter::writePolygon().
+ */
+template <typename DataType>
+class OGRPolygonCollector : public PolygonReceiver<DataType>
+{
+    const GDALGeoTransform gt_;
+    std::vector<std::pair<std::unique_ptr<OGRPolygon>, DataType>> aoPolygons_{};
+
+    CPLErr eErr_{CE_None};
+
+  public:
+    explicit OGRPolygonCollector(const GDALGeoTransform &gt) : gt_(gt)
+    {
+    }
+
+    void receive(RPolygon *poPolygon, DataType nPolygonCellValue) override;
+
+    std::vector<std::pair<std::unique_ptr<OGRPolygon>, DataType>> &
+    getPolygons()
+    {
+        return aoPolygons_;
+    }
+
+    inline CPLErr getErr()
+    {
+        return eErr_;
+    }
+};
+
 /**
  * Write raster polygon object to OGR layer.
  */
@@ -209,10 +264,16 @@ class OGRPolygonWriter : public PolygonReceiver<DataType>
 
     void receive(RPolygon *poPolygon, DataType nPolygonCellValue) override;
 
+    void writePolygon(std::unique_ptr<OGRPolygon> poPolygon,
+                      DataType nPolygonCellValue);
+
     inline CPLErr getErr()
     {
         return eErr_;
     }
+
+  private:
+    void writeFeature(DataType nPolygonCellValue);
 };
 
 }  // namespace polygonizer
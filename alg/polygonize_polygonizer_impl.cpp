@@ -13,5 +13,9 @@ template class OGRPolygonWriter<std::int64_t>;
 
 template class OGRPolygonWriter<float>;
 
+template class OGRPolygonCollector<std::int64_t>;
+
+template class OGRPolygonCollector<float>;
+
 }  // namespace polygonizer
 }  // namespace gdal
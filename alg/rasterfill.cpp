@@ -19,6 +19,7 @@
 #include <cstring>
 
 #include <algorithm>
+#include <memory>
 #include <string>
 #include <utility>
 
@@ -29,6 +30,7 @@
 #include "cpl_vsi.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
 
 /************************************************************************/
 /*                           GDALFilterLine()                           */
@@ -344,6 +346,156 @@ inline void QUAD_CHECK(double &dfQuadDist, float &fQuadValue, int target_x,
     }
 }
 
+/************************************************************************/
+/*                    GDALFillNodataInterpolateLine()                   */
+/*                                                                      */
+/*      Interpolate the nodata pixels of line iY from the "last known   */
+/*      value" information collected by the top-down pass for this      */
+/*      line, and by the bottom-up pass for the line below.             */
+/************************************************************************/
+
+static void GDALFillNodataInterpolateLine(
+    int iY, int nXSize, double dfMaxSearchDist, int nMaxSearchDist,
+    bool bNearest, bool bHasNoData, float fNoData, GUInt32 nNoDataVal,
+    const GUInt32 *panTopDownY, const float *pafTopDownValue,
+    const GUInt32 *panLastY, const float *pafLastValue, GByte *pabyMask,
+    float *pafScanline, GByte *pabyFiltMask)
+{
+    memset(pabyFiltMask, 0, nXSize);
+    for (int iX = 0; iX < nXSize; iX++)
+    {
+        int nThisMaxSearchDist = nMaxSearchDist;
+
+        // If this was a valid target - no change.
+        if (pabyMask[iX])
+            continue;
+
+        enum Quadrants
+        {
+            QUAD_TOP_LEFT = 0,
+            QUAD_BOTTOM_LEFT = 1,
+            QUAD_TOP_RIGHT = 2,
+            QUAD_BOTTOM_RIGHT = 3,
+        };
+
+        constexpr int QUAD_COUNT = 4;
+        double adfQuadDist[QUAD_COUNT] = {};
+        float afQuadValue[QUAD_COUNT] = {};
+
+        for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+        {
+            adfQuadDist[iQuad] = dfMaxSearchDist + 1.0;
+            afQuadValue[iQuad] = 0.0;
+        }
+
+        // Step left and right by one pixel searching for the closest
+        // target value for each quadrant.
+        for (int iStep = 0; iStep <= nThisMaxSearchDist; iStep++)
+        {
+            const int iLeftX = std::max(0, iX - iStep);
+            const int iRightX = std::min(nXSize - 1, iX + iStep);
+
+            // Top left includes current line.
+            QUAD_CHECK(adfQuadDist[QUAD_TOP_LEFT],
+                       afQuadValue[QUAD_TOP_LEFT], iLeftX,
+                       panTopDownY[iLeftX], iX, iY, pafTopDownValue[iLeftX],
+                       nNoDataVal);
+
+            // Bottom left.
+            QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_LEFT],
+                       afQuadValue[QUAD_BOTTOM_LEFT], iLeftX,
+                       panLastY[iLeftX], iX, iY, pafLastValue[iLeftX],
+                       nNoDataVal);
+
+            // Top right and bottom right do no include center pixel.
+            if (iStep == 0)
+                continue;
+
+            // Top right includes current line.
+            QUAD_CHECK(adfQuadDist[QUAD_TOP_RIGHT],
+                       afQuadValue[QUAD_TOP_RIGHT], iRightX,
+                       panTopDownY[iRightX], iX, iY,
+                       pafTopDownValue[iRightX], nNoDataVal);
+
+            // Bottom right.
+            QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_RIGHT],
+                       afQuadValue[QUAD_BOTTOM_RIGHT], iRightX,
+                       panLastY[iRightX], iX, iY, pafLastValue[iRightX],
+                       nNoDataVal);
+
+            // Every four steps, recompute maximum distance.
+            if ((iStep & 0x3) == 0)
+                nThisMaxSearchDist = static_cast<int>(floor(
+                    std::max(std::max(adfQuadDist[0], adfQuadDist[1]),
+                             std::max(adfQuadDist[2], adfQuadDist[3]))));
+        }
+
+        bool bHasSrcValues = false;
+        if (bNearest)
+        {
+            double dfNearestDist = dfMaxSearchDist + 1;
+            float fNearestValue = 0.0f;
+
+            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+            {
+                if (adfQuadDist[iQuad] < dfNearestDist)
+                {
+                    bHasSrcValues = true;
+                    if (!bHasNoData || afQuadValue[iQuad] != fNoData)
+                    {
+                        fNearestValue = afQuadValue[iQuad];
+                        dfNearestDist = adfQuadDist[iQuad];
+                    }
+                }
+            }
+
+            if (bHasSrcValues)
+            {
+                pabyFiltMask[iX] = 255;
+                if (dfNearestDist <= dfMaxSearchDist)
+                {
+                    pabyMask[iX] = 255;
+                    pafScanline[iX] = fNearestValue;
+                }
+                else
+                    pafScanline[iX] = fNoData;
+            }
+        }
+        else
+        {
+            double dfWeightSum = 0.0;
+            double dfValueSum = 0.0;
+
+            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
+            {
+                if (adfQuadDist[iQuad] <= dfMaxSearchDist)
+                {
+                    bHasSrcValues = true;
+                    if (!bHasNoData || afQuadValue[iQuad] != fNoData)
+                    {
+                        const double dfWeight = 1.0 / adfQuadDist[iQuad];
+                        dfWeightSum += dfWeight;
+                        dfValueSum += double(afQuadValue[iQuad]) * dfWeight;
+                    }
+                }
+            }
+
+            if (bHasSrcValues)
+            {
+                pabyFiltMask[iX] = 255;
+                if (dfWeightSum > 0.0)
+                {
+                    pabyMask[iX] = 255;
+                    pafScanline[iX] =
+                        static_cast<float>(dfValueSum / dfWeightSum);
+                }
+                else
+                    pafScanline[iX] = fNoData;
+            }
+        }
+    }
+}
+
 /************************************************************************/
 /*                           GDALFillNodata()                           */
 /************************************************************************/
@@ -384,6 +536,10 @@ inline void QUAD_CHECK(double &dfQuadDist, float &fQuadValue, int target_x,
  * <li>INTERPOLATION=INV_DIST/NEAREST (GDAL >= 3.9). By default, pixels are
  * interpolated using an inverse distance weighting (INV_DIST). It is also
  * possible to choose a nearest neighbour (NEAREST) strategy.</li>
+ * <li>NUM_THREADS=num|ALL_CPUS (GDAL >= 3.12). Number of threads used to
+ * interpolate nodata pixels. Defaults to the value of the GDAL_NUM_THREADS
+ * configuration option, or 1. The result does not depend on the number of
+ * threads. Smoothing passes are not multi-threaded.</li>
  * </ul>
  * @param pfnProgress the progress function to report completion.
  * @param pProgressArg callback data for progress function.
@@ -587,31 +743,62 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         GDALRasterBand::FromHandle(poFiltMaskDS->GetRasterBand(1));
 
     /* -------------------------------------------------------------------- */
-    /*      Allocate buffers for last scanline and this scanline.           */
+    /*      Allocate buffers for last scanline and current chunk.           */
+    /*                                                                      */
+    /*      Both passes process nChunkLines lines at a time, so that the    */
+    /*      interpolation of the bottom-up pass can be spread over several  */
+    /*      threads.                                                        */
     /* -------------------------------------------------------------------- */
+    const int nThreads = GDALGetNumThreads(papszOptions, "NUM_THREADS");
+    int nChunkLines = 1;
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nThreads > 1)
+    {
+        // Stay around 64 MB of working buffers.
+        constexpr int BYTES_PER_PIXEL = 2 * sizeof(GByte) +
+                                        3 * sizeof(float) +
+                                        2 * sizeof(GUInt32);
+        const int nMaxChunkLines = std::max(
+            1, static_cast<int>(64 * 1024 * 1024 /
+                                (static_cast<GIntBig>(nXSize) *
+                                 BYTES_PER_PIXEL)));
+        nChunkLines = std::min(std::min(nYSize, nMaxChunkLines),
+                               std::max(1, 16 * nThreads));
+        if (nChunkLines > 1)
+        {
+            CPLWorkerThreadPool *poThreadPool =
+                GDALGetGlobalThreadPool(nThreads);
+            if (poThreadPool)
+                poJobQueue = poThreadPool->CreateJobQueue();
+        }
+        if (!poJobQueue)
+            nChunkLines = 1;
+    }
+    const size_t nChunkPixels = static_cast<size_t>(nChunkLines) * nXSize;
 
     GUInt32 *panLastY =
         static_cast<GUInt32 *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(GUInt32)));
-    GUInt32 *panThisY =
-        static_cast<GUInt32 *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(GUInt32)));
-    GUInt32 *panTopDownY =
-        static_cast<GUInt32 *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(GUInt32)));
+    GUInt32 *panTopDownY = static_cast<GUInt32 *>(
+        VSI_CALLOC_VERBOSE(nChunkPixels, sizeof(GUInt32)));
+    GUInt32 *panChunkY = static_cast<GUInt32 *>(
+        VSI_CALLOC_VERBOSE(nChunkPixels + nXSize, sizeof(GUInt32)));
     float *pafLastValue =
         static_cast<float *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(float)));
-    float *pafThisValue =
-        static_cast<float *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(float)));
     float *pafTopDownValue =
-        static_cast<float *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(float)));
+        static_cast<float *>(VSI_CALLOC_VERBOSE(nChunkPixels, sizeof(float)));
+    float *pafChunkValue = static_cast<float *>(
+        VSI_CALLOC_VERBOSE(nChunkPixels + nXSize, sizeof(float)));
     float *pafScanline =
-        static_cast<float *>(VSI_CALLOC_VERBOSE(nXSize, sizeof(float)));
-    GByte *pabyMask = static_cast<GByte *>(VSI_CALLOC_VERBOSE(nXSize, 1));
-    GByte *pabyFiltMask = static_cast<GByte *>(VSI_CALLOC_VERBOSE(nXSize, 1));
+        static_cast<float *>(VSI_CALLOC_VERBOSE(nChunkPixels, sizeof(float)));
+    GByte *pabyMask = static_cast<GByte *>(VSI_CALLOC_VERBOSE(nChunkPixels, 1));
+    GByte *pabyFiltMask =
+        static_cast<GByte *>(VSI_CALLOC_VERBOSE(nChunkPixels, 1));
 
     CPLErr eErr = CE_None;
 
-    if (panLastY == nullptr || panThisY == nullptr || panTopDownY == nullptr ||
-        pafLastValue == nullptr || pafThisValue == nullptr ||
-        pafTopDownValue == nullptr || pafScanline == nullptr ||
+    if (panLastY == nullptr || panTopDownY == nullptr || panChunkY == nullptr ||
+        pafLastValue == nullptr || pafTopDownValue == nullptr ||
+        pafChunkValue == nullptr || pafScanline == nullptr ||
         pabyMask == nullptr || pabyFiltMask == nullptr)
     {
         eErr = CE_Failure;
@@ -629,21 +816,24 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
     /*      files.                                                          */
     /* ==================================================================== */
 
-    for (int iY = 0; iY < nYSize && eErr == CE_None; iY++)
+    for (int iYTop = 0; iYTop < nYSize && eErr == CE_None;
+         iYTop += nChunkLines)
     {
+        const int nLines = std::min(nChunkLines, nYSize - iYTop);
+
         /* --------------------------------------------------------------------
          */
-        /*      Read data and mask for this line. */
+        /*      Read data and mask for these lines. */
         /* --------------------------------------------------------------------
          */
-        eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iY, nXSize, 1, pabyMask,
-                            nXSize, 1, GDT_Byte, 0, 0);
+        eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iYTop, nXSize, nLines,
+                            pabyMask, nXSize, nLines, GDT_Byte, 0, 0);
 
         if (eErr != CE_None)
             break;
 
-        eErr = GDALRasterIO(hTargetBand, GF_Read, 0, iY, nXSize, 1, pafScanline,
-                            nXSize, 1, GDT_Float32, 0, 0);
+        eErr = GDALRasterIO(hTargetBand, GF_Read, 0, iYTop, nXSize, nLines,
+                            pafScanline, nXSize, nLines, GDT_Float32, 0, 0);
 
         if (eErr != CE_None)
             break;
@@ -654,54 +844,69 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         /* --------------------------------------------------------------------
          */
 
-        for (int iX = 0; iX < nXSize; iX++)
+        // Slot i of panChunkY / pafChunkValue holds the state of line
+        // iYTop + i. The state of the line above the chunk is in panLastY /
+        // pafLastValue.
+        for (int iY = iYTop; iY < iYTop + nLines; iY++)
         {
-            if (pabyMask[iX])
-            {
-                pafThisValue[iX] = pafScanline[iX];
-                panThisY[iX] = iY;
-            }
-            else if (iY <= dfMaxSearchDist + panLastY[iX])
-            {
-                pafThisValue[iX] = pafLastValue[iX];
-                panThisY[iX] = panLastY[iX];
-            }
-            else
+            const size_t nOffset = static_cast<size_t>(iY - iYTop) * nXSize;
+            const GByte *pabyLineMask = pabyMask + nOffset;
+            const float *pafLine = pafScanline + nOffset;
+            const GUInt32 *panAboveY =
+                iY == iYTop ? panLastY : panChunkY + nOffset - nXSize;
+            const float *pafAboveValue =
+                iY == iYTop ? pafLastValue : pafChunkValue + nOffset - nXSize;
+            GUInt32 *panLineY = panChunkY + nOffset;
+            float *pafLineValue = pafChunkValue + nOffset;
+
+            for (int iX = 0; iX < nXSize; iX++)
             {
-                panThisY[iX] = nNoDataVal;
+                if (pabyLineMask[iX])
+                {
+                    pafLineValue[iX] = pafLine[iX];
+                    panLineY[iX] = iY;
+                }
+                else if (iY <= dfMaxSearchDist + panAboveY[iX])
+                {
+                    pafLineValue[iX] = pafAboveValue[iX];
+                    panLineY[iX] = panAboveY[iX];
+                }
+                else
+                {
+                    panLineY[iX] = nNoDataVal;
+                }
             }
         }
 
+        {
+            const size_t nLastOffset = static_cast<size_t>(nLines - 1) * nXSize;
+            memcpy(panLastY, panChunkY + nLastOffset, nXSize * sizeof(GUInt32));
+            memcpy(pafLastValue, pafChunkValue + nLastOffset,
+                   nXSize * sizeof(float));
+        }
+
         /* --------------------------------------------------------------------
          */
         /*      Write out best index/value to working files. */
         /* --------------------------------------------------------------------
          */
-        eErr = GDALRasterIO(hYBand, GF_Write, 0, iY, nXSize, 1, panThisY,
-                            nXSize, 1, GDT_UInt32, 0, 0);
+        eErr = GDALRasterIO(hYBand, GF_Write, 0, iYTop, nXSize, nLines,
+                            panChunkY, nXSize, nLines, GDT_UInt32, 0, 0);
         if (eErr != CE_None)
             break;
 
-        eErr = GDALRasterIO(hValBand, GF_Write, 0, iY, nXSize, 1, pafThisValue,
-                            nXSize, 1, GDT_Float32, 0, 0);
+        eErr = GDALRasterIO(hValBand, GF_Write, 0, iYTop, nXSize, nLines,
+                            pafChunkValue, nXSize, nLines, GDT_Float32, 0, 0);
         if (eErr != CE_None)
             break;
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Flip this/last buffers. */
-        /* --------------------------------------------------------------------
-         */
-        std::swap(pafThisValue, pafLastValue);
-        std::swap(panThisY, panLastY);
-
         /* --------------------------------------------------------------------
          */
         /*      report progress. */
         /* --------------------------------------------------------------------
          */
-        if (!pfnProgress(dfProgressRatio *
-                             (0.5 * (iY + 1) / static_cast<double>(nYSize)),
+        if (!pfnProgress(dfProgressRatio * (0.5 * (iYTop + nLines) /
+                                            static_cast<double>(nYSize)),
                          "Filling...", pProgressArg))
         {
             CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
@@ -718,17 +923,27 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
     /*      Now we will do collect similar this/last information from       */
     /*      bottom to top and use it in combination with the top to         */
     /*      bottom search info to interpolate.                              */
+    /*                                                                      */
+    /*      Lines are processed by chunks of nChunkLines. The bottom-up     */
+    /*      state is cheap and computed serially, whereas the search for    */
+    /*      each nodata pixel only depends on the state of its own line     */
+    /*      and of the line below, so lines of a chunk can be interpolated  */
+    /*      in parallel.                                                    */
     /* ==================================================================== */
-    for (int iY = nYSize - 1; iY >= 0 && eErr == CE_None; iY--)
+    for (int iYBottom = nYSize - 1; iYBottom >= 0 && eErr == CE_None;
+         iYBottom -= nChunkLines)
     {
-        eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iY, nXSize, 1, pabyMask,
-                            nXSize, 1, GDT_Byte, 0, 0);
+        const int iYTop = std::max(0, iYBottom - nChunkLines + 1);
+        const int nLines = iYBottom - iYTop + 1;
+
+        eErr = GDALRasterIO(hMaskBand, GF_Read, 0, iYTop, nXSize, nLines,
+                            pabyMask, nXSize, nLines, GDT_Byte, 0, 0);
 
         if (eErr != CE_None)
             break;
 
-        eErr = GDALRasterIO(hTargetBand, GF_Read, 0, iY, nXSize, 1, pafScanline,
-                            nXSize, 1, GDT_Float32, 0, 0);
+        eErr = GDALRasterIO(hTargetBand, GF_Read, 0, iYTop, nXSize, nLines,
+                            pafScanline, nXSize, nLines, GDT_Float32, 0, 0);
 
         if (eErr != CE_None)
             break;
@@ -739,38 +954,62 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         /* --------------------------------------------------------------------
          */
 
-        for (int iX = 0; iX < nXSize; iX++)
+        // Slot i of panChunkY / pafChunkValue holds the state of line
+        // iYTop + i, and slot nLines the one of the line below the chunk.
         {
-            if (pabyMask[iX])
-            {
-                pafThisValue[iX] = pafScanline[iX];
-                panThisY[iX] = iY;
-            }
-            else if (panLastY[iX] - iY <= dfMaxSearchDist)
-            {
-                pafThisValue[iX] = pafLastValue[iX];
-                panThisY[iX] = panLastY[iX];
-            }
-            else
+            const size_t nBelowOffset = static_cast<size_t>(nLines) * nXSize;
+            memcpy(panChunkY + nBelowOffset, panLastY,
+                   nXSize * sizeof(GUInt32));
+            memcpy(pafChunkValue + nBelowOffset, pafLastValue,
+                   nXSize * sizeof(float));
+        }
+
+        for (int iY = iYBottom; iY >= iYTop; iY--)
+        {
+            const size_t nOffset = static_cast<size_t>(iY - iYTop) * nXSize;
+            const GByte *pabyLineMask = pabyMask + nOffset;
+            const float *pafLine = pafScanline + nOffset;
+            const GUInt32 *panBelowY = panChunkY + nOffset + nXSize;
+            const float *pafBelowValue = pafChunkValue + nOffset + nXSize;
+            GUInt32 *panLineY = panChunkY + nOffset;
+            float *pafLineValue = pafChunkValue + nOffset;
+
+            for (int iX = 0; iX < nXSize; iX++)
             {
-                panThisY[iX] = nNoDataVal;
+                if (pabyLineMask[iX])
+                {
+                    pafLineValue[iX] = pafLine[iX];
+                    panLineY[iX] = iY;
+                }
+                else if (panBelowY[iX] - iY <= dfMaxSearchDist)
+                {
+                    pafLineValue[iX] = pafBelowValue[iX];
+                    panLineY[iX] = panBelowY[iX];
+                }
+                else
+                {
+                    panLineY[iX] = nNoDataVal;
+                }
             }
         }
 
+        memcpy(panLastY, panChunkY, nXSize * sizeof(GUInt32));
+        memcpy(pafLastValue, pafChunkValue, nXSize * sizeof(float));
+
         /* --------------------------------------------------------------------
          */
         /*      Load the last y and corresponding value from the top down pass.
          */
         /* --------------------------------------------------------------------
          */
-        eErr = GDALRasterIO(hYBand, GF_Read, 0, iY, nXSize, 1, panTopDownY,
-                            nXSize, 1, GDT_UInt32, 0, 0);
+        eErr = GDALRasterIO(hYBand, GF_Read, 0, iYTop, nXSize, nLines,
+                            panTopDownY, nXSize, nLines, GDT_UInt32, 0, 0);
 
         if (eErr != CE_None)
             break;
 
-        eErr = GDALRasterIO(hValBand, GF_Read, 0, iY, nXSize, 1,
-                            pafTopDownValue, nXSize, 1, GDT_Float32, 0, 0);
+        eErr = GDALRasterIO(hValBand, GF_Read, 0, iYTop, nXSize, nLines,
+                            pafTopDownValue, nXSize, nLines, GDT_Float32, 0, 0);
 
         if (eErr != CE_None)
             break;
@@ -780,138 +1019,38 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         /*      Attempt to interpolate any pixels that are nodata. */
         /* --------------------------------------------------------------------
          */
-        memset(pabyFiltMask, 0, nXSize);
-        for (int iX = 0; iX < nXSize; iX++)
+        const auto InterpolateLine = [&](int iY)
         {
-            int nThisMaxSearchDist = nMaxSearchDist;
-
-            // If this was a valid target - no change.
-            if (pabyMask[iX])
-                continue;
-
-            enum Quadrants
-            {
-                QUAD_TOP_LEFT = 0,
-                QUAD_BOTTOM_LEFT = 1,
-                QUAD_TOP_RIGHT = 2,
-                QUAD_BOTTOM_RIGHT = 3,
-            };
-
-            constexpr int QUAD_COUNT = 4;
-            double adfQuadDist[QUAD_COUNT] = {};
-            float afQuadValue[QUAD_COUNT] = {};
-
-            for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
-            {
-                adfQuadDist[iQuad] = dfMaxSearchDist + 1.0;
-                afQuadValue[iQuad] = 0.0;
-            }
-
-            // Step left and right by one pixel searching for the closest
-            // target value for each quadrant.
-            for (int iStep = 0; iStep <= nThisMaxSearchDist; iStep++)
-            {
-                const int iLeftX = std::max(0, iX - iStep);
-                const int iRightX = std::min(nXSize - 1, iX + iStep);
-
-                // Top left includes current line.
-                QUAD_CHECK(adfQuadDist[QUAD_TOP_LEFT],
-                           afQuadValue[QUAD_TOP_LEFT], iLeftX,
-                           panTopDownY[iLeftX], iX, iY, pafTopDownValue[iLeftX],
-                           nNoDataVal);
-
-                // Bottom left.
-                QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_LEFT],
-                           afQuadValue[QUAD_BOTTOM_LEFT], iLeftX,
-                           panLastY[iLeftX], iX, iY, pafLastValue[iLeftX],
-                           nNoDataVal);
-
-                // Top right and bottom right do no include center pixel.
-                if (iStep == 0)
-                    continue;
-
-                // Top right includes current line.
-                QUAD_CHECK(adfQuadDist[QUAD_TOP_RIGHT],
-                           afQuadValue[QUAD_TOP_RIGHT], iRightX,
-                           panTopDownY[iRightX], iX, iY,
-                           pafTopDownValue[iRightX], nNoDataVal);
-
-                // Bottom right.
-                QUAD_CHECK(adfQuadDist[QUAD_BOTTOM_RIGHT],
-                           afQuadValue[QUAD_BOTTOM_RIGHT], iRightX,
-                           panLastY[iRightX], iX, iY, pafLastValue[iRightX],
-                           nNoDataVal);
-
-                // Every four steps, recompute maximum distance.
-                if ((iStep & 0x3) == 0)
-                    nThisMaxSearchDist = static_cast<int>(floor(
-                        std::max(std::max(adfQuadDist[0], adfQuadDist[1]),
-                                 std::max(adfQuadDist[2], adfQuadDist[3]))));
-            }
-
-            bool bHasSrcValues = false;
-            if (bNearest)
-            {
-                double dfNearestDist = dfMaxSearchDist + 1;
-                float fNearestValue = 0.0f;
-
-                for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
-                {
-                    if (adfQuadDist[iQuad] < dfNearestDist)
-                    {
-                        bHasSrcValues = true;
-                        if (!bHasNoData || afQuadValue[iQuad] != fNoData)
-                        {
-                            fNearestValue = afQuadValue[iQuad];
-                            dfNearestDist = adfQuadDist[iQuad];
-                        }
-                    }
-                }
-
-                if (bHasSrcValues)
-                {
-                    pabyFiltMask[iX] = 255;
-                    if (dfNearestDist <= dfMaxSearchDist)
-                    {
-                        pabyMask[iX] = 255;
-                        pafScanline[iX] = fNearestValue;
-                    }
-                    else
-                        pafScanline[iX] = fNoData;
-                }
-            }
-            else
+            const size_t nOffset = static_cast<size_t>(iY - iYTop) * nXSize;
+            GDALFillNodataInterpolateLine(
+                iY, nXSize, dfMaxSearchDist, nMaxSearchDist, bNearest,
+                bHasNoData, fNoData, nNoDataVal, panTopDownY + nOffset,
+                pafTopDownValue + nOffset, panChunkY + nOffset + nXSize,
+                pafChunkValue + nOffset + nXSize, pabyMask + nOffset,
+                pafScanline + nOffset, pabyFiltMask + nOffset);
+        };
+
+        if (poJobQueue && nLines > 1)
+        {
+            const int nJobs = std::min(nThreads, nLines);
+            for (int iJob = 0; iJob < nJobs; iJob++)
             {
-                double dfWeightSum = 0.0;
-                double dfValueSum = 0.0;
-
-                for (int iQuad = 0; iQuad < QUAD_COUNT; iQuad++)
-                {
-                    if (adfQuadDist[iQuad] <= dfMaxSearchDist)
+                poJobQueue->SubmitJob(
+                    [iJob, nJobs, iYBottom, iYTop, &InterpolateLine]()
                     {
-                        bHasSrcValues = true;
-                        if (!bHasNoData || afQuadValue[iQuad] != fNoData)
+                        for (int iY = iYBottom - iJob; iY >= iYTop;
+                             iY -= nJobs)
                         {
-                            const double dfWeight = 1.0 / adfQuadDist[iQuad];
-                            dfWeightSum += dfWeight;
-                            dfValueSum += double(afQuadValue[iQuad]) * dfWeight;
+                            InterpolateLine(iY);
                         }
-                    }
-                }
-
-                if (bHasSrcValues)
-                {
-                    pabyFiltMask[iX] = 255;
-                    if (dfWeightSum > 0.0)
-                    {
-                        pabyMask[iX] = 255;
-                        pafScanline[iX] =
-                            static_cast<float>(dfValueSum / dfWeightSum);
-                    }
-                    else
-                        pafScanline[iX] = fNoData;
-                }
+                    });
             }
+            poJobQueue->WaitCompletion();
+        }
+        else
+        {
+            for (int iY = iYBottom; iY >= iYTop; iY--)
+                InterpolateLine(iY);
         }
 
         /* --------------------------------------------------------------------
@@ -919,8 +1058,8 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         /*      Write out the updated data and mask information. */
         /* --------------------------------------------------------------------
          */
-        eErr = GDALRasterIO(hTargetBand, GF_Write, 0, iY, nXSize, 1,
-                            pafScanline, nXSize, 1, GDT_Float32, 0, 0);
+        eErr = GDALRasterIO(hTargetBand, GF_Write, 0, iYTop, nXSize, nLines,
+                            pafScanline, nXSize, nLines, GDT_Float32, 0, 0);
 
         if (eErr != CE_None)
             break;
@@ -929,36 +1068,28 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
         {
             // Update (copy of) mask band when it has been provided by the
             // user
-            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iY, nXSize, 1, pabyMask,
-                                nXSize, 1, GDT_Byte, 0, 0);
+            eErr = GDALRasterIO(hMaskBand, GF_Write, 0, iYTop, nXSize, nLines,
+                                pabyMask, nXSize, nLines, GDT_Byte, 0, 0);
 
             if (eErr != CE_None)
                 break;
         }
 
-        eErr = GDALRasterIO(hFiltMaskBand, GF_Write, 0, iY, nXSize, 1,
-                            pabyFiltMask, nXSize, 1, GDT_Byte, 0, 0);
+        eErr = GDALRasterIO(hFiltMaskBand, GF_Write, 0, iYTop, nXSize, nLines,
+                            pabyFiltMask, nXSize, nLines, GDT_Byte, 0, 0);
 
         if (eErr != CE_None)
             break;
 
-        /* --------------------------------------------------------------------
-         */
-        /*      Flip this/last buffers. */
-        /* --------------------------------------------------------------------
-         */
-        std::swap(pafThisValue, pafLastValue);
-        std::swap(panThisY, panLastY);
-
         /* --------------------------------------------------------------------
          */
         /*      report progress. */
         /* --------------------------------------------------------------------
          */
-        if (!pfnProgress(
-                dfProgressRatio *
-                    (0.5 + 0.5 * (nYSize - iY) / static_cast<double>(nYSize)),
-                "Filling...", pProgressArg))
+        if (!pfnProgress(dfProgressRatio *
+                             (0.5 + 0.5 * (nYSize - iYTop) /
+                                        static_cast<double>(nYSize)),
+                         "Filling...", pProgressArg))
         {
             CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
             eErr = CE_Failure;
@@ -995,11 +1126,11 @@ CPLErr CPL_STDCALL GDALFillNodata(GDALRasterBandH hTargetBand,
 /* -------------------------------------------------------------------- */
 end:
     CPLFree(panLastY);
-    CPLFree(panThisY);
     CPLFree(panTopDownY);
+    CPLFree(panChunkY);
     CPLFree(pafLastValue);
-    CPLFree(pafThisValue);
     CPLFree(pafTopDownValue);
+    CPLFree(pafChunkValue);
     CPLFree(pafScanline);
     CPLFree(pabyMask);
     CPLFree(pabyFiltMask);
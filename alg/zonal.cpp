@@ -10,9 +10,11 @@
  * SPDX-License-Identifier: MIT
  ****************************************************************************/
 
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
 #include "gdal_priv.h"
 #include "gdal_alg.h"
+#include "gdal_thread_pool.h"
 #include "gdal_utils.h"
 #include "ogrsf_frmts.h"
 #include "raster_stats.h"
@@ -24,8 +26,10 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cstring>
 #include <limits>
+#include <mutex>
 #include <variant>
 #include <vector>
 
@@ -67,6 +71,10 @@ struct GDALZonalStatsOptions
                     include_fields.push_back(pszField);
                 }
             }
+            else if (EQUAL(key, "NUM_THREADS"))
+            {
+                // Parsed by GDALGetNumThreads() below
+            }
             else if (EQUAL(key, "PIXEL_INTERSECTION"))
             {
                 if (EQUAL(value, "DEFAULT"))
@@ -168,6 +176,8 @@ struct GDALZonalStatsOptions
             }
         }
 
+        num_threads = GDALGetNumThreads(papszOptions, "NUM_THREADS");
+
         return CE_None;
     }
 
@@ -193,6 +203,7 @@ struct GDALZonalStatsOptions
     std::size_t memory{0};
     int zones_band{};
     int weights_band{};
+    int num_threads{1};
     CPLStringList layer_creation_options{};
 };
 
@@ -1557,7 +1568,8 @@ class GDALZonalStatsImpl
                         if (!CalculateCoverage(
                                 features[iHit]->GetGeometryRef(),
                                 oTrimmedEnvelope, oGeomWindow.nXSize,
-                                oGeomWindow.nYSize, m_pabyCoverageBuf.get()))
+                                oGeomWindow.nYSize, m_pabyCoverageBuf.get(),
+                                m_geosContext))
                         {
                             return false;
                         }
@@ -1636,6 +1648,227 @@ class GDALZonalStatsImpl
 #endif
     }
 
+    /** Buffers used to compute the stats of a single zone feature. When
+     * features are processed by several threads, each job uses its own
+     * instance. */
+    struct FeatureWorkspace
+    {
+        std::unique_ptr<GByte, VSIFreeReleaser> pabyCoverageBuf{};
+        std::unique_ptr<GByte, VSIFreeReleaser> pabyMaskBuf{};
+        std::unique_ptr<GByte, VSIFreeReleaser> pabyValuesBuf{};
+        std::unique_ptr<double, VSIFreeReleaser> padfWeightsBuf{};
+        std::unique_ptr<GByte, VSIFreeReleaser> pabyWeightsMaskBuf{};
+        std::unique_ptr<double, VSIFreeReleaser> padfX{};
+        std::unique_ptr<double, VSIFreeReleaser> padfY{};
+        size_t nBufSize{0};
+        GEOSContextHandle_t hGEOSCtxt{nullptr};
+    };
+
+    // Compute the window of the source raster that is covered by the extent
+    // of a zone. The window is empty if the zone has no geometry or does not
+    // intersect the raster.
+    bool GetFeatureWindow(const OGRGeometry *poGeom,
+                          GDALRasterWindow &oWindow) const
+    {
+        if (poGeom == nullptr)
+        {
+            oWindow.nXSize = 0;
+            oWindow.nYSize = 0;
+            return true;
+        }
+        if (poGeom->getDimension() != 2)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Non-polygonal geometry encountered.");
+            return false;
+        }
+
+        OGREnvelope oGeomExtent;
+        poGeom->getEnvelope(&oGeomExtent);
+
+        if (!m_srcInvGT.Apply(oGeomExtent, oWindow))
+        {
+            return false;
+        }
+        TrimWindowToRaster(oWindow, m_src);
+        return true;
+    }
+
+    // Compute the stats of all bands for a zone whose window, as returned by
+    // GetFeatureWindow(), is not empty.
+    bool
+    ComputeFeatureStats(const OGRGeometry *poGeom,
+                        const GDALRasterWindow &oWindow, GDALDataset &oSrcDS,
+                        GDALRasterBand *poWeightsBand, size_t nMaxCells,
+                        FeatureWorkspace &ws,
+                        std::vector<gdal::RasterStats<double>> &aoStats) const
+    {
+        // Calculate how many rows of raster data we can read in at
+        // a time while remaining within nMaxCells.
+        const int nRowsPerChunk = std::min(
+            oWindow.nYSize,
+            std::max(1, static_cast<int>(nMaxCells /
+                                         static_cast<size_t>(oWindow.nXSize))));
+
+        const size_t nWindowSize = static_cast<size_t>(oWindow.nXSize) *
+                                   static_cast<size_t>(nRowsPerChunk);
+
+        if (ws.nBufSize < nWindowSize)
+        {
+            bool bAllocSuccess = true;
+            Realloc(ws.pabyValuesBuf, nWindowSize,
+                    GDALGetDataTypeSizeBytes(m_workingDataType), bAllocSuccess);
+            Realloc(ws.pabyCoverageBuf, nWindowSize,
+                    GDALGetDataTypeSizeBytes(m_coverageDataType),
+                    bAllocSuccess);
+            Realloc(ws.pabyMaskBuf, nWindowSize,
+                    GDALGetDataTypeSizeBytes(m_maskDataType), bAllocSuccess);
+
+            if (m_stats_options.store_xy)
+            {
+                Realloc(ws.padfX, oWindow.nXSize,
+                        GDALGetDataTypeSizeBytes(GDT_Float64), bAllocSuccess);
+                Realloc(ws.padfY, oWindow.nYSize,
+                        GDALGetDataTypeSizeBytes(GDT_Float64), bAllocSuccess);
+            }
+
+            if (poWeightsBand != nullptr)
+            {
+                Realloc(ws.padfWeightsBuf, nWindowSize,
+                        GDALGetDataTypeSizeBytes(GDT_Float64), bAllocSuccess);
+                Realloc(ws.pabyWeightsMaskBuf, nWindowSize,
+                        GDALGetDataTypeSizeBytes(m_maskDataType),
+                        bAllocSuccess);
+            }
+            if (!bAllocSuccess)
+            {
+                return false;
+            }
+
+            ws.nBufSize = nWindowSize;
+        }
+
+        if (ws.padfX && ws.padfY)
+        {
+            CalculateCellCenters(oWindow, m_srcGT, ws.padfX.get(),
+                                 ws.padfY.get());
+        }
+
+        aoStats.clear();
+        aoStats.resize(m_options.bands.size(), CreateStats());
+
+        for (int nYOff = oWindow.nYOff; nYOff < oWindow.nYOff + oWindow.nYSize;
+             nYOff += nRowsPerChunk)
+        {
+            GDALRasterWindow oSubWindow;
+            oSubWindow.nXOff = oWindow.nXOff;
+            oSubWindow.nXSize = oWindow.nXSize;
+            oSubWindow.nYOff = nYOff;
+            oSubWindow.nYSize =
+                std::min(nRowsPerChunk, oWindow.nYOff + oWindow.nYSize - nYOff);
+
+            const auto nCoverageXOff = oSubWindow.nXOff - oWindow.nXOff;
+            const auto nCoverageYOff = oSubWindow.nYOff - oWindow.nYOff;
+
+            const OGREnvelope oSnappedGeomExtent = ToEnvelope(oSubWindow);
+
+            if (!CalculateCoverage(poGeom, oSnappedGeomExtent,
+                                   oSubWindow.nXSize, oSubWindow.nYSize,
+                                   ws.pabyCoverageBuf.get(), ws.hGEOSCtxt))
+            {
+                return false;
+            }
+
+            if (poWeightsBand != nullptr)
+            {
+                if (!ReadWindow(
+                        *poWeightsBand, oSubWindow,
+                        reinterpret_cast<GByte *>(ws.padfWeightsBuf.get()),
+                        GDT_Float64))
+                {
+                    return false;
+                }
+                if (!ReadWindow(*poWeightsBand->GetMaskBand(), oSubWindow,
+                                ws.pabyWeightsMaskBuf.get(), GDT_Byte))
+                {
+                    return false;
+                }
+            }
+
+            for (size_t iBandInd = 0; iBandInd < m_options.bands.size();
+                 iBandInd++)
+            {
+                GDALRasterBand *poBand =
+                    oSrcDS.GetRasterBand(m_options.bands[iBandInd]);
+
+                if (!ReadWindow(*poBand, oSubWindow, ws.pabyValuesBuf.get(),
+                                m_workingDataType))
+                {
+                    return false;
+                }
+                if (!ReadWindow(*poBand->GetMaskBand(), oSubWindow,
+                                ws.pabyMaskBuf.get(), m_maskDataType))
+                {
+                    return false;
+                }
+
+                UpdateStats(aoStats[iBandInd], ws.pabyValuesBuf.get(),
+                            ws.pabyMaskBuf.get(), ws.padfWeightsBuf.get(),
+                            ws.pabyWeightsMaskBuf.get(),
+                            ws.pabyCoverageBuf.get(),
+                            ws.padfX ? ws.padfX.get() + nCoverageXOff : nullptr,
+                            ws.padfY ? ws.padfY.get() + nCoverageYOff : nullptr,
+                            oSubWindow.nXSize, oSubWindow.nYSize);
+            }
+        }
+
+        return true;
+    }
+
+    void SetFeatureStatFields(
+        OGRFeature &feature, const GDALRasterWindow &oWindow,
+        const std::vector<gdal::RasterStats<double>> &aoStats) const
+    {
+        if (oWindow.nXSize == 0 || oWindow.nYSize == 0)
+        {
+            const gdal::RasterStats<double> empty(CreateStats());
+            for (int iBand : m_options.bands)
+            {
+                SetStatFields(feature, iBand, empty);
+            }
+        }
+        else
+        {
+            for (size_t iBandInd = 0; iBandInd < m_options.bands.size();
+                 iBandInd++)
+            {
+                SetStatFields(feature, m_options.bands[iBandInd],
+                              aoStats[iBandInd]);
+            }
+        }
+    }
+
+    // Return a thread-safe instance of a dataset, or nullptr if it cannot be
+    // re-opened (e.g. anonymous VRT or MEM dataset) or if it is opened in
+    // update mode, in which case its clones might not see dirty blocks.
+    static std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>
+    GetThreadSafeDataset(GDALDataset &oDS)
+    {
+        std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser> poTSDS;
+        if (oDS.GetAccess() == GA_ReadOnly)
+        {
+            CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+            poTSDS.reset(GDALGetThreadSafeDataset(&oDS, GDAL_OF_RASTER));
+        }
+        if (poTSDS && (poTSDS->GetRasterXSize() != oDS.GetRasterXSize() ||
+                       poTSDS->GetRasterYSize() != oDS.GetRasterYSize() ||
+                       poTSDS->GetRasterCount() != oDS.GetRasterCount()))
+        {
+            poTSDS.reset();
+        }
+        return poTSDS;
+    }
+
     bool ProcessVectorZonesByFeature(GDALProgressFunc pfnProgress,
                                      void *pProgressData)
     {
@@ -1644,10 +1877,30 @@ class GDALZonalStatsImpl
             return false;
         }
 
-        OGREnvelope oGeomExtent;
+        const int nThreads = m_options.num_threads;
+        if (nThreads > 1)
+        {
+            auto poTSSrcDS = GetThreadSafeDataset(m_src);
+            std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>
+                poTSWeightsDS;
+            if (poTSSrcDS && m_weights)
+            {
+                poTSWeightsDS = GetThreadSafeDataset(*m_weights);
+            }
+            if (poTSSrcDS && (!m_weights || poTSWeightsDS))
+            {
+                return ProcessVectorZonesByFeatureMT(
+                    *poTSSrcDS, poTSWeightsDS.get(), nThreads, pfnProgress,
+                    pProgressData);
+            }
+            CPLDebug("ZONAL", "Input datasets cannot be accessed from several "
+                              "threads. Using a single thread");
+        }
+
         GDALRasterWindow oWindow;
 
         std::unique_ptr<GDALDataset> poAlignedWeightsDS;
+        GDALRasterBand *poWeightsBand = nullptr;
         // Align the weighting dataset to the values.
         if (m_weights)
         {
@@ -1663,9 +1916,14 @@ class GDALZonalStatsImpl
                          "Resampled weights to match source raster using "
                          "average resampling.");
             }
+            poWeightsBand =
+                poAlignedWeightsDS->GetRasterBand(m_options.weights_band);
         }
 
-        size_t nBufSize = 0;
+        FeatureWorkspace oWorkspace;
+#ifdef HAVE_GEOS
+        oWorkspace.hGEOSCtxt = m_geosContext;
+#endif
 
         OGRLayer *poSrcLayer = std::get<OGRLayer *>(m_zones);
         OGRLayer *poDstLayer = GetOutputLayer(false);
@@ -1674,200 +1932,301 @@ class GDALZonalStatsImpl
         size_t i = 0;
         auto nFeatures = poSrcLayer->GetFeatureCount();
 
+        std::vector<gdal::RasterStats<double>> aoStats;
         for (const auto &poFeature : *poSrcLayer)
         {
             const auto *poGeom = poFeature->GetGeometryRef();
 
-            if (poGeom == nullptr)
+            if (!GetFeatureWindow(poGeom, oWindow))
             {
-                oWindow.nXSize = 0;
-                oWindow.nYSize = 0;
+                return false;
             }
-            else if (poGeom->getDimension() != 2)
+
+            std::unique_ptr<OGRFeature> poDstFeature(
+                OGRFeature::CreateFeature(poDstLayer->GetLayerDefn()));
+            poDstFeature->SetFrom(poFeature.get());
+
+            if (oWindow.nXSize != 0 && oWindow.nYSize != 0 &&
+                !ComputeFeatureStats(poGeom, oWindow, m_src, poWeightsBand,
+                                     m_maxCells, oWorkspace, aoStats))
             {
-                CPLError(CE_Failure, CPLE_AppDefined,
-                         "Non-polygonal geometry encountered.");
                 return false;
             }
-            else
-            {
-                poGeom->getEnvelope(&oGeomExtent);
+            SetFeatureStatFields(*poDstFeature, oWindow, aoStats);
 
-                if (!m_srcInvGT.Apply(oGeomExtent, oWindow))
-                {
-                    return false;
-                }
+            if (poDstLayer->CreateFeature(poDstFeature.get()) != OGRERR_NONE)
+            {
+                return false;
+            }
 
-                TrimWindowToRaster(oWindow, m_src);
+            if (pfnProgress)
+            {
+                pfnProgress(static_cast<double>(i + 1) /
+                                static_cast<double>(nFeatures),
+                            "", pProgressData);
             }
+            i++;
+        }
 
-            std::unique_ptr<OGRFeature> poDstFeature(
-                OGRFeature::CreateFeature(poDstLayer->GetLayerDefn()));
-            poDstFeature->SetFrom(poFeature.get());
+        return true;
+    }
 
-            if (oWindow.nXSize == 0 || oWindow.nYSize == 0)
+    /** Multi-threaded version of ProcessVectorZonesByFeature().
+     *
+     * Zones are read by batches. Within a batch, zones are sorted according
+     * to the raster block in which their window starts, and split into
+     * contiguous runs that are processed by worker threads, so that each
+     * thread processes zones that are close to each other and mostly reads
+     * blocks that are already in the block cache. Output features are written
+     * in the order of the input features once the batch has been processed.
+     */
+    bool ProcessVectorZonesByFeatureMT(GDALDataset &oTSSrcDS,
+                                       GDALDataset *poTSWeightsDS,
+                                       int nThreads,
+                                       GDALProgressFunc pfnProgress,
+                                       void *pProgressData)
+    {
+        CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (!poThreadPool)
+        {
+            return false;
+        }
+        CPLDebug("ZONAL", "Processing zones by feature using %d threads",
+                 nThreads);
+
+        // Several jobs per thread, for load balancing.
+        const size_t nMaxJobs = static_cast<size_t>(nThreads) * 4;
+        constexpr size_t MAX_ZONES_PER_JOB = 256;
+        constexpr size_t MIN_ZONES_PER_JOB = 16;
+        const size_t nBatchSize = nMaxJobs * MAX_ZONES_PER_JOB;
+        // The memory limit is shared between threads.
+        const size_t nMaxCells =
+            std::max<size_t>(1, m_maxCells / static_cast<size_t>(nThreads));
+
+        // VRT datasets are not thread-safe, so each running job needs its own
+        // dataset to align the weights to the values. They are recycled
+        // between jobs.
+        std::mutex oWeightsMutex;
+        std::vector<std::unique_ptr<GDALDataset>> apoAlignedWeightsDS;
+        if (poTSWeightsDS)
+        {
+            bool resampled = false;
+            auto poAlignedWeightsDS =
+                GetVRT(*poTSWeightsDS, oTSSrcDS, resampled);
+            if (!poAlignedWeightsDS)
             {
-                const gdal::RasterStats<double> empty(CreateStats());
-                for (int iBand : m_options.bands)
-                {
-                    SetStatFields(*poDstFeature, iBand, empty);
-                }
+                return false;
             }
-            else
+            if (resampled)
             {
-                // Calculate how many rows of raster data we can read in at
-                // a time while remaining within maxCells.
-                const int nRowsPerChunk = std::min(
-                    oWindow.nYSize,
-                    std::max(1, static_cast<int>(
-                                    m_maxCells /
-                                    static_cast<size_t>(oWindow.nXSize))));
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "Resampled weights to match source raster using "
+                         "average resampling.");
+            }
+            apoAlignedWeightsDS.push_back(std::move(poAlignedWeightsDS));
+        }
 
-                const size_t nWindowSize = static_cast<size_t>(oWindow.nXSize) *
-                                           static_cast<size_t>(nRowsPerChunk);
+        OGRLayer *poSrcLayer = std::get<OGRLayer *>(m_zones);
+        OGRLayer *poDstLayer = GetOutputLayer(false);
+        if (!poDstLayer)
+            return false;
+        const auto nFeatures = poSrcLayer->GetFeatureCount();
 
-                if (nBufSize < nWindowSize)
-                {
-                    bool bAllocSuccess = true;
-                    Realloc(m_pabyValuesBuf, nWindowSize,
-                            GDALGetDataTypeSizeBytes(m_workingDataType),
-                            bAllocSuccess);
-                    Realloc(m_pabyCoverageBuf, nWindowSize,
-                            GDALGetDataTypeSizeBytes(m_coverageDataType),
-                            bAllocSuccess);
-                    Realloc(m_pabyMaskBuf, nWindowSize,
-                            GDALGetDataTypeSizeBytes(m_maskDataType),
-                            bAllocSuccess);
+        int nBlockXSize = 0;
+        int nBlockYSize = 0;
+        m_src.GetRasterBand(m_options.bands.front())
+            ->GetBlockSize(&nBlockXSize, &nBlockYSize);
+        nBlockXSize = std::max(1, nBlockXSize);
+        nBlockYSize = std::max(1, nBlockYSize);
 
-                    if (m_stats_options.store_xy)
-                    {
-                        Realloc(m_padfX, oWindow.nXSize,
-                                GDALGetDataTypeSizeBytes(GDT_Float64),
-                                bAllocSuccess);
-                        Realloc(m_padfY, oWindow.nYSize,
-                                GDALGetDataTypeSizeBytes(GDT_Float64),
-                                bAllocSuccess);
-                    }
+        struct Zone
+        {
+            std::unique_ptr<OGRFeature> poFeature{};
+            GDALRasterWindow oWindow{};
+            std::vector<gdal::RasterStats<double>> aoStats{};
+        };
 
-                    if (m_weights != nullptr)
-                    {
-                        Realloc(m_padfWeightsBuf, nWindowSize,
-                                GDALGetDataTypeSizeBytes(GDT_Float64),
-                                bAllocSuccess);
-                        Realloc(m_pabyWeightsMaskBuf, nWindowSize,
-                                GDALGetDataTypeSizeBytes(m_maskDataType),
-                                bAllocSuccess);
-                    }
-                    if (!bAllocSuccess)
-                    {
-                        return false;
-                    }
+        std::vector<Zone> aoZones;
+        std::vector<size_t> anOrder;
+        size_t nFeaturesDone = 0;
+        bool bEOF = false;
 
-                    nBufSize = nWindowSize;
+        poSrcLayer->ResetReading();
+        while (!bEOF)
+        {
+            aoZones.clear();
+            anOrder.clear();
+            while (aoZones.size() < nBatchSize)
+            {
+                Zone oZone;
+                oZone.poFeature.reset(poSrcLayer->GetNextFeature());
+                if (!oZone.poFeature)
+                {
+                    bEOF = true;
+                    break;
                 }
-
-                if (m_padfX && m_padfY)
+                if (!GetFeatureWindow(oZone.poFeature->GetGeometryRef(),
+                                      oZone.oWindow))
                 {
-                    CalculateCellCenters(oWindow, m_srcGT, m_padfX.get(),
-                                         m_padfY.get());
+                    return false;
                 }
+                if (oZone.oWindow.nXSize != 0 && oZone.oWindow.nYSize != 0)
+                {
+                    anOrder.push_back(aoZones.size());
+                }
+                aoZones.push_back(std::move(oZone));
+            }
 
-                std::vector<gdal::RasterStats<double>> aoStats;
-                aoStats.resize(m_options.bands.size(), CreateStats());
-
-                for (int nYOff = oWindow.nYOff;
-                     nYOff < oWindow.nYOff + oWindow.nYSize;
-                     nYOff += nRowsPerChunk)
+            std::stable_sort(
+                anOrder.begin(), anOrder.end(),
+                [&aoZones, nBlockXSize, nBlockYSize](size_t a, size_t b)
                 {
-                    GDALRasterWindow oSubWindow;
-                    oSubWindow.nXOff = oWindow.nXOff;
-                    oSubWindow.nXSize = oWindow.nXSize;
-                    oSubWindow.nYOff = nYOff;
-                    oSubWindow.nYSize = std::min(
-                        nRowsPerChunk, oWindow.nYOff + oWindow.nYSize - nYOff);
-
-                    const auto nCoverageXOff = oSubWindow.nXOff - oWindow.nXOff;
-                    const auto nCoverageYOff = oSubWindow.nYOff - oWindow.nYOff;
-
-                    const OGREnvelope oSnappedGeomExtent =
-                        ToEnvelope(oSubWindow);
-
-                    if (!CalculateCoverage(poGeom, oSnappedGeomExtent,
-                                           oSubWindow.nXSize, oSubWindow.nYSize,
-                                           m_pabyCoverageBuf.get()))
-                    {
-                        return false;
-                    }
+                    const auto &oWindowA = aoZones[a].oWindow;
+                    const auto &oWindowB = aoZones[b].oWindow;
+                    return std::make_pair(oWindowA.nYOff / nBlockYSize,
+                                          oWindowA.nXOff / nBlockXSize) <
+                           std::make_pair(oWindowB.nYOff / nBlockYSize,
+                                          oWindowB.nXOff / nBlockXSize);
+                });
+
+            auto poJobQueue = poThreadPool->CreateJobQueue();
+            std::atomic<bool> bError{false};
+            std::atomic<bool> bStop{false};
+            std::atomic<size_t> nZonesDone{0};
+            CPLErrorAccumulator oErrorAccumulator;
+
+            const size_t nJobs =
+                std::min(nMaxJobs, (anOrder.size() + MIN_ZONES_PER_JOB - 1) /
+                                       MIN_ZONES_PER_JOB);
+            for (size_t iJob = 0; iJob < nJobs; ++iJob)
+            {
+                const size_t iFirst = anOrder.size() * iJob / nJobs;
+                const size_t iLast = anOrder.size() * (iJob + 1) / nJobs;
+                const auto Job = [this, iFirst, iLast, nMaxCells, &oTSSrcDS,
+                                  poTSWeightsDS, &aoZones, &anOrder,
+                                  &oWeightsMutex, &apoAlignedWeightsDS,
+                                  &bError, &bStop, &nZonesDone,
+                                  &oErrorAccumulator]()
+                {
+                    auto oAccumulator =
+                        oErrorAccumulator.InstallForCurrentScope();
+                    CPL_IGNORE_RET_VAL(oAccumulator);
 
-                    if (m_weights != nullptr)
+                    std::unique_ptr<GDALDataset> poAlignedWeightsDS;
+                    GDALRasterBand *poWeightsBand = nullptr;
+                    if (poTSWeightsDS)
                     {
-                        GDALRasterBand *poWeightsBand =
-                            poAlignedWeightsDS->GetRasterBand(
-                                m_options.weights_band);
-
-                        if (!ReadWindow(*poWeightsBand, oSubWindow,
-                                        reinterpret_cast<GByte *>(
-                                            m_padfWeightsBuf.get()),
-                                        GDT_Float64))
                         {
-                            return false;
+                            std::lock_guard oLock(oWeightsMutex);
+                            if (!apoAlignedWeightsDS.empty())
+                            {
+                                poAlignedWeightsDS =
+                                    std::move(apoAlignedWeightsDS.back());
+                                apoAlignedWeightsDS.pop_back();
+                            }
                         }
-                        if (!ReadWindow(*poWeightsBand->GetMaskBand(),
-                                        oSubWindow, m_pabyWeightsMaskBuf.get(),
-                                        GDT_Byte))
+                        if (!poAlignedWeightsDS)
                         {
-                            return false;
+                            bool resampled = false;
+                            poAlignedWeightsDS =
+                                GetVRT(*poTSWeightsDS, oTSSrcDS, resampled);
                         }
+                        if (!poAlignedWeightsDS)
+                        {
+                            bError = true;
+                            return;
+                        }
+                        poWeightsBand = poAlignedWeightsDS->GetRasterBand(
+                            m_options.weights_band);
                     }
 
-                    for (size_t iBandInd = 0; iBandInd < m_options.bands.size();
-                         iBandInd++)
+                    FeatureWorkspace oWorkspace;
+                    if (m_options.pixels == GDALZonalStatsOptions::FRACTIONAL)
                     {
-                        GDALRasterBand *poBand =
-                            m_src.GetRasterBand(m_options.bands[iBandInd]);
+                        oWorkspace.hGEOSCtxt = OGRGeometry::createGEOSContext();
+                    }
 
-                        if (!ReadWindow(*poBand, oSubWindow,
-                                        m_pabyValuesBuf.get(),
-                                        m_workingDataType))
-                        {
-                            return false;
-                        }
-                        if (!ReadWindow(*poBand->GetMaskBand(), oSubWindow,
-                                        m_pabyMaskBuf.get(), m_maskDataType))
+                    for (size_t i = iFirst; i < iLast && !bError && !bStop;
+                         ++i)
+                    {
+                        Zone &oZone = aoZones[anOrder[i]];
+                        if (!ComputeFeatureStats(
+                                oZone.poFeature->GetGeometryRef(),
+                                oZone.oWindow, oTSSrcDS, poWeightsBand,
+                                nMaxCells, oWorkspace, oZone.aoStats))
                         {
-                            return false;
+                            bError = true;
                         }
+                        ++nZonesDone;
+                    }
 
-                        UpdateStats(
-                            aoStats[iBandInd], m_pabyValuesBuf.get(),
-                            m_pabyMaskBuf.get(), m_padfWeightsBuf.get(),
-                            m_pabyWeightsMaskBuf.get(), m_pabyCoverageBuf.get(),
-                            m_padfX ? m_padfX.get() + nCoverageXOff : nullptr,
-                            m_padfY ? m_padfY.get() + nCoverageYOff : nullptr,
-                            oSubWindow.nXSize, oSubWindow.nYSize);
+                    if (oWorkspace.hGEOSCtxt)
+                    {
+                        OGRGeometry::freeGEOSContext(oWorkspace.hGEOSCtxt);
+                    }
+                    if (poAlignedWeightsDS)
+                    {
+                        std::lock_guard oLock(oWeightsMutex);
+                        apoAlignedWeightsDS.push_back(
+                            std::move(poAlignedWeightsDS));
                     }
+                };
+                if (!poJobQueue->SubmitJob(Job))
+                {
+                    bError = true;
+                    break;
                 }
+            }
 
-                for (size_t iBandInd = 0; iBandInd < m_options.bands.size();
-                     iBandInd++)
+            const size_t nEmptyZones = aoZones.size() - anOrder.size();
+            while (poJobQueue->WaitEvent())
+            {
+                if (pfnProgress && nFeatures > 0 && !bStop &&
+                    !pfnProgress(
+                        std::min(1.0, static_cast<double>(nFeaturesDone +
+                                                          nEmptyZones +
+                                                          nZonesDone.load()) /
+                                          static_cast<double>(nFeatures)),
+                        "", pProgressData))
                 {
-                    SetStatFields(*poDstFeature, m_options.bands[iBandInd],
-                                  aoStats[iBandInd]);
+                    bStop = true;
                 }
             }
+            poJobQueue->WaitCompletion();
 
-            if (poDstLayer->CreateFeature(poDstFeature.get()) != OGRERR_NONE)
+            oErrorAccumulator.ReplayErrors();
+
+            if (bStop)
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                return false;
+            }
+            if (bError)
             {
                 return false;
             }
 
-            if (pfnProgress)
+            for (const auto &oZone : aoZones)
             {
-                pfnProgress(static_cast<double>(i + 1) /
-                                static_cast<double>(nFeatures),
+                std::unique_ptr<OGRFeature> poDstFeature(
+                    OGRFeature::CreateFeature(poDstLayer->GetLayerDefn()));
+                poDstFeature->SetFrom(oZone.poFeature.get());
+                SetFeatureStatFields(*poDstFeature, oZone.oWindow,
+                                     oZone.aoStats);
+                if (poDstLayer->CreateFeature(poDstFeature.get()) !=
+                    OGRERR_NONE)
+                {
+                    return false;
+                }
+            }
+            nFeaturesDone += aoZones.size();
+
+            if (pfnProgress && nFeatures > 0)
+            {
+                pfnProgress(std::min(1.0, static_cast<double>(nFeaturesDone) /
+                                              static_cast<double>(nFeatures)),
                             "", pProgressData);
             }
-            i++;
         }
 
         return true;
@@ -1896,7 +2255,8 @@ class GDALZonalStatsImpl
 
     bool CalculateCoverage(const OGRGeometry *poGeom,
                            const OGREnvelope &oSnappedGeomExtent, int nXSize,
-                           int nYSize, GByte *pabyCoverageBuf) const
+                           int nYSize, GByte *pabyCoverageBuf,
+                           [[maybe_unused]] GEOSContextHandle_t hGEOSCtxt) const
     {
 #if GEOS_GRID_INTERSECTION_AVAILABLE
         if (m_options.pixels == GDALZonalStatsOptions::FRACTIONAL)
@@ -1904,8 +2264,7 @@ class GDALZonalStatsImpl
             std::memset(pabyCoverageBuf, 0,
                         static_cast<size_t>(nXSize) * nYSize *
                             GDALGetDataTypeSizeBytes(GDT_Float32));
-            GEOSGeometry *poGeosGeom =
-                poGeom->exportToGEOS(m_geosContext, true);
+            GEOSGeometry *poGeosGeom = poGeom->exportToGEOS(hGEOSCtxt, true);
             if (!poGeosGeom)
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
@@ -1914,7 +2273,7 @@ class GDALZonalStatsImpl
             }
 
             const bool bRet = GEOSGridIntersectionFractions_r(
-                m_geosContext, poGeosGeom, oSnappedGeomExtent.MinX,
+                hGEOSCtxt, poGeosGeom, oSnappedGeomExtent.MinX,
                 oSnappedGeomExtent.MinY, oSnappedGeomExtent.MaxX,
                 oSnappedGeomExtent.MaxY, nXSize, nYSize,
                 reinterpret_cast<float *>(pabyCoverageBuf));
@@ -1923,7 +2282,7 @@ class GDALZonalStatsImpl
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Failed to calculate pixel intersection fractions.");
             }
-            GEOSGeom_destroy_r(m_geosContext, poGeosGeom);
+            GEOSGeom_destroy_r(hGEOSCtxt, poGeosGeom);
 
             return bRet;
         }
@@ -2103,6 +2462,9 @@ static CPLErr GDALZonalStats(GDALDataset &srcDataset, GDALDataset *poWeights,
  *          source dataset. If not present, all bands will be processed.
  *   INCLUDE_FIELDS: a comma-separated list of field names from the zones
  *          dataset to be included in output features.
+ *   NUM_THREADS: number of threads (or ALL_CPUS) to use to process vector
+ *          zones with the FEATURE_SEQUENTIAL strategy. Defaults to the value
+ *          of the GDAL_NUM_THREADS configuration option, or 1.
  *   PIXEL_INTERSECTION: controls which pixels are included in calculations:
  *          - DEFAULT: use default options to GDALRasterize
  *          - ALL_TOUCHED: use ALL_TOUCHED option of GDALRasterize
@@ -117,6 +117,7 @@ GDALMdimConvertAlgorithm::GDALMdimConvertAlgorithm()
         .SetMetaVar("<SCALEAXES-SPEC>");
 
     AddArg("strict", 0, _("Turn warnings into failures."), &m_strict);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -147,6 +148,11 @@ bool GDALMdimConvertAlgorithm::RunImpl(GDALProgressFunc pfnProgress,
     {
         aosOptions.AddString("-strict");
     }
+    if (m_numThreads > 0)
+    {
+        aosOptions.AddString("-num_threads");
+        aosOptions.AddString(CPLSPrintf("%d", m_numThreads));
+    }
     for (const auto &array : m_arrays)
     {
         aosOptions.AddString("-array");
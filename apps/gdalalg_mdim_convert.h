@@ -47,6 +47,8 @@ class GDALMdimConvertAlgorithm final : public GDALAlgorithm
     std::vector<std::string> m_groups{};
     std::vector<std::string> m_subsets{};
     std::vector<std::string> m_scaleAxes{};
+    int m_numThreads = 0;
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 //! @endcond
@@ -41,6 +41,7 @@ GDALRasterColorMapAlgorithm::GDALRasterColorMapAlgorithm(bool standaloneStep)
            &m_colorSelection)
         .SetChoices("interpolate", "exact", "nearest")
         .SetDefault(m_colorSelection);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -156,6 +157,11 @@ bool GDALRasterColorMapAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
             aosOptions.AddString("-exact_color_entry");
         else if (m_colorSelection == "nearest")
             aosOptions.AddString("-nearest_color_entry");
+        if (m_numThreads > 0)
+        {
+            aosOptions.AddString("-num_threads");
+            aosOptions.AddString(CPLSPrintf("%d", m_numThreads));
+        }
 
         GDALDEMProcessingOptions *psOptions =
             GDALDEMProcessingOptionsNew(aosOptions.List(), nullptr);
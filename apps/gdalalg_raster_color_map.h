@@ -45,6 +45,8 @@ class GDALRasterColorMapAlgorithm /* non final */
     std::string m_colorMap{};
     bool m_addAlpha = false;
     std::string m_colorSelection = "interpolate";
+    int m_numThreads = 0;
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 /************************************************************************/
@@ -78,6 +78,7 @@ GDALRasterContourAlgorithm::GDALRasterContourAlgorithm(bool standaloneStep)
            _("Group n features per transaction (default 100 000)"),
            &m_groupTransactions)
         .SetMinValueIncluded(0);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -245,6 +246,13 @@ bool GDALRasterContourAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
                                          &hSrcDS, &hBand, &hDstDS,
                                          &hLayer) == CE_None;
 
+        if (bRet && m_numThreads > 0)
+        {
+            papszStringOptions =
+                CSLSetNameValue(papszStringOptions, "NUM_THREADS",
+                                CPLSPrintf("%d", m_numThreads));
+        }
+
         if (bRet)
         {
             bRet = GDALContourGenerateEx(hBand, hLayer, papszStringOptions,
@@ -72,6 +72,10 @@ class GDALRasterContourAlgorithm /* non final */
     int m_expBase = 0;  // -e <base>
     bool m_polygonize = false;    // -p
     int m_groupTransactions = 0;  // gt <n>
+    // Multi-threading changes the order of output features, hence it is
+    // opt-in.
+    int m_numThreads = 1;
+    std::string m_numThreadsStr{"1"};
 };
 
 /************************************************************************/
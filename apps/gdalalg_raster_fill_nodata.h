@@ -47,6 +47,9 @@ class GDALRasterFillNodataAlgorithm /* non final */
     GDALArgDatasetValue m_maskDataset{};
     // By default, pixels are interpolated using an inverse distance weighting (inv_dist). It is also possible to choose a nearest neighbour (nearest) strategy.
     std::string m_strategy = "invdist";
+    // Number of threads
+    int m_numThreads = 0;
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 /************************************************************************/
@@ -62,6 +62,7 @@ GDALRasterHillshadeAlgorithm::GDALRasterHillshadeAlgorithm(bool standaloneStep)
            _("Do not try to interpolate values at dataset edges or close to "
              "nodata values"),
            &m_noEdges);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -167,6 +168,11 @@ bool GDALRasterHillshadeAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
 
     if (!m_noEdges)
         aosOptions.AddString("-compute_edges");
+    if (m_numThreads > 0)
+    {
+        aosOptions.AddString("-num_threads");
+        aosOptions.AddString(CPLSPrintf("%d", m_numThreads));
+    }
 
     GDALDEMProcessingOptions *psOptions =
         GDALDEMProcessingOptionsNew(aosOptions.List(), nullptr);
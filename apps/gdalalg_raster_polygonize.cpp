@@ -57,6 +57,8 @@ GDALRasterPolygonizeAlgorithm::GDALRasterPolygonizeAlgorithm(
            _("Consider diagonal pixels as connected"), &m_connectDiagonalPixels)
         .SetDefault(m_connectDiagonalPixels);
 
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
+
     AddArg("commit-interval", 0, _("Commit interval"), &m_commitInterval)
         .SetHidden();
 }
@@ -259,6 +261,11 @@ bool GDALRasterPolygonizeAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
         aosPolygonizeOptions.SetNameValue("COMMIT_INTERVAL",
                                           CPLSPrintf("%d", m_commitInterval));
     }
+    if (m_numThreads > 0)
+    {
+        aosPolygonizeOptions.SetNameValue("NUM_THREADS",
+                                          CPLSPrintf("%d", m_numThreads));
+    }
 
     bool ret;
     if (GDALDataTypeIsInteger(eDT))
@@ -59,6 +59,10 @@ class GDALRasterPolygonizeAlgorithm /* non final */
     int m_band = 1;
     std::string m_attributeName = "DN";
     bool m_connectDiagonalPixels = false;
+    // Multi-threading changes the order of output features, hence it is
+    // opt-in.
+    int m_numThreads = 1;
+    std::string m_numThreadsStr{"1"};
 
     // hidden
     int m_commitInterval = 0;
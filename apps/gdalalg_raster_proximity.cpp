@@ -55,6 +55,13 @@ GDALRasterProximityAlgorithm::GDALRasterProximityAlgorithm(bool standaloneStep)
            _("Specify a nodata value to use for pixels that are beyond the "
              "maximum distance"),
            &m_noDataValue);
+    AddArg("method", 0,
+           _("Distance computation method: classic two-pass scan, or exact "
+             "Euclidean distance transform"),
+           &m_method)
+        .SetChoices("classic", "edt")
+        .SetDefault(m_method);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -113,6 +120,16 @@ bool GDALRasterProximityAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
         dstBand->SetNoDataValue(m_noDataValue);
     }
 
+    if (m_method == "edt")
+    {
+        proximityOptions.AddString("ALGORITHM=EDT");
+        if (m_numThreads > 0)
+        {
+            proximityOptions.AddString(
+                CPLSPrintf("NUM_THREADS=%d", m_numThreads));
+        }
+    }
+
     // Always set this to YES. Note that this was NOT the
     // default behavior in the python implementation of the utility.
     proximityOptions.AddString("USE_INPUT_NODATA=YES");
@@ -93,6 +93,11 @@ GDALRasterReprojectAlgorithm::GDALRasterReprojectAlgorithm(bool standaloneStep)
     GDALRasterReprojectUtils::AddWarpOptTransformOptErrorThresholdArg(
         this, m_warpOptions, m_transformOptions, m_errorThreshold);
 
+    AddArg("plan", 0,
+           _("Warp plan file, reused if it exists, created otherwise"),
+           &m_planFilename)
+        .SetCategory(GAAC_ADVANCED);
+
     AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
@@ -333,6 +338,11 @@ bool GDALRasterReprojectAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
         aosOptions.AddString("-et");
         aosOptions.AddString(CPLSPrintf("%.17g", m_errorThreshold));
     }
+    if (!m_planFilename.empty())
+    {
+        aosOptions.AddString("-plan");
+        aosOptions.AddString(m_planFilename.c_str());
+    }
 
     bool bOK = false;
     GDALWarpAppOptions *psOptions =
@@ -58,6 +58,7 @@ class GDALRasterReprojectAlgorithm /* non final */
     std::vector<std::string> m_warpOptions{};
     std::vector<std::string> m_transformOptions{};
     double m_errorThreshold = std::numeric_limits<double>::quiet_NaN();
+    std::string m_planFilename{};
     int m_numThreads = 0;
 
     // Work variables
@@ -38,6 +38,7 @@ GDALRasterRoughnessAlgorithm::GDALRasterRoughnessAlgorithm(bool standaloneStep)
            _("Do not try to interpolate values at dataset edges or close to "
              "nodata values"),
            &m_noEdges);
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
 }
 
 /************************************************************************/
@@ -58,6 +59,11 @@ bool GDALRasterRoughnessAlgorithm::RunStep(GDALPipelineStepRunContext &)
     aosOptions.AddString(CPLSPrintf("%d", m_band));
     if (!m_noEdges)
         aosOptions.AddString("-compute_edges");
+    if (m_numThreads > 0)
+    {
+        aosOptions.AddString("-num_threads");
+        aosOptions.AddString(CPLSPrintf("%d", m_numThreads));
+    }
 
     GDALDEMProcessingOptions *psOptions =
         GDALDEMProcessingOptionsNew(aosOptions.List(), nullptr);
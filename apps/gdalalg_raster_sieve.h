@@ -39,6 +39,8 @@ class GDALRasterSieveAlgorithm /* non final */
     int m_sizeThreshold = 2;
     bool m_connectDiagonalPixels = false;
     GDALArgDatasetValue m_maskDataset{};
+    int m_numThreads = 0;
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 /************************************************************************/
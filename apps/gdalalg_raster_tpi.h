@@ -39,6 +39,8 @@ class GDALRasterTPIAlgorithm /* non final */
 
     int m_band = 1;
     bool m_noEdges = false;
+    int m_numThreads = 0;
+    std::string m_numThreadsStr{"ALL_CPUS"};
 };
 
 /************************************************************************/
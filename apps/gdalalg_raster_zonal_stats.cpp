@@ -80,6 +80,7 @@ GDALRasterZonalStatsAlgorithm::GDALRasterZonalStatsAlgorithm(bool bStandalone)
         .SetDefault("feature");
     AddMemorySizeArg(&m_memoryBytes, &m_memoryStr, "chunk-size",
                      _("Maximum size of raster chunks read into memory"));
+    AddNumThreadsArg(&m_numThreads, &m_numThreadsStr);
     AddProgressArg();
 }
 
@@ -187,6 +188,11 @@ bool GDALRasterZonalStatsAlgorithm::RunStep(GDALPipelineStepRunContext &ctxt)
         aosOptions.AddNameValue("INCLUDE_FIELDS",
                                 Join(m_includeFields, ",").c_str());
     }
+    if (m_numThreads > 0)
+    {
+        aosOptions.AddNameValue("NUM_THREADS",
+                                std::to_string(m_numThreads).c_str());
+    }
     aosOptions.AddNameValue("PIXEL_INTERSECTION", m_pixels.c_str());
     if (m_memoryBytes != 0)
     {
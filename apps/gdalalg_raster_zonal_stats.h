@@ -58,6 +58,8 @@ class GDALRasterZonalStatsAlgorithm /* non final */
     std::string m_memoryStr{"5%"};
     std::string m_pixels{"default"};
     int m_weightsBand{0};
+    int m_numThreads{0};
+    std::string m_numThreadsStr{"ALL_CPUS"};
     size_t m_memoryBytes{
         static_cast<size_t>(100) * 1024 *
         1024};  // FIXME validation action doesn't seem to run if arg isn't specified, so this never gets sets?
@@ -93,10 +93,14 @@
 
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
+#include <functional>
 #include <limits>
+#include <mutex>
 
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
@@ -104,6 +108,8 @@
 #include "cpl_vsi_virtual.h"
 #include "gdal.h"
 #include "gdal_priv.h"
+#include "gdal_thread_pool.h"
+#include "gdalstripprocessing.h"
 
 #if defined(__x86_64__) || defined(_M_X64)
 #define HAVE_16_SSE_REG
@@ -172,6 +178,7 @@ struct GDALDEMProcessingOptions
     bool bMultiDirectional = false;
     CPLStringList aosCreationOptions{};
     int nBand = 1;
+    std::string osNumThreads{};  // empty = use GDAL_NUM_THREADS
 };
 
 /************************************************************************/
@@ -308,53 +315,56 @@ GInt32 INTERPOL(GInt32 a, GInt32 b, int bSrcHasNoData, GInt32 fSrcNoDataValue)
 }
 
 /************************************************************************/
-/*                  GDALGeneric3x3Processing()                          */
+/*                   GDALGeneric3x3ProcessingContext                    */
 /************************************************************************/
 
-template <class T>
-static CPLErr GDALGeneric3x3Processing(
-    GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand,
-    typename GDALGeneric3x3ProcessingAlg<T>::type pfnAlg,
-    typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
-        pfnAlg_multisample,
-    std::unique_ptr<AlgorithmParameters> pData, bool bComputeAtEdges,
-    GDALProgressFunc pfnProgress, void *pProgressData)
+// Parameters needed to compute output lines from source lines.
+template <class T> struct GDALGeneric3x3ProcessingContext
 {
-    if (pfnProgress == nullptr)
-        pfnProgress = GDALDummyProgress;
+    typename GDALGeneric3x3ProcessingAlg<T>::type pfnAlg = nullptr;
+    typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
+        pfnAlg_multisample = nullptr;
+    const AlgorithmParameters *pData = nullptr;
+    int nXSize = 0;
+    int nYSize = 0;
+    int bSrcHasNoData = FALSE;
+    T fSrcNoDataValue = 0;
+    bool bIsSrcNoDataNan = false;
+    float fDstNoDataValue = 0;
+    bool bComputeAtEdges = false;
 
-    /* -------------------------------------------------------------------- */
-    /*      Initialize progress counter.                                    */
-    /* -------------------------------------------------------------------- */
-    if (!pfnProgress(0.0, nullptr, pProgressData))
-    {
-        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-        return CE_Failure;
-    }
+    GDALDataType Init(GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand);
 
-    const int nXSize = GDALGetRasterBandXSize(hSrcBand);
-    const int nYSize = GDALGetRasterBandYSize(hSrcBand);
+    bool LineHasNoData(const T *pafLine) const;
 
-    // 1 line destination buffer.
-    float *pafOutputBuf =
-        static_cast<float *>(VSI_MALLOC2_VERBOSE(sizeof(float), nXSize));
-    // 3 line rotating source buffer.
-    T *pafThreeLineWin =
-        static_cast<T *>(VSI_MALLOC2_VERBOSE(3 * sizeof(T), nXSize));
-    if (pafOutputBuf == nullptr || pafThreeLineWin == nullptr)
-    {
-        VSIFree(pafOutputBuf);
-        VSIFree(pafThreeLineWin);
-        return CE_Failure;
-    }
+    void ComputeFirstLine(const T *pafLine1, const T *pafLine2,
+                          float *pafOutputBuf) const;
+
+    void ComputeLine(const T *pafLine1, const T *pafLine2, const T *pafLine3,
+                     bool bOneOfThreeLinesHasNoData, float *pafOutputBuf) const;
+
+    void ComputeLastLine(const T *pafLine1, const T *pafLine2,
+                         float *pafOutputBuf) const;
+};
+
+/************************************************************************/
+/*                                Init()                                */
+/************************************************************************/
+
+// Initialize the nodata related members, and return the data type in which
+// source lines must be read.
+template <class T>
+GDALDataType
+GDALGeneric3x3ProcessingContext<T>::Init(GDALRasterBandH hSrcBand,
+                                         GDALRasterBandH hDstBand)
+{
+    nXSize = GDALGetRasterBandXSize(hSrcBand);
+    nYSize = GDALGetRasterBandYSize(hSrcBand);
 
     GDALDataType eReadDT;
-    int bSrcHasNoData = FALSE;
     const double dfNoDataValue =
         GDALGetRasterNoDataValue(hSrcBand, &bSrcHasNoData);
 
-    bool bIsSrcNoDataNan = false;
-    T fSrcNoDataValue = 0;
     if constexpr (std::numeric_limits<T>::is_integer)
     {
         eReadDT = GDT_Int32;
@@ -389,69 +399,74 @@ static CPLErr GDALGeneric3x3Processing(
     }
 
     int bDstHasNoData = FALSE;
-    float fDstNoDataValue =
+    fDstNoDataValue =
         static_cast<float>(GDALGetRasterNoDataValue(hDstBand, &bDstHasNoData));
     if (!bDstHasNoData)
         fDstNoDataValue = 0.0;
 
-    int nLine1Off = 0;
-    int nLine2Off = nXSize;
-    int nLine3Off = 2 * nXSize;
-
-    // Move a 3x3 pafWindow over each cell
-    // (where the cell in question is #4)
-    //
-    //      0 1 2
-    //      3 4 5
-    //      6 7 8
-
-    /* Preload the first 2 lines */
+    return eReadDT;
+}
 
-    bool abLineHasNoDataValue[3] = {CPL_TO_BOOL(bSrcHasNoData),
-                                    CPL_TO_BOOL(bSrcHasNoData),
-                                    CPL_TO_BOOL(bSrcHasNoData)};
+/************************************************************************/
+/*                           LineHasNoData()                            */
+/************************************************************************/
 
-    for (int i = 0; i < 2 && i < nYSize; i++)
+template <class T>
+bool GDALGeneric3x3ProcessingContext<T>::LineHasNoData(const T *pafLine) const
+{
+    if constexpr (std::numeric_limits<T>::is_integer)
     {
-        if (GDALRasterIO(hSrcBand, GF_Read, 0, i, nXSize, 1,
-                         pafThreeLineWin + i * nXSize, nXSize, 1, eReadDT, 0,
-                         0) != CE_None)
-        {
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
-
-            return CE_Failure;
-        }
-        if (bSrcHasNoData)
+        int iX = 0;
+        for (; iX + 3 < nXSize; iX += 4)
         {
-            abLineHasNoDataValue[i] = false;
-            if constexpr (std::numeric_limits<T>::is_integer)
+            if (pafLine[iX] == fSrcNoDataValue ||
+                pafLine[iX + 1] == fSrcNoDataValue ||
+                pafLine[iX + 2] == fSrcNoDataValue ||
+                pafLine[iX + 3] == fSrcNoDataValue)
             {
-                for (int iX = 0; iX < nXSize; iX++)
-                {
-                    if (pafThreeLineWin[i * nXSize + iX] == fSrcNoDataValue)
-                    {
-                        abLineHasNoDataValue[i] = true;
-                        break;
-                    }
-                }
+                return true;
             }
-            else
+        }
+        for (; iX < nXSize; iX++)
+        {
+            if (pafLine[iX] == fSrcNoDataValue)
+                return true;
+        }
+    }
+    else
+    {
+        int iX = 0;
+        for (; iX + 3 < nXSize; iX += 4)
+        {
+            if (pafLine[iX] == fSrcNoDataValue || std::isnan(pafLine[iX]) ||
+                pafLine[iX + 1] == fSrcNoDataValue ||
+                std::isnan(pafLine[iX + 1]) ||
+                pafLine[iX + 2] == fSrcNoDataValue ||
+                std::isnan(pafLine[iX + 2]) ||
+                pafLine[iX + 3] == fSrcNoDataValue ||
+                std::isnan(pafLine[iX + 3]))
             {
-                for (int iX = 0; iX < nXSize; iX++)
-                {
-                    if (pafThreeLineWin[i * nXSize + iX] == fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[i * nXSize + iX]))
-                    {
-                        abLineHasNoDataValue[i] = true;
-                        break;
-                    }
-                }
+                return true;
             }
         }
+        for (; iX < nXSize; iX++)
+        {
+            if (pafLine[iX] == fSrcNoDataValue || std::isnan(pafLine[iX]))
+                return true;
+        }
     }
+    return false;
+}
+
+/************************************************************************/
+/*                          ComputeFirstLine()                          */
+/************************************************************************/
 
-    CPLErr eErr = CE_None;
+// Compute the first line of the raster from its first two lines.
+template <class T>
+void GDALGeneric3x3ProcessingContext<T>::ComputeFirstLine(
+    const T *pafLine1, const T *pafLine2, float *pafOutputBuf) const
+{
     if (bComputeAtEdges && nXSize >= 2 && nYSize >= 2)
     {
         for (int j = 0; j < nXSize; j++)
@@ -459,25 +474,22 @@ static CPLErr GDALGeneric3x3Processing(
             int jmin = (j == 0) ? j : j - 1;
             int jmax = (j == nXSize - 1) ? j : j + 1;
 
-            T afWin[9] = {
-                INTERPOL(pafThreeLineWin[jmin], pafThreeLineWin[nXSize + jmin],
-                         bSrcHasNoData, fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[j], pafThreeLineWin[nXSize + j],
-                         bSrcHasNoData, fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[jmax], pafThreeLineWin[nXSize + jmax],
-                         bSrcHasNoData, fSrcNoDataValue),
-                pafThreeLineWin[jmin],
-                pafThreeLineWin[j],
-                pafThreeLineWin[jmax],
-                pafThreeLineWin[nXSize + jmin],
-                pafThreeLineWin[nXSize + j],
-                pafThreeLineWin[nXSize + jmax]};
+            T afWin[9] = {INTERPOL(pafLine1[jmin], pafLine2[jmin],
+                                   bSrcHasNoData, fSrcNoDataValue),
+                          INTERPOL(pafLine1[j], pafLine2[j], bSrcHasNoData,
+                                   fSrcNoDataValue),
+                          INTERPOL(pafLine1[jmax], pafLine2[jmax],
+                                   bSrcHasNoData, fSrcNoDataValue),
+                          pafLine1[jmin],
+                          pafLine1[j],
+                          pafLine1[jmax],
+                          pafLine2[jmin],
+                          pafLine2[j],
+                          pafLine2[jmax]};
             pafOutputBuf[j] = ComputeVal(
                 CPL_TO_BOOL(bSrcHasNoData), fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
+                afWin, fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
         }
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, 0, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
     }
     else
     {
@@ -486,227 +498,495 @@ static CPLErr GDALGeneric3x3Processing(
         {
             pafOutputBuf[j] = fDstNoDataValue;
         }
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, 0, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
+    }
+}
 
-        if (eErr == CE_None && nYSize > 1)
-        {
-            eErr = GDALRasterIO(hDstBand, GF_Write, 0, nYSize - 1, nXSize, 1,
-                                pafOutputBuf, nXSize, 1, GDT_Float32, 0, 0);
-        }
+/************************************************************************/
+/*                            ComputeLine()                             */
+/************************************************************************/
+
+// Compute a line that is neither the first nor the last one of the raster,
+// from the previous line, itself and the next line.
+template <class T>
+void GDALGeneric3x3ProcessingContext<T>::ComputeLine(
+    const T *pafLine1, const T *pafLine2, const T *pafLine3,
+    bool bOneOfThreeLinesHasNoData, float *pafOutputBuf) const
+{
+    if (bComputeAtEdges && nXSize >= 2)
+    {
+        int j = 0;
+        T afWin[9] = {
+            INTERPOL(pafLine1[j], pafLine1[j + 1], bSrcHasNoData,
+                     fSrcNoDataValue),
+            pafLine1[j],
+            pafLine1[j + 1],
+            INTERPOL(pafLine2[j], pafLine2[j + 1], bSrcHasNoData,
+                     fSrcNoDataValue),
+            pafLine2[j],
+            pafLine2[j + 1],
+            INTERPOL(pafLine3[j], pafLine3[j + 1], bSrcHasNoData,
+                     fSrcNoDataValue),
+            pafLine3[j],
+            pafLine3[j + 1]};
+
+        pafOutputBuf[j] = ComputeVal(bOneOfThreeLinesHasNoData,
+                                     fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+                                     fDstNoDataValue, pfnAlg, pData,
+                                     bComputeAtEdges);
     }
-    if (eErr != CE_None)
+    else
     {
-        CPLFree(pafOutputBuf);
-        CPLFree(pafThreeLineWin);
+        // Exclude the edges
+        pafOutputBuf[0] = fDstNoDataValue;
+    }
 
-        return eErr;
+    int j = 1;
+    if (pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
+    {
+        j = pfnAlg_multisample(pafLine1, pafLine2, pafLine3, nXSize, pData,
+                               pafOutputBuf);
     }
 
-    int i = 1;  // Used after for.
-    for (; i < nYSize - 1; i++)
+    for (; j < nXSize - 1; j++)
     {
-        /* Read third line of the line buffer */
-        eErr =
-            GDALRasterIO(hSrcBand, GF_Read, 0, i + 1, nXSize, 1,
-                         pafThreeLineWin + nLine3Off, nXSize, 1, eReadDT, 0, 0);
-        if (eErr != CE_None)
+        T afWin[9] = {pafLine1[j - 1], pafLine1[j], pafLine1[j + 1],
+                      pafLine2[j - 1], pafLine2[j], pafLine2[j + 1],
+                      pafLine3[j - 1], pafLine3[j], pafLine3[j + 1]};
+
+        pafOutputBuf[j] = ComputeVal(bOneOfThreeLinesHasNoData,
+                                     fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+                                     fDstNoDataValue, pfnAlg, pData,
+                                     bComputeAtEdges);
+    }
+
+    if (bComputeAtEdges && nXSize >= 2)
+    {
+        j = nXSize - 1;
+
+        T afWin[9] = {pafLine1[j - 1],
+                      pafLine1[j],
+                      INTERPOL(pafLine1[j], pafLine1[j - 1], bSrcHasNoData,
+                               fSrcNoDataValue),
+                      pafLine2[j - 1],
+                      pafLine2[j],
+                      INTERPOL(pafLine2[j], pafLine2[j - 1], bSrcHasNoData,
+                               fSrcNoDataValue),
+                      pafLine3[j - 1],
+                      pafLine3[j],
+                      INTERPOL(pafLine3[j], pafLine3[j - 1], bSrcHasNoData,
+                               fSrcNoDataValue)};
+
+        pafOutputBuf[j] = ComputeVal(bOneOfThreeLinesHasNoData,
+                                     fSrcNoDataValue, bIsSrcNoDataNan, afWin,
+                                     fDstNoDataValue, pfnAlg, pData,
+                                     bComputeAtEdges);
+    }
+    else
+    {
+        // Exclude the edges
+        if (nXSize > 1)
+            pafOutputBuf[nXSize - 1] = fDstNoDataValue;
+    }
+}
+
+/************************************************************************/
+/*                          ComputeLastLine()                           */
+/************************************************************************/
+
+// Compute the last line of the raster from its last two lines.
+template <class T>
+void GDALGeneric3x3ProcessingContext<T>::ComputeLastLine(
+    const T *pafLine1, const T *pafLine2, float *pafOutputBuf) const
+{
+    if (bComputeAtEdges && nXSize >= 2 && nYSize >= 2)
+    {
+        for (int j = 0; j < nXSize; j++)
         {
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
+            int jmin = (j == 0) ? j : j - 1;
+            int jmax = (j == nXSize - 1) ? j : j + 1;
 
-            return eErr;
+            T afWin[9] = {
+                pafLine1[jmin],
+                pafLine1[j],
+                pafLine1[jmax],
+                pafLine2[jmin],
+                pafLine2[j],
+                pafLine2[jmax],
+                INTERPOL(pafLine2[jmin], pafLine1[jmin], bSrcHasNoData,
+                         fSrcNoDataValue),
+                INTERPOL(pafLine2[j], pafLine1[j], bSrcHasNoData,
+                         fSrcNoDataValue),
+                INTERPOL(pafLine2[jmax], pafLine1[jmax], bSrcHasNoData,
+                         fSrcNoDataValue),
+            };
+
+            pafOutputBuf[j] = ComputeVal(
+                CPL_TO_BOOL(bSrcHasNoData), fSrcNoDataValue, bIsSrcNoDataNan,
+                afWin, fDstNoDataValue, pfnAlg, pData, bComputeAtEdges);
+        }
+    }
+    else
+    {
+        // Exclude the edges
+        for (int j = 0; j < nXSize; j++)
+        {
+            pafOutputBuf[j] = fDstNoDataValue;
         }
+    }
+}
 
-        // In case none of the 3 lines have nodata values, then no need to
-        // check it in ComputeVal()
-        bool bOneOfThreeLinesHasNoData = CPL_TO_BOOL(bSrcHasNoData);
-        if (bSrcHasNoData)
+/************************************************************************/
+/*                       GDALDEMProcessByStrips()                       */
+/************************************************************************/
+
+// Maximum number of strips being processed or waiting to be consumed at once
+static int GDALDEMGetStripSlotCount(int nStrips, int nThreads)
+{
+    return std::min(nStrips, 2 * nThreads);
+}
+
+// Process nStrips strips with nThreads threads.
+// pfnComputeStrip(iStrip, iSlot) is called from worker threads, and
+// pfnStripDone(iStrip, iSlot) from the calling thread, in the order of strips,
+// once the strip has been computed. Both return false to stop processing.
+// iSlot, in [0, GDALDEMGetStripSlotCount()[ range, identifies the buffers
+// where a strip can be stored until it has been consumed. It is reused for
+// another strip afterwards.
+static bool GDALDEMProcessByStrips(
+    int nStrips, int nThreads,
+    const std::function<bool(int iStrip, int iSlot)> &pfnComputeStrip,
+    const std::function<bool(int iStrip, int iSlot)> &pfnStripDone)
+{
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return false;
+
+    CPLDebug("GDALDEM", "Processing %d strips using %d threads", nStrips,
+             nThreads);
+
+    const int nSlots = GDALDEMGetStripSlotCount(nStrips, nThreads);
+    std::vector<std::atomic<bool>> abSlotDone(nSlots);
+    std::atomic<bool> bError{false};
+
+    CPLErrorAccumulator oErrorAccumulator;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+    const auto SubmitStrip = [&](int iStrip)
+    {
+        const int iSlot = iStrip % nSlots;
+        abSlotDone[iSlot] = false;
+        const auto Job = [&pfnComputeStrip, &abSlotDone, &bError,
+                          &oErrorAccumulator, iStrip, iSlot]()
         {
-            if constexpr (std::numeric_limits<T>::is_integer)
+            auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+            try
             {
-                bool bLastLineHasNoDataValue = false;
-                int iX = 0;
-                for (; iX + 3 < nXSize; iX += 4)
-                {
-                    if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue ||
-                        pafThreeLineWin[nLine3Off + iX + 1] ==
-                            fSrcNoDataValue ||
-                        pafThreeLineWin[nLine3Off + iX + 2] ==
-                            fSrcNoDataValue ||
-                        pafThreeLineWin[nLine3Off + iX + 3] == fSrcNoDataValue)
-                    {
-                        bLastLineHasNoDataValue = true;
-                        break;
-                    }
-                }
-                if (!bLastLineHasNoDataValue)
-                {
-                    for (; iX < nXSize; iX++)
-                    {
-                        if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue)
-                        {
-                            bLastLineHasNoDataValue = true;
-                        }
-                    }
-                }
-                abLineHasNoDataValue[nLine3Off / nXSize] =
-                    bLastLineHasNoDataValue;
-
-                bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
-                                            abLineHasNoDataValue[1] ||
-                                            abLineHasNoDataValue[2];
+                if (!bError && !pfnComputeStrip(iStrip, iSlot))
+                    bError = true;
             }
-            else
+            catch (const std::exception &e)
             {
-                bool bLastLineHasNoDataValue = false;
-                int iX = 0;
-                for (; iX + 3 < nXSize; iX += 4)
-                {
-                    if (pafThreeLineWin[nLine3Off + iX] == fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX]) ||
-                        pafThreeLineWin[nLine3Off + iX + 1] ==
-                            fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX + 1]) ||
-                        pafThreeLineWin[nLine3Off + iX + 2] ==
-                            fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX + 2]) ||
-                        pafThreeLineWin[nLine3Off + iX + 3] ==
-                            fSrcNoDataValue ||
-                        std::isnan(pafThreeLineWin[nLine3Off + iX + 3]))
-                    {
-                        bLastLineHasNoDataValue = true;
-                        break;
-                    }
-                }
-                if (!bLastLineHasNoDataValue)
-                {
-                    for (; iX < nXSize; iX++)
-                    {
-                        if (pafThreeLineWin[nLine3Off + iX] ==
-                                fSrcNoDataValue ||
-                            std::isnan(pafThreeLineWin[nLine3Off + iX]))
-                        {
-                            bLastLineHasNoDataValue = true;
-                        }
-                    }
-                }
-                abLineHasNoDataValue[nLine3Off / nXSize] =
-                    bLastLineHasNoDataValue;
-
-                bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
-                                            abLineHasNoDataValue[1] ||
-                                            abLineHasNoDataValue[2];
+                CPLError(CE_Failure, CPLE_AppDefined, "%s", e.what());
+                bError = true;
             }
-        }
+            abSlotDone[iSlot] = true;
+        };
+        if (!poJobQueue->SubmitJob(Job))
+            bError = true;
+    };
 
-        if (bComputeAtEdges && nXSize >= 2)
-        {
-            int j = 0;
-            T afWin[9] = {INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j + 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
+    for (int iStrip = 0; iStrip < nSlots; ++iStrip)
+        SubmitStrip(iStrip);
 
-            pafOutputBuf[j] = ComputeVal(
-                bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
+    // Consume strips in order, and reuse the slot of each consumed strip for
+    // a new one.
+    int iStrip = 0;
+    while (iStrip < nStrips && !bError)
+    {
+        const int iSlot = iStrip % nSlots;
+        if (!abSlotDone[iSlot])
+        {
+            poJobQueue->WaitEvent();
+            continue;
         }
-        else
+        if (bError || !pfnStripDone(iStrip, iSlot))
         {
-            // Exclude the edges
-            pafOutputBuf[0] = fDstNoDataValue;
+            bError = true;
+            break;
         }
+        if (iStrip + nSlots < nStrips)
+            SubmitStrip(iStrip + nSlots);
+        ++iStrip;
+    }
+
+    poJobQueue->WaitCompletion();
+    oErrorAccumulator.ReplayErrors();
+
+    return !bError;
+}
+
+/************************************************************************/
+/*                    GDALGeneric3x3ProcessStrips()                     */
+/************************************************************************/
 
-        int j = 1;
-        if (pfnAlg_multisample && !bOneOfThreeLinesHasNoData)
+// Compute output lines [nYOff, nYOff + nYCount[ by strips of nStripHeight
+// lines processed in parallel. Each strip is computed from its own window of
+// source lines, that includes one line above and below it when available.
+// Source lines are read from hReadBand, under the protection of poReadMutex
+// if it is not null.
+// pfnStripDone() is called from the calling thread, in the order of strips,
+// and returns false to stop processing.
+template <class T>
+static bool GDALGeneric3x3ProcessStrips(
+    const GDALGeneric3x3ProcessingContext<T> &oCtx, GDALRasterBandH hReadBand,
+    std::mutex *poReadMutex, GDALDataType eReadDT, int nYOff, int nYCount,
+    int nThreads, int nStripHeight,
+    const std::function<bool(int nStripYOff, int nStripYSize,
+                             const float *pafStrip)> &pfnStripDone)
+{
+    const int nXSize = oCtx.nXSize;
+    const int nYSize = oCtx.nYSize;
+    const int nStrips = DIV_ROUND_UP(nYCount, nStripHeight);
+    std::vector<std::vector<float>> aafOutputBuf(
+        GDALDEMGetStripSlotCount(nStrips, nThreads));
+
+    const auto ComputeStrip = [&](int iStrip, int iSlot)
+    {
+        const int nStripYOff = nYOff + iStrip * nStripHeight;
+        const int nStripYSize =
+            std::min(nStripHeight, nYOff + nYCount - nStripYOff);
+        const int nSrcYOff = std::max(0, nStripYOff - 1);
+        const int nSrcYSize =
+            std::min(nYSize, nStripYOff + nStripYSize + 1) - nSrcYOff;
+
+        std::vector<T> aSrcBuf(static_cast<size_t>(nXSize) * nSrcYSize);
+        std::vector<float> &afOutputBuf = aafOutputBuf[iSlot];
+        afOutputBuf.resize(static_cast<size_t>(nXSize) * nStripYSize);
         {
-            j = pfnAlg_multisample(
-                pafThreeLineWin + nLine1Off, pafThreeLineWin + nLine2Off,
-                pafThreeLineWin + nLine3Off, nXSize, pData.get(), pafOutputBuf);
+            std::unique_lock<std::mutex> oLock;
+            if (poReadMutex)
+                oLock = std::unique_lock<std::mutex>(*poReadMutex);
+            if (GDALRasterIO(hReadBand, GF_Read, 0, nSrcYOff, nXSize,
+                             nSrcYSize, aSrcBuf.data(), nXSize, nSrcYSize,
+                             eReadDT, 0, 0) != CE_None)
+            {
+                return false;
+            }
         }
 
-        for (; j < nXSize - 1; j++)
+        std::vector<bool> abLineHasNoDataValue(nSrcYSize, false);
+        if (oCtx.bSrcHasNoData)
         {
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          pafThreeLineWin[nLine1Off + j + 1],
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          pafThreeLineWin[nLine2Off + j + 1],
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          pafThreeLineWin[nLine3Off + j + 1]};
+            for (int i = 0; i < nSrcYSize; ++i)
+            {
+                abLineHasNoDataValue[i] = oCtx.LineHasNoData(
+                    aSrcBuf.data() + static_cast<size_t>(i) * nXSize);
+            }
+        }
 
-            pafOutputBuf[j] = ComputeVal(
-                bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
+        for (int iY = nStripYOff; iY < nStripYOff + nStripYSize; ++iY)
+        {
+            const int iSrcLine = iY - nSrcYOff;
+            const T *pafLine =
+                aSrcBuf.data() + static_cast<size_t>(iSrcLine) * nXSize;
+            float *pafOutputBuf = afOutputBuf.data() +
+                                  static_cast<size_t>(iY - nStripYOff) * nXSize;
+            if (iY == 0)
+            {
+                oCtx.ComputeFirstLine(pafLine, pafLine + nXSize, pafOutputBuf);
+            }
+            else if (iY == nYSize - 1)
+            {
+                oCtx.ComputeLastLine(pafLine - nXSize, pafLine, pafOutputBuf);
+            }
+            else
+            {
+                const bool bOneOfThreeLinesHasNoData =
+                    abLineHasNoDataValue[iSrcLine - 1] ||
+                    abLineHasNoDataValue[iSrcLine] ||
+                    abLineHasNoDataValue[iSrcLine + 1];
+                oCtx.ComputeLine(pafLine - nXSize, pafLine, pafLine + nXSize,
+                                 bOneOfThreeLinesHasNoData, pafOutputBuf);
+            }
         }
+        return true;
+    };
+
+    const auto StripDone = [&](int iStrip, int iSlot)
+    {
+        const int nStripYOff = nYOff + iStrip * nStripHeight;
+        const int nStripYSize =
+            std::min(nStripHeight, nYOff + nYCount - nStripYOff);
+        return pfnStripDone(nStripYOff, nStripYSize,
+                            aafOutputBuf[iSlot].data());
+    };
+
+    return GDALDEMProcessByStrips(nStrips, nThreads, ComputeStrip, StripDone);
+}
+
+/************************************************************************/
+/*                  GDALGeneric3x3Processing()                          */
+/************************************************************************/
+
+template <class T>
+static CPLErr GDALGeneric3x3Processing(
+    GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand,
+    typename GDALGeneric3x3ProcessingAlg<T>::type pfnAlg,
+    typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
+        pfnAlg_multisample,
+    std::unique_ptr<AlgorithmParameters> pData, bool bComputeAtEdges,
+    int nThreads, GDALProgressFunc pfnProgress, void *pProgressData)
+{
+    if (pfnProgress == nullptr)
+        pfnProgress = GDALDummyProgress;
+
+    /* -------------------------------------------------------------------- */
+    /*      Initialize progress counter.                                    */
+    /* -------------------------------------------------------------------- */
+    if (!pfnProgress(0.0, nullptr, pProgressData))
+    {
+        CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+        return CE_Failure;
+    }
+
+    GDALGeneric3x3ProcessingContext<T> oCtx;
+    oCtx.pfnAlg = pfnAlg;
+    oCtx.pfnAlg_multisample = pfnAlg_multisample;
+    oCtx.pData = pData.get();
+    oCtx.bComputeAtEdges = bComputeAtEdges;
+    const GDALDataType eReadDT = oCtx.Init(hSrcBand, hDstBand);
+
+    const int nXSize = oCtx.nXSize;
+    const int nYSize = oCtx.nYSize;
+    const int bSrcHasNoData = oCtx.bSrcHasNoData;
 
-        if (bComputeAtEdges && nXSize >= 2)
+    /* -------------------------------------------------------------------- */
+    /*      Multi-threaded processing by strips of lines.                   */
+    /* -------------------------------------------------------------------- */
+    const int nStripHeight = GDALGetProcessingStripHeight(
+        nXSize, nYSize, nThreads, "GDAL_DEM_MIN_STRIP_HEIGHT");
+    if (nThreads > 1 && nYSize > nStripHeight)
+    {
+        GDALThreadSafeSourceBands oSrcBands(hSrcBand, nullptr, "GDALDEM");
+
+        const auto WriteStrip = [hDstBand, nXSize, nYSize, pfnProgress,
+                                 pProgressData](int nStripYOff, int nStripYSize,
+                                                const float *pafStrip)
         {
-            j = nXSize - 1;
+            if (GDALRasterIO(hDstBand, GF_Write, 0, nStripYOff, nXSize,
+                             nStripYSize, const_cast<float *>(pafStrip),
+                             nXSize, nStripYSize, GDT_Float32, 0,
+                             0) != CE_None)
+            {
+                return false;
+            }
+            if (!pfnProgress(1.0 * (nStripYOff + nStripYSize) / nYSize,
+                             nullptr, pProgressData))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                return false;
+            }
+            return true;
+        };
 
-            T afWin[9] = {pafThreeLineWin[nLine1Off + j - 1],
-                          pafThreeLineWin[nLine1Off + j],
-                          INTERPOL(pafThreeLineWin[nLine1Off + j],
-                                   pafThreeLineWin[nLine1Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine2Off + j - 1],
-                          pafThreeLineWin[nLine2Off + j],
-                          INTERPOL(pafThreeLineWin[nLine2Off + j],
-                                   pafThreeLineWin[nLine2Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue),
-                          pafThreeLineWin[nLine3Off + j - 1],
-                          pafThreeLineWin[nLine3Off + j],
-                          INTERPOL(pafThreeLineWin[nLine3Off + j],
-                                   pafThreeLineWin[nLine3Off + j - 1],
-                                   bSrcHasNoData, fSrcNoDataValue)};
+        if (!GDALGeneric3x3ProcessStrips(
+                oCtx, oSrcBands.GetSrcBand(), oSrcBands.GetMutex(), eReadDT,
+                0, nYSize, nThreads, nStripHeight, WriteStrip))
+        {
+            return CE_Failure;
+        }
+        return CE_None;
+    }
 
-            pafOutputBuf[j] = ComputeVal(
-                bOneOfThreeLinesHasNoData, fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
+    // 1 line destination buffer.
+    std::unique_ptr<float, VSIFreeReleaser> pafOutputBuf(
+        static_cast<float *>(VSI_MALLOC2_VERBOSE(sizeof(float), nXSize)));
+    // 3 line rotating source buffer.
+    std::unique_ptr<T, VSIFreeReleaser> pafThreeLineWin(
+        static_cast<T *>(VSI_MALLOC2_VERBOSE(3 * sizeof(T), nXSize)));
+    if (pafOutputBuf == nullptr || pafThreeLineWin == nullptr)
+    {
+        return CE_Failure;
+    }
+
+    int nLine1Off = 0;
+    int nLine2Off = nXSize;
+    int nLine3Off = 2 * nXSize;
+
+    // Move a 3x3 pafWindow over each cell
+    // (where the cell in question is #4)
+    //
+    //      0 1 2
+    //      3 4 5
+    //      6 7 8
+
+    /* Preload the first 2 lines */
+
+    bool abLineHasNoDataValue[3] = {CPL_TO_BOOL(bSrcHasNoData),
+                                    CPL_TO_BOOL(bSrcHasNoData),
+                                    CPL_TO_BOOL(bSrcHasNoData)};
+
+    for (int i = 0; i < 2 && i < nYSize; i++)
+    {
+        if (GDALRasterIO(hSrcBand, GF_Read, 0, i, nXSize, 1,
+                         pafThreeLineWin.get() + i * nXSize, nXSize, 1,
+                         eReadDT, 0, 0) != CE_None)
+        {
+            return CE_Failure;
         }
-        else
+        if (bSrcHasNoData)
+        {
+            abLineHasNoDataValue[i] =
+                oCtx.LineHasNoData(pafThreeLineWin.get() + i * nXSize);
+        }
+    }
+
+    oCtx.ComputeFirstLine(pafThreeLineWin.get(),
+                          pafThreeLineWin.get() + nXSize, pafOutputBuf.get());
+    CPLErr eErr = GDALRasterIO(hDstBand, GF_Write, 0, 0, nXSize, 1,
+                               pafOutputBuf.get(), nXSize, 1, GDT_Float32, 0, 0);
+    if (eErr != CE_None)
+        return eErr;
+
+    for (int i = 1; i < nYSize - 1; i++)
+    {
+        /* Read third line of the line buffer */
+        eErr = GDALRasterIO(hSrcBand, GF_Read, 0, i + 1, nXSize, 1,
+                            pafThreeLineWin.get() + nLine3Off, nXSize, 1,
+                            eReadDT, 0, 0);
+        if (eErr != CE_None)
+            return eErr;
+
+        // In case none of the 3 lines have nodata values, then no need to
+        // check it in ComputeVal()
+        bool bOneOfThreeLinesHasNoData = CPL_TO_BOOL(bSrcHasNoData);
+        if (bSrcHasNoData)
         {
-            // Exclude the edges
-            if (nXSize > 1)
-                pafOutputBuf[nXSize - 1] = fDstNoDataValue;
+            abLineHasNoDataValue[nLine3Off / nXSize] =
+                oCtx.LineHasNoData(pafThreeLineWin.get() + nLine3Off);
+
+            bOneOfThreeLinesHasNoData = abLineHasNoDataValue[0] ||
+                                        abLineHasNoDataValue[1] ||
+                                        abLineHasNoDataValue[2];
         }
 
+        oCtx.ComputeLine(pafThreeLineWin.get() + nLine1Off,
+                         pafThreeLineWin.get() + nLine2Off,
+                         pafThreeLineWin.get() + nLine3Off,
+                         bOneOfThreeLinesHasNoData, pafOutputBuf.get());
+
         /* -----------------------------------------
          * Write Line to Raster
          */
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, i, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
+        eErr = GDALRasterIO(hDstBand, GF_Write, 0, i, nXSize, 1,
+                            pafOutputBuf.get(), nXSize, 1, GDT_Float32, 0, 0);
         if (eErr != CE_None)
-        {
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
-
             return eErr;
-        }
 
         if (!pfnProgress(1.0 * (i + 1) / nYSize, nullptr, pProgressData))
         {
             CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-            eErr = CE_Failure;
-
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
-
-            return eErr;
+            return CE_Failure;
         }
 
         const int nTemp = nLine1Off;
@@ -715,53 +995,20 @@ static CPLErr GDALGeneric3x3Processing(
         nLine3Off = nTemp;
     }
 
-    if (bComputeAtEdges && nXSize >= 2 && nYSize >= 2)
+    if (nYSize > 1)
     {
-        for (int j = 0; j < nXSize; j++)
-        {
-            int jmin = (j == 0) ? j : j - 1;
-            int jmax = (j == nXSize - 1) ? j : j + 1;
-
-            T afWin[9] = {
-                pafThreeLineWin[nLine1Off + jmin],
-                pafThreeLineWin[nLine1Off + j],
-                pafThreeLineWin[nLine1Off + jmax],
-                pafThreeLineWin[nLine2Off + jmin],
-                pafThreeLineWin[nLine2Off + j],
-                pafThreeLineWin[nLine2Off + jmax],
-                INTERPOL(pafThreeLineWin[nLine2Off + jmin],
-                         pafThreeLineWin[nLine1Off + jmin], bSrcHasNoData,
-                         fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[nLine2Off + j],
-                         pafThreeLineWin[nLine1Off + j], bSrcHasNoData,
-                         fSrcNoDataValue),
-                INTERPOL(pafThreeLineWin[nLine2Off + jmax],
-                         pafThreeLineWin[nLine1Off + jmax], bSrcHasNoData,
-                         fSrcNoDataValue),
-            };
-
-            pafOutputBuf[j] = ComputeVal(
-                CPL_TO_BOOL(bSrcHasNoData), fSrcNoDataValue, bIsSrcNoDataNan,
-                afWin, fDstNoDataValue, pfnAlg, pData.get(), bComputeAtEdges);
-        }
-        eErr = GDALRasterIO(hDstBand, GF_Write, 0, i, nXSize, 1, pafOutputBuf,
-                            nXSize, 1, GDT_Float32, 0, 0);
+        oCtx.ComputeLastLine(pafThreeLineWin.get() + nLine1Off,
+                             pafThreeLineWin.get() + nLine2Off,
+                             pafOutputBuf.get());
+        eErr = GDALRasterIO(hDstBand, GF_Write, 0, nYSize - 1, nXSize, 1,
+                            pafOutputBuf.get(), nXSize, 1, GDT_Float32, 0, 0);
         if (eErr != CE_None)
-        {
-            CPLFree(pafOutputBuf);
-            CPLFree(pafThreeLineWin);
-
             return eErr;
-        }
     }
 
     pfnProgress(1.0, nullptr, pProgressData);
-    eErr = CE_None;
 
-    CPLFree(pafOutputBuf);
-    CPLFree(pafThreeLineWin);
-
-    return eErr;
+    return CE_None;
 }
 
 /************************************************************************/
@@ -1131,6 +1378,84 @@ static int GDALHillshadeAlg_same_res_multisample(
     }
     return j;
 }
+
+// Same as GDALHillshadeAlg<T, alg>(), processing 4 pixels at once.
+template <class T, class REG_T, GradientAlg alg>
+static int GDALHillshadeAlg_multisample(const T *pafFirstLine,
+                                        const T *pafSecondLine,
+                                        const T *pafThirdLine, int nXSize,
+                                        const AlgorithmParameters *pData,
+                                        float *pafOutputBuf)
+{
+    const GDALHillshadeAlgData *psData =
+        static_cast<const GDALHillshadeAlgData *>(pData);
+    const auto reg_inv_ewres = XMMReg4Double::Set1(psData->inv_ewres_xscale);
+    const auto reg_inv_nsres = XMMReg4Double::Set1(psData->inv_nsres_yscale);
+    const auto reg_fact_x =
+        XMMReg4Double::Set1(psData->sin_az_mul_cos_alt_mul_z_mul_254);
+    const auto reg_fact_y =
+        XMMReg4Double::Set1(psData->cos_az_mul_cos_alt_mul_z_mul_254);
+    const auto reg_constant_num =
+        XMMReg4Double::Set1(psData->sin_altRadians_mul_254);
+    const auto reg_square_z = XMMReg4Double::Set1(psData->square_z);
+    const auto reg_half = XMMReg4Double::Set1(0.5);
+    const auto reg_one = reg_half + reg_half;
+    const auto reg_one_float = XMMReg4Float::Set1(1.0f);
+
+    int j = 1;  // Used after for.
+    for (; j < nXSize - 4; j += 4)
+    {
+        const T *firstLine = pafFirstLine + j - 1;
+        const T *secondLine = pafSecondLine + j - 1;
+        const T *thirdLine = pafThirdLine + j - 1;
+
+        XMMReg4Double reg_x;
+        XMMReg4Double reg_y;
+        if constexpr (alg == GradientAlg::HORN)
+        {
+            const auto firstLine0 = REG_T::Load4Val(firstLine);
+            const auto firstLine1 = REG_T::Load4Val(firstLine + 1);
+            const auto firstLine2 = REG_T::Load4Val(firstLine + 2);
+            const auto secondLine0 = REG_T::Load4Val(secondLine);
+            const auto secondLine2 = REG_T::Load4Val(secondLine + 2);
+            const auto thirdLine0 = REG_T::Load4Val(thirdLine);
+            const auto thirdLine1 = REG_T::Load4Val(thirdLine + 1);
+            const auto thirdLine2 = REG_T::Load4Val(thirdLine + 2);
+
+            reg_x = ((firstLine0 + secondLine0 + secondLine0 + thirdLine0) -
+                     (firstLine2 + secondLine2 + secondLine2 + thirdLine2))
+                        .cast_to_double() *
+                    reg_inv_ewres;
+            reg_y = ((thirdLine0 + thirdLine1 + thirdLine1 + thirdLine2) -
+                     (firstLine0 + firstLine1 + firstLine1 + firstLine2))
+                        .cast_to_double() *
+                    reg_inv_nsres;
+        }
+        else
+        {
+            reg_x = (REG_T::Load4Val(secondLine) -
+                     REG_T::Load4Val(secondLine + 2))
+                        .cast_to_double() *
+                    reg_inv_ewres;
+            reg_y = (REG_T::Load4Val(thirdLine + 1) -
+                     REG_T::Load4Val(firstLine + 1))
+                        .cast_to_double() *
+                    reg_inv_nsres;
+        }
+
+        const auto reg_xx_plus_yy = reg_x * reg_x + reg_y * reg_y;
+        const auto reg_numerator =
+            reg_constant_num - (reg_y * reg_fact_y - reg_x * reg_fact_x);
+        const auto reg_denominator = reg_one + reg_square_z * reg_xx_plus_yy;
+        const auto num_div_sqrt_denom =
+            reg_numerator * reg_denominator.approx_inv_sqrt(reg_one, reg_half);
+
+        auto res = num_div_sqrt_denom.cast_to_float();
+        res = XMMReg4Float::Max(reg_one_float, res + reg_one_float);
+        res.Store4Val(pafOutputBuf + j);
+    }
+    return j;
+}
 #endif
 
 static const double INV_SQUARE_OF_HALF_PI = 1.0 / ((M_PI * M_PI) / 4);
@@ -2028,7 +2353,7 @@ static CPLErr
 GDALColorRelief(GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand1,
                 GDALRasterBandH hDstBand2, GDALRasterBandH hDstBand3,
                 GDALRasterBandH hDstBand4, const char *pszColorFilename,
-                ColorSelectionMode eColorSelectionMode,
+                ColorSelectionMode eColorSelectionMode, int nThreads,
                 GDALProgressFunc pfnProgress, void *pProgressData)
 {
     if (hSrcBand == nullptr || hDstBand1 == nullptr || hDstBand2 == nullptr ||
@@ -2059,57 +2384,30 @@ GDALColorRelief(GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand1,
     const int nXSize = GDALGetRasterBandXSize(hSrcBand);
     const int nYSize = GDALGetRasterBandYSize(hSrcBand);
 
-    std::unique_ptr<float, VSIFreeReleaser> pafSourceBuf;
-    std::unique_ptr<int, VSIFreeReleaser> panSourceBuf;
-    if (pabyPrecomputed)
-        panSourceBuf.reset(
-            static_cast<int *>(VSI_MALLOC2_VERBOSE(sizeof(int), nXSize)));
-    else
-        pafSourceBuf.reset(
-            static_cast<float *>(VSI_MALLOC2_VERBOSE(sizeof(float), nXSize)));
-    std::unique_ptr<GByte, VSIFreeReleaser> pabyDestBuf(
-        static_cast<GByte *>(VSI_MALLOC2_VERBOSE(4, nXSize)));
-    GByte *pabyDestBuf1 = pabyDestBuf.get();
-    GByte *pabyDestBuf2 = pabyDestBuf1 ? pabyDestBuf1 + nXSize : nullptr;
-    GByte *pabyDestBuf3 = pabyDestBuf2 ? pabyDestBuf2 + nXSize : nullptr;
-    GByte *pabyDestBuf4 = pabyDestBuf3 ? pabyDestBuf3 + nXSize : nullptr;
-
-    if ((pabyPrecomputed != nullptr && panSourceBuf == nullptr) ||
-        (pabyPrecomputed == nullptr && pafSourceBuf == nullptr) ||
-        pabyDestBuf1 == nullptr)
-    {
-        return CE_Failure;
-    }
-
     if (!pfnProgress(0.0, nullptr, pProgressData))
     {
         CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
         return CE_Failure;
     }
 
-    int nR = 0;
-    int nG = 0;
-    int nB = 0;
-    int nA = 0;
+    const GDALDataType eReadDT = pabyPrecomputed ? GDT_Int32 : GDT_Float32;
 
-    for (int i = 0; i < nYSize; i++)
+    // Compute the RGBA values of the nCount source values of pSrcBuf, into
+    // 4 consecutive planes of nCount values of pabyDestBuf.
+    const auto ComputeValues =
+        [&asColorAssociation, &pabyPrecomputed, nIndexOffset,
+         eColorSelectionMode](const void *pSrcBuf, size_t nCount,
+                              GByte *pabyDestBuf)
     {
-        /* Read source buffer */
-        CPLErr eErr = GDALRasterIO(
-            hSrcBand, GF_Read, 0, i, nXSize, 1,
-            panSourceBuf ? static_cast<void *>(panSourceBuf.get())
-                         : static_cast<void *>(pafSourceBuf.get()),
-            nXSize, 1, panSourceBuf ? GDT_Int32 : GDT_Float32, 0, 0);
-        if (eErr != CE_None)
-        {
-            return eErr;
-        }
-
+        GByte *pabyDestBuf1 = pabyDestBuf;
+        GByte *pabyDestBuf2 = pabyDestBuf1 + nCount;
+        GByte *pabyDestBuf3 = pabyDestBuf2 + nCount;
+        GByte *pabyDestBuf4 = pabyDestBuf3 + nCount;
         if (pabyPrecomputed)
         {
             const auto pabyPrecomputedRaw = pabyPrecomputed.get();
-            const auto panSourceBufRaw = panSourceBuf.get();
-            for (int j = 0; j < nXSize; j++)
+            const auto panSourceBufRaw = static_cast<const int *>(pSrcBuf);
+            for (size_t j = 0; j < nCount; j++)
             {
                 int nIndex = panSourceBufRaw[j] + nIndexOffset;
                 pabyDestBuf1[j] = pabyPrecomputedRaw[4 * nIndex];
@@ -2120,8 +2418,12 @@ GDALColorRelief(GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand1,
         }
         else
         {
-            const auto pafSourceBufRaw = pafSourceBuf.get();
-            for (int j = 0; j < nXSize; j++)
+            int nR = 0;
+            int nG = 0;
+            int nB = 0;
+            int nA = 0;
+            const auto pafSourceBufRaw = static_cast<const float *>(pSrcBuf);
+            for (size_t j = 0; j < nCount; j++)
             {
                 GDALColorReliefGetRGBA(asColorAssociation,
                                        double(pafSourceBufRaw[j]),
@@ -2132,34 +2434,129 @@ GDALColorRelief(GDALRasterBandH hSrcBand, GDALRasterBandH hDstBand1,
                 pabyDestBuf4[j] = static_cast<GByte>(nA);
             }
         }
+    };
 
-        /* -----------------------------------------
-         * Write Line to Raster
-         */
-        eErr = GDALRasterIO(hDstBand1, GF_Write, 0, i, nXSize, 1, pabyDestBuf1,
-                            nXSize, 1, GDT_Byte, 0, 0);
+    // Write nLines lines computed by ComputeValues() starting at line nYOff.
+    const auto WriteLines = [nXSize, nYSize, hDstBand1, hDstBand2, hDstBand3,
+                             hDstBand4, pfnProgress,
+                             pProgressData](int nYOff, int nLines,
+                                            GByte *pabyDestBuf)
+    {
+        const size_t nCount = static_cast<size_t>(nXSize) * nLines;
+        CPLErr eErr =
+            GDALRasterIO(hDstBand1, GF_Write, 0, nYOff, nXSize, nLines,
+                         pabyDestBuf, nXSize, nLines, GDT_Byte, 0, 0);
         if (eErr == CE_None)
         {
-            eErr = GDALRasterIO(hDstBand2, GF_Write, 0, i, nXSize, 1,
-                                pabyDestBuf2, nXSize, 1, GDT_Byte, 0, 0);
+            eErr = GDALRasterIO(hDstBand2, GF_Write, 0, nYOff, nXSize, nLines,
+                                pabyDestBuf + nCount, nXSize, nLines, GDT_Byte,
+                                0, 0);
         }
         if (eErr == CE_None)
         {
-            eErr = GDALRasterIO(hDstBand3, GF_Write, 0, i, nXSize, 1,
-                                pabyDestBuf3, nXSize, 1, GDT_Byte, 0, 0);
+            eErr = GDALRasterIO(hDstBand3, GF_Write, 0, nYOff, nXSize, nLines,
+                                pabyDestBuf + 2 * nCount, nXSize, nLines,
+                                GDT_Byte, 0, 0);
         }
         if (eErr == CE_None && hDstBand4)
         {
-            eErr = GDALRasterIO(hDstBand4, GF_Write, 0, i, nXSize, 1,
-                                pabyDestBuf4, nXSize, 1, GDT_Byte, 0, 0);
+            eErr = GDALRasterIO(hDstBand4, GF_Write, 0, nYOff, nXSize, nLines,
+                                pabyDestBuf + 3 * nCount, nXSize, nLines,
+                                GDT_Byte, 0, 0);
         }
 
-        if (eErr == CE_None &&
-            !pfnProgress(1.0 * (i + 1) / nYSize, nullptr, pProgressData))
+        if (eErr == CE_None && !pfnProgress(1.0 * (nYOff + nLines) / nYSize,
+                                            nullptr, pProgressData))
         {
             CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
             eErr = CE_Failure;
         }
+        return eErr;
+    };
+
+    /* -------------------------------------------------------------------- */
+    /*      Multi-threaded processing by strips of lines.                   */
+    /* -------------------------------------------------------------------- */
+    const int nStripHeight = GDALGetProcessingStripHeight(
+        nXSize, nYSize, nThreads, "GDAL_DEM_MIN_STRIP_HEIGHT");
+    if (nThreads > 1 && nYSize > nStripHeight)
+    {
+        GDALThreadSafeSourceBands oSrcBands(hSrcBand, nullptr, "GDALDEM");
+
+        const int nStrips = DIV_ROUND_UP(nYSize, nStripHeight);
+        std::vector<std::vector<GByte>> aabyDestBuf(
+            GDALDEMGetStripSlotCount(nStrips, nThreads));
+
+        const auto ComputeStrip = [&](int iStrip, int iSlot)
+        {
+            const int nStripYOff = iStrip * nStripHeight;
+            const int nStripYSize =
+                std::min(nStripHeight, nYSize - nStripYOff);
+            const size_t nCount = static_cast<size_t>(nXSize) * nStripYSize;
+            std::vector<GByte> abySrcBuf(nCount *
+                                         GDALGetDataTypeSizeBytes(eReadDT));
+            {
+                std::unique_lock<std::mutex> oLock;
+                if (auto poMutex = oSrcBands.GetMutex())
+                    oLock = std::unique_lock<std::mutex>(*poMutex);
+                if (GDALRasterIO(oSrcBands.GetSrcBand(), GF_Read, 0, nStripYOff,
+                                 nXSize, nStripYSize, abySrcBuf.data(), nXSize,
+                                 nStripYSize, eReadDT, 0, 0) != CE_None)
+                {
+                    return false;
+                }
+            }
+            aabyDestBuf[iSlot].resize(4 * nCount);
+            ComputeValues(abySrcBuf.data(), nCount, aabyDestBuf[iSlot].data());
+            return true;
+        };
+
+        const auto StripDone = [&](int iStrip, int iSlot)
+        {
+            const int nStripYOff = iStrip * nStripHeight;
+            const int nStripYSize =
+                std::min(nStripHeight, nYSize - nStripYOff);
+            return WriteLines(nStripYOff, nStripYSize,
+                              aabyDestBuf[iSlot].data()) == CE_None;
+        };
+
+        if (!GDALDEMProcessByStrips(nStrips, nThreads, ComputeStrip,
+                                    StripDone))
+        {
+            return CE_Failure;
+        }
+
+        pfnProgress(1.0, nullptr, pProgressData);
+
+        return CE_None;
+    }
+
+    std::unique_ptr<void, VSIFreeReleaser> pSourceBuf(VSI_MALLOC2_VERBOSE(
+        GDALGetDataTypeSizeBytes(eReadDT), nXSize));
+    std::unique_ptr<GByte, VSIFreeReleaser> pabyDestBuf(
+        static_cast<GByte *>(VSI_MALLOC2_VERBOSE(4, nXSize)));
+
+    if (pSourceBuf == nullptr || pabyDestBuf == nullptr)
+    {
+        return CE_Failure;
+    }
+
+    for (int i = 0; i < nYSize; i++)
+    {
+        /* Read source buffer */
+        CPLErr eErr = GDALRasterIO(hSrcBand, GF_Read, 0, i, nXSize, 1,
+                                   pSourceBuf.get(), nXSize, 1, eReadDT, 0, 0);
+        if (eErr != CE_None)
+        {
+            return eErr;
+        }
+
+        ComputeValues(pSourceBuf.get(), nXSize, pabyDestBuf.get());
+
+        /* -----------------------------------------
+         * Write Line to Raster
+         */
+        eErr = WriteLines(i, 1, pabyDestBuf.get());
         if (eErr != CE_None)
         {
             return eErr;
@@ -2446,6 +2843,10 @@ template <class T> class GDALGeneric3x3Dataset final : public GDALDataset
     int nCurLine = -1;
     const bool bComputeAtEdges;
     const bool bTakeReference;
+    const int nNumThreads;
+
+    // Used by multi-threaded reads of hSrcBand
+    std::unique_ptr<GDALThreadSafeSourceBands> poThreadSafeSrcBands{};
 
     using GDALDatasetRefCountedPtr =
         std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser>;
@@ -2462,7 +2863,7 @@ template <class T> class GDALGeneric3x3Dataset final : public GDALDataset
         typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
             pfnAlg_multisample,
         std::unique_ptr<AlgorithmParameters> pAlgData, bool bComputeAtEdges,
-        bool bTakeReferenceIn);
+        bool bTakeReferenceIn, int nNumThreadsIn);
     ~GDALGeneric3x3Dataset() override;
 
     bool InitOK() const
@@ -2496,6 +2897,11 @@ template <class T> class GDALGeneric3x3RasterBand final : public GDALRasterBand
                              GDALDataType eDstDataType);
 
     CPLErr IReadBlock(int, int, void *) override;
+    CPLErr IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize,
+                     int nYSize, void *pData, int nBufXSize, int nBufYSize,
+                     GDALDataType eBufType, GSpacing nPixelSpace,
+                     GSpacing nLineSpace,
+                     GDALRasterIOExtraArg *psExtraArg) override;
     double GetNoDataValue(int *pbHasNoData) override;
 
     int GetOverviewCount() override
@@ -2521,11 +2927,12 @@ GDALGeneric3x3Dataset<T>::GDALGeneric3x3Dataset(
     typename GDALGeneric3x3ProcessingAlg_multisample<T>::type
         pfnAlg_multisampleIn,
     std::unique_ptr<AlgorithmParameters> pAlgDataIn, bool bComputeAtEdgesIn,
-    bool bTakeReferenceIn)
+    bool bTakeReferenceIn, int nNumThreadsIn)
     : pfnAlg(pfnAlgIn), pfnAlg_multisample(pfnAlg_multisampleIn),
       pAlgData(std::move(pAlgDataIn)), hSrcDS(hSrcDSIn), hSrcBand(hSrcBandIn),
       bDstHasNoData(bDstHasNoDataIn), dfDstNoDataValue(dfDstNoDataValueIn),
-      bComputeAtEdges(bComputeAtEdgesIn), bTakeReference(bTakeReferenceIn)
+      bComputeAtEdges(bComputeAtEdgesIn), bTakeReference(bTakeReferenceIn),
+      nNumThreads(nNumThreadsIn)
 {
     CPLAssert(eDstDataType == GDT_Byte || eDstDataType == GDT_Float32);
 
@@ -2566,7 +2973,7 @@ GDALGeneric3x3Dataset<T>::GDALGeneric3x3Dataset(
                                static_cast<double>(nRasterYSize) /
                                    GDALGetRasterYSize(hOvrDS))
                          : nullptr,
-                bComputeAtEdges, false);
+                bComputeAtEdges, false, nNumThreads);
             if (poOvrDS->InitOK())
             {
                 m_apoOverviewDS.emplace_back(poOvrDS.release());
@@ -2975,6 +3382,102 @@ CPLErr GDALGeneric3x3RasterBand<T>::IReadBlock(int /*nBlockXOff*/,
     return CE_None;
 }
 
+/************************************************************************/
+/*                             IRasterIO()                              */
+/************************************************************************/
+
+template <class T>
+CPLErr GDALGeneric3x3RasterBand<T>::IRasterIO(
+    GDALRWFlag eRWFlag, int nXOff, int nYOff, int nXSize, int nYSize,
+    void *pData, int nBufXSize, int nBufYSize, GDALDataType eBufType,
+    GSpacing nPixelSpace, GSpacing nLineSpace,
+    GDALRasterIOExtraArg *psExtraArg)
+{
+    auto poGDS = cpl::down_cast<GDALGeneric3x3Dataset<T> *>(poDS);
+
+    // Requests of whole lines at full resolution are computed by strips in
+    // parallel when several threads are allowed.
+    const int nStripHeight =
+        GDALGetProcessingStripHeight(nRasterXSize, nYSize, poGDS->nNumThreads,
+                                     "GDAL_DEM_MIN_STRIP_HEIGHT");
+    if (eRWFlag == GF_Read && poGDS->nNumThreads > 1 && nXOff == 0 &&
+        nXSize == nRasterXSize && nBufXSize == nXSize &&
+        nBufYSize == nYSize && nYSize > nStripHeight)
+    {
+        if (!poGDS->poThreadSafeSrcBands)
+        {
+            poGDS->poThreadSafeSrcBands =
+                std::make_unique<GDALThreadSafeSourceBands>(
+                    poGDS->hSrcBand, nullptr, "GDALDEM");
+        }
+
+        GDALGeneric3x3ProcessingContext<T> oCtx;
+        oCtx.pfnAlg = poGDS->pfnAlg;
+        oCtx.pfnAlg_multisample = poGDS->pfnAlg_multisample;
+        oCtx.pData = poGDS->pAlgData.get();
+        oCtx.nXSize = nRasterXSize;
+        oCtx.nYSize = nRasterYSize;
+        oCtx.bSrcHasNoData = bSrcHasNoData;
+        oCtx.fSrcNoDataValue = fSrcNoDataValue;
+        oCtx.bIsSrcNoDataNan = bIsSrcNoDataNan;
+        oCtx.fDstNoDataValue = static_cast<float>(poGDS->dfDstNoDataValue);
+        oCtx.bComputeAtEdges = poGDS->bComputeAtEdges;
+
+        std::vector<GByte> abyLine;
+        if (eDataType == GDT_Byte)
+            abyLine.resize(nXSize);
+
+        const auto CopyStrip =
+            [this, &abyLine, pData, nYOff, nYSize, nXSize, eBufType,
+             nPixelSpace, nLineSpace,
+             psExtraArg](int nStripYOff, int nStripYSize, const float *pafStrip)
+        {
+            for (int iY = 0; iY < nStripYSize; ++iY)
+            {
+                const float *pafLine =
+                    pafStrip + static_cast<size_t>(iY) * nXSize;
+                GByte *pabyDst = static_cast<GByte *>(pData) +
+                                 (nStripYOff - nYOff + iY) * nLineSpace;
+                if (eDataType == GDT_Byte)
+                {
+                    // Same rounding as in IReadBlock()
+                    for (int j = 0; j < nXSize; j++)
+                        abyLine[j] = static_cast<GByte>(pafLine[j] + 0.5f);
+                    GDALCopyWords64(abyLine.data(), GDT_Byte, 1, pabyDst,
+                                    eBufType, static_cast<int>(nPixelSpace),
+                                    nXSize);
+                }
+                else
+                {
+                    GDALCopyWords64(pafLine, GDT_Float32,
+                                    static_cast<int>(sizeof(float)), pabyDst,
+                                    eBufType, static_cast<int>(nPixelSpace),
+                                    nXSize);
+                }
+            }
+            if (psExtraArg->pfnProgress &&
+                !psExtraArg->pfnProgress(
+                    1.0 * (nStripYOff + nStripYSize - nYOff) / nYSize, "",
+                    psExtraArg->pProgressData))
+            {
+                CPLError(CE_Failure, CPLE_UserInterrupt, "User terminated");
+                return false;
+            }
+            return true;
+        };
+
+        const bool bOK = GDALGeneric3x3ProcessStrips(
+            oCtx, poGDS->poThreadSafeSrcBands->GetSrcBand(),
+            poGDS->poThreadSafeSrcBands->GetMutex(), eReadDT, nYOff, nYSize,
+            poGDS->nNumThreads, nStripHeight, CopyStrip);
+        return bOK ? CE_None : CE_Failure;
+    }
+
+    return GDALRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
+                                     pData, nBufXSize, nBufYSize, eBufType,
+                                     nPixelSpace, nLineSpace, psExtraArg);
+}
+
 template <class T>
 double GDALGeneric3x3RasterBand<T>::GetNoDataValue(int *pbHasNoData)
 {
@@ -3074,6 +3577,12 @@ static std::unique_ptr<GDALArgumentParser> GDALDEMAppOptionsGetParser(
 
         subParser->add_creation_options_argument(psOptions->aosCreationOptions);
 
+        subParser->add_argument("-num_threads")
+            .metavar("<value>")
+            .store_into(psOptions->osNumThreads)
+            .help(_("Number of threads to use, or ALL_CPUS. Defaults to the "
+                    "GDAL_NUM_THREADS configuration option."));
+
         if (psOptionsForBinary)
         {
             subParser->add_quiet_argument(&psOptionsForBinary->bQuiet);
@@ -3883,6 +4392,12 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
                     GDALHillshadeAlg<float, GradientAlg::ZEVENBERGEN_THORNE>;
                 pfnAlgInt32 =
                     GDALHillshadeAlg<GInt32, GradientAlg::ZEVENBERGEN_THORNE>;
+#ifdef HAVE_16_SSE_REG
+                pfnAlgFloat_multisample = GDALHillshadeAlg_multisample<
+                    float, XMMReg4Float, GradientAlg::ZEVENBERGEN_THORNE>;
+                pfnAlgInt32_multisample = GDALHillshadeAlg_multisample<
+                    GInt32, XMMReg4Int, GradientAlg::ZEVENBERGEN_THORNE>;
+#endif
             }
         }
         else
@@ -3919,6 +4434,14 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
                 {
                     pfnAlgFloat = GDALHillshadeAlg<float, GradientAlg::HORN>;
                     pfnAlgInt32 = GDALHillshadeAlg<GInt32, GradientAlg::HORN>;
+#ifdef HAVE_16_SSE_REG
+                    pfnAlgFloat_multisample =
+                        GDALHillshadeAlg_multisample<float, XMMReg4Float,
+                                                     GradientAlg::HORN>;
+                    pfnAlgInt32_multisample =
+                        GDALHillshadeAlg_multisample<GInt32, XMMReg4Int,
+                                                     GradientAlg::HORN>;
+#endif
                 }
             }
         }
@@ -3998,6 +4521,13 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
             ? GDT_Byte
             : GDT_Float32;
 
+    CPLStringList aosThreadOptions;
+    if (!psOptions->osNumThreads.empty())
+        aosThreadOptions.SetNameValue("NUM_THREADS",
+                                      psOptions->osNumThreads.c_str());
+    const int nNumThreads =
+        GDALGetNumThreads(aosThreadOptions.List(), "NUM_THREADS");
+
     if (EQUAL(osFormat, "VRT"))
     {
         if (eUtilityMode == COLOR_RELIEF)
@@ -4104,7 +4634,8 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
                 auto poDS = std::make_unique<GDALGeneric3x3Dataset<GInt32>>(
                     hSrcDataset, hSrcBand, eDstDataType, bDstHasNoData,
                     dfDstNoDataValue, pfnAlgInt32, pfnAlgInt32_multisample,
-                    std::move(pData), psOptions->bComputeAtEdges, true);
+                    std::move(pData), psOptions->bComputeAtEdges, true,
+                    nNumThreads);
 
                 if (!(poDS->InitOK()))
                 {
@@ -4117,7 +4648,8 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
                 auto poDS = std::make_unique<GDALGeneric3x3Dataset<float>>(
                     hSrcDataset, hSrcBand, eDstDataType, bDstHasNoData,
                     dfDstNoDataValue, pfnAlgFloat, pfnAlgFloat_multisample,
-                    std::move(pData), psOptions->bComputeAtEdges, true);
+                    std::move(pData), psOptions->bComputeAtEdges, true,
+                    nNumThreads);
 
                 if (!(poDS->InitOK()))
                 {
@@ -4168,7 +4700,7 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
                         psOptions->bAddAlpha ? GDALGetRasterBand(hDstDataset, 4)
                                              : nullptr,
                         pszColorFilename, psOptions->eColorSelectionMode,
-                        pfnProgress, pProgressData);
+                        nNumThreads, pfnProgress, pProgressData);
     }
     else
     {
@@ -4179,15 +4711,15 @@ GDALDatasetH GDALDEMProcessing(const char *pszDest, GDALDatasetH hSrcDataset,
         {
             GDALGeneric3x3Processing<GInt32>(
                 hSrcBand, hDstBand, pfnAlgInt32, pfnAlgInt32_multisample,
-                std::move(pData), psOptions->bComputeAtEdges, pfnProgress,
-                pProgressData);
+                std::move(pData), psOptions->bComputeAtEdges, nNumThreads,
+                pfnProgress, pProgressData);
         }
         else
         {
             GDALGeneric3x3Processing<float>(
                 hSrcBand, hDstBand, pfnAlgFloat, pfnAlgFloat_multisample,
-                std::move(pData), psOptions->bComputeAtEdges, pfnProgress,
-                pProgressData);
+                std::move(pData), psOptions->bComputeAtEdges, nNumThreads,
+                pfnProgress, pProgressData);
         }
     }
 
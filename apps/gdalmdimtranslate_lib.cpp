@@ -16,6 +16,7 @@
 #include "gdal_utils.h"
 #include "gdal_utils_priv.h"
 #include "gdalargumentparser.h"
+#include "gdalmultidim_priv.h"
 #include "vrtdataset.h"
 #include <algorithm>
 #include <map>
@@ -40,6 +41,7 @@ struct GDALMultiDimTranslateOptions
     bool bUpdate = false;
     bool bOverwrite = false;
     bool bNoOverwrite = false;
+    std::string osNumThreads{};  // empty = single-threaded copy
 };
 
 /*************************************************************************/
@@ -123,6 +125,12 @@ GDALMultiDimTranslateAppOptionsGetParser(
         .store_into(psOptions->bStrict)
         .help(_("Turn warnings into failures."));
 
+    argParser->add_argument("-num_threads")
+        .metavar("<value>")
+        .store_into(psOptions->osNumThreads)
+        .help(_("Number of threads to use when copying arrays, or "
+                "ALL_CPUS. Defaults to 1."));
+
     // Undocumented option used by gdal mdim convert
     argParser->add_argument("--overwrite")
         .store_into(psOptions->bOverwrite)
@@ -721,11 +729,13 @@ GetDimensionDesc(DimensionRemapper &oDimRemapper,
 
 // foo
 // name=foo,transpose=[1,0],view=[0],dstname=bar,ot=Float32
+// name=foo,reduce=mean:time
 static bool ParseArraySpec(const std::string &arraySpec, std::string &srcName,
                            std::string &dstName, int &band,
                            std::vector<int> &anTransposedAxis,
                            std::string &viewExpr,
-                           GDALExtendedDataType &outputType, bool &bResampled)
+                           GDALExtendedDataType &outputType, bool &bResampled,
+                           std::string &reduceExpr)
 {
     if (!STARTS_WITH(arraySpec.c_str(), "name=") &&
         !STARTS_WITH(arraySpec.c_str(), "band="))
@@ -835,6 +845,17 @@ static bool ParseArraySpec(const std::string &arraySpec, std::string &srcName,
         {
             bResampled = CPLTestBool(token.c_str() + strlen("resample="));
         }
+        else if (STARTS_WITH(token.c_str(), "reduce="))
+        {
+            reduceExpr = token.substr(strlen("reduce="));
+            if (reduceExpr.find(':') == std::string::npos)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Invalid value for reduce. Expected "
+                         "{operation}:{dimension_name}");
+                return false;
+            }
+        }
         else
         {
             CPLError(CE_Failure, CPLE_AppDefined,
@@ -867,9 +888,11 @@ static bool TranslateArray(
     std::vector<int> anTransposedAxis;
     std::string viewExpr;
     bool bResampled = false;
+    std::string reduceExpr;
     GDALExtendedDataType outputType(GDALExtendedDataType::Create(GDT_Unknown));
     if (!ParseArraySpec(arraySpec, srcArrayName, dstArrayName, band,
-                        anTransposedAxis, viewExpr, outputType, bResampled))
+                        anTransposedAxis, viewExpr, outputType, bResampled,
+                        reduceExpr))
     {
         return false;
     }
@@ -911,6 +934,14 @@ static bool TranslateArray(
 
     auto tmpArray = srcArray;
 
+    if (!reduceExpr.empty())
+    {
+        auto newTmpArray = GDALMDArrayGetReducedFromExpr(tmpArray, reduceExpr);
+        if (!newTmpArray)
+            return false;
+        tmpArray = std::move(newTmpArray);
+    }
+
     if (bResampled)
     {
         auto newTmpArray =
@@ -1300,8 +1331,10 @@ static bool TranslateArray(
         return false;
 
     GUInt64 nCurCost = 0;
-    dstArray->CopyFromAllExceptValues(srcArray.get(), false, nCurCost, 0,
-                                      nullptr, nullptr);
+    // A reduced array has its own data type, nodata value and dimensions
+    dstArray->CopyFromAllExceptValues(
+        reduceExpr.empty() ? srcArray.get() : tmpArray.get(), false, nCurCost,
+        0, nullptr, nullptr);
     if (bResampled)
         dstArray->SetSpatialRef(tmpArray->GetSpatialRef().get());
 
@@ -1396,10 +1429,16 @@ static bool TranslateArray(
             band < 0 ? srcArray->GetFullName() : std::string(),
             band >= 1 ? CPLSPrintf("%d", band) : std::string(),
             std::move(anTransposedAxis),
-            bResampled ? (viewExpr.empty()
-                              ? std::string("resample=true")
-                              : std::string("resample=true,").append(viewExpr))
-                       : std::move(viewExpr),
+            (reduceExpr.empty()
+                 ? std::string()
+                 : std::string("reduce=")
+                       .append(reduceExpr)
+                       .append(bResampled || !viewExpr.empty() ? "," : "")) +
+                (bResampled
+                     ? (viewExpr.empty()
+                            ? std::string("resample=true")
+                            : std::string("resample=true,").append(viewExpr))
+                     : std::move(viewExpr)),
             std::move(anSrcOffset), std::move(anCount), std::move(anStep),
             std::move(anDstOffset));
         dstArray->AddSource(std::move(poSource));
@@ -1732,9 +1771,10 @@ CopyToNonMultiDimensionalDriver(GDALDriver *poDriver, const char *pszDest,
         GDALExtendedDataType outputType(
             GDALExtendedDataType::Create(GDT_Unknown));
         bool bResampled = false;
+        std::string reduceExpr;
         ParseArraySpec(psOptions->aosArraySpec[0], srcArrayName, dstArrayName,
                        band, anTransposedAxis, viewExpr, outputType,
-                       bResampled);
+                       bResampled, reduceExpr);
         srcArray = poRG->OpenMDArray(dstArrayName);
     }
     else
@@ -1804,6 +1844,34 @@ CopyToNonMultiDimensionalDriver(GDALDriver *poDriver, const char *pszDest,
         psOptions ? psOptions->pProgressData : nullptr));
 }
 
+/************************************************************************/
+/*                    CanReadAndWriteConcurrently()                     */
+/************************************************************************/
+
+// Whether arrays of poSrcDS can be read from a worker thread while arrays
+// of a dataset of poDstDriver are written. This is not the case when both
+// sides may use libhdf5, which is generally not thread-safe: the netCDF
+// driver serializes its calls with its own mutex, and the HDF5 based drivers
+// with another one (or none).
+static bool CanReadAndWriteConcurrently(GDALDataset *poSrcDS,
+                                        GDALDriver *poDstDriver)
+{
+    const auto MayUseLibHDF5 = [](GDALDriver *poDriver)
+    {
+        if (!poDriver)
+            return true;
+        // VRT datasets may reference datasets of any of those drivers
+        for (const char *pszDriverName :
+             {"HDF5", "BAG", "S102", "S104", "S111", "netCDF", "VRT"})
+        {
+            if (EQUAL(poDriver->GetDescription(), pszDriverName))
+                return true;
+        }
+        return false;
+    };
+    return !MayUseLibHDF5(poSrcDS->GetDriver()) || !MayUseLibHDF5(poDstDriver);
+}
+
 /************************************************************************/
 /*                        GDALMultiDimTranslate()                       */
 /************************************************************************/
@@ -1977,6 +2045,25 @@ GDALMultiDimTranslate(const char *pszDest, GDALDatasetH hDstDS, int nSrcCount,
         poTmpSrcDS = poTmpDS.get();
     }
 
+    // Let array copies (GDALMDArray::CopyFrom()) read source chunks in
+    // worker threads
+    std::unique_ptr<CPLConfigOptionSetter> poNumThreadsSetter;
+    if (psOptions && !psOptions->osNumThreads.empty())
+    {
+        if (CanReadAndWriteConcurrently(poSrcDS, poDriver))
+        {
+            poNumThreadsSetter = std::make_unique<CPLConfigOptionSetter>(
+                "GDAL_MDARRAY_COPY_NUM_THREADS",
+                psOptions->osNumThreads.c_str(), false);
+        }
+        else
+        {
+            CPLDebug("GDALMDIMTRANSLATE",
+                     "Source and output drivers may share a library that is "
+                     "not thread-safe: ignoring -num_threads");
+        }
+    }
+
     auto poRG(poTmpSrcDS->GetRootGroup());
     if (poRG &&
         poDriver->GetMetadataItem(GDAL_DCAP_CREATE_MULTIDIMENSIONAL) ==
@@ -142,6 +142,10 @@ struct GDALWarpAppOptions
 
     double dfErrorThreshold = -1;
 
+    /*! filename of a warp plan, created if it does not exist yet, and
+        reused otherwise. */
+    std::string osPlanFilename{};
+
     /*! the amount of memory (in megabytes) that the warp API is allowed
         to use for caching. */
     double dfWarpMemoryLimit = 0;
@@ -1578,6 +1582,22 @@ static bool CheckOptions(const char *pszDest, GDALDatasetH hDstDS,
             psOptions->dfErrorThreshold = 0.125;
     }
 
+    if (!psOptions->osPlanFilename.empty())
+    {
+        if (nSrcCount > 1)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "-plan can only be used with a single source dataset.");
+            return false;
+        }
+        if (psOptions->dfErrorThreshold == 0)
+        {
+            CPLError(CE_Failure, CPLE_NotSupported,
+                     "-plan cannot be used with an error threshold of 0.");
+            return false;
+        }
+    }
+
     /* -------------------------------------------------------------------- */
     /*      -te_srs option                                                  */
     /* -------------------------------------------------------------------- */
@@ -1668,6 +1688,119 @@ static bool CheckOptions(const char *pszDest, GDALDatasetH hDstDS,
     return true;
 }
 
+/************************************************************************/
+/*                        LoadOrCreateWarpPlan()                        */
+/************************************************************************/
+
+// Return a warp plan transformer for the warping of hSrcDS into hDstDS. If
+// the plan file exists, and has been created for the dimensions of the
+// datasets, the error threshold and a base transformer identical to the
+// passed one (same geotransforms, CRS and transformer options), it is loaded.
+// Otherwise the plan is built from the passed transformer and saved.
+static void *LoadOrCreateWarpPlan(GDALDatasetH hSrcDS, GDALDatasetH hDstDS,
+                                  GDALTransformerFunc pfnTransformer,
+                                  void *pTransformArg,
+                                  const GDALWarpAppOptions *psOptions)
+{
+    const char *pszFilename = psOptions->osPlanFilename.c_str();
+    const int nSrcXSize = GDALGetRasterXSize(hSrcDS);
+    const int nSrcYSize = GDALGetRasterYSize(hSrcDS);
+    const int nDstXSize = GDALGetRasterXSize(hDstDS);
+    const int nDstYSize = GDALGetRasterYSize(hDstDS);
+
+    VSIStatBufL sStat;
+    if (VSIStatL(pszFilename, &sStat) == 0)
+    {
+        CPLXMLTreeCloser poTree(CPLParseXMLFile(pszFilename));
+        const CPLXMLNode *psPlan =
+            poTree ? CPLGetXMLNode(poTree.get(), "=WarpPlanTransformer")
+                   : nullptr;
+        if (psPlan == nullptr)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined, "%s is not a warp plan.",
+                     pszFilename);
+            return nullptr;
+        }
+
+        const auto SerializeToString = [](const CPLXMLNode *psNode)
+        {
+            std::string osRet;
+            if (psNode)
+            {
+                char *pszXML = CPLSerializeXMLTree(psNode);
+                osRet = pszXML;
+                CPLFree(pszXML);
+            }
+            return osRet;
+        };
+
+        const CPLXMLNode *psBase = CPLGetXMLNode(psPlan, "BaseTransformer");
+        CPLXMLTreeCloser poCurBase(
+            GDALSerializeTransformer(pfnTransformer, pTransformArg));
+        std::string osMismatch;
+        if (atoi(CPLGetXMLValue(psPlan, "SrcXSize", "0")) != nSrcXSize ||
+            atoi(CPLGetXMLValue(psPlan, "SrcYSize", "0")) != nSrcYSize ||
+            atoi(CPLGetXMLValue(psPlan, "DstXSize", "0")) != nDstXSize ||
+            atoi(CPLGetXMLValue(psPlan, "DstYSize", "0")) != nDstYSize)
+        {
+            osMismatch = CPLSPrintf(
+                "a source raster of %s x %s pixels and a target raster of "
+                "%s x %s pixels, whereas the current source raster has "
+                "%d x %d pixels and the target raster %d x %d pixels",
+                CPLGetXMLValue(psPlan, "SrcXSize", ""),
+                CPLGetXMLValue(psPlan, "SrcYSize", ""),
+                CPLGetXMLValue(psPlan, "DstXSize", ""),
+                CPLGetXMLValue(psPlan, "DstYSize", ""), nSrcXSize, nSrcYSize,
+                nDstXSize, nDstYSize);
+        }
+        else if (CPLAtof(CPLGetXMLValue(psPlan, "MaxError", "0")) !=
+                 psOptions->dfErrorThreshold)
+        {
+            osMismatch = CPLSPrintf(
+                "an error threshold of %s, whereas the current one is %.17g",
+                CPLGetXMLValue(psPlan, "MaxError", ""),
+                psOptions->dfErrorThreshold);
+        }
+        else if (!psBase || !poCurBase ||
+                 SerializeToString(psBase->psChild) !=
+                     SerializeToString(poCurBase.get()))
+        {
+            osMismatch = "other geotransforms, coordinate reference systems "
+                         "or transformer options";
+        }
+
+        if (osMismatch.empty())
+        {
+            GDALTransformerFunc pfnPlanTransformer = nullptr;
+            void *pPlanTransformArg = nullptr;
+            GDALDeserializeTransformer(const_cast<CPLXMLNode *>(psPlan),
+                                       &pfnPlanTransformer,
+                                       &pPlanTransformArg);
+            return pPlanTransformArg;
+        }
+
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Warp plan %s has been created for %s. Rebuilding it.",
+                 pszFilename, osMismatch.c_str());
+    }
+
+    void *pPlanTransformArg = GDALCreateWarpPlanTransformer(
+        pfnTransformer, pTransformArg, nSrcXSize, nSrcYSize, nDstXSize,
+        nDstYSize, psOptions->dfErrorThreshold, nullptr);
+    if (pPlanTransformArg == nullptr)
+        return nullptr;
+    CPLXMLTreeCloser poTree(GDALSerializeTransformer(GDALWarpPlanTransform,
+                                                     pPlanTransformArg));
+    if (!poTree || !CPLSerializeXMLTreeToFile(poTree.get(), pszFilename))
+    {
+        CPLError(CE_Failure, CPLE_FileIO, "Cannot write warp plan %s.",
+                 pszFilename);
+        GDALDestroyWarpPlanTransformer(pPlanTransformArg);
+        return nullptr;
+    }
+    return pPlanTransformArg;
+}
+
 /************************************************************************/
 /*                       ProcessCutlineOptions()                        */
 /************************************************************************/
@@ -3223,6 +3356,36 @@ GDALWarpDirect(const char *pszDest, GDALDatasetH hDstDS, int nSrcCount,
         }
 #endif
 
+        /* --------------------------------------------------------------------
+         */
+        /*      Replace the transformer by a warp plan, loaded from disk */
+        /*      or built and saved for later reuse. */
+        /* --------------------------------------------------------------------
+         */
+        if (!psOptions->osPlanFilename.empty())
+        {
+            if (!bUseApproxTransformer)
+            {
+                CPLError(CE_Failure, CPLE_NotSupported,
+                         "-plan cannot be used when a vertical shift is "
+                         "applied.");
+                GDALReleaseDataset(hWrkSrcDS);
+                GDALReleaseDataset(hDstDS);
+                return nullptr;
+            }
+            hTransformArg.reset(LoadOrCreateWarpPlan(
+                hWrkSrcDS, hDstDS, pfnTransformer, hTransformArg.get(),
+                psOptions));
+            if (!hTransformArg)
+            {
+                GDALReleaseDataset(hWrkSrcDS);
+                GDALReleaseDataset(hDstDS);
+                return nullptr;
+            }
+            pfnTransformer = GDALWarpPlanTransform;
+            bUseApproxTransformer = false;
+        }
+
         /* --------------------------------------------------------------------
          */
         /*      Warp the transformer with a linear approximator unless the */
@@ -6032,6 +6195,11 @@ GDALWarpAppOptionsGetParser(GDALWarpAppOptions *psOptions,
             })
         .help(_("Error threshold."));
 
+    argParser->add_argument("-plan")
+        .metavar("<filename>")
+        .store_into(psOptions->osPlanFilename)
+        .help(_("Warp plan to reuse, or to create if it does not exist."));
+
     argParser->add_argument("-wm")
         .metavar("<memory_in_mb>")
         .action(
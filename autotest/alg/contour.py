@@ -607,3 +607,44 @@ cellsize     1
             elev_values.append((f["ELEV_MIN"], f["ELEV_MAX"]))
 
         assert elev_values == expected_elev_values, (elev_values, expected_elev_values)
+
+
+###############################################################################
+# Test that multi-threaded contour generation gives the same lines as the
+# single-threaded one
+
+
+@pytest.mark.parametrize("use_nodata", [False, True])
+@pytest.mark.parametrize("min_strip_height", ["1", "5", "30"])
+def test_contour_num_threads(use_nodata, min_strip_height):
+
+    src_ds = gdal.Open("../gdrivers/data/n43.tif")
+
+    def normalize(points):
+        if len(points) > 2 and points[0] == points[-1]:
+            # Closed lines may start at a different point
+            points = points[0:-1]
+            idx = points.index(min(points))
+            points = points[idx:] + points[0:idx]
+            points.append(points[0])
+        return points
+
+    def contour(num_threads):
+        ogr_ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+        lyr = ogr_ds.CreateLayer("contour", geom_type=ogr.wkbLineString)
+        lyr.CreateField(ogr.FieldDefn("ELEV", ogr.OFTReal))
+        options = ["LEVEL_INTERVAL=10", "ELEV_FIELD=0", "NUM_THREADS=" + num_threads]
+        if use_nodata:
+            options.append("NODATA=400")
+        with gdal.config_option("GDAL_CONTOUR_MIN_STRIP_HEIGHT", min_strip_height):
+            assert (
+                gdal.ContourGenerateEx(src_ds.GetRasterBand(1), lyr, options=options)
+                == gdal.CE_None
+            )
+        return sorted(
+            (f["ELEV"], normalize(f.GetGeometryRef().GetPoints())) for f in lyr
+        )
+
+    ref = contour("1")
+    assert ref
+    assert contour("4") == ref
@@ -12,6 +12,7 @@
 ###############################################################################
 
 import array
+import random
 import struct
 
 import pytest
@@ -386,3 +387,58 @@ def test_fillnodata_nearest(
         for i in range(height)
     ]
     assert got == expected
+
+
+###############################################################################
+# Test that multi-threaded filling gives the same result as the
+# single-threaded one
+
+
+@pytest.mark.parametrize("interpolation", ["INV_DIST", "NEAREST"])
+@pytest.mark.parametrize("max_search_dist", [0, 5])
+@pytest.mark.parametrize("smoothing_iterations", [0, 2])
+def test_fillnodata_num_threads(
+    interpolation, max_search_dist, smoothing_iterations
+):
+
+    width = 83
+    height = 131
+    rng = random.Random(0)
+    src_ds = gdal.GetDriverByName("MEM").Create(
+        "", width, height, 1, gdal.GDT_Float32
+    )
+    src_ds.GetRasterBand(1).SetNoDataValue(0)
+    src_ds.WriteRaster(
+        0,
+        0,
+        width,
+        height,
+        array.array(
+            "f",
+            [
+                0 if rng.random() < 0.9 else rng.uniform(1, 100)
+                for _ in range(width * height)
+            ],
+        ).tobytes(),
+    )
+
+    def fillnodata(num_threads):
+        ds = gdal.GetDriverByName("MEM").CreateCopy("", src_ds)
+        assert (
+            gdal.FillNodata(
+                targetBand=ds.GetRasterBand(1),
+                maskBand=None,
+                maxSearchDist=max_search_dist,
+                smoothingIterations=smoothing_iterations,
+                options=[
+                    "INTERPOLATION=" + interpolation,
+                    "NUM_THREADS=" + num_threads,
+                ],
+            )
+            == 0
+        )
+        return ds.ReadRaster()
+
+    ref = fillnodata("1")
+    assert ref != src_ds.ReadRaster()
+    assert fillnodata("4") == ref
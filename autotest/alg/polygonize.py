@@ -427,3 +427,42 @@ def test_polygonize_8():
         wkt
         == "POLYGON ((1 4,1 3,0 3,0 1,1 1,1 0,3 0,3 1,4 1,4 3,3 3,3 4,1 4),(1 3,3 3,3 1,1 1,1 3))"
     )
+
+
+###############################################################################
+# Test that multi-threaded polygonization gives the same polygons as the
+# single-threaded one
+
+
+@pytest.mark.parametrize("is_int_polygonize", [True, False])
+@pytest.mark.parametrize("connectedness", ["4", "8"])
+@pytest.mark.parametrize("use_mask", [False, True])
+@pytest.mark.parametrize("min_strip_height", ["1", "7", "64"])
+def test_polygonize_num_threads(
+    is_int_polygonize, connectedness, use_mask, min_strip_height
+):
+
+    src_ds = gdal.Open("data/polygonize_check_area.tif")
+    src_band = src_ds.GetRasterBand(1)
+    mask_band = src_band.GetMaskBand() if use_mask else None
+
+    def polygonize(num_threads):
+        mem_ds = ogr.GetDriverByName("MEM").CreateDataSource("out")
+        mem_layer = mem_ds.CreateLayer("poly", None, ogr.wkbPolygon)
+        mem_layer.CreateField(ogr.FieldDefn("DN", ogr.OFTInteger))
+        options = ["NUM_THREADS=" + num_threads]
+        # Only the presence of the 8CONNECTED option is tested
+        if connectedness == "8":
+            options.append("8CONNECTED=8")
+        func = gdal.Polygonize if is_int_polygonize else gdal.FPolygonize
+        with gdal.config_option(
+            "GDAL_POLYGONIZE_MIN_STRIP_HEIGHT", min_strip_height
+        ):
+            assert func(src_band, mask_band, mem_layer, 0, options) == 0
+        return sorted(
+            (f["DN"], f.GetGeometryRef().ExportToIsoWkt()) for f in mem_layer
+        )
+
+    ref = polygonize("1")
+    assert ref
+    assert polygonize("4") == ref
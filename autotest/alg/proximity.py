@@ -12,6 +12,8 @@
 ###############################################################################
 
 
+import struct
+
 import pytest
 
 from osgeo import gdal
@@ -109,3 +111,137 @@ def test_proximity_3():
     if cs != cs_expected:
         print("Got: ", cs)
         pytest.fail("got wrong checksum")
+
+
+###############################################################################
+# Test ALGORITHM=EDT against a brute-force computation
+
+
+def _brute_force_proximity(
+    values, xsize, ysize, targets, maxdist, nodata, src_nodata, fixed_buf_val
+):
+    import math
+
+    def is_target(val):
+        return val in targets if targets else val != 0
+
+    target_pixels = [
+        (x, y)
+        for y in range(ysize)
+        for x in range(xsize)
+        if is_target(values[y * xsize + x])
+    ]
+    out = []
+    for y in range(ysize):
+        for x in range(xsize):
+            val = values[y * xsize + x]
+            if is_target(val):
+                out.append(0.0)
+                continue
+            if src_nodata is not None and val == src_nodata:
+                out.append(nodata)
+                continue
+            best = min(
+                [(tx - x) ** 2 + (ty - y) ** 2 for (tx, ty) in target_pixels],
+                default=None,
+            )
+            if best is None or best > maxdist * maxdist:
+                out.append(nodata)
+            elif fixed_buf_val is not None:
+                out.append(fixed_buf_val)
+            else:
+                dist = math.sqrt(best)
+                out.append(struct.unpack("f", struct.pack("f", dist))[0])
+    return out
+
+
+@pytest.mark.parametrize(
+    "options",
+    [
+        [],
+        ["VALUES=1,2", "MAXDIST=6.5", "NODATA=-1"],
+        ["VALUES=1", "MAXDIST=10", "NODATA=-2", "FIXED_BUF_VAL=255"],
+        ["VALUES=1,2", "USE_INPUT_NODATA=YES", "NODATA=-1"],
+    ],
+)
+@pytest.mark.parametrize("num_threads", [1, 4])
+def test_proximity_edt(options, num_threads):
+
+    xsize = 37
+    ysize = 29
+    values = []
+    for y in range(ysize):
+        for x in range(xsize):
+            h = (x * 7919 + y * 104729 + x * y * 31) % 97
+            values.append(1 if h == 0 else 2 if h == 1 else 3 if h < 10 else 0)
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", xsize, ysize)
+    src_ds.GetRasterBand(1).WriteRaster(
+        0, 0, xsize, ysize, struct.pack("B" * len(values), *values)
+    )
+    src_ds.GetRasterBand(1).SetNoDataValue(3)
+
+    dst_ds = gdal.GetDriverByName("MEM").Create(
+        "", xsize, ysize, 1, gdal.GDT_Float32
+    )
+    gdal.ComputeProximity(
+        src_ds.GetRasterBand(1),
+        dst_ds.GetRasterBand(1),
+        options=options + ["ALGORITHM=EDT", f"NUM_THREADS={num_threads}"],
+    )
+    got = struct.unpack(
+        "f" * (xsize * ysize), dst_ds.GetRasterBand(1).ReadRaster()
+    )
+
+    opts = dict(opt.split("=") for opt in options)
+    expected = _brute_force_proximity(
+        values,
+        xsize,
+        ysize,
+        [int(v) for v in opts["VALUES"].split(",")] if "VALUES" in opts else [],
+        float(opts.get("MAXDIST", xsize + ysize)),
+        float(opts.get("NODATA", 65535)),
+        3 if opts.get("USE_INPUT_NODATA") == "YES" else None,
+        float(opts["FIXED_BUF_VAL"]) if "FIXED_BUF_VAL" in opts else None,
+    )
+    assert list(got) == expected
+
+
+###############################################################################
+# Test ALGORITHM=EDT against the default algorithm
+
+
+@pytest.mark.parametrize(
+    "options",
+    [[], ["VALUES=65,64", "MAXDIST=12", "USE_INPUT_NODATA=YES", "NODATA=0"]],
+)
+def test_proximity_edt_vs_classic(options):
+
+    src_ds = gdal.Open("data/pat.tif")
+    src_band = src_ds.GetRasterBand(1)
+
+    ref_ds = gdal.GetDriverByName("MEM").Create("", 25, 25, 1, gdal.GDT_Byte)
+    gdal.ComputeProximity(src_band, ref_ds.GetRasterBand(1), options=options)
+
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        dst_ds = gdal.GetDriverByName("MEM").Create(
+            "", 25, 25, 1, gdal.GDT_Byte
+        )
+        gdal.ComputeProximity(
+            src_band,
+            dst_ds.GetRasterBand(1),
+            options=options + ["ALGORITHM=EDT"],
+        )
+    assert dst_ds.ReadRaster() == ref_ds.ReadRaster()
+
+
+def test_proximity_invalid_algorithm():
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 1, 1)
+    dst_ds = gdal.GetDriverByName("MEM").Create("", 1, 1)
+    with pytest.raises(Exception, match="Unrecognized ALGORITHM value"):
+        gdal.ComputeProximity(
+            src_ds.GetRasterBand(1),
+            dst_ds.GetRasterBand(1),
+            options=["ALGORITHM=invalid"],
+        )
@@ -12,6 +12,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import random
 
 import gdaltest
 import pytest
@@ -341,3 +342,64 @@ def test_sieve_all_masked():
     gdal.SieveFilter(src_band, mask_band, src_band, 4, 4)
 
     assert src_band.Checksum() == expected_cs
+
+
+###############################################################################
+# Test that multi-threaded sieving gives the same result as the
+# single-threaded one
+
+
+@pytest.mark.parametrize("connectedness", [4, 8])
+@pytest.mark.parametrize("use_mask", [False, True])
+@pytest.mark.parametrize("in_place", [False, True])
+@pytest.mark.parametrize("min_strip_height", ["1", "7", "64"])
+def test_sieve_num_threads(connectedness, use_mask, in_place, min_strip_height):
+
+    width = 97
+    height = 113
+    rng = random.Random(0)
+    drv = gdal.GetDriverByName("MEM")
+    src_ds = drv.Create("", width, height, 1, gdal.GDT_Byte)
+    src_ds.WriteRaster(
+        0,
+        0,
+        width,
+        height,
+        bytes(rng.choice((1, 1, 2, 3)) for _ in range(width * height)),
+    )
+    mask_band = None
+    if use_mask:
+        mask_ds = drv.Create("", width, height, 1, gdal.GDT_Byte)
+        mask_ds.WriteRaster(
+            0,
+            0,
+            width,
+            height,
+            bytes(0 if rng.random() < 0.1 else 255 for _ in range(width * height)),
+        )
+        mask_band = mask_ds.GetRasterBand(1)
+
+    def sieve(num_threads):
+        if in_place:
+            dst_ds = drv.CreateCopy("", src_ds)
+            src_band = dst_ds.GetRasterBand(1)
+        else:
+            dst_ds = drv.Create("", width, height, 1, gdal.GDT_Byte)
+            src_band = src_ds.GetRasterBand(1)
+        with gdal.config_option("GDAL_SIEVE_MIN_STRIP_HEIGHT", min_strip_height):
+            assert (
+                gdal.SieveFilter(
+                    src_band,
+                    mask_band,
+                    dst_ds.GetRasterBand(1),
+                    5,
+                    connectedness,
+                    options=["NUM_THREADS=" + num_threads],
+                )
+                == 0
+            )
+        return dst_ds.ReadRaster()
+
+    ref = sieve("1")
+    assert ref != src_ds.ReadRaster()
+    assert sieve("4") == ref
@@ -2197,3 +2197,68 @@ def test_warp_mode_nan(dt):
 
     out_ds = gdal.Warp("", ds, options="-f MEM -r mode -ts 1 1")
     assert out_ds.ReadRaster(0, 0, 1, 1) == b"\xFF" * dtsize, gdal.GetDataTypeName(dt)
+
+
+###############################################################################
+# Test that the separable resampling code path, used for scale+translate
+# transformations, gives the same results as the generic one
+
+
+@pytest.mark.parametrize("resampling", ["bilinear", "cubic", "cubicspline", "lanczos"])
+@pytest.mark.parametrize("dt", [gdal.GDT_Byte, gdal.GDT_Int16, gdal.GDT_Float32])
+@pytest.mark.parametrize("nodata", [None, 0])
+@pytest.mark.parametrize("num_threads", [1, 3])
+def test_warp_separable_resampling(resampling, dt, nodata, num_threads):
+
+    gdaltest.importorskip_gdal_array()
+    np = pytest.importorskip("numpy")
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 200, 150, 2, dt)
+    src_ds.SetGeoTransform([1000, 1, 0, 2000, 0, -1])
+    y, x = np.mgrid[0:150, 0:200]
+    ar = 100 + 80 * np.sin(x * 0.1) * np.cos(y * 0.13)
+    ar[(x * 7 + y * 3) % 11 == 0] = 0
+    for i in range(2):
+        src_ds.GetRasterBand(i + 1).WriteArray(ar + i)
+        if nodata is not None:
+            src_ds.GetRasterBand(i + 1).SetNoDataValue(nodata)
+
+    def warp(separable):
+        debug_msgs = []
+
+        def handler(eErrClass, err_no, msg):
+            if eErrClass == gdal.CE_Debug:
+                debug_msgs.append(msg)
+
+        with gdaltest.error_handler(handler), gdal.config_options(
+            {"CPL_DEBUG": "GDAL", "WARP_THREAD_CHUNK_SIZE": "0"}
+        ):
+            gdal.SetCurrentErrorHandlerCatchDebug(True)
+            out_ds = gdal.Warp(
+                "",
+                src_ds,
+                format="MEM",
+                outputBounds=[1010.3, 1861.7, 1190.1, 1995.2],
+                width=37,
+                height=29,
+                resampleAlg=resampling,
+                warpOptions=[
+                    f"SEPARABLE_RESAMPLING={separable}",
+                    f"NUM_THREADS={num_threads}",
+                ],
+            )
+        used_separable = any("::GWKSeparableResample()" in msg for msg in debug_msgs)
+        return out_ds, used_separable
+
+    ref_ds, used_separable = warp("NO")
+    assert not used_separable
+    got_ds, used_separable = warp("YES")
+    assert used_separable
+    for i in range(2):
+        ref = ref_ds.GetRasterBand(i + 1).ReadAsArray().astype(np.float64)
+        got = got_ds.GetRasterBand(i + 1).ReadAsArray().astype(np.float64)
+        if dt == gdal.GDT_Float32:
+            np.testing.assert_allclose(got, ref, rtol=1e-5, atol=1e-3)
+        else:
+            # Rounding of values may differ
+            assert np.max(np.abs(got - ref)) <= 1
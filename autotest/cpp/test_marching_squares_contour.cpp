@@ -474,4 +474,138 @@ TEST_F(test_ms_contour, saddle_point)
                                      {0.9, 2}}));
     }
 }
+
+// Lines generated by processing horizontal strips of the raster separately,
+// and joining their unfinished lines, are the same as the ones generated by
+// processing the whole raster at once
+TEST_F(test_ms_contour, strips)
+{
+    // 5 x 6 pixels, with a nodata value
+    const double nodata = -1;
+    std::vector<double> data = {1, 2, 3,  2,  1,  //
+                                2, 8, 12, 8,  2,  //
+                                3, 9, -1, 13, 3,  //
+                                2, 8, 14, 9,  2,  //
+                                1, 3, 11, 4,  1,  //
+                                1, 2, 3,  2,  1};
+    const size_t width = 5;
+    const size_t height = 6;
+
+    struct LineCollector
+    {
+        // level, then points of each line
+        std::vector<std::pair<double, std::vector<std::pair<double, double>>>>
+            lines{};
+
+        void addLine(double level, LineString &ls, bool /* closed */)
+        {
+            std::vector<std::pair<double, double>> points;
+            for (const auto &pt : ls)
+                points.emplace_back(pt.x, pt.y);
+            // closed lines may start at a different point
+            if (points.size() > 2 && points.front() == points.back())
+            {
+                points.pop_back();
+                std::rotate(points.begin(),
+                            std::min_element(points.begin(), points.end()),
+                            points.end());
+                points.push_back(points.front());
+            }
+            lines.emplace_back(level, std::move(points));
+        }
+    };
+
+    IntervalLevelRangeIterator levels(0.0, 5.0, 1.0);
+
+    LineCollector ref;
+    {
+        SegmentMerger<LineCollector, IntervalLevelRangeIterator> writer(
+            ref, levels, /* polygonize */ false);
+        ContourGenerator<decltype(writer), IntervalLevelRangeIterator> cg(
+            width, height, /* hasNoData */ true, nodata, writer, levels);
+        for (size_t i = 0; i < height; ++i)
+            cg.feedLine(&data[i * width]);
+    }
+    std::sort(ref.lines.begin(), ref.lines.end());
+    ASSERT_FALSE(ref.lines.empty());
+
+    for (size_t stripHeight = 1; stripHeight < height; ++stripHeight)
+    {
+        LineCollector res;
+        {
+            SegmentMerger<LineCollector, IntervalLevelRangeIterator> writer(
+                res, levels, /* polygonize */ false);
+            for (size_t start = 0; start < height; start += stripHeight)
+            {
+                LevelLineStrings unfinishedLines;
+                {
+                    SegmentMerger<LineCollector, IntervalLevelRangeIterator>
+                        stripWriter(res, levels, /* polygonize */ false);
+                    ContourGenerator<decltype(stripWriter),
+                                     IntervalLevelRangeIterator>
+                        cg(width, height, /* hasNoData */ true, nodata,
+                           stripWriter, levels);
+                    if (start > 0)
+                    {
+                        cg.startAtLine(start, &data[(start - 1) * width]);
+                        stripWriter.setStripTopY(start - .5);
+                    }
+                    for (size_t i = start;
+                         i < std::min(height, start + stripHeight); ++i)
+                        cg.feedLine(&data[i * width]);
+                    unfinishedLines = stripWriter.takeUnfinishedLines();
+                }
+                writer.joinUnfinishedLines(unfinishedLines);
+            }
+        }
+        std::sort(res.lines.begin(), res.lines.end());
+        EXPECT_EQ(res.lines, ref.lines) << "stripHeight=" << stripHeight;
+    }
+}
 }  // namespace
+
+// Unfinished lines are not written by the destructor of SegmentMerger once
+// discardUnfinishedLines() has been called
+TEST_F(test_ms_contour, discard_unfinished_lines)
+{
+    std::vector<double> data = {1, 2, 3, 2, 1,  //
+                                2, 8, 9, 8, 2,  //
+                                3, 9, 9, 9, 3};
+    const size_t width = 5;
+    const size_t height = 6;
+
+    struct LineCounter
+    {
+        int count = 0;
+
+        void addLine(double /* level */, LineString & /* ls */,
+                     bool /* closed */)
+        {
+            ++count;
+        }
+    };
+
+    IntervalLevelRangeIterator levels(0.0, 5.0, 1.0);
+
+    for (const bool discard : {false, true})
+    {
+        LineCounter counter;
+        int countBeforeDestruction = 0;
+        {
+            SegmentMerger<LineCounter, IntervalLevelRangeIterator> writer(
+                counter, levels, /* polygonize */ false);
+            ContourGenerator<decltype(writer), IntervalLevelRangeIterator> cg(
+                width, height, /* hasNoData */ false, 0, writer, levels);
+            // Only feed the first lines, as if processing was interrupted
+            for (size_t i = 0; i < 3; ++i)
+                cg.feedLine(&data[i * width]);
+            if (discard)
+                writer.discardUnfinishedLines();
+            countBeforeDestruction = counter.count;
+        }
+        if (discard)
+            EXPECT_EQ(counter.count, countBeforeDestruction);
+        else
+            EXPECT_GT(counter.count, countBeforeDestruction);
+    }
+}
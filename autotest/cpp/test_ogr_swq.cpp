@@ -12,7 +12,9 @@
 
 #include "gdal_unit_test.h"
 
+#include "cpl_conv.h"
 #include "ogr_core.h"
+#include "ogr_feature.h"
 #include "ogr_geometry.h"
 #include "ogr_swq.h"
 
@@ -212,4 +214,126 @@ TEST_F(test_ogr_swq, select_unparse)
     }
 }
 
+TEST_F(test_ogr_swq, compiled_where)
+{
+    OGRFeatureDefn *poDefn = new OGRFeatureDefn("test");
+    poDefn->Reference();
+    {
+        OGRFieldDefn oFieldDefn("i", OFTInteger);
+        poDefn->AddFieldDefn(&oFieldDefn);
+    }
+    {
+        OGRFieldDefn oFieldDefn("i64", OFTInteger64);
+        poDefn->AddFieldDefn(&oFieldDefn);
+    }
+    {
+        OGRFieldDefn oFieldDefn("r", OFTReal);
+        poDefn->AddFieldDefn(&oFieldDefn);
+    }
+    {
+        OGRFieldDefn oFieldDefn("s", OFTString);
+        poDefn->AddFieldDefn(&oFieldDefn);
+    }
+    {
+        OGRFieldDefn oFieldDefn("b", OFTInteger);
+        oFieldDefn.SetSubType(OFSTBoolean);
+        poDefn->AddFieldDefn(&oFieldDefn);
+    }
+
+    std::vector<std::unique_ptr<OGRFeature>> apoFeatures;
+    for (int i = 0; i < 12; ++i)
+    {
+        auto poFeature = std::make_unique<OGRFeature>(poDefn);
+        poFeature->SetFID(i);
+        // Field 0 is unset every 4 features, and null every 5 features
+        if ((i % 4) != 0)
+            poFeature->SetField(0, i - 5);
+        if ((i % 5) == 0)
+            poFeature->SetFieldNull(0);
+        if ((i % 3) != 0)
+            poFeature->SetField(1,
+                                static_cast<GIntBig>(i) * 1000 * 1000 * 1000);
+        if ((i % 6) != 1)
+            poFeature->SetField(2, i * 0.5 - 1);
+        if ((i % 7) != 2)
+            poFeature->SetField(3, i % 2 ? "foo" : "Bar");
+        poFeature->SetField(4, i % 2);
+        apoFeatures.push_back(std::move(poFeature));
+    }
+
+    const struct
+    {
+        const char *pszExpr;
+        bool bMustBeCompiled;
+    } asTests[] = {
+        {"i = 1", true},
+        {"i <> 1", true},
+        {"i < 1", true},
+        {"1 < i", true},
+        {"i >= 1", true},
+        {"-2 >= i", true},
+        {"i BETWEEN -2 AND 2", true},
+        {"i IN (1, 3, -4)", true},
+        {"i IS NULL", true},
+        {"i IS NOT NULL", true},
+        {"i64 > 5000000000", true},
+        {"i64 IN (1000000000, 4000000000)", true},
+        {"r >= 1.5", true},
+        {"r = 1", true},
+        {"r BETWEEN 0.5 AND 2", true},
+        {"i = 1.5", false},
+        {"i < 1.5", false},
+        {"s = 'foo'", true},
+        {"s <> 'FOO'", true},
+        {"s > 'c'", true},
+        {"'c' > s", true},
+        {"s IN ('x', 'bar')", true},
+        {"s BETWEEN 'a' AND 'c'", true},
+        {"s LIKE 'f%'", true},
+        {"s ILIKE 'B_R'", true},
+        {"s IS NULL", true},
+        {"b = 1", true},
+        {"FID = 2", true},
+        {"FID IN (1, 5, 7)", true},
+        {"NOT (i = 1)", true},
+        {"NOT (i > 0)", true},
+        {"i > 0 AND s = 'foo'", true},
+        {"i > 0 OR s = 'foo'", true},
+        {"NOT (i > 0 AND r > 1)", true},
+        {"NOT (i > 0 OR r > 1)", true},
+        {"NOT (NOT (i > 0) AND s LIKE 'b%')", true},
+        {"i + 1 = 2", false},
+        {"s = '2020-01-01T00:00:00+00'", false},
+    };
+
+    for (const auto &sTest : asTests)
+    {
+        OGRFeatureQuery oQuery;
+        ASSERT_EQ(oQuery.Compile(poDefn, sTest.pszExpr), OGRERR_NONE)
+            << sTest.pszExpr;
+        if (sTest.bMustBeCompiled)
+        {
+            EXPECT_NE(oQuery.GetCompiledProgram(), nullptr) << sTest.pszExpr;
+        }
+
+        OGRFeatureQuery oRefQuery;
+        {
+            CPLConfigOptionSetter oSetter("OGR_FEATURE_QUERY_COMPILED", "NO",
+                                          false);
+            ASSERT_EQ(oRefQuery.Compile(poDefn, sTest.pszExpr), OGRERR_NONE);
+        }
+        ASSERT_EQ(oRefQuery.GetCompiledProgram(), nullptr);
+
+        for (const auto &poFeature : apoFeatures)
+        {
+            EXPECT_EQ(oQuery.Evaluate(poFeature.get()),
+                      oRefQuery.Evaluate(poFeature.get()))
+                << sTest.pszExpr << " on feature " << poFeature->GetFID();
+        }
+    }
+
+    apoFeatures.clear();
+    poDefn->Release();
+}
+
 }  // namespace
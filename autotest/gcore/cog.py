@@ -677,6 +677,44 @@ def test_cog_byte_to_web_mercator_manual():
     gdal.Unlink(directory)
 
 
+###############################################################################
+# Test reprojection without materializing a temporary warped file
+
+
+def test_cog_byte_to_web_mercator_no_warp_temp_file(tmp_vsimem):
+
+    src_ds = gdal.Open("data/byte.tif")
+    options = ["BLOCKSIZE=256", "TILING_SCHEME=GoogleMapsCompatible"]
+
+    filename_ref = str(tmp_vsimem / "ref.tif")
+    with gdal.config_option("COG_DELETE_TEMP_FILES", "NO"):
+        assert gdal.GetDriverByName("COG").CreateCopy(
+            filename_ref, src_ds, options=options
+        )
+    assert gdal.VSIStatL(filename_ref + ".warped.tif.tmp") is not None
+
+    filename = str(tmp_vsimem / "cog.tif")
+    with gdal.config_option("COG_DELETE_TEMP_FILES", "NO"):
+        assert gdal.GetDriverByName("COG").CreateCopy(
+            filename, src_ds, options=options + ["WARP_TEMP_FILE=NO"]
+        )
+    assert gdal.VSIStatL(filename + ".warped.tif.tmp") is None
+
+    ref_ds = gdal.Open(filename_ref)
+    ds = gdal.Open(filename)
+    assert ds.RasterCount == ref_ds.RasterCount
+    assert ds.RasterXSize == ref_ds.RasterXSize
+    assert ds.RasterYSize == ref_ds.RasterYSize
+    assert ds.GetGeoTransform() == pytest.approx(ref_ds.GetGeoTransform())
+    assert ds.GetRasterBand(1).GetBlockSize() == [256, 256]
+    assert (
+        ds.GetRasterBand(1).GetOverviewCount()
+        == ref_ds.GetRasterBand(1).GetOverviewCount()
+    )
+    assert gdaltest.compare_ds(ds, ref_ds, verbose=0) <= 1
+    assert ds.GetMetadataItem("LAYOUT", "IMAGE_STRUCTURE") == "COG"
+
+
 ###############################################################################
 # Test OVERVIEWS creation option
 
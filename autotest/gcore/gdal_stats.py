@@ -1150,3 +1150,88 @@ def test_stats_float64_nan_with_nodata(tmp_vsimem, GDAL_STATS_USE_FLOAT64_OPTIM)
         assert got_stats == expected_stats
     else:
         assert got_stats == pytest.approx(expected_stats, rel=1e-15)
+
+
+###############################################################################
+# Test that GDAL_NUM_THREADS gives the same results as the single-threaded
+# code path
+
+
+@pytest.mark.parametrize(
+    "datatype",
+    [
+        gdal.GDT_Byte,
+        gdal.GDT_UInt16,
+        gdal.GDT_Int16,
+        gdal.GDT_Float32,
+        gdal.GDT_Float64,
+    ],
+)
+@pytest.mark.parametrize("nodata,with_mask", [(None, False), (7, False), (None, True)])
+def test_stats_multithreaded(tmp_vsimem, datatype, nodata, with_mask):
+
+    width = 1100
+    height = 1000
+    mem_ds = gdal.GetDriverByName("MEM").Create("", width, height)
+    mem_ds.WriteRaster(
+        0,
+        0,
+        width,
+        height,
+        bytes((x * 7 + y * 13) % 251 for y in range(height) for x in range(width)),
+    )
+
+    filename = tmp_vsimem / "test.tif"
+    ds = gdal.Translate(
+        filename,
+        mem_ds,
+        outputType=datatype,
+        noData=nodata,
+        creationOptions=["TILED=YES"],
+    )
+    if with_mask:
+        ds.CreateMaskBand(gdal.GMF_PER_DATASET)
+        ds.GetRasterBand(1).GetMaskBand().Fill(255)
+        ds.GetRasterBand(1).GetMaskBand().WriteRaster(
+            300, 200, 500, 400, b"\x00" * (500 * 400)
+        )
+    ds = None
+
+    def compute():
+        debug_msgs = []
+
+        def handler(eErrClass, err_no, msg):
+            if eErrClass == gdal.CE_Debug:
+                debug_msgs.append(msg)
+
+        ds = gdal.Open(filename)
+        band = ds.GetRasterBand(1)
+        with gdaltest.error_handler(handler), gdaltest.config_option(
+            "CPL_DEBUG", "GDAL"
+        ):
+            gdal.SetCurrentErrorHandlerCatchDebug(True)
+            stats = band.ComputeStatistics(False)
+            minmax = band.ComputeRasterMinMax(False)
+            hist = band.GetHistogram(-0.5, 255.5, 256, False, False)
+        # Traces of the calls that used the multi-threaded code path
+        mt_msgs = [msg for msg in debug_msgs if "blocks of band 1" in msg]
+        return stats, minmax, hist, mt_msgs
+
+    with gdal.config_option("GDAL_NUM_THREADS", "1"):
+        stats, minmax, hist, mt_msgs = compute()
+    assert mt_msgs == []
+    with gdal.config_option("GDAL_NUM_THREADS", "4"):
+        mt_stats, mt_minmax, mt_hist, mt_msgs = compute()
+    # 5x4 blocks of 256x256 pixels are processed by 4 threads
+    assert len(mt_msgs) == 3
+    assert all("Processing 20 blocks" in msg for msg in mt_msgs)
+    assert all("using 4 threads" in msg for msg in mt_msgs)
+
+    assert mt_stats[0:2] == stats[0:2]
+    if datatype in (gdal.GDT_Byte, gdal.GDT_UInt16) and not with_mask:
+        # Integer code path
+        assert mt_stats == stats
+    else:
+        assert mt_stats == pytest.approx(stats, rel=1e-12)
+    assert mt_minmax == minmax
+    assert mt_hist == hist
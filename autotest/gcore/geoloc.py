@@ -378,6 +378,74 @@ def test_geoloc_affine_transformation_with_noise(step, convention):
     gdal.Unlink("/vsimem/lat.tif")
 
 
+###############################################################################
+# Test that building the backmap with several threads gives the same result
+# as with a single thread
+
+
+@pytest.mark.parametrize("use_temp_datasets", ["YES", "NO"])
+def test_geoloc_backmap_multithreaded(tmp_vsimem, use_temp_datasets):
+
+    r = random.Random(0)
+
+    # Larger than the 256x256 tiles used to build the backmap
+    size = 600
+    lon_ds = gdal.GetDriverByName("GTiff").Create(
+        tmp_vsimem / "lon.tif", size, size, 1, gdal.GDT_Float32
+    )
+    lat_ds = gdal.GetDriverByName("GTiff").Create(
+        tmp_vsimem / "lat.tif", size, size, 1, gdal.GDT_Float32
+    )
+    for y in range(size):
+        vals = array.array(
+            "f",
+            [
+                -80 + 0.01 * (x + 0.2 * y) + r.uniform(-0.002, 0.002)
+                for x in range(size)
+            ],
+        )
+        lon_ds.WriteRaster(0, y, size, 1, vals)
+        vals = array.array(
+            "f",
+            [
+                50 - 0.01 * (y + 0.1 * x) + r.uniform(-0.002, 0.002)
+                for x in range(size)
+            ],
+        )
+        lat_ds.WriteRaster(0, y, size, 1, vals)
+    lon_ds = None
+    lat_ds = None
+
+    ds = gdal.GetDriverByName("MEM").Create("", size, size)
+    md = {
+        "LINE_OFFSET": "0",
+        "LINE_STEP": "1",
+        "PIXEL_OFFSET": "0",
+        "PIXEL_STEP": "1",
+        "X_DATASET": str(tmp_vsimem / "lon.tif"),
+        "X_BAND": "1",
+        "Y_DATASET": str(tmp_vsimem / "lat.tif"),
+        "Y_BAND": "1",
+        "SRS": "EPSG:4326",
+    }
+    ds.SetMetadata(md, "GEOLOCATION")
+
+    points = [
+        (-80 + 0.01 * (x + 0.2 * y), 50 - 0.01 * (y + 0.1 * x))
+        for y in range(0, size, 7)
+        for x in range(0, size, 7)
+    ]
+
+    res = []
+    with gdaltest.config_option("GDAL_GEOLOC_USE_TEMP_DATASETS", use_temp_datasets):
+        for num_threads in (1, 4):
+            tr = gdal.Transformer(ds, None, [f"NUM_THREADS={num_threads}"])
+            res.append(tr.TransformPoints(True, points))
+            tr = None
+
+    assert res[0] == res[1]
+
+
 ###############################################################################
 # Test GEOLOC_ARRAY transformer option to have the warped dataset != geolocation dataset
 
@@ -15,6 +15,7 @@ import array
 import itertools
 import json
 import math
+import re
 import struct
 
 import gdaltest
@@ -1954,3 +1955,214 @@ def test_multidim_dataset_as_mdarray_errors():
     with pytest.raises(Exception, match="Illegal value for DIM_ORDER option"):
         with gdal.GetDriverByName("MEM").Create("", 1, 1, 1) as ds:
             ds.AsMDArray(["DIM_ORDER=invalid"])
+
+
+###############################################################################
+@pytest.mark.require_driver("Zarr")
+@pytest.mark.parametrize("use_config_option", [False, True])
+@pytest.mark.parametrize("cache_size", ["100", "1000", "1KB"])
+def test_multidim_chunk_cache(tmp_vsimem, use_config_option, cache_size):
+
+    filename = str(tmp_vsimem / "test.zarr")
+    with gdal.GetDriverByName("Zarr").CreateMultiDimensional(filename) as ds:
+        rg = ds.GetRootGroup()
+        dim0 = rg.CreateDimension("dim0", None, None, 10)
+        dim1 = rg.CreateDimension("dim1", None, None, 13)
+        ar = rg.CreateMDArray(
+            "test",
+            [dim0, dim1],
+            gdal.ExtendedDataType.Create(gdal.GDT_Int16),
+            ["BLOCKSIZE=3,4"],
+        )
+        assert ar.Write(array.array("h", list(range(10 * 13)))) == gdal.CE_None
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("test")
+    ref = ds.GetRootGroup().OpenMDArray("test")
+
+    # Chunks are 24 bytes large: a 100 byte cache can only hold 4 of them,
+    # and larger requests bypass it.
+    if use_config_option:
+        with gdal.config_option("GDAL_MDARRAY_CHUNK_CACHE_SIZE", cache_size):
+            ds_cached = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+            cached = ds_cached.GetRootGroup().OpenMDArray("test")
+            cached.Read(array_start_idx=[0, 0], count=[1, 1])
+    else:
+        with pytest.raises(Exception, match="cannot be cached"):
+            with gdaltest.enable_exceptions():
+                ar.GetChunkCached(["CACHE_SIZE=10"])
+        with pytest.raises(Exception, match="Invalid value for CACHE_SIZE"):
+            with gdaltest.enable_exceptions():
+                ar.GetChunkCached(["CACHE_SIZE=invalid"])
+        cached = ar.GetChunkCached(["CACHE_SIZE=" + cache_size])
+        assert cached.GetDimensionCount() == 2
+        assert cached.GetBlockSize() == [3, 4]
+
+    for kwargs in [
+        {},
+        {"array_start_idx": [1, 2], "count": [5, 7]},
+        {"array_start_idx": [9, 12], "count": [4, 5], "array_step": [-2, -3]},
+        {"array_start_idx": [2, 0], "count": [3, 13], "array_step": [0, 1]},
+        {"array_start_idx": [0, 1], "count": [10, 4], "array_step": [1, 3]},
+        {
+            "array_start_idx": [3, 3],
+            "count": [4, 2],
+            "buffer_datatype": gdal.ExtendedDataType.Create(gdal.GDT_Float64),
+        },
+    ]:
+        assert cached.Read(**kwargs) == ref.Read(**kwargs), kwargs
+        # Second read served from the cache
+        assert cached.Read(**kwargs) == ref.Read(**kwargs), kwargs
+
+    # The cache reports its statistics when it is destroyed
+    debug_msgs = []
+
+    def handler(eErrClass, err_no, msg):
+        if eErrClass == gdal.CE_Debug and "Chunk cache of" in msg:
+            debug_msgs.append(msg)
+
+    with gdaltest.error_handler(handler), gdal.config_option("CPL_DEBUG", "ON"):
+        gdal.SetCurrentErrorHandlerCatchDebug(True)
+        del cached
+        if use_config_option:
+            del ds_cached
+
+    assert len(debug_msgs) == 1
+    m = re.match(
+        r"GDAL: Chunk cache of /test: (\d+) hits, (\d+) misses", debug_msgs[0]
+    )
+    assert m, debug_msgs
+    assert int(m.group(1)) > 0
+    assert int(m.group(2)) > 0
+
+
+###############################################################################
+@pytest.mark.parametrize("num_threads", [None, "2"])
+def test_multidim_GetReduced(num_threads):
+
+    drv = gdal.GetDriverByName("MEM")
+    mem_ds = drv.CreateMultiDimensional("myds")
+    rg = mem_ds.GetRootGroup()
+    dim_t = rg.CreateDimension("time", None, None, 5)
+    dim_y = rg.CreateDimension("y", None, None, 3)
+    dim_x = rg.CreateDimension("x", None, None, 4)
+    ar = rg.CreateMDArray(
+        "ar",
+        [dim_t, dim_y, dim_x],
+        gdal.ExtendedDataType.Create(gdal.GDT_Float32),
+    )
+    ar.SetNoDataValueDouble(-999)
+    ar.SetUnit("K")
+    vals = [float(i % 7) for i in range(5 * 3 * 4)]
+    vals[0] = -999  # nodata
+    vals[12] = float("nan")
+    # All values along time are invalid for (y=0, x=1)
+    for t in range(5):
+        vals[t * 12 + 1] = -999
+    assert ar.Write(vals) == gdal.CE_None
+
+    def get(t, y, x):
+        return vals[t * 12 + y * 4 + x]
+
+    def valid(v):
+        return v == v and v != -999
+
+    options = ["NUM_THREADS=" + num_threads] if num_threads else []
+
+    with pytest.raises(Exception, match="Unsupported reduction operation"):
+        with gdaltest.enable_exceptions():
+            ar.GetReduced("median", 0)
+    with pytest.raises(Exception, match="Invalid dimension index"):
+        with gdaltest.enable_exceptions():
+            ar.GetReduced("mean", 3)
+
+    mean = ar.GetReduced("mean", 0, options)
+    assert [dim.GetName() for dim in mean.GetDimensions()] == ["y", "x"]
+    assert mean.GetDataType().GetNumericDataType() == gdal.GDT_Float64
+    assert mean.GetUnit() == "K"
+    assert math.isnan(mean.GetNoDataValueAsDouble())
+    got = struct.unpack("d" * 12, mean.Read())
+    for y in range(3):
+        for x in range(4):
+            v = [get(t, y, x) for t in range(5) if valid(get(t, y, x))]
+            if v:
+                assert got[y * 4 + x] == pytest.approx(sum(v) / len(v))
+            else:
+                assert math.isnan(got[y * 4 + x])
+
+    # Strided and reversed read
+    got = struct.unpack(
+        "d" * 4,
+        mean.Read(array_start_idx=[2, 3], count=[2, 2], array_step=[-1, -2]),
+    )
+    full = struct.unpack("d" * 12, mean.Read())
+    assert got == (full[11], full[9], full[7], full[5])
+
+    count = ar.GetReduced("count", 0, options)
+    assert count.GetDataType().GetNumericDataType() == gdal.GDT_UInt64
+    assert count.GetUnit() == ""
+    got = struct.unpack("Q" * 12, count.Read())
+    for y in range(3):
+        for x in range(4):
+            nvalid = len([t for t in range(5) if valid(get(t, y, x))])
+            assert got[y * 4 + x] == nvalid
+
+    for op, func in [("min", min), ("max", max), ("sum", sum)]:
+        reduced = ar.GetReduced(op, 1, options)
+        dim_names = [dim.GetName() for dim in reduced.GetDimensions()]
+        assert dim_names == ["time", "x"]
+        got = struct.unpack("d" * 20, reduced.Read())
+        for t in range(5):
+            for x in range(4):
+                v = [get(t, y, x) for y in range(3) if valid(get(t, y, x))]
+                if v:
+                    assert got[t * 4 + x] == pytest.approx(func(v)), (op, t, x)
+                elif op == "sum":
+                    assert got[t * 4 + x] == 0
+                else:
+                    assert math.isnan(got[t * 4 + x])
+
+    # Reduction of a 1D array gives a 0D array
+    ar1d = rg.CreateMDArray(
+        "ar1d", [dim_t], gdal.ExtendedDataType.Create(gdal.GDT_Int16)
+    )
+    assert ar1d.Write(array.array("h", [1, 2, 3, 4, 5])) == gdal.CE_None
+    reduced = ar1d.GetReduced("sum", 0)
+    assert reduced.GetDimensionCount() == 0
+    assert struct.unpack("d", reduced.Read()) == (15,)
+
+
+###############################################################################
+# Test GetReduced() with an output large enough to be processed by several
+# threads, and a reduced dimension read in several slabs
+
+
+@pytest.mark.parametrize("num_threads", [None, "2"])
+def test_multidim_GetReduced_large(num_threads):
+
+    drv = gdal.GetDriverByName("MEM")
+    mem_ds = drv.CreateMultiDimensional("myds")
+    rg = mem_ds.GetRootGroup()
+    nt, ny, nx = 5, 64, 128
+    dim_t = rg.CreateDimension("time", None, None, nt)
+    dim_y = rg.CreateDimension("y", None, None, ny)
+    dim_x = rg.CreateDimension("x", None, None, nx)
+    ar = rg.CreateMDArray(
+        "ar",
+        [dim_t, dim_y, dim_x],
+        gdal.ExtendedDataType.Create(gdal.GDT_Float32),
+    )
+    ar.SetNoDataValueDouble(-999)
+    vals = [float((i * 7919) % 101) for i in range(nt * ny * nx)]
+    for i in range(0, len(vals), 13):
+        vals[i] = -999
+    assert ar.Write(array.array("f", vals)) == gdal.CE_None
+
+    options = ["NUM_THREADS=" + num_threads] if num_threads else []
+    for op, func in [("min", min), ("max", max), ("sum", sum)]:
+        with gdal.config_option("GDAL_MDARRAY_REDUCE_MAX_SLAB_ROWS", "2"):
+            got = struct.unpack("d" * (ny * nx), ar.GetReduced(op, 0, options).Read())
+        for i in range(ny * nx):
+            v = [vals[t * ny * nx + i] for t in range(nt)]
+            v = [x for x in v if x != -999]
+            assert got[i] == pytest.approx(func(v)), (op, i)
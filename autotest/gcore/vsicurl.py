@@ -11,6 +11,7 @@
 # SPDX-License-Identifier: MIT
 ###############################################################################
 
+import os
 import sys
 import time
 
@@ -1703,3 +1704,160 @@ def test_VSIFOpenExL_CACHE_NO(server):
 
         with gdal.VSIFile(filename, "rb", False, {"CACHE": "NO"}) as f:
             assert f.read() == b"1234"
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_DISK_CACHE_DIR
+
+
+@gdaltest.enable_exceptions()
+def test_vsicurl_disk_cache(server, tmp_path):
+
+    gdal.VSICurlClearCache()
+
+    filename = f"/vsicurl/http://localhost:{server.port}/test.bin"
+
+    with gdal.config_options(
+        {
+            "CPL_VSIL_CURL_DISK_CACHE_DIR": str(tmp_path),
+            "GDAL_DISABLE_READDIR_ON_OPEN": "YES",
+        }
+    ):
+        handler = webserver.SequentialHandler()
+        handler.add("HEAD", "/test.bin", 200, {"Content-Length": "3", "ETag": '"1"'})
+        handler.add("GET", "/test.bin", 200, {"Content-Length": "3"}, b"abc")
+        with webserver.install_http_handler(handler):
+            with gdal.VSIFile(filename, "rb") as f:
+                assert f.read() == b"abc"
+
+        gdal.VSICurlClearCache()
+
+        # Content is served from the disk cache
+        handler = webserver.SequentialHandler()
+        handler.add("HEAD", "/test.bin", 200, {"Content-Length": "3", "ETag": '"1"'})
+        with webserver.install_http_handler(handler):
+            with gdal.VSIFile(filename, "rb") as f:
+                assert f.read() == b"abc"
+
+        gdal.VSICurlClearCache()
+
+        # Remote file has changed: content must be downloaded again
+        handler = webserver.SequentialHandler()
+        handler.add("HEAD", "/test.bin", 200, {"Content-Length": "3", "ETag": '"2"'})
+        handler.add("GET", "/test.bin", 200, {"Content-Length": "3"}, b"def")
+        with webserver.install_http_handler(handler):
+            with gdal.VSIFile(filename, "rb") as f:
+                assert f.read() == b"def"
+
+        gdal.VSICurlClearCache()
+
+        def cached_files():
+            return set(
+                f for f in tmp_path.glob("*/*") if f.is_file() and f.suffix != ".tmp"
+            )
+
+        cached_files_before = cached_files()
+        assert len(cached_files_before) == 2
+
+        # No ETag nor Last-Modified: no caching
+        for i in range(2):
+            handler = webserver.SequentialHandler()
+            handler.add("HEAD", "/test.bin", 200, {"Content-Length": "3"})
+            handler.add("GET", "/test.bin", 200, {"Content-Length": "3"}, b"ghi")
+            with webserver.install_http_handler(handler):
+                with gdal.VSIFile(filename, "rb") as f:
+                    assert f.read() == b"ghi"
+
+            gdal.VSICurlClearCache()
+
+        assert cached_files() == cached_files_before
+
+    gdal.VSICurlClearCache()
+
+
+###############################################################################
+# Test CPL_VSIL_CURL_DISK_CACHE_SIZE
+
+
+@gdaltest.enable_exceptions()
+def test_vsicurl_disk_cache_eviction(server, tmp_path):
+
+    gdal.VSICurlClearCache()
+
+    def cached_files():
+        return set(
+            f for f in tmp_path.glob("*/*") if f.is_file() and f.suffix != ".tmp"
+        )
+
+    def read(i, from_disk_cache):
+        handler = webserver.SequentialHandler()
+        handler.add(
+            "HEAD", f"/test{i}.bin", 200, {"Content-Length": "3", "ETag": '"1"'}
+        )
+        if not from_disk_cache:
+            handler.add("GET", f"/test{i}.bin", 200, {"Content-Length": "3"}, b"abc")
+        with webserver.install_http_handler(handler):
+            with gdal.VSIFile(
+                f"/vsicurl/http://localhost:{server.port}/test{i}.bin", "rb"
+            ) as f:
+                assert f.read() == b"abc"
+        gdal.VSICurlClearCache()
+
+    # The cache is trimmed to 80% of its maximum size, that is 9 bytes,
+    # when it exceeds 11 bytes.
+    with gdal.config_options(
+        {
+            "CPL_VSIL_CURL_DISK_CACHE_DIR": str(tmp_path),
+            "CPL_VSIL_CURL_DISK_CACHE_SIZE": "11",
+            "GDAL_DISABLE_READDIR_ON_OPEN": "YES",
+        }
+    ):
+        files = []
+        for i in range(3):
+            before = cached_files()
+            read(i, from_disk_cache=False)
+            new_files = cached_files() - before
+            assert len(new_files) == 1
+            files += new_files
+
+        # Make test0.bin the oldest accessed file, then access it so that
+        # test1.bin becomes the least recently used one.
+        now = time.time()
+        for i, f in enumerate(files):
+            os.utime(f, (now - 300 + 100 * i, now - 300 + 100 * i))
+        read(0, from_disk_cache=True)
+
+        before = cached_files()
+        read(3, from_disk_cache=False)
+        new_files = cached_files() - before
+        assert len(new_files) == 1
+
+    assert cached_files() == set([files[0], files[2]]) | new_files
+
+    gdal.VSICurlClearCache()
+
+    with gdal.config_options(
+        {
+            "CPL_VSIL_CURL_DISK_CACHE_DIR": str(tmp_path),
+            "CPL_VSIL_CURL_DISK_CACHE_SIZE": "5",
+            "GDAL_DISABLE_READDIR_ON_OPEN": "YES",
+        }
+    ):
+        for i in range(3):
+            handler = webserver.SequentialHandler()
+            handler.add(
+                "HEAD", f"/test{i}.bin", 200, {"Content-Length": "3", "ETag": '"1"'}
+            )
+            handler.add("GET", f"/test{i}.bin", 200, {"Content-Length": "3"}, b"abc")
+            with webserver.install_http_handler(handler):
+                with gdal.VSIFile(
+                    f"/vsicurl/http://localhost:{server.port}/test{i}.bin", "rb"
+                ) as f:
+                    assert f.read() == b"abc"
+
+    cached_files = [
+        f for f in tmp_path.glob("*/*") if f.is_file() and f.suffix != ".tmp"
+    ]
+    assert sum(f.stat().st_size for f in cached_files) <= 5
+
+    gdal.VSICurlClearCache()
@@ -1245,3 +1245,72 @@ interleave = bip
         match="Cannot handle bands=2147483648 due to GDAL raster data model limitation",
     ):
         gdal.Open("/vsimem/test.bin")
+
+
+###############################################################################
+# Test reading through a memory mapping of the file (RAW_VIRTUAL_MEM_IO)
+
+
+@pytest.mark.parametrize("byte_order", [0, 1])
+@pytest.mark.parametrize("interleave", ["bsq", "bil", "bip"])
+def test_envi_read_virtual_mem_io(tmp_path, byte_order, interleave):
+
+    xsize = 5
+    ysize = 4
+    nbands = 3
+    values = {}
+    for b in range(nbands):
+        for y in range(ysize):
+            for x in range(xsize):
+                values[(b, y, x)] = 1000 * b + 10 * y + x
+    if interleave == "bsq":
+        indices = [
+            (b, y, x) for b in range(nbands) for y in range(ysize) for x in range(xsize)
+        ]
+    elif interleave == "bil":
+        indices = [
+            (b, y, x) for y in range(ysize) for b in range(nbands) for x in range(xsize)
+        ]
+    else:
+        indices = [
+            (b, y, x) for y in range(ysize) for x in range(xsize) for b in range(nbands)
+        ]
+    fmt = (">" if byte_order == 1 else "<") + "h" * len(indices)
+
+    filename = tmp_path / "test.bin"
+    with open(tmp_path / "test.hdr", "wt") as f:
+        f.write(f"""ENVI
+samples = {xsize}
+lines = {ysize}
+bands = {nbands}
+header offset = 0
+data type = 2
+byte order = {byte_order}
+interleave = {interleave}
+""")
+    with open(filename, "wb") as f:
+        f.write(struct.pack(fmt, *[values[idx] for idx in indices]))
+
+    def read():
+        ds = gdal.Open(filename)
+        ret = [
+            ds.ReadRaster(),
+            ds.ReadRaster(buf_type=gdal.GDT_Float32),
+            ds.GetRasterBand(2).ReadRaster(1, 1, 3, 2),
+            ds.GetRasterBand(3).ReadRaster(0, 0, xsize, ysize, 2, 2),
+        ]
+        return ret
+
+    expected = read()
+    assert expected[0] == struct.pack(
+        "h" * len(indices),
+        *[
+            values[(b, y, x)]
+            for b in range(nbands)
+            for y in range(ysize)
+            for x in range(xsize)
+        ],
+    )
+
+    with gdaltest.config_option("RAW_VIRTUAL_MEM_IO", "YES"):
+        assert read() == expected
@@ -4414,3 +4414,108 @@ def test_gpkg_copy_using_get_data_coverage_status(tmp_vsimem):
         == (gdal.GDAL_DATA_COVERAGE_STATUS_DATA | gdal.GDAL_DATA_COVERAGE_STATUS_EMPTY)
         and pct == 25.0
     )
+
+
+###############################################################################
+# Test multi-threaded tile encoding
+
+
+def _collect_gpkg_thread_debug_messages():
+    debug_msgs = []
+
+    def handler(eErrClass, err_no, msg):
+        if eErrClass == gdal.CE_Debug and "using 4 threads" in msg:
+            debug_msgs.append(msg)
+
+    return debug_msgs, handler
+
+
+@pytest.mark.parametrize("tile_format", ["PNG", "JPEG", "PNG8"])
+def test_gpkg_raster_write_multithreaded(tmp_vsimem, tile_format):
+
+    if gdal.GetDriverByName(tile_format.replace("PNG8", "PNG")) is None:
+        pytest.skip(f"{tile_format} driver missing")
+
+    src_ds = gdal.Translate(
+        "", "data/rgbsmall.tif", format="MEM", width=1000, height=900
+    )
+    # Add an empty area, so that some tiles are not written
+    src_ds.WriteRaster(0, 0, 600, 300, b"\x00" * (600 * 300 * 3))
+
+    options = [f"TILE_FORMAT={tile_format}", "BLOCKSIZE=128"]
+
+    ref_filename = str(tmp_vsimem / "ref.gpkg")
+    with gdal.config_option("GDAL_NUM_THREADS", "1"):
+        ds = gdaltest.gpkg_dr.CreateCopy(ref_filename, src_ds, options=options)
+        ds.BuildOverviews("AVERAGE", [2, 4])
+        ds = None
+
+    filename = str(tmp_vsimem / "test.gpkg")
+    debug_msgs, handler = _collect_gpkg_thread_debug_messages()
+    with gdaltest.error_handler(handler), gdaltest.config_options(
+        {"GDAL_NUM_THREADS": "4", "CPL_DEBUG": "GPKG"}
+    ):
+        gdal.SetCurrentErrorHandlerCatchDebug(True)
+        ds = gdaltest.gpkg_dr.CreateCopy(filename, src_ds, options=options)
+        ds.BuildOverviews("AVERAGE", [2, 4])
+        ds = None
+
+    # Check that the tiles have been encoded by worker threads
+    assert debug_msgs
+    assert all(msg.endswith("tiles encoded using 4 threads") for msg in debug_msgs)
+
+    ref_ds = gdal.Open(ref_filename)
+    ds = gdal.Open(filename)
+    for i in range(ds.RasterCount):
+        ref_band = ref_ds.GetRasterBand(i + 1)
+        band = ds.GetRasterBand(i + 1)
+        assert band.Checksum() == ref_band.Checksum()
+        assert band.GetOverview(0).Checksum() == ref_band.GetOverview(0).Checksum()
+        assert band.GetOverview(1).Checksum() == ref_band.GetOverview(1).Checksum()
+
+    with ds.ExecuteSQL("SELECT COUNT(*) FROM test") as sql_lyr:
+        count = sql_lyr.GetNextFeature().GetField(0)
+    with ref_ds.ExecuteSQL("SELECT COUNT(*) FROM ref") as sql_lyr:
+        assert count == sql_lyr.GetNextFeature().GetField(0)
+
+
+###############################################################################
+# Test reading back a tile that is still being encoded by a worker thread
+
+
+@pytest.mark.require_driver("PNG")
+def test_gpkg_raster_read_pending_tile_multithreaded(tmp_vsimem):
+
+    filename = str(tmp_vsimem / "test.gpkg")
+    debug_msgs = []
+
+    def handler(eErrClass, err_no, msg):
+        if eErrClass == gdal.CE_Debug and "pending tiles" in msg:
+            debug_msgs.append(msg)
+
+    data = b"".join(bytes([10 * (i + 1)]) * 128 for i in range(4)) * 128
+    with gdaltest.error_handler(handler), gdaltest.config_options(
+        {"GDAL_NUM_THREADS": "4", "CPL_DEBUG": "GPKG"}
+    ):
+        gdal.SetCurrentErrorHandlerCatchDebug(True)
+        ds = gdaltest.gpkg_dr.Create(
+            filename, 512, 128, 1, options=["TILE_FORMAT=PNG", "BLOCKSIZE=128"]
+        )
+        ds.SetGeoTransform([0, 1, 0, 0, 0, -1])
+        band = ds.GetRasterBand(1)
+        band.WriteRaster(0, 0, 512, 128, data)
+
+        # Evict the dirty blocks from the block cache, so that the tiles are
+        # submitted for encoding, but not inserted in the database yet
+        with gdaltest.SetCacheMax(0):
+            pass
+
+        assert band.ReadRaster(0, 0, 128, 128) == bytes([10]) * (128 * 128)
+        ds = None
+
+    assert debug_msgs
+    assert debug_msgs[0].startswith("GPKG: Inserting ")
+    assert debug_msgs[0].endswith(" pending tiles before reading tile (row=0, col=0)")
+
+    with gdal.Open(filename) as ds:
+        assert ds.GetRasterBand(1).ReadRaster() == data
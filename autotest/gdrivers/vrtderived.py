@@ -1360,6 +1360,60 @@ def test_vrt_pixelfn_expression_coordinates():
     np.testing.assert_array_equal(actual, expected)
 
 
+@pytest.mark.parametrize(
+    "expression",
+    [
+        "(B1-B2)/(B1+B2)",
+        "-B1^2 + 2^-B2 + B1^3",
+        "B1 > 100 && B2 <= 120 || B1 == 107 ? sqrt(B1) : -B2",
+        "min(B1, B2, 120) + max(B1, 2) + sum(B1, B2) + avg(B1, B2, 3)",
+        "sign(B1 - 120) + rint(B2 / 3) + fmod(B1, 7) + abs(B1 - B2)",
+        "isnodata(B1) ? 0 : ln(B1) + log10(B2) + exp(B1 / 100) + _pi",
+        "isnan(B1 / (B2 - B2)) + cos(B1) * sin(B2) + atan(B1)",
+        "B1 + 0.25 * _CENTER_X_ - _CENTER_Y_ / 1e3",
+        "B1 / sum(BANDS)",
+    ],
+)
+@pytest.mark.parametrize("propagate_nodata", ["true", "false"])
+def test_vrt_pixelfn_expression_vectorized(expression, propagate_nodata):
+
+    if not gdaltest.gdal_has_vrt_expression_dialect("muparser"):
+        pytest.skip("muparser not available")
+
+    gdaltest.importorskip_gdal_array()
+    np = pytest.importorskip("numpy")
+
+    expression = expression.replace("<", "&lt;").replace(">", "&gt;")
+    expression = expression.replace("&&", "&amp;&amp;")
+
+    xml = f"""
+    <VRTDataset rasterXSize="20" rasterYSize="20">
+      <GeoTransform>440720,60,0,3751320,0,-60</GeoTransform>
+      <VRTRasterBand dataType="Float64" band="1" subClass="VRTDerivedRasterBand">
+        <NoDataValue>107</NoDataValue>
+        <PixelFunctionType>expression</PixelFunctionType>
+        <PixelFunctionArguments expression="{expression}" propagateNoData="{propagate_nodata}"/>
+        <SimpleSource>
+           <SourceFilename>data/byte.tif</SourceFilename>
+           <SourceBand>1</SourceBand>
+        </SimpleSource>
+        <SimpleSource>
+           <SourceFilename>data/byte.tif</SourceFilename>
+           <SourceBand>1</SourceBand>
+           <SrcRect xOff="1" yOff="2" xSize="19" ySize="18"/>
+           <DstRect xOff="0" yOff="0" xSize="19" ySize="18"/>
+        </SimpleSource>
+      </VRTRasterBand>
+    </VRTDataset>"""
+
+    with gdal.config_option("GDAL_VRT_VECTORIZED_EXPRESSION", "NO"):
+        expected = gdal.Open(xml).ReadAsArray()
+    with gdal.config_option("GDAL_VRT_VECTORIZED_EXPRESSION", "YES"):
+        actual = gdal.Open(xml).ReadAsArray()
+
+    np.testing.assert_allclose(actual, expected, rtol=1e-12, equal_nan=True)
+
+
 @gdaltest.enable_exceptions()
 def test_vrt_pixelfn_expression_coordinates_no_geotransform():
 
@@ -4069,6 +4069,96 @@ def test_zarr_advise_read(tmp_path, compression, format):
     read()
 
 
+@pytest.mark.parametrize("compression", ["NONE", "GZIP"])
+def test_zarr_v3_multithreaded_read_write(tmp_vsimem, compression):
+
+    filename = str(tmp_vsimem / "test.zarr")
+
+    dim0_size = 123
+    dim1_size = 257
+    data = array.array("H", [i % 65535 for i in range(dim0_size * dim1_size)])
+    # Create empty block
+    for y in range(100, 110):
+        for x in range(180, 210):
+            data[dim1_size * y + x] = 0
+
+    debug_msgs = []
+
+    def handler(eErrClass, err_no, msg):
+        if eErrClass == gdal.CE_Debug and "using 4 threads" in msg:
+            debug_msgs.append(msg)
+
+    with gdaltest.error_handler(handler), gdaltest.config_options(
+        {"GDAL_NUM_THREADS": "4", "CPL_DEBUG": "ZARR"}
+    ):
+        gdal.SetCurrentErrorHandlerCatchDebug(True)
+        ds = gdal.GetDriverByName("ZARR").CreateMultiDimensional(
+            filename, options=["FORMAT=ZARR_V3"]
+        )
+        rg = ds.GetRootGroup()
+        dim0 = rg.CreateDimension("dim0", None, None, dim0_size)
+        dim1 = rg.CreateDimension("dim1", None, None, dim1_size)
+        ar = rg.CreateMDArray(
+            "test",
+            [dim0, dim1],
+            gdal.ExtendedDataType.Create(gdal.GDT_UInt16),
+            ["COMPRESS=" + compression, "BLOCKSIZE=10,30"],
+        )
+        ar.SetNoDataValueDouble(0)
+        assert ar.Write(data) == gdal.CE_None
+        # Partial update of existing tiles
+        assert (
+            ar.Write(
+                array.array("H", [1] * (25 * 50)),
+                array_start_idx=[5, 15],
+                count=[25, 50],
+            )
+            == gdal.CE_None
+        )
+        for y in range(5, 30):
+            for x in range(15, 65):
+                data[dim1_size * y + x] = 1
+        ds = None
+
+    # The tiles completed by both writes were encoded by worker threads
+    assert len(debug_msgs) == 2
+    for msg in debug_msgs:
+        assert msg.startswith("ZARR: Encoded and wrote ")
+        assert msg.endswith(" tiles of /test using 4 threads")
+
+    assert gdal.VSIStatL(filename + "/test/c/0/0") is not None
+    assert gdal.VSIStatL(filename + "/test/c/10/6") is None
+
+    ds = gdal.OpenEx(filename, gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("test")
+    assert ar.Read() == data.tobytes()
+
+    debug_msgs.clear()
+    with gdaltest.error_handler(handler), gdaltest.config_options(
+        {"GDAL_NUM_THREADS": "4", "CPL_DEBUG": "ZARR"}
+    ):
+        gdal.SetCurrentErrorHandlerCatchDebug(True)
+        assert ar.Read() == data.tobytes()
+        got = ar.Read(
+            array_start_idx=[100, 200], count=[20, 50], array_step=[-1, -1]
+        )
+        expected = array.array(
+            "H",
+            [
+                data[dim1_size * (100 - y) + 200 - x]
+                for y in range(20)
+                for x in range(50)
+            ],
+        )
+        assert got == expected.tobytes()
+
+    # 13 x 9 tiles for the whole array, and 3 x 2 tiles for the subset
+    assert debug_msgs == [
+        "ZARR: Decoding 117 tiles of /test using 4 threads",
+        "ZARR: Decoding 6 tiles of /test using 4 threads",
+    ]
+
+
 def test_zarr_read_invalid_nczarr_dim(tmp_vsimem):
 
     gdal.Mkdir(tmp_vsimem / "test.zarr", 0)
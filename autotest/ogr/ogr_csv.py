@@ -3630,6 +3630,188 @@ def test_ogr_csv_creation_illegal_layer_name(tmp_vsimem):
         ds.CreateLayer("illegal/with/slash")
 
 
+###############################################################################
+# Test that the native GetArrowStream() implementation returns the same
+# content as the generic one
+
+
+def _get_arrow_stream_as_lists(lyr, options=[]):
+    ret = {}
+    for batch in lyr.GetArrowStreamAsNumPy(options=options):
+        for k, v in batch.items():
+            ret.setdefault(k, []).extend(v.tolist())
+    return ret
+
+
+def _check_arrow_stream_native(lyr, options=[]):
+    native = _get_arrow_stream_as_lists(lyr, options)
+    assert (
+        lyr.GetMetadataItem(
+            "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+        )
+        == "YES"
+    )
+
+    with gdal.config_option("OGR_CSV_STREAM_BASE_IMPL", "YES"):
+        generic = _get_arrow_stream_as_lists(lyr, options)
+    assert (
+        lyr.GetMetadataItem(
+            "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+        )
+        == "NO"
+    )
+
+    assert native == generic
+    return native
+
+
+@pytest.mark.parametrize(
+    "filename,open_options",
+    [
+        ("data/csv/testcsvt.csv", []),
+        ("data/csv/testdatetime.csv", []),
+        ("data/csv/testnull.csv", []),
+        ("data/csv/testnull.csv", ["EMPTY_STRING_AS_NULL=YES"]),
+        ("data/csv/testtypeautodetect.csv", ["AUTODETECT_TYPE=YES"]),
+        ("data/csv/csv_with_utf8_bom.csv", []),
+        ("data/csv/header_with_line_break.csv", []),
+        ("data/csv/double_quotes_in_middle_of_field.csv", []),
+        ("data/prime_meridian.csv", []),
+    ],
+)
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_ogr_csv_arrow_stream_native(filename, open_options, num_threads):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        ds = gdal.OpenEx(filename, gdal.OF_VECTOR, open_options=open_options)
+        lyr = ds.GetLayer(0)
+        for options in ([], ["MAX_FEATURES_IN_BATCH=2", "INCLUDE_FID=NO"]):
+            _check_arrow_stream_native(lyr, options)
+
+
+###############################################################################
+# Test the native GetArrowStream() implementation on geometry columns,
+# multi-line values and with several chunks decoded by worker threads
+
+
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_ogr_csv_arrow_stream_native_geometries(tmp_vsimem, num_threads):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test.csv")
+    content = "id,wkt_geom,x,y,comment\r\n"
+    for i in range(1000):
+        if i % 7 == 0:
+            content += f'{i},,,,"multi\r\nline ""{i}"""\r\n'
+        else:
+            content += f'{i},"POINT ({i} {-i})",{i}.5,{-i},foo {i}\r\n'
+    gdal.FileFromMemBuffer(filename, content)
+
+    with gdal.config_option("GDAL_NUM_THREADS", num_threads):
+        ds = gdal.OpenEx(
+            filename,
+            gdal.OF_VECTOR,
+            open_options=["X_POSSIBLE_NAMES=x", "Y_POSSIBLE_NAMES=y"],
+        )
+        lyr = ds.GetLayer(0)
+        native = _check_arrow_stream_native(lyr, ["MAX_FEATURES_IN_BATCH=10"])
+        assert native["comment"][0] == 'multi\nline "0"'
+        assert len(native["OGC_FID"]) == 1000
+
+        ds = gdal.OpenEx(
+            filename,
+            gdal.OF_VECTOR,
+            open_options=["GEOM_POSSIBLE_NAMES=wkt_geom", "KEEP_GEOM_COLUMNS=NO"],
+        )
+        lyr = ds.GetLayer(0)
+        native = _check_arrow_stream_native(lyr, ["MAX_FEATURES_IN_BATCH=10"])
+        assert native["OGC_FID"] == list(range(1, 1001))
+
+        # Batches may be returned out of order, but with the same content
+        native = _get_arrow_stream_as_lists(
+            lyr, ["MAX_FEATURES_IN_BATCH=10", "PRESERVE_ORDER=NO"]
+        )
+        order = sorted(
+            range(len(native["OGC_FID"])), key=lambda i: native["OGC_FID"][i]
+        )
+        for k in native:
+            native[k] = [native[k][i] for i in order]
+        assert native == _get_arrow_stream_as_lists(
+            lyr, ["MAX_FEATURES_IN_BATCH=10"]
+        )
+
+
+###############################################################################
+# Test the native GetArrowStream() implementation when records, escaped double
+# quotes and new line sequences are split across read boundaries
+
+
+@pytest.mark.parametrize("read_size", [1, 2, 3, 7, 64])
+@pytest.mark.parametrize("num_threads", ["1", "4"])
+def test_ogr_csv_arrow_stream_native_read_boundaries(
+    tmp_vsimem, read_size, num_threads
+):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test.csv")
+    content = "\xef\xbb\xbfid,comment,val\r\n"
+    expected = []
+    for i in range(100):
+        if i % 3 == 0:
+            content += f'{i},"multi\r\nline\n""quoted"",\r\n{i}",{i}.5\r\n'
+            expected.append(f'multi\nline\n"quoted",\n{i}')
+        elif i % 3 == 1:
+            content += f'{i},"""{i}""",{i}.5\n\r\n'
+            expected.append(f'"{i}"')
+        else:
+            content += f'{i},a""b{i},{i}.5\r\n'
+            expected.append(f'a""b{i}')
+    gdal.FileFromMemBuffer(filename, content.encode("UTF-8"))
+
+    with gdal.config_options(
+        {"GDAL_NUM_THREADS": num_threads, "OGR_CSV_STREAM_READ_SIZE": str(read_size)}
+    ):
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        assert lyr.TestCapability(ogr.OLCFastGetArrowStream)
+        native = _check_arrow_stream_native(lyr, ["MAX_FEATURES_IN_BATCH=7"])
+    assert native["id"] == [str(i) for i in range(100)]
+    assert native["comment"] == expected
+    assert native["val"] == [f"{i}.5" for i in range(100)]
+
+
+###############################################################################
+# Test that the native GetArrowStream() implementation is not used with
+# filters
+
+
+def test_ogr_csv_arrow_stream_native_filters():
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    ds = ogr.Open("data/prime_meridian.csv")
+    lyr = ds.GetLayer(0)
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream)
+
+    lyr.SetAttributeFilter("PRIME_MERIDIAN_CODE = 8901")
+    assert not lyr.TestCapability(ogr.OLCFastGetArrowStream)
+    native = _get_arrow_stream_as_lists(lyr)
+    assert (
+        lyr.GetMetadataItem(
+            "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+        )
+        == "NO"
+    )
+    assert native["OGC_FID"] == [f.GetFID() for f in lyr]
+
+    lyr.SetAttributeFilter(None)
+    assert lyr.TestCapability(ogr.OLCFastGetArrowStream)
+
+
 ###############################################################################
 
 
@@ -1150,6 +1150,81 @@ def test_ogr_flatgeobuf_arrow_stream_numpy(layer_creation_options):
     ogr.GetDriverByName("FlatGeobuf").DeleteDataSource("/vsimem/test.fgb")
 
 
+###############################################################################
+# Test that attribute filters evaluated on Arrow batches give the same result
+# as when evaluated on features
+
+
+@pytest.mark.parametrize(
+    "where",
+    [
+        "int16 = -123",
+        "int16 < 0 AND int32 IS NULL",
+        "NOT (int16 > -200)",
+        "int32 IN (12345678, 1)",
+        "int64 >= 12345678901234 OR float64 < 1",
+        "float32 BETWEEN 1 AND 1.5",
+        "str = 'ABC'",
+        "str LIKE 'a%' OR str IS NULL",
+        "str IN ('x', 'def')",
+        "bool = 1",
+        "FID IN (1, 2)",
+        "int16 + 1 = -122",
+    ],
+)
+@pytest.mark.parametrize("compiled", ["YES", "NO"])
+def test_ogr_flatgeobuf_arrow_stream_numpy_attribute_filter(
+    tmp_vsimem, where, compiled
+):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    filename = str(tmp_vsimem / "test.fgb")
+    ds = ogr.GetDriverByName("FlatGeoBuf").CreateDataSource(filename)
+    lyr = ds.CreateLayer("test", geom_type=ogr.wkbPoint)
+    lyr.CreateField(ogr.FieldDefn("str", ogr.OFTString))
+    field = ogr.FieldDefn("bool", ogr.OFTInteger)
+    field.SetSubType(ogr.OFSTBoolean)
+    lyr.CreateField(field)
+    field = ogr.FieldDefn("int16", ogr.OFTInteger)
+    field.SetSubType(ogr.OFSTInt16)
+    lyr.CreateField(field)
+    lyr.CreateField(ogr.FieldDefn("int32", ogr.OFTInteger))
+    lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    field = ogr.FieldDefn("float32", ogr.OFTReal)
+    field.SetSubType(ogr.OFSTFloat32)
+    lyr.CreateField(field)
+    lyr.CreateField(ogr.FieldDefn("float64", ogr.OFTReal))
+    for i in range(10):
+        f = ogr.Feature(lyr.GetLayerDefn())
+        if i % 3 != 0:
+            f.SetField("str", ["abc", "def", "ghi"][i % 3])
+        f.SetField("bool", i % 2)
+        f.SetField("int16", -123 if i % 4 == 0 else i)
+        if i % 2 == 0:
+            f.SetField("int32", 12345678)
+        f.SetField("int64", 12345678901234 + i - 5)
+        f.SetField("float32", i * 0.25)
+        if i % 5 != 0:
+            f.SetField("float64", i * 0.5)
+        f.SetGeometryDirectly(ogr.CreateGeometryFromWkt(f"POINT({i} {i})"))
+        lyr.CreateFeature(f)
+    ds = None
+
+    with gdal.config_option("OGR_FEATURE_QUERY_COMPILED", compiled):
+        ds = ogr.Open(filename)
+        lyr = ds.GetLayer(0)
+        lyr.SetAttributeFilter(where)
+
+    expected_fids = [f.GetFID() for f in lyr]
+
+    fids = []
+    stream = lyr.GetArrowStreamAsNumPy(options=["MAX_FEATURES_IN_BATCH=3"])
+    for batch in stream:
+        fids += [int(fid) for fid in batch["OGC_FID"]]
+    assert fids == expected_fids
+
+
 ###############################################################################
 # Test reading an empty file with GetArrowStream()
 
@@ -10212,6 +10212,158 @@ def test_ogr_gpkg_write_arrow_fallback_types(tmp_vsimem):
     assert f.GetGeometryRef().ExportToIsoWkt() == "POINT (1 2)"
 
 
+###############################################################################
+# Test the native WriteArrowBatch() implementation against the generic one
+
+
+@gdaltest.enable_exceptions()
+def test_ogr_gpkg_write_arrow_native(tmp_vsimem):
+
+    src_ds = ogr.GetDriverByName("MEM").CreateDataSource("")
+    src_lyr = src_ds.CreateLayer("test")
+    src_lyr.CreateField(ogr.FieldDefn("string", ogr.OFTString))
+    src_lyr.CreateField(ogr.FieldDefn("int", ogr.OFTInteger))
+    src_lyr.CreateField(ogr.FieldDefn("int64", ogr.OFTInteger64))
+    src_lyr.CreateField(ogr.FieldDefn("real", ogr.OFTReal))
+    src_lyr.CreateField(ogr.FieldDefn("binary", ogr.OFTBinary))
+    wkts = [
+        "POINT (1 2)",
+        "LINESTRING Z (1 2 3,4 5 6)",
+        "POLYGON ((0 0,0 1,1 1,0 0))",
+        "MULTIPOLYGON (((10 10,10 11,11 11,10 10)))",
+        "POINT EMPTY",
+        "CIRCULARSTRING (0 0,1 1,2 0)",
+        None,
+    ]
+    for i, wkt in enumerate(wkts):
+        f = ogr.Feature(src_lyr.GetLayerDefn())
+        if i != 1:
+            f["string"] = "foo%d" % i
+            f["int"] = i
+            f["int64"] = 12345678901234 + i
+            f["real"] = 1.5 + i
+            f.SetField("binary", b"\x01\x23" * i)
+        if wkt:
+            f.SetGeometry(ogr.CreateGeometryFromWkt(wkt))
+        f.SetFID(10 + i)
+        src_lyr.CreateFeature(f)
+
+    def write(filename):
+        ds = gdal.GetDriverByName("GPKG").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+        lyr = ds.CreateLayer("test")
+        assert lyr.TestCapability(ogr.OLCFastWriteArrowBatch)
+
+        stream = src_lyr.GetArrowStream()
+        schema = stream.GetSchema()
+        for i in range(schema.GetChildrenCount()):
+            if schema.GetChild(i).GetName() not in ("wkb_geometry", "OGC_FID"):
+                lyr.CreateFieldFromArrowSchema(schema.GetChild(i))
+
+        while True:
+            array = stream.GetNextRecordBatch()
+            if array is None:
+                break
+            assert lyr.WriteArrowBatch(schema, array, ["FID=OGC_FID"])
+        ds.Close()
+
+    filename_native = tmp_vsimem / "test_ogr_gpkg_write_arrow_native.gpkg"
+    write(filename_native)
+    filename_base = tmp_vsimem / "test_ogr_gpkg_write_arrow_base.gpkg"
+    with gdaltest.config_option("OGR_GPKG_WRITE_ARROW_BATCH_BASE_IMPL", "YES"):
+        write(filename_base)
+
+    ds_native = ogr.Open(filename_native)
+    lyr_native = ds_native.GetLayer(0)
+    ds_base = ogr.Open(filename_base)
+    lyr_base = ds_base.GetLayer(0)
+
+    assert lyr_native.GetFeatureCount() == len(wkts)
+    assert lyr_native.GetExtent() == lyr_base.GetExtent()
+    assert lyr_native.GetGeomType() == lyr_base.GetGeomType()
+    for f_base in lyr_base:
+        f_native = lyr_native.GetNextFeature()
+        assert f_native.Equal(f_base)
+    assert lyr_native.GetNextFeature() is None
+
+    # Check the geometry blobs, which include the GeoPackage header
+    sql = "SELECT hex(geom) FROM test ORDER BY fid"
+    with ds_native.ExecuteSQL(sql) as sql_lyr_native:
+        with ds_base.ExecuteSQL(sql) as sql_lyr_base:
+            for f_base in sql_lyr_base:
+                f_native = sql_lyr_native.GetNextFeature()
+                assert f_native.GetField(0) == f_base.GetField(0)
+
+    # Check the spatial index
+    assert lyr_native.TestCapability(ogr.OLCFastSpatialFilter)
+    lyr_native.SetSpatialFilterRect(9, 9, 12, 12)
+    assert [f.GetFID() for f in lyr_native] == [13]
+    lyr_native.SetSpatialFilterRect(3.5, 4.5, 4.5, 5.5)
+    assert [f.GetFID() for f in lyr_native] == [11]
+
+    sql = (
+        "SELECT * FROM gpkg_extensions WHERE "
+        "extension_name = 'gpkg_geom_CIRCULARSTRING'"
+    )
+    with ds_native.ExecuteSQL(sql) as sql_lyr:
+        assert sql_lyr.GetFeatureCount() == 1
+
+
+###############################################################################
+# Test that the native WriteArrowBatch() implementation does not copy WKB
+# with mixed byte order or trailing bytes as it is
+
+
+@gdaltest.enable_exceptions()
+def test_ogr_gpkg_write_arrow_native_unusual_wkb(tmp_vsimem):
+    pa = pytest.importorskip("pyarrow")
+    if int(pa.__version__.split(".")[0]) < 14:
+        pytest.skip("pyarrow >= 14 needed")
+
+    import struct
+
+    # Little-endian MultiPoint with a big-endian Point
+    mixed_byte_order = struct.pack("<BII", 1, 4, 1) + struct.pack(">BIdd", 0, 1, 1, 2)
+    # Little-endian Point followed by a byte that is not part of it
+    trailing_bytes = struct.pack("<BIdd", 1, 1, 3, 4) + b"\x00"
+    field = pa.field("geom", pa.binary(), metadata={"ARROW:extension:name": "ogc.wkb"})
+    table = pa.table(
+        [pa.array([mixed_byte_order, trailing_bytes], pa.binary())],
+        schema=pa.schema([field]),
+    )
+
+    def write(filename):
+        ds = gdal.GetDriverByName("GPKG").Create(filename, 0, 0, 0, gdal.GDT_Unknown)
+        lyr = ds.CreateLayer("test")
+        for batch in table.to_batches():
+            lyr.WriteArrow(batch.to_struct_array())
+        ds.Close()
+
+    filename_native = tmp_vsimem / "native.gpkg"
+    write(filename_native)
+    filename_base = tmp_vsimem / "base.gpkg"
+    with gdaltest.config_option("OGR_GPKG_WRITE_ARROW_BATCH_BASE_IMPL", "YES"):
+        write(filename_base)
+
+    ds_native = ogr.Open(filename_native)
+    lyr_native = ds_native.GetLayer(0)
+    ds_base = ogr.Open(filename_base)
+    assert [f.GetGeometryRef().ExportToIsoWkt() for f in lyr_native] == [
+        "MULTIPOINT ((1 2))",
+        "POINT (3 4)",
+    ]
+    assert lyr_native.GetExtent() == (1, 3, 2, 4)
+
+    sql = "SELECT hex(geom) FROM test ORDER BY fid"
+    with ds_native.ExecuteSQL(sql) as sql_lyr_native:
+        with ds_base.ExecuteSQL(sql) as sql_lyr_base:
+            assert [f.GetField(0) for f in sql_lyr_native] == [
+                f.GetField(0) for f in sql_lyr_base
+            ]
+
+    lyr_native.SetSpatialFilterRect(0.5, 1.5, 1.5, 2.5)
+    assert [f.GetFID() for f in lyr_native] == [1]
+
+
 ###############################################################################
 # Test a SQL request with the geometry in the first row being null
 
@@ -2967,3 +2967,89 @@ def test_ogr_openfilegdb_vsizip_random_zip_name_and_no_gdb_subdir():
 
     with ogr.Open("/vsizip/data/filegdb/testopenfilegdb.zip") as ds:
         assert ds.GetLayerCount() == 37
+
+
+###############################################################################
+# Test that the native GetArrowStream() implementation returns the same
+# content as the generic one
+
+
+def _get_arrow_stream_as_lists(lyr, options=[]):
+    ret = {}
+    for batch in lyr.GetArrowStreamAsNumPy(options=options):
+        for k, v in batch.items():
+            ret.setdefault(k, []).extend(v.tolist())
+    return ret
+
+
+@pytest.mark.parametrize(
+    "filename",
+    [
+        "data/filegdb/testopenfilegdb.gdb.zip",
+        "data/filegdb/arcgis_pro_32_types.gdb",
+        "data/filegdb/curves.gdb",
+    ],
+)
+def test_ogr_openfilegdb_arrow_stream_native(filename):
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    ds = ogr.Open(filename)
+    for lyr in ds:
+        for options in ([], ["MAX_FEATURES_IN_BATCH=2", "INCLUDE_FID=NO"]):
+            native = _get_arrow_stream_as_lists(lyr, options)
+            assert (
+                lyr.GetMetadataItem(
+                    "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH",
+                    "__DEBUG__",
+                )
+                == "YES"
+            )
+
+            with gdal.config_option("OGR_OPENFILEGDB_STREAM_BASE_IMPL", "YES"):
+                generic = _get_arrow_stream_as_lists(lyr, options)
+            assert (
+                lyr.GetMetadataItem(
+                    "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH",
+                    "__DEBUG__",
+                )
+                == "NO"
+            )
+
+            assert native == generic, lyr.GetName()
+
+
+###############################################################################
+# Test the native GetArrowStream() implementation with filters
+
+
+def test_ogr_openfilegdb_arrow_stream_native_filters():
+    gdaltest.importorskip_gdal_array()
+    pytest.importorskip("numpy")
+
+    ds = ogr.Open("data/filegdb/test_spatial_index.gdb.zip")
+    lyr = ds.GetLayerByName("test")
+
+    def check(expected_optimized):
+        native = _get_arrow_stream_as_lists(lyr)
+        assert lyr.GetMetadataItem(
+            "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH", "__DEBUG__"
+        ) == ("YES" if expected_optimized else "NO")
+        fids = [f.GetFID() for f in lyr]
+        assert native.get(lyr.GetFIDColumn() or "OGC_FID", []) == fids
+        return fids
+
+    # Evaluated with the .spx spatial index
+    lyr.SetSpatialFilterRect(400000, 0, 500100, 4500100)
+    assert len(check(True)) > 0
+
+    # Evaluated with the .atx attribute index
+    lyr.SetAttributeFilter("id = 1")
+    assert len(check(True)) == 1
+
+    lyr.SetSpatialFilter(None)
+    assert len(check(True)) == 1
+
+    # Not evaluated by the index: generic implementation
+    lyr.SetAttributeFilter("id + 0 = 1")
+    check(False)
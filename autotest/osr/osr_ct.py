@@ -596,6 +596,64 @@ def test_osr_ct_options_only_best_enabled():
     )
 
 
+###############################################################################
+# Test CoordinateTransformationOptions.SetNumThreads
+
+
+@pytest.mark.parametrize("check_with_invert_proj", ["NO", "YES"])
+def test_osr_ct_options_num_threads(check_with_invert_proj):
+
+    s = osr.SpatialReference()
+    s.ImportFromEPSG(4326)
+    s.SetAxisMappingStrategy(osr.OAMS_TRADITIONAL_GIS_ORDER)
+    t = osr.SpatialReference()
+    t.ImportFromEPSG(32631)
+
+    # Include points that cannot be transformed
+    pnts = [(-10 + 0.001 * i, 45 + 0.0001 * i) for i in range(1000)]
+    pnts += [(float("inf"), 0), (0, 91)] * 10
+
+    with gdal.config_options(
+        {
+            "CHECK_WITH_INVERT_PROJ": check_with_invert_proj,
+            "OGR_CT_MIN_POINTS_PER_THREAD": "100",
+        }
+    ):
+        res = []
+        errors = []
+        threaded = []
+        for num_threads in (1, 4):
+            options = osr.CoordinateTransformationOptions()
+            options.SetNumThreads(num_threads)
+            ct = osr.CoordinateTransformation(s, t, options)
+
+            debug_msgs = []
+            error_msgs = []
+
+            def handler(eErrClass, err_no, msg):
+                if eErrClass == gdal.CE_Debug:
+                    debug_msgs.append(msg)
+                else:
+                    error_msgs.append((eErrClass, err_no, msg))
+
+            with gdaltest.error_handler(handler), gdal.config_option(
+                "CPL_DEBUG", "OGRCT"
+            ):
+                gdal.SetCurrentErrorHandlerCatchDebug(True)
+                res.append(ct.TransformPoints(pnts))
+            errors.append(error_msgs)
+            threaded.append(
+                "OGRCT: Transforming 1020 points with 4 threads" in debug_msgs
+            )
+
+    assert threaded == [False, True]
+    assert res[0] == res[1]
+    # Errors are reported in the same order
+    assert errors[0] == errors[1]
+    assert res[1][0][0] != float("inf")
+    assert res[1][-1][0] == float("inf")
+
+
 ###############################################################################
 # Test that we pass a neutral time when not explicitly specified
 
@@ -204,6 +204,29 @@ cellsize     1
     assert alg.ParseRunAndFinalize(alg_options)
 
 
+def test_gdalalg_raster_contour_num_threads():
+    def get_features(num_threads=None):
+        alg = get_contour_alg()
+        alg["input"] = "../gdrivers/data/n43.tif"
+        alg["output"] = ""
+        alg["output-format"] = "MEM"
+        alg["interval"] = 10
+        if num_threads:
+            alg["num-threads"] = num_threads
+        with gdal.config_options(
+            {"GDAL_CONTOUR_MIN_STRIP_HEIGHT": "10", "GDAL_DEBUG_CPU_COUNT": "4"}
+        ):
+            assert alg.Run()
+        return [
+            (f.GetFID(), f.GetGeometryRef().ExportToWkt())
+            for f in alg["output"].GetDataset().GetLayer(0)
+        ]
+
+    assert len(get_features(4)) == len(get_features(1))
+    # Multi-threading is opt-in, as it changes the order of features
+    assert get_features() == get_features(1)
+
+
 @pytest.mark.require_driver("GPKG")
 def test_gdalalg_raster_contour_creation_options(tmp_vsimem):
 
@@ -146,6 +146,15 @@ def test_gdalalg_raster_fill_nodata_strategy(tmp_path, tmp_vsimem):
     del ds
 
 
+def test_gdalalg_raster_fill_nodata_num_threads(tmp_path, tmp_vsimem):
+
+    alg = get_alg()
+    alg["num-threads"] = 4
+    ds = run_alg(alg, tmp_path, tmp_vsimem)
+    assert ds.ReadAsArray(1, 1, 1, 1)[0][0] == 125
+    del ds
+
+
 def test_gdalalg_raster_fill_nodata_mask(tmp_path, tmp_vsimem):
 
     # Create a mask
@@ -13,6 +13,7 @@
 
 import os
 
+import gdaltest
 import pytest
 
 from osgeo import gdal
@@ -201,3 +202,41 @@ def test_gdalalg_raster_hillshade_overview():
     assert out_ds.GetRasterBand(1).GetOverview(1).YSize == 31
     assert out_ds.GetRasterBand(1).GetOverview(0).Checksum() == cs
     assert out_ds.GetRasterBand(1).GetOverview(0).ComputeStatistics(False) == stats
+
+
+def test_gdalalg_raster_hillshade_num_threads():
+
+    with gdal.Run(
+        "raster",
+        "hillshade",
+        input="../gdrivers/data/n43.tif",
+        output="",
+        output_format="MEM",
+        num_threads=1,
+    ) as alg:
+        ref_cs = alg.Output().GetRasterBand(1).Checksum()
+
+    debug_msgs = []
+
+    def handler(eErrClass, err_no, msg):
+        if eErrClass == gdal.CE_Debug and "strips using" in msg:
+            debug_msgs.append(msg)
+
+    with gdaltest.error_handler(handler), gdal.config_options(
+        {
+            "CPL_DEBUG": "GDALDEM",
+            "GDAL_DEM_MIN_STRIP_HEIGHT": "7",
+            "GDAL_DEBUG_CPU_COUNT": "4",
+        }
+    ):
+        gdal.SetCurrentErrorHandlerCatchDebug(True)
+        with gdal.Run(
+            "raster",
+            "hillshade",
+            input="../gdrivers/data/n43.tif",
+            output="",
+            output_format="MEM",
+            num_threads=4,
+        ) as alg:
+            assert alg.Output().GetRasterBand(1).Checksum() == ref_cs
+    assert set(debug_msgs) == {"GDALDEM: Processing 8 strips using 4 threads"}
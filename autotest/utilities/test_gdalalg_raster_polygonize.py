@@ -237,6 +237,41 @@ def test_gdalalg_raster_polygonize_connect_diagonal_pixels():
     assert lyr.GetFeatureCount() == 229
 
 
+def test_gdalalg_raster_polygonize_num_threads():
+
+    alg = get_alg()
+    alg["input"] = "../gcore/data/byte.tif"
+    alg["output"] = ""
+    alg["output-format"] = "MEM"
+    alg["num-threads"] = 4
+    with gdal.config_option("GDAL_POLYGONIZE_MIN_STRIP_HEIGHT", "2"):
+        assert alg.Run()
+    ds = alg["output"].GetDataset()
+    lyr = ds.GetLayerByName("polygonize")
+    assert lyr.GetFeatureCount() == 281
+
+
+def test_gdalalg_raster_polygonize_num_threads_default():
+
+    def run(num_threads=None):
+        alg = get_alg()
+        alg["input"] = "../gcore/data/byte.tif"
+        alg["output"] = ""
+        alg["output-format"] = "MEM"
+        if num_threads:
+            alg["num-threads"] = num_threads
+        with gdal.config_options(
+            {"GDAL_POLYGONIZE_MIN_STRIP_HEIGHT": "2", "GDAL_DEBUG_CPU_COUNT": "4"}
+        ):
+            assert alg.Run()
+        lyr = alg["output"].GetDataset().GetLayerByName("polygonize")
+        return [(f.GetFID(), f["DN"], f.GetGeometryRef().ExportToWkt()) for f in lyr]
+
+    # Multi-threading is opt-in, as it changes the order of features
+    assert run() == run("1")
+    assert sorted(x[1:] for x in run("4")) == sorted(x[1:] for x in run("1"))
+
+
 @pytest.mark.require_driver("GPKG")
 def test_gdalalg_raster_polygonize_creation_options(tmp_vsimem):
 
@@ -195,8 +195,11 @@ def create_gtiff_from_array(
         ),
     ),
 )
+@pytest.mark.parametrize("method", ["classic", "edt"])
 @pytest.mark.require_driver("GTiff")
-def test_gdalalg_raster_proximity_options(tmp_vsimem, options, expected_output_data):
+def test_gdalalg_raster_proximity_options(
+    tmp_vsimem, options, expected_output_data, method
+):
     """Test proximity calculation with several options."""
     input_data = np.array([[3, 0, 0], [0, 0, 0], [0, 0, 1]], dtype=np.uint8)
     src_filename = tmp_vsimem / "prox_in.tif"
@@ -214,6 +217,9 @@ def test_gdalalg_raster_proximity_options(tmp_vsimem, options, expected_output_d
 
     for k, v in options.items():
         alg[k] = v
+    alg["method"] = method
+    if method == "edt":
+        alg["num-threads"] = 2
 
     assert alg.Run()
     assert alg.Finalize()
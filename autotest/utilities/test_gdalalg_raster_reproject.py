@@ -315,3 +315,27 @@ def test_gdalalg_raster_reproject_complete_dst_crs_iau_mars(tmp_path):
     )
     assert "Earth" not in out
     assert "Mars" in out
+
+
+def test_gdalalg_raster_reproject_plan(tmp_vsimem):
+
+    plan_filename = str(tmp_vsimem / "plan.xml")
+
+    for i in range(2):
+        out_filename = str(tmp_vsimem / f"out{i}.tif")
+        alg = get_reproject_alg()
+        alg.ParseRunAndFinalize(
+            [
+                "--dst-crs=EPSG:4326",
+                "--size=40,30",
+                f"--plan={plan_filename}",
+                "../gcore/data/byte.tif",
+                out_filename,
+            ],
+        )
+        assert gdal.VSIStatL(plan_filename) is not None
+
+    with gdal.Open(str(tmp_vsimem / "out0.tif")) as ds0, gdal.Open(
+        str(tmp_vsimem / "out1.tif")
+    ) as ds1:
+        assert ds0.GetRasterBand(1).Checksum() == ds1.GetRasterBand(1).Checksum()
@@ -74,6 +74,31 @@ def test_gdalalg_raster_sieve(
     assert dst_band.Checksum() == expected_checksum
 
 
+@pytest.mark.require_driver("AAIGRID")
+@pytest.mark.require_driver("GTiff")
+@pytest.mark.parametrize(
+    "connect_diagonal_pixels,expected_checksum",
+    (
+        (False, 364),
+        (True, 370),
+    ),
+)
+def test_gdalalg_raster_sieve_num_threads(
+    tmp_vsimem, connect_diagonal_pixels, expected_checksum
+):
+
+    alg = get_alg()
+    alg["input"] = "../alg/data/sieve_src.grd"
+    alg["output"] = tmp_vsimem / "out.tif"
+    alg["size-threshold"] = 2
+    alg["connect-diagonal-pixels"] = connect_diagonal_pixels
+    alg["num-threads"] = 4
+    with gdal.config_option("GDAL_SIEVE_MIN_STRIP_HEIGHT", "1"):
+        assert alg.Run()
+    ds = alg["output"].GetDataset()
+    assert ds.GetRasterBand(1).Checksum() == expected_checksum
+
+
 @pytest.mark.require_driver("AAIGRID")
 @pytest.mark.require_driver("GTiff")
 def test_gdalalg_raster_sieve_mask(tmp_path, tmp_vsimem):
@@ -1107,3 +1107,72 @@ def test_gdalalg_raster_zonal_stats_null_geometry(zonal, strategy):
 
     assert results[0]["sum"] == 0
     assert results[0]["mode"] is None
+
+
+@pytest.mark.parametrize("weighted", (False, True))
+def test_gdalalg_raster_zonal_stats_polygon_zones_multithreaded(
+    tmp_vsimem, polyrast, weighted
+):
+
+    src_fname = tmp_vsimem / "polyrast.tif"
+    gdal.GetDriverByName("GTiff").CreateCopy(
+        src_fname, polyrast, options=["TILED=YES", "BLOCKXSIZE=16", "BLOCKYSIZE=16"]
+    )
+
+    # Many small zones, listed in an order unrelated to their location
+    zones = gdal.GetDriverByName("MEM").CreateVector("")
+    zones_lyr = zones.CreateLayer("zones")
+    zones_lyr.CreateField(ogr.FieldDefn("zone_id", ogr.OFTInteger))
+    gt = polyrast.GetGeoTransform()
+    for i in range(500):
+        x = gt[0] + ((i * 7) % 19) * gt[1] + 50
+        y = gt[3] + ((i * 11) % 19) * gt[5] - 50
+        f = ogr.Feature(zones_lyr.GetLayerDefn())
+        f["zone_id"] = i
+        if i % 50 != 49:
+            f.SetGeometry(
+                ogr.CreateGeometryFromWkt(
+                    f"POLYGON (({x} {y},{x + 300} {y},{x + 300} {y - 250},{x} {y - 250},{x} {y}))"
+                )
+            )
+        zones_lyr.CreateFeature(f)
+
+    def run(num_threads):
+        reg = gdal.GetGlobalAlgorithmRegistry()
+        zonal = reg.InstantiateAlg("raster").InstantiateSubAlgorithm("zonal-stats")
+        zonal["input"] = src_fname
+        if weighted:
+            zonal["weights"] = src_fname
+        zonal["zones"] = zones
+        zonal["output"] = ""
+        zonal["output-format"] = "MEM"
+        zonal["strategy"] = "feature"
+        zonal["pixels"] = "all-touched"
+        zonal["stat"] = ["count", "sum", "mean", "min", "max"] + (
+            ["weighted_mean"] if weighted else []
+        )
+        zonal["include-field"] = "zone_id"
+        zonal["num-threads"] = num_threads
+
+        debug_msgs = []
+
+        def handler(eErrClass, err_no, msg):
+            if eErrClass == gdal.CE_Debug:
+                debug_msgs.append(msg)
+
+        with gdaltest.error_handler(handler), gdal.config_option("CPL_DEBUG", "ZONAL"):
+            gdal.SetCurrentErrorHandlerCatchDebug(True)
+            assert zonal.Run()
+        mt = f"ZONAL: Processing zones by feature using {num_threads} threads"
+        return [f.items() for f in zonal.Output().GetLayer(0)], mt in debug_msgs
+
+    expected, used_mt = run("1")
+    assert not used_mt
+    assert len(expected) == 500
+    assert [f["zone_id"] for f in expected] == list(range(500))
+    assert expected[49]["count"] == 0
+
+    with gdaltest.config_option("GDAL_DEBUG_CPU_COUNT", "4"):
+        got, used_mt = run("4")
+    assert used_mt
+    assert got == expected
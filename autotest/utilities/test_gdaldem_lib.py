@@ -13,6 +13,7 @@
 ###############################################################################
 
 import collections
+import contextlib
 import struct
 
 import gdaltest
@@ -945,3 +946,93 @@ def test_gdaldem_lib_flipped_hillshade_slope_roughness(alg):
     out_ds = gdal.Warp("", out_ds, format="MEM")
     assert ref_ds.GetGeoTransform() == pytest.approx(out_ds.GetGeoTransform())
     assert ref_ds.ReadRaster() == out_ds.ReadRaster()
+
+
+###############################################################################
+# Collect the debug messages emitted when strips are processed in parallel
+
+
+@contextlib.contextmanager
+def collect_strip_debug_messages():
+
+    debug_msgs = []
+
+    def handler(eErrClass, err_no, msg):
+        if eErrClass == gdal.CE_Debug and "strips using" in msg:
+            debug_msgs.append(msg)
+
+    with gdaltest.error_handler(handler), gdal.config_option("CPL_DEBUG", "GDALDEM"):
+        gdal.SetCurrentErrorHandlerCatchDebug(True)
+        yield debug_msgs
+
+
+###############################################################################
+# Test that multi-threaded processing gives the same result as single-threaded
+
+
+@pytest.mark.parametrize(
+    "alg,options",
+    [
+        ("hillshade", []),
+        ("hillshade", ["-alg", "ZevenbergenThorne"]),
+        ("hillshade", ["-combined"]),
+        ("hillshade", ["-multidirectional"]),
+        ("hillshade", ["-igor"]),
+        ("slope", []),
+        ("aspect", []),
+        ("TRI", []),
+        ("TPI", []),
+        ("roughness", []),
+        ("color-relief", ["-alpha"]),
+    ],
+)
+@pytest.mark.parametrize("computeEdges", [False, True])
+@pytest.mark.parametrize("src", ["GTiff", "MEM_Float32_nodata"])
+def test_gdaldem_lib_num_threads(alg, options, computeEdges, src):
+
+    src_ds = gdal.Open("../gdrivers/data/n43.tif")
+    if src != "GTiff":
+        src_ds = gdal.Translate("", src_ds, format="MEM", outputType=gdal.GDT_Float32)
+        src_ds.GetRasterBand(1).SetNoDataValue(0)
+        src_ds.GetRasterBand(1).WriteRaster(30, 40, 3, 2, b"\0" * (4 * 3 * 2))
+
+    kwargs = {"format": "MEM", "computeEdges": computeEdges}
+    if alg == "color-relief":
+        kwargs["colorFilename"] = "data/color_file.txt"
+
+    with collect_strip_debug_messages() as debug_msgs:
+        ref_ds = gdal.DEMProcessing(
+            "", src_ds, alg, options=options + ["-num_threads", "1"], **kwargs
+        )
+    assert debug_msgs == []
+    with collect_strip_debug_messages() as debug_msgs, gdal.config_option(
+        "GDAL_DEM_MIN_STRIP_HEIGHT", "7"
+    ):
+        out_ds = gdal.DEMProcessing(
+            "", src_ds, alg, options=options + ["-num_threads", "4"], **kwargs
+        )
+    # 121 lines split into strips of 16 lines
+    assert set(debug_msgs) == {"GDALDEM: Processing 8 strips using 4 threads"}
+    assert ref_ds.ReadRaster() == out_ds.ReadRaster()
+
+
+###############################################################################
+# Test multi-threaded processing of a streamed dataset
+
+
+@pytest.mark.parametrize("alg", ["hillshade", "slope", "TPI"])
+def test_gdaldem_lib_num_threads_stream(alg):
+
+    src_ds = gdal.Open("../gdrivers/data/n43.tif")
+    ref_ds = gdal.DEMProcessing(
+        "", src_ds, alg, format="MEM", options=["-num_threads", "1"]
+    )
+    with gdal.config_option("GDAL_DEM_MIN_STRIP_HEIGHT", "7"):
+        out_ds = gdal.DEMProcessing(
+            "", src_ds, alg, format="stream", options=["-num_threads", "4"]
+        )
+        with collect_strip_debug_messages() as debug_msgs:
+            assert out_ds.ReadRaster(buf_type=gdal.GDT_Float32) == ref_ds.ReadRaster(
+                buf_type=gdal.GDT_Float32
+            )
+        assert set(debug_msgs) == {"GDALDEM: Processing 8 strips using 4 threads"}
@@ -963,6 +963,65 @@ def test_gdalmdimtranslate_array_resample():
     assert struct.unpack("d" * 3, lon.Read()) == (1.5, 2.5, 3.5)
 
 
+###############################################################################
+
+
+@pytest.mark.require_driver("Zarr")
+@pytest.mark.skipif(
+    not gdaltest.vrt_has_open_support(),
+    reason="VRT driver open missing",
+)
+def test_gdalmdimtranslate_array_reduce(tmp_vsimem):
+
+    src_filename = str(tmp_vsimem / "src.zarr")
+    drv = gdal.GetDriverByName("Zarr")
+    with drv.CreateMultiDimensional(src_filename) as ds:
+        rg = ds.GetRootGroup()
+        dim_t = rg.CreateDimension("time", None, None, 3)
+        dim_y = rg.CreateDimension("y", None, None, 2)
+        dim_x = rg.CreateDimension("x", None, None, 2)
+        ar = rg.CreateMDArray(
+            "ar",
+            [dim_t, dim_y, dim_x],
+            gdal.ExtendedDataType.Create(gdal.GDT_Int16),
+        )
+        ar.Write(struct.pack("h" * 12, *range(12)))
+
+    with pytest.raises(Exception, match="Invalid value for reduce"):
+        gdal.MultiDimTranslate(
+            "", src_filename, arraySpecs=["name=ar,reduce=mean"], format="MEM"
+        )
+
+    with pytest.raises(Exception, match="has no dimension named 'invalid'"):
+        gdal.MultiDimTranslate(
+            "",
+            src_filename,
+            arraySpecs=["name=ar,reduce=mean:invalid"],
+            format="MEM",
+        )
+
+    ds = gdal.MultiDimTranslate(
+        "", src_filename, arraySpecs=["name=ar,reduce=mean:time"], format="MEM"
+    )
+    ar = ds.GetRootGroup().OpenMDArray("ar")
+    assert [dim.GetName() for dim in ar.GetDimensions()] == ["y", "x"]
+    assert ar.GetDataType() == gdal.ExtendedDataType.Create(gdal.GDT_Float64)
+    assert struct.unpack("d" * 4, ar.Read()) == (4, 5, 6, 7)
+
+    # Check that the reduction is serialized in the VRT
+    vrt_filename = str(tmp_vsimem / "out.vrt")
+    gdal.MultiDimTranslate(
+        vrt_filename,
+        src_filename,
+        arraySpecs=["name=ar,reduce=max:x,view=[::-1,:]"],
+        format="VRT",
+    )
+    ds = gdal.OpenEx(vrt_filename, gdal.OF_MULTIDIM_RASTER)
+    ar = ds.GetRootGroup().OpenMDArray("ar")
+    assert [dim.GetName() for dim in ar.GetDimensions()] == ["time", "y"]
+    assert struct.unpack("d" * 6, ar.Read()) == (9, 11, 5, 7, 1, 3)
+
+
 def XXXX_test_all():
     while True:
         test_gdalmdimtranslate_no_arg()
@@ -1029,3 +1088,107 @@ def test_gdalmdimtranslate_array_copy_blocksize(tmp_path):
     )
     ds = gdal.Open(tmp_path / "out.nc")
     assert ds.GetRasterBand(1).GetBlockSize() == [15, 6]
+
+
+###############################################################################
+# Test multi-threaded copy of arrays
+
+
+def _collect_debug_messages():
+    debug_msgs = []
+
+    def handler(eErrClass, err_no, msg):
+        if eErrClass == gdal.CE_Debug:
+            debug_msgs.append(msg)
+
+    return debug_msgs, handler
+
+
+@pytest.mark.require_driver("Zarr")
+@pytest.mark.parametrize("num_threads", [None, "1", "2", "ALL_CPUS"])
+def test_gdalmdimtranslate_num_threads(tmp_vsimem, num_threads):
+
+    src_filename = str(tmp_vsimem / "src.zarr")
+    drv = gdal.GetDriverByName("Zarr")
+    with drv.CreateMultiDimensional(src_filename) as ds:
+        rg = ds.GetRootGroup()
+        dim_y = rg.CreateDimension("y", None, None, 25)
+        dim_x = rg.CreateDimension("x", None, None, 30)
+        ar = rg.CreateMDArray(
+            "ar",
+            [dim_y, dim_x],
+            gdal.ExtendedDataType.Create(gdal.GDT_Int16),
+            ["BLOCKSIZE=4,7"],
+        )
+        ar.Write(struct.pack("h" * (25 * 30), *range(25 * 30)))
+
+    dst_filename = str(tmp_vsimem / "dst.zarr")
+    debug_msgs, handler = _collect_debug_messages()
+    # Force the copy to be done in several chunks, and check that
+    # GDAL_NUM_THREADS alone does not enable the multi-threaded copy
+    with gdaltest.error_handler(handler), gdaltest.config_options(
+        {"GDAL_SWATH_SIZE": "200", "GDAL_NUM_THREADS": "4", "CPL_DEBUG": "ON"}
+    ):
+        gdal.SetCurrentErrorHandlerCatchDebug(True)
+        gdal.MultiDimTranslate(
+            dst_filename,
+            src_filename,
+            format="Zarr",
+            options=["-num_threads", num_threads] if num_threads else [],
+        )
+
+    pipeline_msgs = [msg for msg in debug_msgs if "with a pipeline of" in msg]
+    if num_threads == "2" or (num_threads == "ALL_CPUS" and gdal.GetNumCPUs() > 1):
+        nthreads = 2 if num_threads == "2" else gdal.GetNumCPUs()
+        assert pipeline_msgs == [
+            f"GDAL: Copying /ar with a pipeline of {nthreads} threads"
+        ]
+    else:
+        assert pipeline_msgs == []
+
+    with gdal.OpenEx(dst_filename, gdal.OF_MULTIDIM_RASTER) as ds:
+        ar = ds.GetRootGroup().OpenMDArray("ar")
+        assert struct.unpack("h" * (25 * 30), ar.Read()) == tuple(range(25 * 30))
+
+
+###############################################################################
+# Test that arrays are not read and written concurrently when the input and
+# output drivers may share libhdf5
+
+
+@pytest.mark.require_driver("netCDF")
+def test_gdalmdimtranslate_num_threads_netcdf_to_netcdf(tmp_path):
+
+    src_filename = str(tmp_path / "src.nc")
+    drv = gdal.GetDriverByName("netCDF")
+    with drv.CreateMultiDimensional(src_filename) as ds:
+        rg = ds.GetRootGroup()
+        dim_y = rg.CreateDimension("y", None, None, 25)
+        dim_x = rg.CreateDimension("x", None, None, 30)
+        ar = rg.CreateMDArray(
+            "ar", [dim_y, dim_x], gdal.ExtendedDataType.Create(gdal.GDT_Int16)
+        )
+        ar.Write(struct.pack("h" * (25 * 30), *range(25 * 30)))
+
+    dst_filename = str(tmp_path / "dst.nc")
+    debug_msgs, handler = _collect_debug_messages()
+    with gdaltest.error_handler(handler), gdaltest.config_options(
+        {"GDAL_SWATH_SIZE": "200", "CPL_DEBUG": "ON"}
+    ):
+        gdal.SetCurrentErrorHandlerCatchDebug(True)
+        gdal.MultiDimTranslate(
+            dst_filename,
+            src_filename,
+            format="netCDF",
+            options=["-num_threads", "2"],
+        )
+
+    assert (
+        "GDALMDIMTRANSLATE: Source and output drivers may share a library that "
+        "is not thread-safe: ignoring -num_threads" in debug_msgs
+    )
+    assert not [msg for msg in debug_msgs if "with a pipeline of" in msg]
+
+    with gdal.OpenEx(dst_filename, gdal.OF_MULTIDIM_RASTER) as ds:
+        ar = ds.GetRootGroup().OpenMDArray("ar")
+        assert struct.unpack("h" * (25 * 30), ar.Read()) == tuple(range(25 * 30))
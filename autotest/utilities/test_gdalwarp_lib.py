@@ -4747,3 +4747,105 @@ def test_gdalwarp_lib_mask_band_and_src_nodata():
     ):
         out_ds = gdal.Warp("", src_ds, options="-f MEM -dstnodata 5")
         assert out_ds.GetRasterBand(1).ReadRaster() == b"\x05"
+
+
+###############################################################################
+# Test -plan
+
+
+@pytest.mark.require_driver("GTiff")
+def test_gdalwarp_lib_plan(tmp_vsimem):
+
+    plan_filename = str(tmp_vsimem / "plan.xml")
+    options = "-f MEM -t_srs EPSG:4326 -ts 40 30 -r bilinear"
+
+    ref_ds = gdal.Warp("", "../gcore/data/byte.tif", options=options)
+    ref_data = struct.unpack("B" * 40 * 30, ref_ds.GetRasterBand(1).ReadRaster())
+
+    # Creation of the plan
+    out_ds = gdal.Warp(
+        "", "../gcore/data/byte.tif", options=options + " -plan " + plan_filename
+    )
+    assert gdal.VSIStatL(plan_filename) is not None
+    data = struct.unpack("B" * 40 * 30, out_ds.GetRasterBand(1).ReadRaster())
+    assert max(abs(a - b) for a, b in zip(data, ref_data)) <= 1
+
+    # Reuse of the plan
+    out_ds = gdal.Warp(
+        "", "../gcore/data/byte.tif", options=options + " -plan " + plan_filename
+    )
+    assert out_ds.GetRasterBand(1).ReadRaster() == bytes(data)
+
+    # VRT output serializes the plan
+    vrt_filename = str(tmp_vsimem / "out.vrt")
+    gdal.Warp(
+        vrt_filename,
+        "../gcore/data/byte.tif",
+        options=options.replace("MEM", "VRT") + " -plan " + plan_filename,
+    )
+    with gdal.Open(vrt_filename) as vrt_ds:
+        assert vrt_ds.GetRasterBand(1).ReadRaster() == bytes(data)
+
+    # A plan created for other dimensions, error threshold or CRS is rebuilt
+    for other_options in (
+        "-f MEM -t_srs EPSG:4326 -ts 20 20 -r bilinear",
+        options + " -et 0.25",
+        "-f MEM -t_srs EPSG:32631 -ts 40 30 -r bilinear",
+    ):
+        other_ref_ds = gdal.Warp("", "../gcore/data/byte.tif", options=other_options)
+        gdal.ErrorReset()
+        with gdal.quiet_errors():
+            out_ds = gdal.Warp(
+                "",
+                "../gcore/data/byte.tif",
+                options=other_options + " -plan " + plan_filename,
+            )
+        assert "Rebuilding it" in gdal.GetLastErrorMsg()
+        other_ref_data = other_ref_ds.GetRasterBand(1).ReadRaster()
+        data = out_ds.GetRasterBand(1).ReadRaster()
+        assert max(abs(a - b) for a, b in zip(data, other_ref_data)) <= 1
+        gdal.ErrorReset()
+        gdal.Warp(
+            "",
+            "../gcore/data/byte.tif",
+            options=other_options + " -plan " + plan_filename,
+        )
+        assert gdal.GetLastErrorMsg() == ""
+
+    with pytest.raises(Exception, match="cannot be used with an error threshold"):
+        gdal.Warp(
+            "",
+            "../gcore/data/byte.tif",
+            options=options + " -et 0 -plan " + plan_filename,
+        )
+
+    gdal.FileFromMemBuffer(plan_filename, "<foo/>")
+    with pytest.raises(Exception, match="is not a warp plan"):
+        gdal.Warp(
+            "", "../gcore/data/byte.tif", options=options + " -plan " + plan_filename
+        )
+
+
+###############################################################################
+# Test -plan when part of the target raster is outside of the domain of
+# validity of the projection
+
+
+def test_gdalwarp_lib_plan_outside_projection_domain(tmp_vsimem):
+
+    src_ds = gdal.GetDriverByName("MEM").Create("", 360, 180)
+    src_ds.SetGeoTransform([-180, 1, 0, 90, 0, -1])
+    srs = osr.SpatialReference()
+    srs.ImportFromEPSG(4326)
+    src_ds.SetSpatialRef(srs)
+    src_ds.GetRasterBand(1).Fill(255)
+
+    options = '-f MEM -t_srs "+proj=ortho +lat_0=40 +lon_0=10" -ts 200 200'
+    ref_ds = gdal.Warp("", src_ds, options=options)
+    plan_filename = str(tmp_vsimem / "plan.xml")
+    out_ds = gdal.Warp("", src_ds, options=options + " -plan " + plan_filename)
+
+    # Pixels near the limb of the projection are kept
+    ref_data = ref_ds.GetRasterBand(1).ReadRaster()
+    data = out_ds.GetRasterBand(1).ReadRaster()
+    assert sum(1 for a, b in zip(data, ref_data) if a != b) <= 10
@@ -562,6 +562,28 @@ void COGRemoveWarpingOptions(CPLStringList &aosOptions)
     aosOptions.SetNameValue("ZOOM_LEVEL_STRATEGY", nullptr);
 }
 
+/************************************************************************/
+/*                            GetBlockSize()                            */
+/************************************************************************/
+
+static CPLString GetBlockSize(CSLConstList papszOptions,
+                              const gdal::TileMatrixSet *poTM)
+{
+    CPLString osBlockSize(CSLFetchNameValueDef(papszOptions, "BLOCKSIZE", ""));
+    if (osBlockSize.empty())
+    {
+        if (poTM)
+        {
+            osBlockSize.Printf("%d", poTM->tileMatrixList()[0].mTileWidth);
+        }
+        else
+        {
+            osBlockSize = "512";
+        }
+    }
+    return osBlockSize;
+}
+
 /************************************************************************/
 /*                        CreateReprojectedDS()                         */
 /************************************************************************/
@@ -571,28 +593,49 @@ static std::unique_ptr<GDALDataset> CreateReprojectedDS(
     const char *const *papszOptions, const CPLString &osResampling,
     const CPLString &osTargetSRS, const int nXSize, const int nYSize,
     const double dfMinX, const double dfMinY, const double dfMaxX,
-    const double dfMaxY, const double dfRes, GDALProgressFunc pfnProgress,
-    void *pProgressData, double &dfCurPixels, double &dfTotalPixelsToProcess)
+    const double dfMaxY, const double dfRes, const char *pszBlockSize,
+    GDALProgressFunc pfnProgress, void *pProgressData, double &dfCurPixels,
+    double &dfTotalPixelsToProcess)
 {
+    // By default, we materialize the reprojected dataset as a GTiff, since
+    // overview building and the final copy on a warped VRT means warping
+    // twice. WARP_TEMP_FILE=NO trades that CPU time for disk space, which
+    // matters for very large outputs.
+    const bool bUseTempFile = CPLTestBool(
+        CSLFetchNameValueDef(papszOptions, "WARP_TEMP_FILE", "YES"));
+
     char **papszArg = nullptr;
-    // We could have done a warped VRT, but overview building on it might be
-    // slow, so materialize as GTiff
-    papszArg = CSLAddString(papszArg, "-of");
-    papszArg = CSLAddString(papszArg, "GTiff");
-    papszArg = CSLAddString(papszArg, "-co");
-    papszArg = CSLAddString(papszArg, "TILED=YES");
-    papszArg = CSLAddString(papszArg, "-co");
-    papszArg = CSLAddString(papszArg, "SPARSE_OK=YES");
-    const char *pszBIGTIFF = CSLFetchNameValue(papszOptions, "BIGTIFF");
-    if (pszBIGTIFF)
+    if (bUseTempFile)
+    {
+        papszArg = CSLAddString(papszArg, "-of");
+        papszArg = CSLAddString(papszArg, "GTiff");
+        papszArg = CSLAddString(papszArg, "-co");
+        papszArg = CSLAddString(papszArg, "TILED=YES");
+        papszArg = CSLAddString(papszArg, "-co");
+        papszArg = CSLAddString(papszArg, "SPARSE_OK=YES");
+        const char *pszBIGTIFF = CSLFetchNameValue(papszOptions, "BIGTIFF");
+        if (pszBIGTIFF)
+        {
+            papszArg = CSLAddString(papszArg, "-co");
+            papszArg = CSLAddString(
+                papszArg, (CPLString("BIGTIFF=") + pszBIGTIFF).c_str());
+        }
+        papszArg = CSLAddString(papszArg, "-co");
+        papszArg = CSLAddString(
+            papszArg, HasZSTDCompression() ? "COMPRESS=ZSTD" : "COMPRESS=LZW");
+    }
+    else
     {
+        // Align the blocks of the warped VRT on the tiles of the output
+        papszArg = CSLAddString(papszArg, "-of");
+        papszArg = CSLAddString(papszArg, "VRT");
+        papszArg = CSLAddString(papszArg, "-co");
+        papszArg = CSLAddString(
+            papszArg, (CPLString("BLOCKXSIZE=") + pszBlockSize).c_str());
         papszArg = CSLAddString(papszArg, "-co");
-        papszArg = CSLAddString(papszArg,
-                                (CPLString("BIGTIFF=") + pszBIGTIFF).c_str());
+        papszArg = CSLAddString(
+            papszArg, (CPLString("BLOCKYSIZE=") + pszBlockSize).c_str());
     }
-    papszArg = CSLAddString(papszArg, "-co");
-    papszArg = CSLAddString(papszArg, HasZSTDCompression() ? "COMPRESS=ZSTD"
-                                                           : "COMPRESS=LZW");
     papszArg = CSLAddString(papszArg, "-t_srs");
     papszArg = CSLAddString(papszArg, osTargetSRS);
     papszArg = CSLAddString(papszArg, "-te");
@@ -649,8 +692,11 @@ static std::unique_ptr<GDALDataset> CreateReprojectedDS(
         CSLFetchNameValueDef(papszOptions, "OVERVIEWS", "AUTO");
     const bool bUseExistingOrNone = EQUAL(pszOverviews, "FORCE_USE_EXISTING") ||
                                     EQUAL(pszOverviews, "NONE");
+    const double dfWarpPixels =
+        bUseTempFile ? double(nXSize) * nYSize * (nBands + (bHasMask ? 1 : 0))
+                     : 0;
     dfTotalPixelsToProcess =
-        double(nXSize) * nYSize * (nBands + (bHasMask ? 1 : 0)) +
+        dfWarpPixels +
         ((bHasMask && !bUseExistingOrNone) ? double(nXSize) * nYSize / 3 : 0) +
         (!bUseExistingOrNone ? double(nXSize) * nYSize * nBands / 3 : 0) +
         double(nXSize) * nYSize * (nBands + (bHasMask ? 1 : 0)) * 4. / 3;
@@ -660,8 +706,7 @@ static std::unique_ptr<GDALDataset> CreateReprojectedDS(
     if (psOptions == nullptr)
         return nullptr;
 
-    const double dfNextPixels =
-        double(nXSize) * nYSize * (nBands + (bHasMask ? 1 : 0));
+    const double dfNextPixels = dfWarpPixels;
     void *pScaledProgress = GDALCreateScaledProgress(
         dfCurPixels / dfTotalPixelsToProcess,
         dfNextPixels / dfTotalPixelsToProcess, pfnProgress, pProgressData);
@@ -670,7 +715,9 @@ static std::unique_ptr<GDALDataset> CreateReprojectedDS(
     CPLDebug("COG", "Reprojecting source dataset: start");
     GDALWarpAppOptionsSetProgress(psOptions, GDALScaledProgress,
                                   pScaledProgress);
-    CPLString osTmpFile(GetTmpFilename(pszDstFilename, "warped.tif.tmp"));
+    const CPLString osTmpFile(
+        bUseTempFile ? GetTmpFilename(pszDstFilename, "warped.tif.tmp")
+                     : CPLString());
     auto hSrcDS = GDALDataset::ToHandle(poSrcDS);
 
     std::unique_ptr<CPLConfigOptionSetter> poWarpThreadSetter;
@@ -723,7 +770,7 @@ GDALCOGCreator::~GDALCOGCreator()
         CPLTestBool(CPLGetConfigOption("COG_DELETE_TEMP_FILES", "YES"));
     if (bDeleteTempFiles)
     {
-        if (m_poReprojectedDS)
+        if (m_poReprojectedDS && m_poReprojectedDS->GetDescription()[0])
         {
             CPLString osProjectedDSName(m_poReprojectedDS->GetDescription());
             m_poReprojectedDS.reset();
@@ -875,7 +922,8 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
             m_poReprojectedDS = CreateReprojectedDS(
                 pszFilename, poCurDS, papszOptions, osTargetResampling,
                 osTargetSRS, nTargetXSize, nTargetYSize, dfTargetMinX,
-                dfTargetMinY, dfTargetMaxX, dfTargetMaxY, dfRes, pfnProgress,
+                dfTargetMinY, dfTargetMaxX, dfTargetMaxY, dfRes,
+                GetBlockSize(papszOptions, poTM.get()), pfnProgress,
                 pProgressData, dfCurPixels, dfTotalPixelsToProcess);
             if (!m_poReprojectedDS)
                 return nullptr;
@@ -984,18 +1032,7 @@ GDALDataset *GDALCOGCreator::Create(const char *pszFilename,
         m_poVRTWithOrWithoutStats->ClearStatistics();
     }
 
-    CPLString osBlockSize(CSLFetchNameValueDef(papszOptions, "BLOCKSIZE", ""));
-    if (osBlockSize.empty())
-    {
-        if (poTM)
-        {
-            osBlockSize.Printf("%d", poTM->tileMatrixList()[0].mTileWidth);
-        }
-        else
-        {
-            osBlockSize = "512";
-        }
-    }
+    const CPLString osBlockSize(GetBlockSize(papszOptions, poTM.get()));
 
     const int nOvrThresholdSize = atoi(osBlockSize);
 
@@ -1640,6 +1677,9 @@ void GDALCOGDriver::InitializeCreationOptionList()
         "NO to "
         "disable the addition of an alpha band in case of reprojection' "
         "default='YES'/>"
+        "  <Option name='WARP_TEMP_FILE' type='boolean' description='Whether "
+        "the reprojected dataset is materialized as a temporary file, or "
+        "computed on-the-fly' default='YES'/>"
 #if LIBGEOTIFF_VERSION >= 1600
         "   <Option name='GEOTIFF_VERSION' type='string-select' default='AUTO' "
         "description='Which version of GeoTIFF must be used'>"
@@ -39,10 +39,12 @@
 #endif
 
 #include "gdal_priv_templates.hpp"
+#include "cpl_mem_cache.h"
 
 #include <algorithm>
 #include <cassert>
 #include <limits>
+#include <mutex>
 
 namespace gdal
 {
@@ -2810,6 +2812,120 @@ static const char pszExprPixelFuncMetadata[] =
     "   <Argument type='builtin' value='geotransform' />"
     "</PixelFunctionArgumentsList>";
 
+#if GDAL_VRT_ENABLE_MUPARSER
+
+/************************************************************************/
+/*                    VectorizedExpressionCacheEntry                    */
+/************************************************************************/
+
+// Cache of compiled vectorized expressions, so that they are not compiled
+// again each time a block is computed. As VectorizedExpression::Evaluate()
+// uses internal buffers, an instance is taken out of the cache while it is
+// used.
+struct VectorizedExpressionCacheEntry
+{
+    // Whether the expression is supported by gdal::VectorizedExpression
+    bool bSupported = false;
+    // Compiled instances that are not in use
+    std::vector<std::unique_ptr<gdal::VectorizedExpression>> apoIdle{};
+};
+
+static std::mutex g_oVectorizedExpressionCacheMutex;
+static lru11::Cache<std::string,
+                    std::shared_ptr<VectorizedExpressionCacheEntry>>
+    g_oVectorizedExpressionCache(64);
+
+/************************************************************************/
+/*                      ExprPixelFuncVectorized()                       */
+/************************************************************************/
+
+// Evaluates the expression a whole line at a time, with sources converted
+// to double arrays, instead of pixel by pixel.
+static CPLErr
+ExprPixelFuncVectorized(gdal::VectorizedExpression &oExpression,
+                        void **papoSources, int nSources, void *pData,
+                        int nXSize, int nYSize, GDALDataType eSrcType,
+                        GDALDataType eBufType, int nPixelSpace, int nLineSpace,
+                        bool bHasNoData, bool bPropagateNoData,
+                        double dfNoData, bool includeCenterCoords,
+                        const GDALGeoTransform &gt, int nXOff, int nYOff)
+{
+    const int nVariables = nSources + (includeCenterCoords ? 2 : 0);
+    std::vector<double> adfValues;
+    std::vector<double> adfResults;
+    try
+    {
+        adfValues.resize(static_cast<size_t>(nVariables) * nXSize);
+        adfResults.resize(nXSize);
+    }
+    catch (const std::bad_alloc &)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory,
+                 "Out of memory in ExprPixelFuncVectorized()");
+        return CE_Failure;
+    }
+
+    std::vector<const double *> apadfVariables(nVariables);
+    for (int iVar = 0; iVar < nVariables; ++iVar)
+        apadfVariables[iVar] =
+            adfValues.data() + static_cast<size_t>(iVar) * nXSize;
+    double *padfCenterX =
+        includeCenterCoords
+            ? adfValues.data() + static_cast<size_t>(nSources) * nXSize
+            : nullptr;
+    double *padfCenterY = includeCenterCoords ? padfCenterX + nXSize : nullptr;
+
+    const int nSrcTypeSize = GDALGetDataTypeSizeBytes(eSrcType);
+    for (int iLine = 0; iLine < nYSize; ++iLine)
+    {
+        const size_t nSrcOffset =
+            static_cast<size_t>(iLine) * nXSize * nSrcTypeSize;
+        for (int iSrc = 0; iSrc < nSources; iSrc++)
+        {
+            GDALCopyWords(static_cast<const GByte *>(papoSources[iSrc]) +
+                              nSrcOffset,
+                          eSrcType, nSrcTypeSize,
+                          adfValues.data() + static_cast<size_t>(iSrc) * nXSize,
+                          GDT_Float64, sizeof(double), nXSize);
+        }
+
+        if (includeCenterCoords)
+        {
+            for (int iCol = 0; iCol < nXSize; ++iCol)
+            {
+                // Add 0.5 to pixel / line to move from pixel corner to cell center
+                gt.Apply(static_cast<double>(iCol + nXOff) + 0.5,
+                         static_cast<double>(iLine + nYOff) + 0.5,
+                         &padfCenterX[iCol], &padfCenterY[iCol]);
+            }
+        }
+
+        oExpression.Evaluate(apadfVariables.data(), nXSize, adfResults.data());
+
+        if (bHasNoData && bPropagateNoData)
+        {
+            for (int iSrc = 0; iSrc < nSources; iSrc++)
+            {
+                const double *padfSrc = apadfVariables[iSrc];
+                for (int iCol = 0; iCol < nXSize; ++iCol)
+                {
+                    if (IsNoData(padfSrc[iCol], dfNoData))
+                        adfResults[iCol] = dfNoData;
+                }
+            }
+        }
+
+        GDALCopyWords(adfResults.data(), GDT_Float64, sizeof(double),
+                      static_cast<GByte *>(pData) +
+                          static_cast<GSpacing>(nLineSpace) * iLine,
+                      eBufType, nPixelSpace, nXSize);
+    }
+
+    return CE_None;
+}
+
+#endif  // GDAL_VRT_ENABLE_MUPARSER
+
 static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
                             int nXSize, int nYSize, GDALDataType eSrcType,
                             GDALDataType eBufType, int nPixelSpace,
@@ -2860,14 +2976,6 @@ static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
         pszDialect = "muparser";
     }
 
-    auto poExpression = gdal::MathExpression::Create(pszExpression, pszDialect);
-
-    // cppcheck-suppress knownConditionTrueFalse
-    if (!poExpression)
-    {
-        return CE_Failure;
-    }
-
     int nXOff = 0;
     int nYOff = 0;
     GDALGeoTransform gt;
@@ -2909,29 +3017,127 @@ static CPLErr ExprPixelFunc(void **papoSources, int nSources, void *pData,
         }
     }
 
+    // Create the expression evaluated pixel by pixel
+    const auto CreateMathExpression =
+        [pszExpression, pszDialect, &aosSourceNames, &adfValuesForPixel,
+         includeCenterCoords, &dfCenterX, &dfCenterY, bHasNoData, &dfNoData]()
     {
+        auto poExpr = gdal::MathExpression::Create(pszExpression, pszDialect);
+        if (!poExpr)
+            return poExpr;
+
         int iSource = 0;
         for (const auto &osName : aosSourceNames)
         {
-            poExpression->RegisterVariable(osName,
-                                           &adfValuesForPixel[iSource++]);
+            poExpr->RegisterVariable(osName, &adfValuesForPixel[iSource++]);
         }
-    }
 
-    if (includeCenterCoords)
-    {
-        poExpression->RegisterVariable("_CENTER_X_", &dfCenterX);
-        poExpression->RegisterVariable("_CENTER_Y_", &dfCenterY);
-    }
+        if (includeCenterCoords)
+        {
+            poExpr->RegisterVariable("_CENTER_X_", &dfCenterX);
+            poExpr->RegisterVariable("_CENTER_Y_", &dfCenterY);
+        }
+
+        if (bHasNoData)
+        {
+            poExpr->RegisterVariable("NODATA", &dfNoData);
+        }
+
+        if (strstr(pszExpression, "BANDS"))
+        {
+            poExpr->RegisterVector("BANDS", &adfValuesForPixel);
+        }
+        return poExpr;
+    };
 
-    if (bHasNoData)
+#if GDAL_VRT_ENABLE_MUPARSER
+    // Use the vectorized evaluator when it supports all the constructs of
+    // the expression. Older muparser versions have no isnodata() function.
+    if (EQUAL(pszDialect, "muparser") &&
+        (gdal::MuParserHasDefineFunUserData() ||
+         !strstr(pszExpression, "isnodata")) &&
+        CPLTestBool(
+            CPLGetConfigOption("GDAL_VRT_VECTORIZED_EXPRESSION", "YES")))
     {
-        poExpression->RegisterVariable("NODATA", &dfNoData);
+        std::vector<std::string> aosVariables(aosSourceNames.begin(),
+                                              aosSourceNames.end());
+        if (includeCenterCoords)
+        {
+            aosVariables.push_back("_CENTER_X_");
+            aosVariables.push_back("_CENTER_Y_");
+        }
+        std::vector<std::pair<std::string, double>> aoConstants;
+        if (bHasNoData)
+            aoConstants.emplace_back("NODATA", dfNoData);
+
+        std::string osKey(pszExpression);
+        for (const auto &osVariable : aosVariables)
+        {
+            osKey += '\n';
+            osKey += osVariable;
+        }
+        if (bHasNoData)
+            osKey += CPLSPrintf("\nNODATA=%.17g", dfNoData);
+
+        // Take a compiled instance of the expression from the cache
+        std::shared_ptr<VectorizedExpressionCacheEntry> poEntry;
+        std::unique_ptr<gdal::VectorizedExpression> poVectorizedExpression;
+        {
+            std::lock_guard oLock(g_oVectorizedExpressionCacheMutex);
+            if (g_oVectorizedExpressionCache.tryGet(osKey, poEntry) &&
+                !poEntry->apoIdle.empty())
+            {
+                poVectorizedExpression = std::move(poEntry->apoIdle.back());
+                poEntry->apoIdle.pop_back();
+            }
+        }
+
+        if (!poEntry)
+        {
+            poEntry = std::make_shared<VectorizedExpressionCacheEntry>();
+            poVectorizedExpression = gdal::VectorizedExpression::Create(
+                pszExpression, aosVariables, aoConstants);
+            poEntry->bSupported = poVectorizedExpression != nullptr;
+            if (poEntry->bSupported)
+            {
+                // Report invalid variable names as the muparser evaluator
+                // does
+                auto poExpression = CreateMathExpression();
+                if (!poExpression || poExpression->Compile() != CE_None)
+                    return CE_Failure;
+            }
+            std::lock_guard oLock(g_oVectorizedExpressionCacheMutex);
+            g_oVectorizedExpressionCache.insert(osKey, poEntry);
+        }
+        else if (poEntry->bSupported && !poVectorizedExpression)
+        {
+            // All cached instances are in use by other threads
+            poVectorizedExpression = gdal::VectorizedExpression::Create(
+                pszExpression, aosVariables, aoConstants);
+        }
+
+        if (poVectorizedExpression)
+        {
+            const CPLErr eErr = ExprPixelFuncVectorized(
+                *poVectorizedExpression, papoSources, nSources, pData, nXSize,
+                nYSize, eSrcType, eBufType, nPixelSpace, nLineSpace,
+                bHasNoData, bPropagateNoData, dfNoData, includeCenterCoords,
+                gt, nXOff, nYOff);
+
+            // Give the instance back to the cache
+            std::lock_guard oLock(g_oVectorizedExpressionCacheMutex);
+            poEntry->apoIdle.push_back(std::move(poVectorizedExpression));
+            return eErr;
+        }
     }
+#endif
+
+    auto poExpression = CreateMathExpression();
 
-    if (strstr(pszExpression, "BANDS"))
+    // cppcheck-suppress knownConditionTrueFalse
+    if (!poExpression)
     {
-        poExpression->RegisterVector("BANDS", &adfValuesForPixel);
+        return CE_Failure;
     }
 
     std::unique_ptr<double, VSIFreeReleaser> padfResults(
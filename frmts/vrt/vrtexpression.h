@@ -14,7 +14,10 @@
 
 #include "cpl_error.h"
 
+#include <memory>
+#include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace gdal
@@ -165,6 +168,58 @@ class MuParserExpression final : public MathExpression
 
 #endif
 
+/**
+ * Class to evaluate an expression over arrays of values at once.
+ *
+ * Only a subset of the muparser syntax is supported: numbers, variables,
+ * arithmetic, comparison and logical operators, the ternary operator and
+ * the most common functions. The expression is compiled once into a list
+ * of operations that each process a chunk of values, which is much faster
+ * than evaluating the expression for each value.
+ */
+class VectorizedExpression final
+{
+  public:
+    ~VectorizedExpression();
+
+    /**
+     * Compile an expression.
+     *
+     * @param osExpression The body of the expression, e.g. "(B-A)/(B+A)"
+     * @param aosVariables Names of the variables of the expression.
+     * @param aoConstants Names and values of constants, such as NODATA.
+     * @return a VectorizedExpression, or nullptr if the expression uses a
+     *         construct that is not supported. No error is emitted in that
+     *         case, and callers should fall back to a MathExpression.
+     *
+     * @since 3.12
+     */
+    static std::unique_ptr<VectorizedExpression>
+    Create(std::string_view osExpression,
+           const std::vector<std::string> &aosVariables,
+           const std::vector<std::pair<std::string, double>> &aoConstants);
+
+    /**
+     * Evaluate the expression.
+     *
+     * @param papadfVariables Array of aosVariables.size() pointers, each
+     *                        to nValues values of the matching variable.
+     * @param nValues Number of values to evaluate.
+     * @param padfResults Array of nValues values receiving the results.
+     *
+     * @since 3.12
+     */
+    void Evaluate(const double *const *papadfVariables, size_t nValues,
+                  double *padfResults);
+
+  private:
+    VectorizedExpression();
+
+    class Impl;
+
+    std::unique_ptr<Impl> m_pImpl;
+};
+
 inline std::unique_ptr<MathExpression>
 MathExpression::Create([[maybe_unused]] const char *pszExpression,
                        const char *pszDialect)
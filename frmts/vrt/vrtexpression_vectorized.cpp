@@ -0,0 +1,955 @@
+/******************************************************************************
+ *
+ * Project:  Virtual GDAL Datasets
+ * Purpose:  Implementation of VectorizedExpression
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "vrtexpression.h"
+
+#include "cpl_conv.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+
+namespace gdal
+{
+
+/*! @cond Doxygen_Suppress */
+
+namespace
+{
+
+// Number of values processed at once by each operation. Small enough for
+// the temporary arrays of an expression to remain in the L1/L2 cache.
+constexpr size_t CHUNK_SIZE = 256;
+
+enum class Op
+{
+    CONSTANT,
+    VARIABLE,
+    NEG,
+    ADD,
+    SUB,
+    MUL,
+    DIV,
+    POW,
+    POW2,
+    POW3,
+    POW4,
+    LT,
+    LE,
+    GT,
+    GE,
+    EQ,
+    NE,
+    AND,
+    OR,
+    IF,
+    MIN,
+    MAX,
+    FMOD,
+    ABS,
+    SIGN,
+    RINT,
+    ISNAN,
+    ISNODATA,
+    FUNC,
+};
+
+struct Node
+{
+    Op eOp = Op::CONSTANT;
+    double dfValue = 0;
+    int iVariable = -1;
+    double (*pfnFunc)(double) = nullptr;
+    std::vector<std::unique_ptr<Node>> apoArgs{};
+};
+
+/************************************************************************/
+/*                     Functions evaluated per value                    */
+/************************************************************************/
+
+// Implementations mirror the ones of muparser, so that results do not
+// depend on whether the expression is vectorized or not.
+
+static double Sin(double x)
+{
+    return std::sin(x);
+}
+
+static double Cos(double x)
+{
+    return std::cos(x);
+}
+
+static double Tan(double x)
+{
+    return std::tan(x);
+}
+
+static double ASin(double x)
+{
+    return std::asin(x);
+}
+
+static double ACos(double x)
+{
+    return std::acos(x);
+}
+
+static double ATan(double x)
+{
+    return std::atan(x);
+}
+
+static double Sinh(double x)
+{
+    return std::sinh(x);
+}
+
+static double Cosh(double x)
+{
+    return std::cosh(x);
+}
+
+static double Tanh(double x)
+{
+    return std::tanh(x);
+}
+
+static double ASinh(double x)
+{
+    return std::asinh(x);
+}
+
+static double ACosh(double x)
+{
+    return std::acosh(x);
+}
+
+static double ATanh(double x)
+{
+    return std::atanh(x);
+}
+
+static double Ln(double x)
+{
+    return std::log(x);
+}
+
+static double Log10(double x)
+{
+    return std::log10(x);
+}
+
+static double Exp(double x)
+{
+    return std::exp(x);
+}
+
+static double Sqrt(double x)
+{
+    return std::sqrt(x);
+}
+
+/************************************************************************/
+/*                        VectorizedExprParser                          */
+/************************************************************************/
+
+// Recursive descent parser for the subset of the muparser grammar that
+// VectorizedExpression can evaluate. Any other construct makes parsing
+// fail, without emitting an error.
+class VectorizedExprParser
+{
+  public:
+    VectorizedExprParser(
+        std::string_view osExpression,
+        const std::vector<std::string> &aosVariables,
+        const std::vector<std::pair<std::string, double>> &aoConstants)
+        : m_osExpr(osExpression), m_aosVariables(aosVariables)
+    {
+        m_oConstants["_pi"] = M_PI;
+        m_oConstants["_e"] = std::exp(1.0);
+        m_oConstants["nan"] = std::numeric_limits<double>::quiet_NaN();
+        m_oConstants["NaN"] = std::numeric_limits<double>::quiet_NaN();
+        for (const auto &[osName, dfValue] : aoConstants)
+        {
+            m_oConstants[osName] = dfValue;
+            if (osName == "NODATA")
+            {
+                m_bHasNoData = true;
+                m_dfNoData = dfValue;
+            }
+        }
+    }
+
+    std::unique_ptr<Node> Parse()
+    {
+        auto poNode = ParseTernary();
+        SkipSpaces();
+        if (!poNode || m_nPos != m_osExpr.size())
+            return nullptr;
+        return poNode;
+    }
+
+  private:
+    const std::string_view m_osExpr;
+    const std::vector<std::string> &m_aosVariables;
+    std::map<std::string, double> m_oConstants{};
+    bool m_bHasNoData = false;
+    double m_dfNoData = 0;
+    size_t m_nPos = 0;
+    int m_nDepth = 0;
+
+    static constexpr int MAX_DEPTH = 100;
+
+    void SkipSpaces()
+    {
+        while (m_nPos < m_osExpr.size() &&
+               (m_osExpr[m_nPos] == ' ' || m_osExpr[m_nPos] == '\t' ||
+                m_osExpr[m_nPos] == '\r' || m_osExpr[m_nPos] == '\n'))
+        {
+            ++m_nPos;
+        }
+    }
+
+    bool Accept(std::string_view osToken)
+    {
+        SkipSpaces();
+        if (m_osExpr.substr(m_nPos, osToken.size()) == osToken)
+        {
+            m_nPos += osToken.size();
+            return true;
+        }
+        return false;
+    }
+
+    bool Peek(char ch)
+    {
+        SkipSpaces();
+        return m_nPos < m_osExpr.size() && m_osExpr[m_nPos] == ch;
+    }
+
+    static std::unique_ptr<Node> MakeNode(Op eOp, std::unique_ptr<Node> poA,
+                                          std::unique_ptr<Node> poB = nullptr,
+                                          std::unique_ptr<Node> poC = nullptr)
+    {
+        auto poNode = std::make_unique<Node>();
+        poNode->eOp = eOp;
+        poNode->apoArgs.push_back(std::move(poA));
+        if (poB)
+            poNode->apoArgs.push_back(std::move(poB));
+        if (poC)
+            poNode->apoArgs.push_back(std::move(poC));
+        return poNode;
+    }
+
+    static std::unique_ptr<Node> MakeConstant(double dfValue)
+    {
+        auto poNode = std::make_unique<Node>();
+        poNode->eOp = Op::CONSTANT;
+        poNode->dfValue = dfValue;
+        return poNode;
+    }
+
+    std::unique_ptr<Node> ParseTernary()
+    {
+        if (++m_nDepth > MAX_DEPTH)
+            return nullptr;
+        auto poCond = ParseOr();
+        if (poCond && Accept("?"))
+        {
+            auto poThen = ParseTernary();
+            if (!poThen || !Accept(":"))
+                return nullptr;
+            auto poElse = ParseTernary();
+            if (!poElse)
+                return nullptr;
+            poCond = MakeNode(Op::IF, std::move(poCond), std::move(poThen),
+                              std::move(poElse));
+        }
+        --m_nDepth;
+        return poCond;
+    }
+
+    std::unique_ptr<Node> ParseOr()
+    {
+        auto poNode = ParseAnd();
+        while (poNode && Accept("||"))
+        {
+            auto poRHS = ParseAnd();
+            if (!poRHS)
+                return nullptr;
+            poNode = MakeNode(Op::OR, std::move(poNode), std::move(poRHS));
+        }
+        return poNode;
+    }
+
+    std::unique_ptr<Node> ParseAnd()
+    {
+        auto poNode = ParseComparison();
+        while (poNode && Accept("&&"))
+        {
+            auto poRHS = ParseComparison();
+            if (!poRHS)
+                return nullptr;
+            poNode = MakeNode(Op::AND, std::move(poNode), std::move(poRHS));
+        }
+        return poNode;
+    }
+
+    std::unique_ptr<Node> ParseComparison()
+    {
+        auto poNode = ParseAdditive();
+        while (poNode)
+        {
+            Op eOp;
+            if (Accept("<="))
+                eOp = Op::LE;
+            else if (Accept(">="))
+                eOp = Op::GE;
+            else if (Accept("=="))
+                eOp = Op::EQ;
+            else if (Accept("!="))
+                eOp = Op::NE;
+            else if (Accept("<"))
+                eOp = Op::LT;
+            else if (Accept(">"))
+                eOp = Op::GT;
+            else
+                break;
+            auto poRHS = ParseAdditive();
+            if (!poRHS)
+                return nullptr;
+            poNode = MakeNode(eOp, std::move(poNode), std::move(poRHS));
+        }
+        return poNode;
+    }
+
+    std::unique_ptr<Node> ParseAdditive()
+    {
+        auto poNode = ParseMultiplicative();
+        while (poNode)
+        {
+            Op eOp;
+            if (Accept("+"))
+                eOp = Op::ADD;
+            else if (Accept("-"))
+                eOp = Op::SUB;
+            else
+                break;
+            auto poRHS = ParseMultiplicative();
+            if (!poRHS)
+                return nullptr;
+            poNode = MakeNode(eOp, std::move(poNode), std::move(poRHS));
+        }
+        return poNode;
+    }
+
+    std::unique_ptr<Node> ParseMultiplicative()
+    {
+        auto poNode = ParseUnary();
+        while (poNode)
+        {
+            Op eOp;
+            if (Accept("*"))
+                eOp = Op::MUL;
+            else if (Accept("/"))
+                eOp = Op::DIV;
+            else
+                break;
+            auto poRHS = ParseUnary();
+            if (!poRHS)
+                return nullptr;
+            poNode = MakeNode(eOp, std::move(poNode), std::move(poRHS));
+        }
+        return poNode;
+    }
+
+    // As in muparser, the sign operators have a lower precedence than the
+    // power operator: -2^2 = -4
+    std::unique_ptr<Node> ParseUnary()
+    {
+        if (++m_nDepth > MAX_DEPTH)
+            return nullptr;
+        std::unique_ptr<Node> poNode;
+        if (Accept("-"))
+        {
+            poNode = ParseUnary();
+            if (poNode)
+                poNode = MakeNode(Op::NEG, std::move(poNode));
+        }
+        else if (Accept("+"))
+        {
+            poNode = ParseUnary();
+        }
+        else
+        {
+            poNode = ParsePower();
+        }
+        --m_nDepth;
+        return poNode;
+    }
+
+    std::unique_ptr<Node> ParsePower()
+    {
+        auto poNode = ParsePrimary();
+        if (poNode && Accept("^"))
+        {
+            // Right associative
+            auto poExponent = ParseUnary();
+            if (!poExponent)
+                return nullptr;
+            // muparser replaces small integer exponents by multiplications
+            if (poExponent->eOp == Op::CONSTANT &&
+                (poExponent->dfValue == 2 || poExponent->dfValue == 3 ||
+                 poExponent->dfValue == 4))
+            {
+                const Op eOp = poExponent->dfValue == 2   ? Op::POW2
+                               : poExponent->dfValue == 3 ? Op::POW3
+                                                          : Op::POW4;
+                poNode = MakeNode(eOp, std::move(poNode));
+            }
+            else
+            {
+                poNode = MakeNode(Op::POW, std::move(poNode),
+                                  std::move(poExponent));
+            }
+        }
+        return poNode;
+    }
+
+    std::unique_ptr<Node> ParseNumber()
+    {
+        const size_t nStart = m_nPos;
+        const auto IsDigit = [this]()
+        {
+            return m_nPos < m_osExpr.size() && m_osExpr[m_nPos] >= '0' &&
+                   m_osExpr[m_nPos] <= '9';
+        };
+        while (IsDigit())
+            ++m_nPos;
+        if (m_nPos < m_osExpr.size() && m_osExpr[m_nPos] == '.')
+        {
+            ++m_nPos;
+            while (IsDigit())
+                ++m_nPos;
+            if (m_nPos == nStart + 1)
+                return nullptr;
+        }
+        if (m_nPos < m_osExpr.size() &&
+            (m_osExpr[m_nPos] == 'e' || m_osExpr[m_nPos] == 'E'))
+        {
+            ++m_nPos;
+            if (m_nPos < m_osExpr.size() &&
+                (m_osExpr[m_nPos] == '+' || m_osExpr[m_nPos] == '-'))
+                ++m_nPos;
+            if (!IsDigit())
+                return nullptr;
+            while (IsDigit())
+                ++m_nPos;
+        }
+        return MakeConstant(
+            CPLAtof(std::string(m_osExpr.substr(nStart, m_nPos - nStart))
+                        .c_str()));
+    }
+
+    std::string ParseIdentifier()
+    {
+        const size_t nStart = m_nPos;
+        while (m_nPos < m_osExpr.size() &&
+               (isalnum(static_cast<unsigned char>(m_osExpr[m_nPos])) ||
+                m_osExpr[m_nPos] == '_'))
+        {
+            ++m_nPos;
+        }
+        std::string osName(m_osExpr.substr(nStart, m_nPos - nStart));
+
+        // Variable names such as X[1]
+        if (m_nPos < m_osExpr.size() && m_osExpr[m_nPos] == '[')
+        {
+            const auto nEnd = m_osExpr.find(']', m_nPos);
+            if (nEnd != std::string_view::npos)
+            {
+                std::string osIndexedName(
+                    m_osExpr.substr(nStart, nEnd + 1 - nStart));
+                if (std::find(m_aosVariables.begin(), m_aosVariables.end(),
+                              osIndexedName) != m_aosVariables.end())
+                {
+                    m_nPos = nEnd + 1;
+                    return osIndexedName;
+                }
+            }
+        }
+        return osName;
+    }
+
+    bool ParseArguments(std::vector<std::unique_ptr<Node>> &apoArgs)
+    {
+        if (!Accept("("))
+            return false;
+        do
+        {
+            auto poArg = ParseTernary();
+            if (!poArg)
+                return false;
+            apoArgs.push_back(std::move(poArg));
+        } while (Accept(","));
+        return Accept(")");
+    }
+
+    std::unique_ptr<Node> ParseFunction(const std::string &osName)
+    {
+        static const std::map<std::string, double (*)(double)> oMapFunc = {
+            {"sin", Sin},     {"cos", Cos},     {"tan", Tan},
+            {"asin", ASin},   {"acos", ACos},   {"atan", ATan},
+            {"sinh", Sinh},   {"cosh", Cosh},   {"tanh", Tanh},
+            {"asinh", ASinh}, {"acosh", ACosh}, {"atanh", ATanh},
+            {"ln", Ln},       {"log10", Log10}, {"exp", Exp},
+            {"sqrt", Sqrt},
+        };
+
+        std::vector<std::unique_ptr<Node>> apoArgs;
+        if (!ParseArguments(apoArgs))
+            return nullptr;
+
+        if (const auto oIter = oMapFunc.find(osName); oIter != oMapFunc.end())
+        {
+            if (apoArgs.size() != 1)
+                return nullptr;
+            auto poNode = MakeNode(Op::FUNC, std::move(apoArgs[0]));
+            poNode->pfnFunc = oIter->second;
+            return poNode;
+        }
+
+        const std::pair<const char *, Op> asUnaryOps[] = {
+            {"abs", Op::ABS},
+            {"sign", Op::SIGN},
+            {"rint", Op::RINT},
+            {"isnan", Op::ISNAN},
+            {"isnodata", Op::ISNODATA},
+        };
+        for (const auto &[pszName, eOp] : asUnaryOps)
+        {
+            if (osName == pszName)
+            {
+                if (apoArgs.size() != 1)
+                    return nullptr;
+                if (eOp == Op::ISNODATA && !m_bHasNoData)
+                {
+                    // isnodata() is always false in the absence of nodata
+                    return MakeConstant(0);
+                }
+                auto poNode = MakeNode(eOp, std::move(apoArgs[0]));
+                poNode->dfValue = m_dfNoData;
+                return poNode;
+            }
+        }
+
+        if (osName == "fmod")
+        {
+            if (apoArgs.size() != 2)
+                return nullptr;
+            return MakeNode(Op::FMOD, std::move(apoArgs[0]),
+                            std::move(apoArgs[1]));
+        }
+
+        // Variadic functions are evaluated as in muparser, that is
+        // min(a, b, c) = min(min(min(a, a), b), c) and
+        // sum(a, b, c) = ((0 + a) + b) + c
+        if (osName == "min" || osName == "max")
+        {
+            const Op eOp = osName == "min" ? Op::MIN : Op::MAX;
+            std::unique_ptr<Node> poNode;
+            for (auto &poArg : apoArgs)
+            {
+                poNode = poNode ? MakeNode(eOp, std::move(poNode),
+                                           std::move(poArg))
+                                : std::move(poArg);
+            }
+            return poNode;
+        }
+
+        if (osName == "sum" || osName == "avg")
+        {
+            const double dfCount = static_cast<double>(apoArgs.size());
+            std::unique_ptr<Node> poNode = MakeConstant(0);
+            for (auto &poArg : apoArgs)
+                poNode = MakeNode(Op::ADD, std::move(poNode), std::move(poArg));
+            if (osName == "avg")
+                poNode = MakeNode(Op::DIV, std::move(poNode),
+                                  MakeConstant(dfCount));
+            return poNode;
+        }
+
+        return nullptr;
+    }
+
+    std::unique_ptr<Node> ParsePrimary()
+    {
+        SkipSpaces();
+        if (m_nPos == m_osExpr.size())
+            return nullptr;
+
+        const char ch = m_osExpr[m_nPos];
+        if ((ch >= '0' && ch <= '9') || ch == '.')
+        {
+            return ParseNumber();
+        }
+
+        if (ch == '(')
+        {
+            ++m_nPos;
+            auto poNode = ParseTernary();
+            if (!poNode || !Accept(")"))
+                return nullptr;
+            return poNode;
+        }
+
+        if (!isalpha(static_cast<unsigned char>(ch)) && ch != '_')
+            return nullptr;
+
+        const std::string osName = ParseIdentifier();
+        if (Peek('('))
+            return ParseFunction(osName);
+
+        const auto oIterVar =
+            std::find(m_aosVariables.begin(), m_aosVariables.end(), osName);
+        if (oIterVar != m_aosVariables.end())
+        {
+            auto poNode = std::make_unique<Node>();
+            poNode->eOp = Op::VARIABLE;
+            poNode->iVariable =
+                static_cast<int>(oIterVar - m_aosVariables.begin());
+            return poNode;
+        }
+
+        if (const auto oIter = m_oConstants.find(osName);
+            oIter != m_oConstants.end())
+        {
+            return MakeConstant(oIter->second);
+        }
+
+        return nullptr;
+    }
+};
+
+/************************************************************************/
+/*                            Apply helpers                             */
+/************************************************************************/
+
+template <class F>
+static void Apply1(const double *padfA, double *padfOut, size_t nCount, F f)
+{
+    for (size_t i = 0; i < nCount; ++i)
+        padfOut[i] = f(padfA[i]);
+}
+
+template <class F>
+static void Apply2(const double *padfA, const double *padfB, double *padfOut,
+                   size_t nCount, F f)
+{
+    for (size_t i = 0; i < nCount; ++i)
+        padfOut[i] = f(padfA[i], padfB[i]);
+}
+
+static double ToDouble(bool b)
+{
+    return b ? 1.0 : 0.0;
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                     VectorizedExpression::Impl                       */
+/************************************************************************/
+
+class VectorizedExpression::Impl
+{
+  public:
+    // A compiled expression is a list of instructions, each evaluating a
+    // node of the expression tree over CHUNK_SIZE values at once. Slots
+    // [0, nVariables) are the input variables, the following ones are
+    // temporary arrays.
+    struct Instruction
+    {
+        Op eOp = Op::CONSTANT;
+        int iDst = 0;
+        int anArgs[3] = {0, 0, 0};
+        double dfValue = 0;
+        double (*pfnFunc)(double) = nullptr;
+    };
+
+    int m_nVariables = 0;
+    int m_nSlots = 0;
+    int m_iResult = 0;
+    std::vector<Instruction> m_aoInstructions{};
+    // Arrays of constants, that are filled once at compilation time
+    std::vector<std::pair<int, double>> m_aoConstantSlots{};
+    std::vector<double> m_adfTemporaries{};
+    std::vector<double *> m_apadfSlots{};
+
+    int Compile(const Node &oNode)
+    {
+        if (oNode.eOp == Op::VARIABLE)
+            return oNode.iVariable;
+
+        if (oNode.eOp == Op::CONSTANT)
+        {
+            const int iSlot = m_nSlots++;
+            m_aoConstantSlots.emplace_back(iSlot, oNode.dfValue);
+            return iSlot;
+        }
+
+        Instruction oInstr;
+        oInstr.eOp = oNode.eOp;
+        oInstr.dfValue = oNode.dfValue;
+        oInstr.pfnFunc = oNode.pfnFunc;
+        for (size_t i = 0; i < oNode.apoArgs.size(); ++i)
+            oInstr.anArgs[i] = Compile(*oNode.apoArgs[i]);
+        oInstr.iDst = m_nSlots++;
+        m_aoInstructions.push_back(oInstr);
+        return oInstr.iDst;
+    }
+
+    static void Execute(const Instruction &oInstr, double *const *papadfSlots,
+                        size_t nCount)
+    {
+        double *padfOut = papadfSlots[oInstr.iDst];
+        const double *padfA = papadfSlots[oInstr.anArgs[0]];
+        const double *padfB = papadfSlots[oInstr.anArgs[1]];
+        switch (oInstr.eOp)
+        {
+            case Op::CONSTANT:
+            case Op::VARIABLE:
+                break;
+            case Op::NEG:
+                Apply1(padfA, padfOut, nCount, [](double a) { return -a; });
+                break;
+            case Op::ADD:
+                Apply2(padfA, padfB, padfOut, nCount,
+                       [](double a, double b) { return a + b; });
+                break;
+            case Op::SUB:
+                Apply2(padfA, padfB, padfOut, nCount,
+                       [](double a, double b) { return a - b; });
+                break;
+            case Op::MUL:
+                Apply2(padfA, padfB, padfOut, nCount,
+                       [](double a, double b) { return a * b; });
+                break;
+            case Op::DIV:
+                Apply2(padfA, padfB, padfOut, nCount,
+                       [](double a, double b) { return a / b; });
+                break;
+            case Op::POW:
+                Apply2(padfA, padfB, padfOut, nCount,
+                       [](double a, double b) { return std::pow(a, b); });
+                break;
+            case Op::POW2:
+                Apply1(padfA, padfOut, nCount, [](double a) { return a * a; });
+                break;
+            case Op::POW3:
+                Apply1(padfA, padfOut, nCount,
+                       [](double a) { return a * a * a; });
+                break;
+            case Op::POW4:
+                Apply1(padfA, padfOut, nCount,
+                       [](double a) { return a * a * a * a; });
+                break;
+            case Op::LT:
+                Apply2(padfA, padfB, padfOut, nCount,
+                       [](double a, double b) { return ToDouble(a < b); });
+                break;
+            case Op::LE:
+                Apply2(padfA, padfB, padfOut, nCount,
+                       [](double a, double b) { return ToDouble(a <= b); });
+                break;
+            case Op::GT:
+                Apply2(padfA, padfB, padfOut, nCount,
+                       [](double a, double b) { return ToDouble(a > b); });
+                break;
+            case Op::GE:
+                Apply2(padfA, padfB, padfOut, nCount,
+                       [](double a, double b) { return ToDouble(a >= b); });
+                break;
+            case Op::EQ:
+                Apply2(padfA, padfB, padfOut, nCount,
+                       [](double a, double b) { return ToDouble(a == b); });
+                break;
+            case Op::NE:
+                Apply2(padfA, padfB, padfOut, nCount,
+                       [](double a, double b) { return ToDouble(a != b); });
+                break;
+            case Op::AND:
+                Apply2(padfA, padfB, padfOut, nCount, [](double a, double b)
+                       { return ToDouble(a != 0 && b != 0); });
+                break;
+            case Op::OR:
+                Apply2(padfA, padfB, padfOut, nCount, [](double a, double b)
+                       { return ToDouble(a != 0 || b != 0); });
+                break;
+            case Op::IF:
+            {
+                const double *padfC = papadfSlots[oInstr.anArgs[2]];
+                for (size_t i = 0; i < nCount; ++i)
+                    padfOut[i] = padfA[i] != 0 ? padfB[i] : padfC[i];
+                break;
+            }
+            case Op::MIN:
+                Apply2(padfA, padfB, padfOut, nCount,
+                       [](double a, double b) { return std::min(a, b); });
+                break;
+            case Op::MAX:
+                Apply2(padfA, padfB, padfOut, nCount,
+                       [](double a, double b) { return std::max(a, b); });
+                break;
+            case Op::FMOD:
+                Apply2(padfA, padfB, padfOut, nCount,
+                       [](double a, double b) { return std::fmod(a, b); });
+                break;
+            case Op::ABS:
+                Apply1(padfA, padfOut, nCount,
+                       [](double a) { return std::fabs(a); });
+                break;
+            case Op::SIGN:
+                Apply1(padfA, padfOut, nCount, [](double a)
+                       { return a < 0 ? -1.0 : (a > 0 ? 1.0 : 0.0); });
+                break;
+            case Op::RINT:
+                Apply1(padfA, padfOut, nCount,
+                       [](double a) { return std::floor(a + 0.5); });
+                break;
+            case Op::ISNAN:
+                Apply1(padfA, padfOut, nCount,
+                       [](double a) { return ToDouble(std::isnan(a)); });
+                break;
+            case Op::ISNODATA:
+            {
+                const double dfNoData = oInstr.dfValue;
+                if (std::isnan(dfNoData))
+                {
+                    Apply1(padfA, padfOut, nCount,
+                           [](double a) { return ToDouble(std::isnan(a)); });
+                }
+                else
+                {
+                    Apply1(padfA, padfOut, nCount, [dfNoData](double a)
+                           { return ToDouble(a == dfNoData); });
+                }
+                break;
+            }
+            case Op::FUNC:
+            {
+                const auto pfnFunc = oInstr.pfnFunc;
+                for (size_t i = 0; i < nCount; ++i)
+                    padfOut[i] = pfnFunc(padfA[i]);
+                break;
+            }
+        }
+    }
+};
+
+/************************************************************************/
+/*                        VectorizedExpression()                        */
+/************************************************************************/
+
+VectorizedExpression::VectorizedExpression() : m_pImpl(std::make_unique<Impl>())
+{
+}
+
+VectorizedExpression::~VectorizedExpression() = default;
+
+/************************************************************************/
+/*                    VectorizedExpression::Create()                    */
+/************************************************************************/
+
+std::unique_ptr<VectorizedExpression> VectorizedExpression::Create(
+    std::string_view osExpression, const std::vector<std::string> &aosVariables,
+    const std::vector<std::pair<std::string, double>> &aoConstants)
+{
+    VectorizedExprParser oParser(osExpression, aosVariables, aoConstants);
+    const auto poRoot = oParser.Parse();
+    if (!poRoot)
+        return nullptr;
+
+    auto poExpr =
+        std::unique_ptr<VectorizedExpression>(new VectorizedExpression());
+    auto &oImpl = *(poExpr->m_pImpl);
+    oImpl.m_nVariables = static_cast<int>(aosVariables.size());
+    oImpl.m_nSlots = oImpl.m_nVariables;
+    oImpl.m_iResult = oImpl.Compile(*poRoot);
+
+    const size_t nTemporaries =
+        static_cast<size_t>(oImpl.m_nSlots - oImpl.m_nVariables);
+    try
+    {
+        oImpl.m_adfTemporaries.resize(nTemporaries * CHUNK_SIZE);
+        oImpl.m_apadfSlots.resize(oImpl.m_nSlots);
+    }
+    catch (const std::bad_alloc &)
+    {
+        return nullptr;
+    }
+    for (size_t i = 0; i < nTemporaries; ++i)
+    {
+        oImpl.m_apadfSlots[oImpl.m_nVariables + i] =
+            oImpl.m_adfTemporaries.data() + i * CHUNK_SIZE;
+    }
+    for (const auto &[iSlot, dfValue] : oImpl.m_aoConstantSlots)
+    {
+        std::fill_n(oImpl.m_apadfSlots[iSlot], CHUNK_SIZE, dfValue);
+    }
+
+    return poExpr;
+}
+
+/************************************************************************/
+/*                   VectorizedExpression::Evaluate()                   */
+/************************************************************************/
+
+void VectorizedExpression::Evaluate(const double *const *papadfVariables,
+                                    size_t nValues, double *padfResults)
+{
+    auto &oImpl = *m_pImpl;
+    for (size_t nOffset = 0; nOffset < nValues; nOffset += CHUNK_SIZE)
+    {
+        const size_t nCount = std::min(CHUNK_SIZE, nValues - nOffset);
+        for (int i = 0; i < oImpl.m_nVariables; ++i)
+        {
+            oImpl.m_apadfSlots[i] =
+                const_cast<double *>(papadfVariables[i]) + nOffset;
+        }
+
+        if (oImpl.m_aoInstructions.empty())
+        {
+            // Expression is a single variable or constant
+            memcpy(padfResults + nOffset, oImpl.m_apadfSlots[oImpl.m_iResult],
+                   nCount * sizeof(double));
+            continue;
+        }
+
+        // The last instruction directly writes into the output array
+        double *padfLastTemp = oImpl.m_apadfSlots[oImpl.m_iResult];
+        oImpl.m_apadfSlots[oImpl.m_iResult] = padfResults + nOffset;
+        for (const auto &oInstr : oImpl.m_aoInstructions)
+        {
+            Impl::Execute(oInstr, oImpl.m_apadfSlots.data(), nCount);
+        }
+        oImpl.m_apadfSlots[oImpl.m_iResult] = padfLastTemp;
+    }
+}
+
+/*! @endcond Doxygen_Suppress */
+
+}  // namespace gdal
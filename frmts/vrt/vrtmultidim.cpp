@@ -22,6 +22,7 @@
 #include "cpl_minixml.h"
 #include "cpl_multiproc.h"
 #include "gdal_priv.h"
+#include "gdalmultidim_priv.h"
 #include "vrtdataset.h"
 
 VRTMDArraySource::~VRTMDArraySource() = default;
@@ -2110,6 +2111,23 @@ VRTMDArraySourceFromArray::GetSourceArray() const
     }
 
     std::string osViewExpr = m_osViewExpr;
+    if (STARTS_WITH(osViewExpr.c_str(), "reduce="))
+    {
+        const auto nCommaPos = osViewExpr.find(',');
+        poArray = GDALMDArrayGetReducedFromExpr(
+            poArray, osViewExpr.substr(strlen("reduce="),
+                                       nCommaPos == std::string::npos
+                                           ? std::string::npos
+                                           : nCommaPos - strlen("reduce=")));
+        if (poArray == nullptr)
+        {
+            return {nullptr, nullptr};
+        }
+        if (nCommaPos == std::string::npos)
+            osViewExpr.clear();
+        else
+            osViewExpr = osViewExpr.substr(nCommaPos + 1);
+    }
     if (STARTS_WITH(osViewExpr.c_str(), "resample=true,") ||
         osViewExpr == "resample=true")
     {
@@ -15,6 +15,7 @@
 
 #include "cpl_compressor.h"
 #include "cpl_json.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_priv.h"
 #include "gdal_pam_multidim.h"
 #include "memmultidim.h"
@@ -1497,12 +1498,25 @@ class ZarrV3CodecSequence
 /*                           ZarrV3Array                                */
 /************************************************************************/
 
+class CPLErrorAccumulator;
+
 class ZarrV3Array final : public ZarrArray
 {
     bool m_bV2ChunkKeyEncoding = false;
     std::unique_ptr<ZarrV3CodecSequence> m_poCodecs{};
     CPLJSONArray m_oJSONCodecs{};
 
+    // Only set during IWrite(), when dirty tiles are encoded and written
+    // by worker threads.
+    std::unique_ptr<CPLJobQueue> m_poTileWriteJobQueue{};
+    int m_nTileWriteThreads = 0;
+    mutable bool m_bTileWriteJobsOK = true;
+    mutable int m_nTileWriteJobs = 0;
+    CPLErrorAccumulator *m_poTileWriteErrors = nullptr;
+
+    ZarrV3Array(const ZarrV3Array &) = delete;
+    ZarrV3Array &operator=(const ZarrV3Array &) = delete;
+
     ZarrV3Array(const std::shared_ptr<ZarrSharedResource> &poSharedResource,
                 const std::string &osParentName, const std::string &osName,
                 const std::vector<std::shared_ptr<GDALDimension>> &aoDims,
@@ -1524,6 +1538,13 @@ class ZarrV3Array final : public ZarrArray
                       ZarrByteVectorQuickResize &abyDecodedTileData,
                       bool &bMissingTileOut) const;
 
+    uint64_t GetTileCountForRequest(const GUInt64 *arrayStartIdx,
+                                    const size_t *count) const;
+
+    bool EncodeAndWriteTile(const std::string &osFilename,
+                            ZarrV3CodecSequence *poCodecs,
+                            ZarrByteVectorQuickResize &abyTile) const;
+
   public:
     ~ZarrV3Array() override;
 
@@ -1567,6 +1588,16 @@ class ZarrV3Array final : public ZarrArray
     bool IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
                      CSLConstList papszOptions) const override;
 
+    bool IRead(const GUInt64 *arrayStartIdx, const size_t *count,
+               const GInt64 *arrayStep, const GPtrDiff_t *bufferStride,
+               const GDALExtendedDataType &bufferDataType,
+               void *pDstBuffer) const override;
+
+    bool IWrite(const GUInt64 *arrayStartIdx, const size_t *count,
+                const GInt64 *arrayStep, const GPtrDiff_t *bufferStride,
+                const GDALExtendedDataType &bufferDataType,
+                const void *pSrcBuffer) override;
+
     CPLStringList GetRawBlockInfoInfo() const override;
 };
 
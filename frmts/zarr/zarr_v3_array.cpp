@@ -10,6 +10,7 @@
  * SPDX-License-Identifier: MIT
  ****************************************************************************/
 
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
 #include "cpl_vsi_virtual.h"
 #include "gdal_thread_pool.h"
@@ -709,6 +710,166 @@ bool ZarrV3Array::IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
     return bGlobalStatus;
 }
 
+/************************************************************************/
+/*                ZarrV3Array::GetTileCountForRequest()                 */
+/************************************************************************/
+
+// Return the number of tiles intersecting the
+// [arrayStartIdx, arrayStartIdx + count[ window.
+uint64_t ZarrV3Array::GetTileCountForRequest(const GUInt64 *arrayStartIdx,
+                                             const size_t *count) const
+{
+    uint64_t nTiles = 1;
+    for (size_t i = 0; i < m_aoDims.size(); ++i)
+    {
+        // Overflow on number of tiles already checked in Create()
+        nTiles *= (arrayStartIdx[i] + count[i] - 1) / m_anBlockSize[i] -
+                  arrayStartIdx[i] / m_anBlockSize[i] + 1;
+    }
+    return nTiles;
+}
+
+/************************************************************************/
+/*                         ZarrV3Array::IRead()                         */
+/************************************************************************/
+
+bool ZarrV3Array::IRead(const GUInt64 *arrayStartIdx, const size_t *count,
+                        const GInt64 *arrayStep, const GPtrDiff_t *bufferStride,
+                        const GDALExtendedDataType &bufferDataType,
+                        void *pDstBuffer) const
+{
+    // When GDAL_NUM_THREADS is set, and the request spans several tiles that
+    // have not already been cached by AdviseRead(), decode them in parallel
+    // with IAdviseRead() into a temporary cache.
+    const int nThreads = GDALGetNumThreads();
+    bool bUseTemporaryCache = false;
+    if (nThreads > 1 && m_bValid && m_oMapTileIndexToCachedTile.empty())
+    {
+        const size_t nDims = m_aoDims.size();
+        std::vector<GUInt64> anStartIdx(nDims);
+        std::vector<size_t> anCount(nDims);
+        bool bContiguous = true;
+        for (size_t i = 0; i < nDims && bContiguous; ++i)
+        {
+            // Do not decode tiles that would be skipped by the step
+            bContiguous = count[i] == 1 || arrayStep[i] == 1 ||
+                          arrayStep[i] == -1;
+            anStartIdx[i] = arrayStep[i] < 0
+                                ? arrayStartIdx[i] - (count[i] - 1)
+                                : arrayStartIdx[i];
+            anCount[i] = count[i];
+        }
+
+        const uint64_t nTiles =
+            bContiguous ? GetTileCountForRequest(anStartIdx.data(),
+                                                 anCount.data())
+                        : 0;
+        // Use at most half of the remaining block cache, as IAdviseRead()
+        const uint64_t nCacheSize = static_cast<uint64_t>(
+            std::max<GIntBig>(0, GDALGetCacheMax64() - GDALGetCacheUsed64()) /
+            2);
+        if (nTiles > 1 &&
+            nTiles <= nCacheSize / std::max<size_t>(1, m_nTileSize))
+        {
+            // Make sure IAdviseRead() sees the content of the dirty tile
+            if (!FlushDirtyTile())
+                return false;
+
+            CPLStringList aosOptions;
+            aosOptions.SetNameValue("NUM_THREADS", CPLSPrintf("%d", nThreads));
+            aosOptions.SetNameValue(
+                "CACHE_SIZE",
+                CPLSPrintf(CPL_FRMT_GUIB, static_cast<GUIntBig>(nCacheSize)));
+            if (!IAdviseRead(anStartIdx.data(), anCount.data(),
+                             aosOptions.List()))
+            {
+                m_oMapTileIndexToCachedTile.clear();
+                return false;
+            }
+            CPLDebug(ZARR_DEBUG_KEY, "Decoding %d tiles of %s using %d threads",
+                     static_cast<int>(nTiles), GetFullName().c_str(),
+                     nThreads);
+            bUseTemporaryCache = true;
+        }
+    }
+
+    const bool bRet = ZarrArray::IRead(arrayStartIdx, count, arrayStep,
+                                       bufferStride, bufferDataType,
+                                       pDstBuffer);
+    if (bUseTemporaryCache)
+        m_oMapTileIndexToCachedTile.clear();
+    return bRet;
+}
+
+/************************************************************************/
+/*                         ZarrV3Array::IWrite()                        */
+/************************************************************************/
+
+bool ZarrV3Array::IWrite(const GUInt64 *arrayStartIdx, const size_t *count,
+                         const GInt64 *arrayStep,
+                         const GPtrDiff_t *bufferStride,
+                         const GDALExtendedDataType &bufferDataType,
+                         const void *pSrcBuffer)
+{
+    // When GDAL_NUM_THREADS is set, and the request spans several tiles,
+    // compress and write the tiles that are completed in worker threads.
+    // The last tile touched by the request stays in the dirty tile cache, as
+    // in the single-threaded case.
+    const int nThreads = GDALGetNumThreads();
+    CPLErrorAccumulator oErrorAccumulator;
+    if (nThreads > 1 && m_bValid)
+    {
+        const size_t nDims = m_aoDims.size();
+        std::vector<GUInt64> anStartIdx(nDims);
+        for (size_t i = 0; i < nDims; ++i)
+        {
+            anStartIdx[i] =
+                arrayStep[i] < 0
+                    ? arrayStartIdx[i] - (count[i] - 1) * (-arrayStep[i])
+                    : arrayStartIdx[i];
+        }
+        std::vector<size_t> anCount(nDims);
+        for (size_t i = 0; i < nDims; ++i)
+        {
+            anCount[i] = static_cast<size_t>(
+                (count[i] - 1) * std::abs(arrayStep[i]) + 1);
+        }
+        if (GetTileCountForRequest(anStartIdx.data(), anCount.data()) > 2)
+        {
+            auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+            if (poThreadPool)
+            {
+                m_poTileWriteJobQueue = poThreadPool->CreateJobQueue();
+                m_nTileWriteThreads = nThreads;
+                m_bTileWriteJobsOK = true;
+                m_nTileWriteJobs = 0;
+                m_poTileWriteErrors = &oErrorAccumulator;
+            }
+        }
+    }
+
+    bool bRet = ZarrArray::IWrite(arrayStartIdx, count, arrayStep,
+                                  bufferStride, bufferDataType, pSrcBuffer);
+
+    if (m_poTileWriteJobQueue)
+    {
+        m_poTileWriteJobQueue->WaitCompletion();
+        m_poTileWriteJobQueue.reset();
+        if (m_nTileWriteJobs > 0)
+        {
+            CPLDebug(ZARR_DEBUG_KEY,
+                     "Encoded and wrote %d tiles of %s using %d threads",
+                     m_nTileWriteJobs, GetFullName().c_str(),
+                     m_nTileWriteThreads);
+        }
+        m_poTileWriteErrors = nullptr;
+        oErrorAccumulator.ReplayErrors();
+        bRet = bRet && m_bTileWriteJobsOK;
+    }
+
+    return bRet;
+}
+
 /************************************************************************/
 /*                    ZarrV3Array::FlushDirtyTile()                     */
 /************************************************************************/
@@ -754,16 +915,6 @@ bool ZarrV3Array::FlushDirtyTile() const
         }
     }
 
-    const size_t nSizeBefore = m_abyRawTileData.size();
-    if (m_poCodecs)
-    {
-        if (!m_poCodecs->Encode(m_abyRawTileData))
-        {
-            m_abyRawTileData.resize(nSizeBefore);
-            return false;
-        }
-    }
-
     if (m_osDimSeparator == "/")
     {
         std::string osDir = CPLGetDirnameSafe(osFilename.c_str());
@@ -774,25 +925,90 @@ bool ZarrV3Array::FlushDirtyTile() const
             {
                 CPLError(CE_Failure, CPLE_AppDefined,
                          "Cannot create directory %s", osDir.c_str());
-                m_abyRawTileData.resize(nSizeBefore);
                 return false;
             }
         }
     }
 
+    if (m_poTileWriteJobQueue)
+    {
+        // Defer compression and writing to a worker thread, on a copy of
+        // the tile. Limit the number of pending tiles to bound memory usage.
+        struct TileWriteJob
+        {
+            std::string osFilename{};
+            ZarrByteVectorQuickResize abyTile{};
+            std::unique_ptr<ZarrV3CodecSequence> poCodecs{};
+        };
+
+        auto psJob = std::make_shared<TileWriteJob>();
+        psJob->osFilename = std::move(osFilename);
+        try
+        {
+            psJob->abyTile.resize(m_abyRawTileData.size());
+        }
+        catch (const std::bad_alloc &e)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+            return false;
+        }
+        memcpy(psJob->abyTile.data(), m_abyRawTileData.data(),
+               m_abyRawTileData.size());
+        if (m_poCodecs)
+            psJob->poCodecs = m_poCodecs->Clone();
+
+        m_poTileWriteJobQueue->WaitCompletion(2 * m_nTileWriteThreads);
+        ++m_nTileWriteJobs;
+        return m_poTileWriteJobQueue->SubmitJob(
+            [this, psJob]()
+            {
+                auto oContext = m_poTileWriteErrors->InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oContext);
+                const bool bOK = EncodeAndWriteTile(
+                    psJob->osFilename, psJob->poCodecs.get(), psJob->abyTile);
+                std::lock_guard<std::mutex> oLock(m_oMutex);
+                m_bTileWriteJobsOK = m_bTileWriteJobsOK && bOK;
+            });
+    }
+
+    const size_t nSizeBefore = m_abyRawTileData.size();
+    const bool bRet =
+        EncodeAndWriteTile(osFilename, m_poCodecs.get(), m_abyRawTileData);
+    m_abyRawTileData.resize(nSizeBefore);
+
+    return bRet;
+}
+
+/************************************************************************/
+/*                 ZarrV3Array::EncodeAndWriteTile()                    */
+/************************************************************************/
+
+// Compress abyTile (in place) and write it to osFilename.
+// This method should NOT modify any ZarrArray member, as it may be called
+// concurrently from several threads.
+bool ZarrV3Array::EncodeAndWriteTile(const std::string &osFilename,
+                                     ZarrV3CodecSequence *poCodecs,
+                                     ZarrByteVectorQuickResize &abyTile) const
+{
+    if (poCodecs)
+    {
+        if (!poCodecs->Encode(abyTile))
+        {
+            return false;
+        }
+    }
+
     VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "wb");
     if (fp == nullptr)
     {
         CPLError(CE_Failure, CPLE_AppDefined, "Cannot create tile %s",
                  osFilename.c_str());
-        m_abyRawTileData.resize(nSizeBefore);
         return false;
     }
 
     bool bRet = true;
-    const size_t nRawDataSize = m_abyRawTileData.size();
-    if (VSIFWriteL(m_abyRawTileData.data(), 1, nRawDataSize, fp) !=
-        nRawDataSize)
+    const size_t nRawDataSize = abyTile.size();
+    if (VSIFWriteL(abyTile.data(), 1, nRawDataSize, fp) != nRawDataSize)
     {
         CPLError(CE_Failure, CPLE_AppDefined,
                  "Could not write tile %s correctly", osFilename.c_str());
@@ -800,8 +1016,6 @@ bool ZarrV3Array::FlushDirtyTile() const
     }
     VSIFCloseL(fp);
 
-    m_abyRawTileData.resize(nSizeBefore);
-
     return bRet;
 }
 
@@ -2798,6 +2798,11 @@ GDALMDArrayH CPL_DLL GDALMDArrayGetResampled(GDALMDArrayH hArray,
                                              GDALRIOResampleAlg resampleAlg,
                                              OGRSpatialReferenceH hTargetSRS,
                                              CSLConstList papszOptions);
+GDALMDArrayH CPL_DLL GDALMDArrayGetReduced(GDALMDArrayH hArray,
+                                           const char *pszOperation,
+                                           size_t iDim,
+                                           CSLConstList papszOptions)
+    CPL_WARN_UNUSED_RESULT;
 GDALMDArrayH CPL_DLL GDALMDArrayGetGridded(
     GDALMDArrayH hArray, const char *pszGridOptions, GDALMDArrayH hXArray,
     GDALMDArrayH hYArray, CSLConstList papszOptions) CPL_WARN_UNUSED_RESULT;
@@ -2881,6 +2886,8 @@ bool CPL_DLL GDALMDArrayGetRawBlockInfo(GDALMDArrayH hArray,
 
 void CPL_DLL GDALReleaseArrays(GDALMDArrayH *arrays, size_t nCount);
 int CPL_DLL GDALMDArrayCache(GDALMDArrayH hArray, CSLConstList papszOptions);
+GDALMDArrayH CPL_DLL GDALMDArrayGetChunkCached(GDALMDArrayH hArray,
+                                               CSLConstList papszOptions);
 bool CPL_DLL GDALMDArrayRename(GDALMDArrayH hArray, const char *pszNewName);
 
 GDALRasterAttributeTableH CPL_DLL GDALCreateRasterAttributeTableFromMDArrays(
@@ -30,6 +30,7 @@
 /* ******************************************************************** */
 
 class GDALMDArray;
+class GDALMDArrayChunkCache;
 class GDALAttribute;
 class GDALDataset;
 class GDALDimension;
@@ -877,6 +878,10 @@ class CPL_DLL GDALMDArray : virtual public GDALAbstractMDArray,
     mutable bool m_bHasTriedCachedArray = false;
     mutable std::shared_ptr<GDALMDArray> m_poCachedArray{};
 
+    // In-memory chunk cache, enabled by GDAL_MDARRAY_CHUNK_CACHE_SIZE
+    mutable bool m_bHasTriedChunkCache = false;
+    mutable std::shared_ptr<GDALMDArrayChunkCache> m_poChunkCache{};
+
   protected:
     //! @cond Doxygen_Suppress
     GDALMDArray(const std::string &osParentName, const std::string &osName,
@@ -1045,6 +1050,10 @@ class CPL_DLL GDALMDArray : virtual public GDALAbstractMDArray,
                  const OGRSpatialReference *poTargetSRS,
                  CSLConstList papszOptions) const;
 
+    std::shared_ptr<GDALMDArray>
+    GetReduced(const std::string &osOperation, size_t iDim,
+               CSLConstList papszOptions = nullptr) const;
+
     std::shared_ptr<GDALMDArray>
     GetGridded(const std::string &osGridOptions,
                const std::shared_ptr<GDALMDArray> &poXArray = nullptr,
@@ -1090,6 +1099,9 @@ class CPL_DLL GDALMDArray : virtual public GDALAbstractMDArray,
 
     bool Cache(CSLConstList papszOptions = nullptr) const;
 
+    std::shared_ptr<GDALMDArray>
+    GetChunkCached(CSLConstList papszOptions = nullptr) const;
+
     bool
     Read(const GUInt64 *arrayStartIdx,    // array of size GetDimensionCount()
          const size_t *count,             // array of size GetDimensionCount()
@@ -12,6 +12,12 @@
 
 #include "gdal_thread_pool.h"
 
+#include "cpl_conv.h"
+#include "cpl_multiproc.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <cstdlib>
 #include <mutex>
 
 // For unclear reasons, attempts at making this a std::unique_ptr<>, even
@@ -52,3 +58,54 @@ void GDALDestroyGlobalThreadPool()
     delete gpoCompressThreadPool;
     gpoCompressThreadPool = nullptr;
 }
+
+/************************************************************************/
+/*                         GDALGetNumThreads()                          */
+/************************************************************************/
+
+/** Return the number of threads to use, as specified by the GDAL_NUM_THREADS
+ * configuration option ("ALL_CPUS" or an integer value).
+ *
+ * @param nMaxVal Maximum value to return, or -1 for no limit.
+ * @param bDefaultToAllCPUs Whether to default to ALL_CPUS (instead of 1) when
+ *                          GDAL_NUM_THREADS is not set.
+ * @return a value in [1, nMaxVal] range.
+ */
+int GDALGetNumThreads(int nMaxVal, bool bDefaultToAllCPUs)
+{
+    const char *pszThreads = CPLGetConfigOption(
+        "GDAL_NUM_THREADS", bDefaultToAllCPUs ? "ALL_CPUS" : "1");
+    int nThreads =
+        EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszThreads);
+    if (nMaxVal > 0)
+        nThreads = std::min(nThreads, nMaxVal);
+    return std::max(1, nThreads);
+}
+
+/************************************************************************/
+/*                         GDALGetNumThreads()                          */
+/************************************************************************/
+
+/** Return the number of threads to use, as specified by the pszItem option
+ * of papszOptions ("ALL_CPUS" or an integer value), or by the
+ * GDAL_NUM_THREADS configuration option if it is not set.
+ *
+ * @param papszOptions List of options.
+ * @param pszItem Name of the option, typically "NUM_THREADS".
+ * @param nMaxVal Maximum value to return, or -1 for no limit.
+ * @param bDefaultToAllCPUs Whether to default to ALL_CPUS (instead of 1) when
+ *                          neither the option nor GDAL_NUM_THREADS are set.
+ * @return a value in [1, nMaxVal] range.
+ */
+int GDALGetNumThreads(CSLConstList papszOptions, const char *pszItem,
+                      int nMaxVal, bool bDefaultToAllCPUs)
+{
+    const char *pszThreads = CSLFetchNameValue(papszOptions, pszItem);
+    if (!pszThreads)
+        return GDALGetNumThreads(nMaxVal, bDefaultToAllCPUs);
+    int nThreads =
+        EQUAL(pszThreads, "ALL_CPUS") ? CPLGetNumCPUs() : atoi(pszThreads);
+    if (nMaxVal > 0)
+        nThreads = std::min(nThreads, nMaxVal);
+    return std::max(1, nThreads);
+}
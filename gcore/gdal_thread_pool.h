@@ -19,4 +19,9 @@ CPLWorkerThreadPool CPL_DLL *GDALGetGlobalThreadPool(int nThreads);
 
 void GDALDestroyGlobalThreadPool();
 
+int CPL_DLL GDALGetNumThreads(int nMaxVal = -1, bool bDefaultToAllCPUs = false);
+
+int CPL_DLL GDALGetNumThreads(CSLConstList papszOptions, const char *pszItem,
+                              int nMaxVal = -1, bool bDefaultToAllCPUs = false);
+
 #endif  // GDAL_THREAD_POOL_H
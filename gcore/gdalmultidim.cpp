@@ -29,6 +29,7 @@
 #include "gdal_pam.h"
 #include "gdal_pam_multidim.h"
 #include "gdal_rat.h"
+#include "gdal_thread_pool.h"
 #include "gdal_utils.h"
 #include "cpl_safemaths.hpp"
 #include "memmultidim.h"
@@ -4086,26 +4087,33 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
             GUInt64 nTotalBytesThisArray = 0;
             bool bStop = false;
 
-            static bool f(GDALAbstractMDArray *l_poSrcArray,
-                          const GUInt64 *chunkArrayStartIdx,
-                          const size_t *chunkCount, GUInt64 iCurChunk,
-                          GUInt64 nChunkCount, void *pUserData)
+            // Multi-threaded pipeline: a source chunk is read by a worker
+            // thread while the previous one is written by the calling thread.
+            const GDALMDArray *poSrcArray = nullptr;
+            std::unique_ptr<CPLJobQueue> poJobQueue{};
+            int nThreads = 1;
+            std::vector<GByte> abyTmp2{};
+            bool bHasPendingChunk = false;
+            bool bPendingReadOK = false;
+            std::vector<GUInt64> anPendingStartIdx{};
+            std::vector<size_t> anPendingCount{};
+            GUInt64 iPendingChunk = 0;
+            std::unique_ptr<CPLErrorAccumulator> poPendingErrors{};
+            // Chunk read by the last completed job, stored in abyTmp
+            std::vector<GUInt64> anReadyStartIdx{};
+            std::vector<size_t> anReadyCount{};
+            GUInt64 iReadyChunk = 0;
+            GUInt64 nTotalChunkCount = 0;
+
+            // Free the strings of a chunk that has been read
+            static void FreeChunk(const GDALAbstractMDArray *l_poSrcArray,
+                                  const size_t *chunkCount, GByte *pabyChunk)
             {
                 const auto &dt(l_poSrcArray->GetDataType());
-                auto data = static_cast<CopyFunc *>(pUserData);
-                auto poDstArray = data->poDstArray;
-                if (!l_poSrcArray->Read(chunkArrayStartIdx, chunkCount, nullptr,
-                                        nullptr, dt, &data->abyTmp[0]))
-                {
-                    return false;
-                }
-                bool bRet =
-                    poDstArray->Write(chunkArrayStartIdx, chunkCount, nullptr,
-                                      nullptr, dt, &data->abyTmp[0]);
                 if (dt.NeedsFreeDynamicMemory())
                 {
                     const auto l_nDTSize = dt.GetSize();
-                    GByte *ptr = &data->abyTmp[0];
+                    GByte *ptr = pabyChunk;
                     const size_t l_nDims(l_poSrcArray->GetDimensionCount());
                     size_t nEltCount = 1;
                     for (size_t i = 0; i < l_nDims; ++i)
@@ -4118,27 +4126,125 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
                         ptr += l_nDTSize;
                     }
                 }
+            }
+
+            bool WriteChunk(const GDALAbstractMDArray *l_poSrcArray,
+                            const GUInt64 *chunkArrayStartIdx,
+                            const size_t *chunkCount, GUInt64 iCurChunk,
+                            GUInt64 nChunkCount, GByte *pabyChunk)
+            {
+                const auto &dt(l_poSrcArray->GetDataType());
+                bool bRet = poDstArray->Write(chunkArrayStartIdx, chunkCount,
+                                              nullptr, nullptr, dt, pabyChunk);
+                FreeChunk(l_poSrcArray, chunkCount, pabyChunk);
                 if (!bRet)
                 {
                     return false;
                 }
 
                 double dfCurCost =
-                    double(data->nCurCost) + double(iCurChunk) / nChunkCount *
-                                                 data->nTotalBytesThisArray;
-                if (!data->pfnProgress(dfCurCost / data->nTotalCost, "",
-                                       data->pProgressData))
+                    double(nCurCost) +
+                    double(iCurChunk) / nChunkCount * nTotalBytesThisArray;
+                if (!pfnProgress(dfCurCost / nTotalCost, "", pProgressData))
                 {
-                    data->bStop = true;
+                    bStop = true;
                     return false;
                 }
 
                 return true;
             }
+
+            // Wait for the read of the pending chunk, whose content is
+            // then available in abyTmp.
+            bool WaitPendingChunk()
+            {
+                bHasPendingChunk = false;
+                poJobQueue->WaitCompletion();
+                poPendingErrors->ReplayErrors();
+                std::swap(abyTmp, abyTmp2);
+                std::swap(anReadyStartIdx, anPendingStartIdx);
+                std::swap(anReadyCount, anPendingCount);
+                iReadyChunk = iPendingChunk;
+                return bPendingReadOK;
+            }
+
+            bool WriteReadyChunk(const GDALAbstractMDArray *l_poSrcArray)
+            {
+                return WriteChunk(l_poSrcArray, anReadyStartIdx.data(),
+                                  anReadyCount.data(), iReadyChunk,
+                                  nTotalChunkCount, abyTmp.data());
+            }
+
+            static bool f(GDALAbstractMDArray *l_poSrcArray,
+                          const GUInt64 *chunkArrayStartIdx,
+                          const size_t *chunkCount, GUInt64 iCurChunk,
+                          GUInt64 nChunkCount, void *pUserData)
+            {
+                const auto &dt(l_poSrcArray->GetDataType());
+                auto data = static_cast<CopyFunc *>(pUserData);
+                if (data->poJobQueue)
+                {
+                    const bool bHasReadyChunk = data->bHasPendingChunk;
+                    if (bHasReadyChunk && !data->WaitPendingChunk())
+                        return false;
+
+                    // Read this chunk into abyTmp2 in a worker thread, while
+                    // the previous one is written from abyTmp.
+                    const size_t l_nDims(l_poSrcArray->GetDimensionCount());
+                    data->anPendingStartIdx.assign(
+                        chunkArrayStartIdx, chunkArrayStartIdx + l_nDims);
+                    data->anPendingCount.assign(chunkCount,
+                                                chunkCount + l_nDims);
+                    data->iPendingChunk = iCurChunk;
+                    data->nTotalChunkCount = nChunkCount;
+                    data->poPendingErrors =
+                        std::make_unique<CPLErrorAccumulator>();
+                    data->bHasPendingChunk = true;
+                    data->poJobQueue->SubmitJob(
+                        [data, l_poSrcArray]()
+                        {
+                            auto oContext = data->poPendingErrors
+                                                ->InstallForCurrentScope();
+                            CPL_IGNORE_RET_VAL(oContext);
+                            const auto &l_dt(l_poSrcArray->GetDataType());
+                            // Let drivers that support it (e.g. Zarr)
+                            // decode the blocks of the chunk in parallel
+                            if (data->nThreads > 2)
+                            {
+                                CPLStringList aosOptions;
+                                aosOptions.SetNameValue(
+                                    "NUM_THREADS",
+                                    CPLSPrintf("%d", data->nThreads - 1));
+                                CPL_IGNORE_RET_VAL(
+                                    data->poSrcArray->AdviseRead(
+                                        data->anPendingStartIdx.data(),
+                                        data->anPendingCount.data(),
+                                        aosOptions.List()));
+                            }
+                            data->bPendingReadOK = l_poSrcArray->Read(
+                                data->anPendingStartIdx.data(),
+                                data->anPendingCount.data(), nullptr, nullptr,
+                                l_dt, data->abyTmp2.data());
+                        });
+
+                    return !bHasReadyChunk ||
+                           data->WriteReadyChunk(l_poSrcArray);
+                }
+
+                if (!l_poSrcArray->Read(chunkArrayStartIdx, chunkCount, nullptr,
+                                        nullptr, dt, &data->abyTmp[0]))
+                {
+                    return false;
+                }
+                return data->WriteChunk(l_poSrcArray, chunkArrayStartIdx,
+                                        chunkCount, iCurChunk, nChunkCount,
+                                        data->abyTmp.data());
+            }
         };
 
         CopyFunc copyFunc;
         copyFunc.poDstArray = this;
+        copyFunc.poSrcArray = poSrcArray;
         copyFunc.nCurCost = nCurCost;
         copyFunc.nTotalCost = nTotalCost;
         copyFunc.nTotalBytesThisArray = GetTotalElementsCount() * nDTSize;
@@ -4156,9 +4262,11 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
                                GDALGetCacheMax64() / 4));
         const auto anChunkSizes(GetProcessingChunkSize(nMaxChunkSize));
         size_t nRealChunkSize = nDTSize;
-        for (const auto &nChunkSize : anChunkSizes)
+        GUInt64 nChunkCount = 1;
+        for (size_t i = 0; i < anChunkSizes.size(); ++i)
         {
-            nRealChunkSize *= nChunkSize;
+            nRealChunkSize *= anChunkSizes[i];
+            nChunkCount *= cpl::div_round_up(count[i], anChunkSizes[i]);
         }
         try
         {
@@ -4171,12 +4279,60 @@ bool GDALMDArray::CopyFrom(CPL_UNUSED GDALDataset *poSrcDS,
             nCurCost += copyFunc.nTotalBytesThisArray;
             return false;
         }
-        if (copyFunc.nTotalBytesThisArray != 0 &&
-            !const_cast<GDALMDArray *>(poSrcArray)
-                 ->ProcessPerChunk(arrayStartIdx.data(), count.data(),
-                                   anChunkSizes.data(), CopyFunc::f,
-                                   &copyFunc) &&
-            (bStrict || copyFunc.bStop))
+
+        // The multi-threaded pipeline is only enabled by callers, such as
+        // gdalmdimtranslate, that know that the source and destination
+        // arrays can be read and written concurrently.
+        const char *pszNumThreads =
+            CPLGetConfigOption("GDAL_MDARRAY_COPY_NUM_THREADS", nullptr);
+        if (pszNumThreads)
+        {
+            copyFunc.nThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                                    ? CPLGetNumCPUs()
+                                    : std::max(1, atoi(pszNumThreads));
+        }
+        if (copyFunc.nThreads > 1 && nChunkCount > 1)
+        {
+            auto poThreadPool = GDALGetGlobalThreadPool(copyFunc.nThreads);
+            if (poThreadPool)
+            {
+                try
+                {
+                    copyFunc.abyTmp2.resize(nRealChunkSize);
+                    copyFunc.poJobQueue = poThreadPool->CreateJobQueue();
+                    CPLDebug("GDAL",
+                             "Copying %s with a pipeline of %d threads",
+                             poSrcArray->GetFullName().c_str(),
+                             copyFunc.nThreads);
+                }
+                catch (const std::exception &)
+                {
+                    // Fallback to single-threaded copy
+                    copyFunc.abyTmp2.clear();
+                }
+            }
+        }
+
+        bool bRet = copyFunc.nTotalBytesThisArray == 0 ||
+                    const_cast<GDALMDArray *>(poSrcArray)
+                        ->ProcessPerChunk(arrayStartIdx.data(), count.data(),
+                                          anChunkSizes.data(), CopyFunc::f,
+                                          &copyFunc);
+        // Write the last chunk (or just wait for it and free it in case of
+        // error)
+        if (copyFunc.bHasPendingChunk)
+        {
+            if (!copyFunc.WaitPendingChunk())
+                bRet = false;
+            else if (!bRet)
+            {
+                CopyFunc::FreeChunk(poSrcArray, copyFunc.anReadyCount.data(),
+                                    copyFunc.abyTmp.data());
+            }
+            else if (!copyFunc.WriteReadyChunk(poSrcArray))
+                bRet = false;
+        }
+        if (!bRet && (bStrict || copyFunc.bStop))
         {
             nCurCost += copyFunc.nTotalBytesThisArray;
             return false;
@@ -4578,6 +4734,19 @@ bool GDALMDArray::Read(const GUInt64 *arrayStartIdx, const size_t *count,
         }
     }
 
+    if (!m_bHasTriedChunkCache)
+    {
+        m_bHasTriedChunkCache = true;
+        // Only read-only arrays are eligible, so that the cache cannot get
+        // out of sync with the array content.
+        const size_t nChunkCacheSize = GDALMDArrayChunkCache::GetDefaultSize();
+        if (nChunkCacheSize > 0 && !m_poCachedArray && !IsWritable())
+        {
+            m_poChunkCache =
+                GDALMDArrayChunkCache::Create(*this, nChunkCacheSize);
+        }
+    }
+
     const auto array = m_poCachedArray ? m_poCachedArray.get() : this;
     if (!array->GetDataType().CanConvertTo(bufferDataType))
     {
@@ -4596,6 +4765,21 @@ bool GDALMDArray::Read(const GUInt64 *arrayStartIdx, const size_t *count,
         return false;
     }
 
+    if (m_poChunkCache)
+    {
+        const auto readFunc =
+            [this](const GUInt64 *arrayStartIdxIn, const size_t *countIn,
+                   const GInt64 *arrayStepIn, const GPtrDiff_t *bufferStrideIn,
+                   const GDALExtendedDataType &bufferDataTypeIn,
+                   void *pDstBufferIn)
+        {
+            return IRead(arrayStartIdxIn, countIn, arrayStepIn,
+                         bufferStrideIn, bufferDataTypeIn, pDstBufferIn);
+        };
+        return m_poChunkCache->Read(readFunc, arrayStartIdx, count, arrayStep,
+                                    bufferStride, bufferDataType, pDstBuffer);
+    }
+
     return array->IRead(arrayStartIdx, count, arrayStep, bufferStride,
                         bufferDataType, pDstBuffer);
 }
@@ -13330,6 +13514,32 @@ GDALMDArrayH *GDALMDArrayGetCoordinateVariables(GDALMDArrayH hArray,
     return ret;
 }
 
+/************************************************************************/
+/*                        GDALMDArrayGetReduced()                       */
+/************************************************************************/
+
+/** Return an array whose values are the reduction of the values of this
+ * array along one of its dimensions.
+ *
+ * The returned object should be released with GDALMDArrayRelease().
+ *
+ * This is the same as the C++ method GDALMDArray::GetReduced().
+ *
+ * @since GDAL 3.12
+ */
+GDALMDArrayH GDALMDArrayGetReduced(GDALMDArrayH hArray,
+                                   const char *pszOperation, size_t iDim,
+                                   CSLConstList papszOptions)
+{
+    VALIDATE_POINTER1(hArray, __func__, nullptr);
+    VALIDATE_POINTER1(pszOperation, __func__, nullptr);
+    auto reduced =
+        hArray->m_poImpl->GetReduced(pszOperation, iDim, papszOptions);
+    if (!reduced)
+        return nullptr;
+    return new GDALMDArrayHS(reduced);
+}
+
 /************************************************************************/
 /*                     GDALMDArrayGetGridded()                          */
 /************************************************************************/
@@ -13469,6 +13679,29 @@ int GDALMDArrayCache(GDALMDArrayH hArray, CSLConstList papszOptions)
     return hArray->m_poImpl->Cache(papszOptions);
 }
 
+/************************************************************************/
+/*                      GDALMDArrayGetChunkCached()                     */
+/************************************************************************/
+
+/** Return a view of the array that caches, in memory, the chunks read from
+ * the array.
+ *
+ * The returned object should be released with GDALMDArrayRelease().
+ *
+ * This is the same as the C++ method GDALMDArray::GetChunkCached().
+ *
+ * @since GDAL 3.12
+ */
+GDALMDArrayH GDALMDArrayGetChunkCached(GDALMDArrayH hArray,
+                                       CSLConstList papszOptions)
+{
+    VALIDATE_POINTER1(hArray, __func__, nullptr);
+    auto cached = hArray->m_poImpl->GetChunkCached(papszOptions);
+    if (!cached)
+        return nullptr;
+    return new GDALMDArrayHS(cached);
+}
+
 /************************************************************************/
 /*                       GDALMDArrayRename()                           */
 /************************************************************************/
@@ -0,0 +1,634 @@
+/******************************************************************************
+ *
+ * Name:     gdalmultidim_chunkcache.cpp
+ * Project:  GDAL Core
+ * Purpose:  GDALMDArray::GetChunkCached() implementation
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gdal_priv.h"
+#include "gdal_pam_multidim.h"
+#include "gdalmultidim_priv.h"
+
+#include <algorithm>
+#include <limits>
+#include <new>
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                       GDALMDArrayChunkCache()                        */
+/************************************************************************/
+
+GDALMDArrayChunkCache::GDALMDArrayChunkCache(
+    const std::string &osArrayName, std::vector<GUInt64> &&anDimSizes,
+    std::vector<GUInt64> &&anChunkSizes, const GDALExtendedDataType &oDT,
+    size_t nMaxChunks)
+    : m_osArrayName(osArrayName), m_anDimSizes(std::move(anDimSizes)),
+      m_anChunkSizes(std::move(anChunkSizes)), m_dt(oDT),
+      m_oCache(nMaxChunks, 0)
+{
+}
+
+/************************************************************************/
+/*                       ~GDALMDArrayChunkCache()                       */
+/************************************************************************/
+
+GDALMDArrayChunkCache::~GDALMDArrayChunkCache()
+{
+    if (m_nHits > 0 || m_nMisses > 0)
+    {
+        CPLDebug("GDAL",
+                 "Chunk cache of %s: " CPL_FRMT_GUIB " hits, " CPL_FRMT_GUIB
+                 " misses",
+                 m_osArrayName.c_str(), m_nHits, m_nMisses);
+    }
+}
+
+/************************************************************************/
+/*                         ParseCacheSize()                             */
+/************************************************************************/
+
+/** Parse a cache size, such as "100000", "100MB" or "10%", and return it in
+ * bytes, or 0 if it is invalid.
+ */
+static size_t ParseCacheSize(const char *pszSize)
+{
+    GIntBig nSize = 0;
+    if (CPLParseMemorySize(pszSize, &nSize, nullptr) != CE_None || nSize <= 0)
+        return 0;
+    return static_cast<size_t>(std::min<GUIntBig>(
+        static_cast<GUIntBig>(nSize), std::numeric_limits<size_t>::max()));
+}
+
+/************************************************************************/
+/*                           GetDefaultSize()                           */
+/************************************************************************/
+
+/** Return the default maximum size in bytes of a chunk cache, from the
+ * GDAL_MDARRAY_CHUNK_CACHE_SIZE configuration option, or 0 if not set.
+ */
+size_t GDALMDArrayChunkCache::GetDefaultSize()
+{
+    const char *pszSize =
+        CPLGetConfigOption("GDAL_MDARRAY_CHUNK_CACHE_SIZE", nullptr);
+    if (!pszSize)
+        return 0;
+    const size_t nSize = ParseCacheSize(pszSize);
+    if (nSize == 0)
+    {
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Could not parse value for GDAL_MDARRAY_CHUNK_CACHE_SIZE. "
+                 "Chunk cache disabled.");
+    }
+    return nSize;
+}
+
+/************************************************************************/
+/*                               Create()                               */
+/************************************************************************/
+
+/** Instantiate a chunk cache for oArray, or return nullptr if the array is
+ * not eligible to caching (zero-dimensional array, data type with dynamically
+ * allocated memory, or chunk too large compared to nMaxSizeInBytes).
+ */
+std::unique_ptr<GDALMDArrayChunkCache>
+GDALMDArrayChunkCache::Create(const GDALMDArray &oArray,
+                              size_t nMaxSizeInBytes)
+{
+    const auto &oDT = oArray.GetDataType();
+    const auto &apoDims = oArray.GetDimensions();
+    if (apoDims.empty() || oDT.NeedsFreeDynamicMemory() || oDT.GetSize() == 0)
+        return nullptr;
+
+    const auto anBlockSize = oArray.GetBlockSize();
+    std::vector<GUInt64> anDimSizes;
+    std::vector<GUInt64> anChunkSizes;
+    GUInt64 nChunkBytes = oDT.GetSize();
+    for (size_t i = 0; i < apoDims.size(); ++i)
+    {
+        const GUInt64 nDimSize = apoDims[i]->GetSize();
+        if (nDimSize == 0)
+            return nullptr;
+        // A block size of 0 means that the driver has no preferred chunking
+        // for that dimension: consider the whole dimension as a single chunk.
+        GUInt64 nChunkSize =
+            i < anBlockSize.size() && anBlockSize[i] > 0 ? anBlockSize[i] : 0;
+        if (nChunkSize == 0 || nChunkSize > nDimSize)
+            nChunkSize = nDimSize;
+        if (nChunkSize > nMaxSizeInBytes / nChunkBytes)
+            return nullptr;
+        nChunkBytes *= nChunkSize;
+        anDimSizes.push_back(nDimSize);
+        anChunkSizes.push_back(nChunkSize);
+    }
+
+    // Require room for at least a few chunks, otherwise caching is pointless
+    const size_t nMaxChunks =
+        nMaxSizeInBytes / static_cast<size_t>(nChunkBytes);
+    if (nMaxChunks < 4)
+        return nullptr;
+
+    return std::unique_ptr<GDALMDArrayChunkCache>(
+        new GDALMDArrayChunkCache(oArray.GetFullName(), std::move(anDimSizes),
+                                  std::move(anChunkSizes), oDT, nMaxChunks));
+}
+
+/************************************************************************/
+/*                                Clear()                               */
+/************************************************************************/
+
+void GDALMDArrayChunkCache::Clear()
+{
+    m_oCache.clear();
+}
+
+/************************************************************************/
+/*                              GetChunk()                              */
+/************************************************************************/
+
+std::shared_ptr<std::vector<GByte>>
+GDALMDArrayChunkCache::GetChunk(const ReadFunc &readFunc,
+                                const std::vector<GUInt64> &anChunkIdx,
+                                const std::vector<size_t> &anChunkCount)
+{
+    const std::string osKey(reinterpret_cast<const char *>(anChunkIdx.data()),
+                            anChunkIdx.size() * sizeof(GUInt64));
+    std::shared_ptr<std::vector<GByte>> poChunk;
+    if (m_oCache.tryGet(osKey, poChunk))
+    {
+        ++m_nHits;
+        return poChunk;
+    }
+    ++m_nMisses;
+
+    const size_t nDims = m_anDimSizes.size();
+    std::vector<GUInt64> anStartIdx(nDims);
+    std::vector<GInt64> anStep(nDims, 1);
+    std::vector<GPtrDiff_t> anStride(nDims);
+    size_t nElts = 1;
+    for (size_t i = nDims; i > 0;)
+    {
+        --i;
+        anStartIdx[i] = anChunkIdx[i] * m_anChunkSizes[i];
+        anStride[i] = static_cast<GPtrDiff_t>(nElts);
+        nElts *= anChunkCount[i];
+    }
+
+    try
+    {
+        poChunk = std::make_shared<std::vector<GByte>>(nElts * m_dt.GetSize());
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return nullptr;
+    }
+    if (!readFunc(anStartIdx.data(), anChunkCount.data(), anStep.data(),
+                  anStride.data(), m_dt, poChunk->data()))
+    {
+        return nullptr;
+    }
+    m_oCache.insert(osKey, poChunk);
+    return poChunk;
+}
+
+/************************************************************************/
+/*                                 Read()                               */
+/************************************************************************/
+
+/** Read a region of the array through the cache.
+ *
+ * Parameters have the same semantics as GDALAbstractMDArray::IRead(), and
+ * are assumed to have been validated by the caller.
+ */
+bool GDALMDArrayChunkCache::Read(const ReadFunc &readFunc,
+                                 const GUInt64 *arrayStartIdx,
+                                 const size_t *count, const GInt64 *arrayStep,
+                                 const GPtrDiff_t *bufferStride,
+                                 const GDALExtendedDataType &bufferDataType,
+                                 void *pDstBuffer)
+{
+    const size_t nDims = m_anDimSizes.size();
+
+    // For each dimension, split the requested indices into runs of
+    // consecutive request indices that fall into the same chunk.
+    struct ChunkRun
+    {
+        GUInt64 nChunkIdx;
+        size_t nFirst;  // index of the first element in the request
+        size_t nCount;
+    };
+
+    std::vector<std::vector<ChunkRun>> aaoRuns(nDims);
+    size_t nTotalChunks = 1;
+    for (size_t i = 0; i < nDims; ++i)
+    {
+        const GInt64 nStart = static_cast<GInt64>(arrayStartIdx[i]);
+        const GInt64 nStep = arrayStep[i];
+        const GInt64 nChunkSize = static_cast<GInt64>(m_anChunkSizes[i]);
+        size_t k = 0;
+        while (k < count[i])
+        {
+            const GInt64 nIdx = nStart + static_cast<GInt64>(k) * nStep;
+            const GInt64 nChunkIdx = nIdx / nChunkSize;
+            size_t kEnd = count[i];
+            if (nStep > 0)
+            {
+                const GInt64 nLastIdx = (nChunkIdx + 1) * nChunkSize - 1;
+                kEnd = static_cast<size_t>(std::min<GUInt64>(
+                    kEnd, static_cast<GUInt64>((nLastIdx - nStart) / nStep) +
+                              1));
+            }
+            else if (nStep < 0)
+            {
+                const GInt64 nFirstIdx = nChunkIdx * nChunkSize;
+                kEnd = static_cast<size_t>(std::min<GUInt64>(
+                    kEnd, static_cast<GUInt64>((nStart - nFirstIdx) / -nStep) +
+                              1));
+            }
+            aaoRuns[i].push_back(
+                {static_cast<GUInt64>(nChunkIdx), k, kEnd - k});
+            if (aaoRuns[i].size() > m_oCache.getMaxSize() / nTotalChunks)
+            {
+                // The request touches more chunks than we can hold: caching
+                // would just evict useful chunks and add copies.
+                return readFunc(arrayStartIdx, count, arrayStep, bufferStride,
+                                bufferDataType, pDstBuffer);
+            }
+            k = kEnd;
+        }
+        nTotalChunks *= aaoRuns[i].size();
+    }
+
+    const size_t nSrcEltSize = m_dt.GetSize();
+    const size_t nDstEltSize = bufferDataType.GetSize();
+    const bool bNumeric = m_dt.GetClass() == GEDTC_NUMERIC &&
+                          bufferDataType.GetClass() == GEDTC_NUMERIC;
+    const GDALDataType eSrcDT = m_dt.GetNumericDataType();
+    const GDALDataType eDstDT = bufferDataType.GetNumericDataType();
+
+    std::vector<size_t> anRunIdx(nDims);
+    std::vector<GUInt64> anChunkIdx(nDims);
+    std::vector<size_t> anChunkCount(nDims);
+    std::vector<size_t> anChunkStride(nDims);
+    std::vector<size_t> anSubIdx(nDims);
+    while (true)
+    {
+        // Fetch the current chunk
+        for (size_t i = 0; i < nDims; ++i)
+        {
+            anChunkIdx[i] = aaoRuns[i][anRunIdx[i]].nChunkIdx;
+            const GUInt64 nChunkStart = anChunkIdx[i] * m_anChunkSizes[i];
+            anChunkCount[i] = static_cast<size_t>(
+                std::min(m_anChunkSizes[i], m_anDimSizes[i] - nChunkStart));
+        }
+        size_t nChunkStride = 1;
+        for (size_t i = nDims; i > 0;)
+        {
+            --i;
+            anChunkStride[i] = nChunkStride;
+            nChunkStride *= anChunkCount[i];
+        }
+        const auto poChunk = GetChunk(readFunc, anChunkIdx, anChunkCount);
+        if (!poChunk)
+            return false;
+        const GByte *pabyChunk = poChunk->data();
+
+        // Copy the intersection of the request with the chunk, iterating
+        // over all dimensions but the last one.
+        const auto GetSrcOffset = [&](size_t i, size_t k)
+        {
+            const GInt64 nIdx = static_cast<GInt64>(arrayStartIdx[i]) +
+                                static_cast<GInt64>(k) * arrayStep[i];
+            return static_cast<size_t>(
+                       static_cast<GUInt64>(nIdx) -
+                       anChunkIdx[i] * m_anChunkSizes[i]) *
+                   anChunkStride[i];
+        };
+        const auto &oLastRun = aaoRuns[nDims - 1][anRunIdx[nDims - 1]];
+        const GInt64 nSrcInnerStride = arrayStep[nDims - 1] *
+                                       static_cast<GInt64>(nSrcEltSize);
+        const GPtrDiff_t nDstInnerStride =
+            bufferStride[nDims - 1] * static_cast<GPtrDiff_t>(nDstEltSize);
+        const bool bCanUseCopyWords =
+            bNumeric &&
+            std::abs(nSrcInnerStride) <= std::numeric_limits<int>::max() &&
+            std::abs(nDstInnerStride) <= std::numeric_limits<int>::max();
+        for (size_t i = 0; i + 1 < nDims; ++i)
+            anSubIdx[i] = aaoRuns[i][anRunIdx[i]].nFirst;
+        while (true)
+        {
+            size_t nSrcOffset = GetSrcOffset(nDims - 1, oLastRun.nFirst);
+            GPtrDiff_t nDstOffset =
+                static_cast<GPtrDiff_t>(oLastRun.nFirst) *
+                bufferStride[nDims - 1];
+            for (size_t i = 0; i + 1 < nDims; ++i)
+            {
+                nSrcOffset += GetSrcOffset(i, anSubIdx[i]);
+                nDstOffset +=
+                    static_cast<GPtrDiff_t>(anSubIdx[i]) * bufferStride[i];
+            }
+            const GByte *pabySrc = pabyChunk + nSrcOffset * nSrcEltSize;
+            GByte *pabyDst = static_cast<GByte *>(pDstBuffer) +
+                             nDstOffset * static_cast<GPtrDiff_t>(nDstEltSize);
+            if (bCanUseCopyWords)
+            {
+                GDALCopyWords64(pabySrc, eSrcDT,
+                                static_cast<int>(nSrcInnerStride), pabyDst,
+                                eDstDT, static_cast<int>(nDstInnerStride),
+                                oLastRun.nCount);
+            }
+            else
+            {
+                for (size_t k = 0; k < oLastRun.nCount; ++k)
+                {
+                    if (!GDALExtendedDataType::CopyValue(
+                            pabySrc + static_cast<GPtrDiff_t>(k) *
+                                          nSrcInnerStride,
+                            m_dt,
+                            pabyDst + static_cast<GPtrDiff_t>(k) *
+                                          nDstInnerStride,
+                            bufferDataType))
+                    {
+                        return false;
+                    }
+                }
+            }
+
+            bool bMore = false;
+            for (size_t i = nDims - 1; i > 0;)
+            {
+                --i;
+                const auto &oRun = aaoRuns[i][anRunIdx[i]];
+                if (++anSubIdx[i] < oRun.nFirst + oRun.nCount)
+                {
+                    bMore = true;
+                    break;
+                }
+                anSubIdx[i] = oRun.nFirst;
+            }
+            if (!bMore)
+                break;
+        }
+
+        // Advance to the next chunk
+        bool bMore = false;
+        for (size_t i = nDims; i > 0;)
+        {
+            --i;
+            if (++anRunIdx[i] < aaoRuns[i].size())
+            {
+                bMore = true;
+                break;
+            }
+            anRunIdx[i] = 0;
+        }
+        if (!bMore)
+            return true;
+    }
+}
+
+/************************************************************************/
+/*                       GDALMDArrayChunkCached                         */
+/************************************************************************/
+
+class GDALMDArrayChunkCached final : public GDALPamMDArray
+{
+  private:
+    std::shared_ptr<GDALMDArray> m_poParent{};
+    mutable std::unique_ptr<GDALMDArrayChunkCache> m_poCache{};
+
+  protected:
+    GDALMDArrayChunkCached(const std::shared_ptr<GDALMDArray> &poParent,
+                           std::unique_ptr<GDALMDArrayChunkCache> &&poCache)
+        : GDALAbstractMDArray(std::string(),
+                              "Chunk cached view of " +
+                                  poParent->GetFullName()),
+          GDALPamMDArray(std::string(),
+                         "Chunk cached view of " + poParent->GetFullName(),
+                         GDALPamMultiDim::GetPAM(poParent),
+                         poParent->GetContext()),
+          m_poParent(poParent), m_poCache(std::move(poCache))
+    {
+    }
+
+    bool IRead(const GUInt64 *arrayStartIdx, const size_t *count,
+               const GInt64 *arrayStep, const GPtrDiff_t *bufferStride,
+               const GDALExtendedDataType &bufferDataType,
+               void *pDstBuffer) const override
+    {
+        const auto readFunc =
+            [this](const GUInt64 *arrayStartIdxIn, const size_t *countIn,
+                   const GInt64 *arrayStepIn, const GPtrDiff_t *bufferStrideIn,
+                   const GDALExtendedDataType &bufferDataTypeIn,
+                   void *pDstBufferIn)
+        {
+            return m_poParent->Read(arrayStartIdxIn, countIn, arrayStepIn,
+                                    bufferStrideIn, bufferDataTypeIn,
+                                    pDstBufferIn);
+        };
+        return m_poCache->Read(readFunc, arrayStartIdx, count, arrayStep,
+                               bufferStride, bufferDataType, pDstBuffer);
+    }
+
+    bool IWrite(const GUInt64 *arrayStartIdx, const size_t *count,
+                const GInt64 *arrayStep, const GPtrDiff_t *bufferStride,
+                const GDALExtendedDataType &bufferDataType,
+                const void *pSrcBuffer) override
+    {
+        m_poCache->Clear();
+        return m_poParent->Write(arrayStartIdx, count, arrayStep, bufferStride,
+                                 bufferDataType, pSrcBuffer);
+    }
+
+    bool IAdviseRead(const GUInt64 *arrayStartIdx, const size_t *count,
+                     CSLConstList papszOptions) const override
+    {
+        return m_poParent->AdviseRead(arrayStartIdx, count, papszOptions);
+    }
+
+  public:
+    static std::shared_ptr<GDALMDArrayChunkCached>
+    Create(const std::shared_ptr<GDALMDArray> &poParent,
+           std::unique_ptr<GDALMDArrayChunkCache> &&poCache)
+    {
+        auto newAr(std::shared_ptr<GDALMDArrayChunkCached>(
+            new GDALMDArrayChunkCached(poParent, std::move(poCache))));
+        newAr->SetSelf(newAr);
+        return newAr;
+    }
+
+    bool IsWritable() const override
+    {
+        return m_poParent->IsWritable();
+    }
+
+    const std::string &GetFilename() const override
+    {
+        return m_poParent->GetFilename();
+    }
+
+    const std::vector<std::shared_ptr<GDALDimension>> &
+    GetDimensions() const override
+    {
+        return m_poParent->GetDimensions();
+    }
+
+    const GDALExtendedDataType &GetDataType() const override
+    {
+        return m_poParent->GetDataType();
+    }
+
+    const std::string &GetUnit() const override
+    {
+        return m_poParent->GetUnit();
+    }
+
+    std::shared_ptr<OGRSpatialReference> GetSpatialRef() const override
+    {
+        return m_poParent->GetSpatialRef();
+    }
+
+    const void *GetRawNoDataValue() const override
+    {
+        return m_poParent->GetRawNoDataValue();
+    }
+
+    bool SetRawNoDataValue(const void *pRawNoData) override
+    {
+        return m_poParent->SetRawNoDataValue(pRawNoData);
+    }
+
+    double GetOffset(bool *pbHasOffset,
+                     GDALDataType *peStorageType) const override
+    {
+        return m_poParent->GetOffset(pbHasOffset, peStorageType);
+    }
+
+    double GetScale(bool *pbHasScale,
+                    GDALDataType *peStorageType) const override
+    {
+        return m_poParent->GetScale(pbHasScale, peStorageType);
+    }
+
+    std::vector<GUInt64> GetBlockSize() const override
+    {
+        return m_poParent->GetBlockSize();
+    }
+
+    std::shared_ptr<GDALAttribute>
+    GetAttribute(const std::string &osName) const override
+    {
+        return m_poParent->GetAttribute(osName);
+    }
+
+    std::vector<std::shared_ptr<GDALAttribute>>
+    GetAttributes(CSLConstList papszOptions = nullptr) const override
+    {
+        return m_poParent->GetAttributes(papszOptions);
+    }
+
+    bool SetUnit(const std::string &osUnit) override
+    {
+        return m_poParent->SetUnit(osUnit);
+    }
+
+    bool SetSpatialRef(const OGRSpatialReference *poSRS) override
+    {
+        return m_poParent->SetSpatialRef(poSRS);
+    }
+
+    std::shared_ptr<GDALAttribute>
+    CreateAttribute(const std::string &osName,
+                    const std::vector<GUInt64> &anDimensions,
+                    const GDALExtendedDataType &oDataType,
+                    CSLConstList papszOptions = nullptr) override
+    {
+        return m_poParent->CreateAttribute(osName, anDimensions, oDataType,
+                                           papszOptions);
+    }
+};
+
+//! @endcond
+
+/************************************************************************/
+/*                           GetChunkCached()                           */
+/************************************************************************/
+
+/** Return a view of the array that caches, in memory, the chunks read from
+ * this array.
+ *
+ * The chunk size is the one returned by GetBlockSize(), a zero value for a
+ * dimension meaning that the whole dimension is a single chunk. Chunks are
+ * retrieved from this array in its native data type, and evicted in a least
+ * recently used order once the cache size is reached. Requests that intersect
+ * more chunks than the cache can hold are forwarded to this array without
+ * caching. This is mostly useful when doing many small, overlapping or
+ * strided, reads on an array whose driver does not cache decoded chunks.
+ *
+ * Writing through the returned array invalidates its cache. Modifications
+ * done directly on this array are not reflected in chunks already cached.
+ *
+ * This is the same as the C function GDALMDArrayGetChunkCached().
+ *
+ * @param papszOptions NULL terminated list of options, or nullptr. Supported
+ * options are:
+ * <ul>
+ * <li>CACHE_SIZE=val: Maximum size of the cache, in bytes, or with a unit
+ * (e.g. "100MB") or as a percentage of the usable RAM (e.g. "10%"). Defaults
+ * to the value of the GDAL_MDARRAY_CHUNK_CACHE_SIZE configuration option if
+ * set, or 64 MB otherwise.</li>
+ * </ul>
+ *
+ * @return a new array, or nullptr if the array cannot be cached (data type
+ * with dynamically allocated memory such as strings, or chunk too large
+ * compared to the cache size) or in case of error.
+ *
+ * @since GDAL 3.12
+ */
+std::shared_ptr<GDALMDArray>
+GDALMDArray::GetChunkCached(CSLConstList papszOptions) const
+{
+    auto self = std::dynamic_pointer_cast<GDALMDArray>(m_pSelf.lock());
+    if (!self)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Driver implementation issue: m_pSelf not set !");
+        return nullptr;
+    }
+
+    size_t nCacheSize = 64 * 1024 * 1024;
+    const char *pszCacheSize = CSLFetchNameValue(papszOptions, "CACHE_SIZE");
+    if (pszCacheSize)
+    {
+        nCacheSize = ParseCacheSize(pszCacheSize);
+        if (nCacheSize == 0)
+        {
+            CPLError(CE_Failure, CPLE_IllegalArg,
+                     "Invalid value for CACHE_SIZE: %s", pszCacheSize);
+            return nullptr;
+        }
+    }
+    else
+    {
+        const size_t nDefaultSize = GDALMDArrayChunkCache::GetDefaultSize();
+        if (nDefaultSize > 0)
+            nCacheSize = nDefaultSize;
+    }
+
+    auto poCache = GDALMDArrayChunkCache::Create(*this, nCacheSize);
+    if (!poCache)
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "Array %s cannot be cached with a cache of " CPL_FRMT_GUIB
+                 " bytes",
+                 GetFullName().c_str(), static_cast<GUIntBig>(nCacheSize));
+        return nullptr;
+    }
+    return GDALMDArrayChunkCached::Create(self, std::move(poCache));
+}
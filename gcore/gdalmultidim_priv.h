@@ -14,6 +14,9 @@
 #define GDALMULTIDIM_PRIV_INCLUDED
 
 #include "gdal_priv.h"
+#include "cpl_mem_cache.h"
+
+#include <functional>
 
 //! @cond Doxygen_Suppress
 
@@ -110,6 +113,70 @@ class GDALMDIAsAttribute final : public GDALAttribute
     }
 };
 
+std::shared_ptr<GDALMDArray>
+    CPL_DLL GDALMDArrayGetReducedFromExpr(
+        const std::shared_ptr<GDALMDArray> &poArray,
+        const std::string &osReduceExpr);
+
+/************************************************************************/
+/*                        GDALMDArrayChunkCache                         */
+/************************************************************************/
+
+/** LRU cache of decoded chunks of a GDALMDArray, whose chunk size is given
+ * by GDALMDArray::GetBlockSize(), and whose total size is bounded in bytes.
+ *
+ * Requests are served by assembling the chunks they intersect. Chunks
+ * missing from the cache are fetched, in the array data type, with the
+ * ReadFunc provided by the caller. Requests intersecting more chunks than
+ * the cache can hold are directly forwarded to ReadFunc.
+ */
+class CPL_DLL GDALMDArrayChunkCache
+{
+  public:
+    /** Function reading a region of the array, with the same semantics as
+     * GDALAbstractMDArray::IRead() (step and stride arrays are never null)
+     */
+    using ReadFunc = std::function<bool(
+        const GUInt64 *arrayStartIdx, const size_t *count,
+        const GInt64 *arrayStep, const GPtrDiff_t *bufferStride,
+        const GDALExtendedDataType &bufferDataType, void *pDstBuffer)>;
+
+    static std::unique_ptr<GDALMDArrayChunkCache>
+    Create(const GDALMDArray &oArray, size_t nMaxSizeInBytes);
+
+    static size_t GetDefaultSize();
+
+    ~GDALMDArrayChunkCache();
+
+    bool Read(const ReadFunc &readFunc, const GUInt64 *arrayStartIdx,
+              const size_t *count, const GInt64 *arrayStep,
+              const GPtrDiff_t *bufferStride,
+              const GDALExtendedDataType &bufferDataType,
+              void *pDstBuffer);
+
+    void Clear();
+
+  private:
+    const std::string m_osArrayName;
+    std::vector<GUInt64> m_anDimSizes{};
+    std::vector<GUInt64> m_anChunkSizes{};
+    const GDALExtendedDataType m_dt;
+    lru11::Cache<std::string, std::shared_ptr<std::vector<GByte>>> m_oCache;
+    GUIntBig m_nHits = 0;
+    GUIntBig m_nMisses = 0;
+
+    GDALMDArrayChunkCache(const std::string &osArrayName,
+                          std::vector<GUInt64> &&anDimSizes,
+                          std::vector<GUInt64> &&anChunkSizes,
+                          const GDALExtendedDataType &oDT, size_t nMaxChunks);
+
+    std::shared_ptr<std::vector<GByte>>
+    GetChunk(const ReadFunc &readFunc, const std::vector<GUInt64> &anChunkIdx,
+             const std::vector<size_t> &anChunkCount);
+
+    CPL_DISALLOW_COPY_ASSIGN(GDALMDArrayChunkCache)
+};
+
 //! @endcond
 
 #endif  // GDALMULTIDIM_PRIV_INCLUDED
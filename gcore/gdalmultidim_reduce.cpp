@@ -0,0 +1,608 @@
+/******************************************************************************
+ *
+ * Name:     gdalmultidim_reduce.cpp
+ * Project:  GDAL Core
+ * Purpose:  GDALMDArray::GetReduced() implementation
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gdal_priv.h"
+#include "gdal_pam_multidim.h"
+#include "gdal_thread_pool.h"
+#include "gdalmultidim_priv.h"
+
+#include <algorithm>
+#include <climits>
+#include <cmath>
+#include <limits>
+#include <new>
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                         GDALMDArrayReduced                           */
+/************************************************************************/
+
+class GDALMDArrayReduced final : public GDALPamMDArray
+{
+  public:
+    enum class Operation
+    {
+        MEAN,
+        MIN,
+        MAX,
+        SUM,
+        COUNT
+    };
+
+  private:
+    std::shared_ptr<GDALMDArray> m_poParent{};
+    const Operation m_eOp;
+    const size_t m_iDim;
+    std::vector<std::shared_ptr<GDALDimension>> m_apoDims{};
+    const GDALExtendedDataType m_dt;
+    const int m_nThreads;
+    bool m_bParentHasNoData = false;
+    double m_dfParentNoData = 0;
+    const double m_dfNoData = std::numeric_limits<double>::quiet_NaN();
+
+    // Maximum size of the buffer of values read from the parent array
+    static constexpr size_t MAX_SLAB_MEMORY = 32 * 1024 * 1024;
+
+    struct Accumulator
+    {
+        std::vector<double> adfValue{};
+        std::vector<GUInt64> anCount{};
+    };
+
+    void Accumulate(const double *padfSlab, size_t nRows, size_t nElts,
+                    size_t iStart, size_t iEnd, Accumulator &oAcc) const;
+
+  protected:
+    GDALMDArrayReduced(const std::shared_ptr<GDALMDArray> &poParent,
+                       Operation eOp, size_t iDim, int nThreads)
+        : GDALAbstractMDArray(std::string(), "Reduced view of " +
+                                                 poParent->GetFullName()),
+          GDALPamMDArray(std::string(),
+                         "Reduced view of " + poParent->GetFullName(),
+                         GDALPamMultiDim::GetPAM(poParent),
+                         poParent->GetContext()),
+          m_poParent(poParent), m_eOp(eOp), m_iDim(iDim),
+          m_dt(GDALExtendedDataType::Create(
+              eOp == Operation::COUNT ? GDT_UInt64 : GDT_Float64)),
+          m_nThreads(nThreads)
+    {
+        const auto &apoParentDims = m_poParent->GetDimensions();
+        for (size_t i = 0; i < apoParentDims.size(); ++i)
+        {
+            if (i != m_iDim)
+                m_apoDims.push_back(apoParentDims[i]);
+        }
+        m_dfParentNoData =
+            m_poParent->GetNoDataValueAsDouble(&m_bParentHasNoData);
+    }
+
+    bool IRead(const GUInt64 *arrayStartIdx, const size_t *count,
+               const GInt64 *arrayStep, const GPtrDiff_t *bufferStride,
+               const GDALExtendedDataType &bufferDataType,
+               void *pDstBuffer) const override;
+
+  public:
+    static std::shared_ptr<GDALMDArrayReduced>
+    Create(const std::shared_ptr<GDALMDArray> &poParent, Operation eOp,
+           size_t iDim, int nThreads)
+    {
+        auto newAr(std::shared_ptr<GDALMDArrayReduced>(
+            new GDALMDArrayReduced(poParent, eOp, iDim, nThreads)));
+        newAr->SetSelf(newAr);
+        return newAr;
+    }
+
+    bool IsWritable() const override
+    {
+        return false;
+    }
+
+    const std::string &GetFilename() const override
+    {
+        return m_poParent->GetFilename();
+    }
+
+    const std::vector<std::shared_ptr<GDALDimension>> &
+    GetDimensions() const override
+    {
+        return m_apoDims;
+    }
+
+    const GDALExtendedDataType &GetDataType() const override
+    {
+        return m_dt;
+    }
+
+    const std::string &GetUnit() const override
+    {
+        static const std::string osEmpty;
+        return m_eOp == Operation::COUNT ? osEmpty : m_poParent->GetUnit();
+    }
+
+    std::shared_ptr<OGRSpatialReference> GetSpatialRef() const override
+    {
+        auto poSrcSRS = m_poParent->GetSpatialRef();
+        if (!poSrcSRS)
+            return nullptr;
+        std::vector<int> dstMapping;
+        for (int srcAxis : poSrcSRS->GetDataAxisToSRSAxisMapping())
+        {
+            const int iSrcDim = srcAxis - 1;
+            if (iSrcDim < 0 || static_cast<size_t>(iSrcDim) == m_iDim)
+                dstMapping.push_back(0);
+            else if (static_cast<size_t>(iSrcDim) > m_iDim)
+                dstMapping.push_back(srcAxis - 1);
+            else
+                dstMapping.push_back(srcAxis);
+        }
+        auto poClone(std::shared_ptr<OGRSpatialReference>(poSrcSRS->Clone()));
+        poClone->SetDataAxisToSRSAxisMapping(dstMapping);
+        return poClone;
+    }
+
+    const void *GetRawNoDataValue() const override
+    {
+        // Elements with no valid value along the reduced dimension
+        return m_eOp == Operation::MEAN || m_eOp == Operation::MIN ||
+                       m_eOp == Operation::MAX
+                   ? &m_dfNoData
+                   : nullptr;
+    }
+
+    std::vector<GUInt64> GetBlockSize() const override
+    {
+        auto anBlockSize = m_poParent->GetBlockSize();
+        if (m_iDim < anBlockSize.size())
+            anBlockSize.erase(anBlockSize.begin() + m_iDim);
+        return anBlockSize;
+    }
+
+    std::vector<std::shared_ptr<GDALAttribute>>
+    GetAttributes(CSLConstList papszOptions = nullptr) const override
+    {
+        // Attributes describing the encoding of values of the parent array
+        // do not apply to the reduced values.
+        std::vector<std::shared_ptr<GDALAttribute>> apoAttrs;
+        for (auto &poAttr : m_poParent->GetAttributes(papszOptions))
+        {
+            const auto &osName = poAttr->GetName();
+            if (osName != "missing_value" && osName != "_FillValue" &&
+                osName != "valid_min" && osName != "valid_max" &&
+                osName != "valid_range" && osName != "scale_factor" &&
+                osName != "add_offset")
+            {
+                apoAttrs.push_back(std::move(poAttr));
+            }
+        }
+        return apoAttrs;
+    }
+};
+
+/************************************************************************/
+/*                  GDALMDArrayReduced::Accumulate()                    */
+/************************************************************************/
+
+// Accumulate the values of the nRows x nElts padfSlab buffer, for output
+// elements in the [iStart, iEnd[ range.
+void GDALMDArrayReduced::Accumulate(const double *padfSlab, size_t nRows,
+                                    size_t nElts, size_t iStart, size_t iEnd,
+                                    Accumulator &oAcc) const
+{
+    const bool bHasNoData = m_bParentHasNoData;
+    const double dfNoData = m_dfParentNoData;
+    double *padfValue = oAcc.adfValue.data();
+    GUInt64 *panCount = oAcc.anCount.data();
+    for (size_t iRow = 0; iRow < nRows; ++iRow)
+    {
+        const double *padfRow = padfSlab + iRow * nElts;
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            const double dfVal = padfRow[i];
+            if (std::isnan(dfVal) || (bHasNoData && dfVal == dfNoData))
+                continue;
+            switch (m_eOp)
+            {
+                case Operation::MEAN:
+                case Operation::SUM:
+                    padfValue[i] += dfVal;
+                    break;
+                case Operation::MIN:
+                    if (panCount[i] == 0 || dfVal < padfValue[i])
+                        padfValue[i] = dfVal;
+                    break;
+                case Operation::MAX:
+                    if (panCount[i] == 0 || dfVal > padfValue[i])
+                        padfValue[i] = dfVal;
+                    break;
+                case Operation::COUNT:
+                    break;
+            }
+            ++panCount[i];
+        }
+    }
+}
+
+/************************************************************************/
+/*                     GDALMDArrayReduced::IRead()                      */
+/************************************************************************/
+
+bool GDALMDArrayReduced::IRead(const GUInt64 *arrayStartIdx,
+                               const size_t *count, const GInt64 *arrayStep,
+                               const GPtrDiff_t *bufferStride,
+                               const GDALExtendedDataType &bufferDataType,
+                               void *pDstBuffer) const
+{
+    const size_t nDims = m_apoDims.size();
+    size_t nElts = 1;
+    for (size_t i = 0; i < nDims; ++i)
+        nElts *= count[i];
+
+    // The reduced dimension is read by slabs, of at most MAX_SLAB_MEMORY
+    // bytes, and aligned on the block size of the parent array.
+    const GUInt64 nReducedDimSize =
+        m_poParent->GetDimensions()[m_iDim]->GetSize();
+    size_t nSlabRows = std::max<size_t>(
+        1, MAX_SLAB_MEMORY / (std::max<size_t>(1, nElts) * sizeof(double)));
+    // Only for testing purposes
+    const char *pszMaxSlabRows =
+        CPLGetConfigOption("GDAL_MDARRAY_REDUCE_MAX_SLAB_ROWS", nullptr);
+    if (pszMaxSlabRows)
+        nSlabRows = std::min<size_t>(
+            nSlabRows, std::max(1, atoi(pszMaxSlabRows)));
+    if (nSlabRows > nReducedDimSize)
+        nSlabRows = static_cast<size_t>(nReducedDimSize);
+    const auto anParentBlockSize = m_poParent->GetBlockSize();
+    if (m_iDim < anParentBlockSize.size() && anParentBlockSize[m_iDim] > 0 &&
+        nSlabRows > anParentBlockSize[m_iDim])
+    {
+        const size_t nBlockSize = static_cast<size_t>(anParentBlockSize[m_iDim]);
+        nSlabRows = (nSlabRows / nBlockSize) * nBlockSize;
+    }
+
+    // Request on the parent array: the reduced dimension is the slowest
+    // varying one in the slab buffer.
+    std::vector<GUInt64> anParentStartIdx;
+    std::vector<size_t> anParentCount;
+    std::vector<GInt64> anParentStep;
+    std::vector<GPtrDiff_t> anParentStride;
+    {
+        std::vector<GPtrDiff_t> anStride(nDims);
+        size_t nStride = 1;
+        for (size_t i = nDims; i > 0;)
+        {
+            --i;
+            anStride[i] = static_cast<GPtrDiff_t>(nStride);
+            nStride *= count[i];
+        }
+        for (size_t i = 0; i < nDims; ++i)
+        {
+            if (i == m_iDim)
+            {
+                anParentStartIdx.push_back(0);
+                anParentCount.push_back(0);
+                anParentStep.push_back(1);
+                anParentStride.push_back(static_cast<GPtrDiff_t>(nElts));
+            }
+            anParentStartIdx.push_back(arrayStartIdx[i]);
+            anParentCount.push_back(count[i]);
+            anParentStep.push_back(arrayStep[i]);
+            anParentStride.push_back(anStride[i]);
+        }
+        if (m_iDim == nDims)
+        {
+            anParentStartIdx.push_back(0);
+            anParentCount.push_back(0);
+            anParentStep.push_back(1);
+            anParentStride.push_back(static_cast<GPtrDiff_t>(nElts));
+        }
+    }
+
+    Accumulator oAcc;
+    std::vector<double> adfSlabs[2];
+    try
+    {
+        oAcc.adfValue.resize(nElts);
+        oAcc.anCount.resize(nElts);
+        adfSlabs[0].resize(nSlabRows * nElts);
+    }
+    catch (const std::exception &e)
+    {
+        CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+        return false;
+    }
+
+    // When using several threads, the next slab is read from the parent
+    // array, by the calling thread, while worker threads accumulate the
+    // values of the current slab. Accesses to the parent array remain
+    // serialized.
+    const int nThreads = static_cast<int>(
+        std::min<size_t>(m_nThreads, std::max<size_t>(1, nElts / 4096)));
+    std::unique_ptr<CPLJobQueue> poJobQueue;
+    if (nThreads > 1)
+    {
+        auto poThreadPool = GDALGetGlobalThreadPool(nThreads);
+        if (poThreadPool)
+        {
+            try
+            {
+                if (nSlabRows < nReducedDimSize)
+                    adfSlabs[1].resize(nSlabRows * nElts);
+                poJobQueue = poThreadPool->CreateJobQueue();
+            }
+            catch (const std::exception &)
+            {
+                // Fallback to single-threaded processing
+            }
+        }
+    }
+
+    const auto dfDT = GDALExtendedDataType::Create(GDT_Float64);
+    const auto ReadSlab = [this, &anParentStartIdx, &anParentCount,
+                           &anParentStep, &anParentStride, &dfDT,
+                           nReducedDimSize, nSlabRows](GUInt64 nRowStart,
+                                                       double *padfSlab)
+    {
+        anParentStartIdx[m_iDim] = nRowStart;
+        anParentCount[m_iDim] = static_cast<size_t>(std::min<GUInt64>(
+            nSlabRows, nReducedDimSize - nRowStart));
+        return m_poParent->Read(anParentStartIdx.data(), anParentCount.data(),
+                                anParentStep.data(), anParentStride.data(),
+                                dfDT, padfSlab);
+    };
+
+    // An empty reduced dimension gives the same result as a dimension where
+    // all values are invalid, without reading anything.
+    int iCurSlab = 0;
+    if (nReducedDimSize > 0 && !ReadSlab(0, adfSlabs[0].data()))
+        return false;
+    for (GUInt64 nRowStart = 0; nRowStart < nReducedDimSize;
+         nRowStart += nSlabRows)
+    {
+        const size_t nRows = static_cast<size_t>(
+            std::min<GUInt64>(nSlabRows, nReducedDimSize - nRowStart));
+        const double *padfSlab = adfSlabs[iCurSlab].data();
+        const GUInt64 nNextRowStart = nRowStart + nRows;
+        if (poJobQueue)
+        {
+            const size_t nEltsPerJob = (nElts + nThreads - 1) / nThreads;
+            for (size_t iStart = 0; iStart < nElts; iStart += nEltsPerJob)
+            {
+                const size_t iEnd = std::min(nElts, iStart + nEltsPerJob);
+                poJobQueue->SubmitJob(
+                    [this, padfSlab, nRows, nElts, iStart, iEnd, &oAcc]()
+                    { Accumulate(padfSlab, nRows, nElts, iStart, iEnd, oAcc); });
+            }
+            bool bOK = true;
+            if (nNextRowStart < nReducedDimSize)
+                bOK = ReadSlab(nNextRowStart, adfSlabs[1 - iCurSlab].data());
+            poJobQueue->WaitCompletion();
+            if (!bOK)
+                return false;
+            iCurSlab = 1 - iCurSlab;
+        }
+        else
+        {
+            Accumulate(padfSlab, nRows, nElts, 0, nElts, oAcc);
+            if (nNextRowStart < nReducedDimSize &&
+                !ReadSlab(nNextRowStart, adfSlabs[0].data()))
+            {
+                return false;
+            }
+        }
+    }
+
+    // Finalize values in the accumulator
+    if (m_eOp == Operation::COUNT)
+    {
+        // Values are stored as doubles in adfValue[] below, which is exact
+        // up to 2^53 elements
+        for (size_t i = 0; i < nElts; ++i)
+            oAcc.adfValue[i] = static_cast<double>(oAcc.anCount[i]);
+    }
+    else if (m_eOp != Operation::SUM)
+    {
+        for (size_t i = 0; i < nElts; ++i)
+        {
+            if (oAcc.anCount[i] == 0)
+                oAcc.adfValue[i] = m_dfNoData;
+            else if (m_eOp == Operation::MEAN)
+                oAcc.adfValue[i] /= static_cast<double>(oAcc.anCount[i]);
+        }
+    }
+
+    // Copy the compact result to the user buffer
+    if (nDims == 0)
+    {
+        return GDALExtendedDataType::CopyValue(oAcc.adfValue.data(), dfDT,
+                                               pDstBuffer, bufferDataType);
+    }
+    const size_t nDstEltSize = bufferDataType.GetSize();
+    const bool bNumericDst = bufferDataType.GetClass() == GEDTC_NUMERIC;
+    const GPtrDiff_t nDstInnerStride =
+        bufferStride[nDims - 1] * static_cast<GPtrDiff_t>(nDstEltSize);
+    const size_t nInnerCount = count[nDims - 1];
+    std::vector<size_t> anIdx(nDims);
+    const double *padfSrc = oAcc.adfValue.data();
+    while (true)
+    {
+        GPtrDiff_t nDstOffset = 0;
+        for (size_t i = 0; i + 1 < nDims; ++i)
+            nDstOffset += static_cast<GPtrDiff_t>(anIdx[i]) * bufferStride[i];
+        GByte *pabyDst = static_cast<GByte *>(pDstBuffer) +
+                         nDstOffset * static_cast<GPtrDiff_t>(nDstEltSize);
+        if (bNumericDst && std::abs(nDstInnerStride) <= INT_MAX)
+        {
+            GDALCopyWords64(padfSrc, GDT_Float64, sizeof(double), pabyDst,
+                            bufferDataType.GetNumericDataType(),
+                            static_cast<int>(nDstInnerStride), nInnerCount);
+        }
+        else
+        {
+            for (size_t k = 0; k < nInnerCount; ++k)
+            {
+                if (!GDALExtendedDataType::CopyValue(
+                        padfSrc + k, dfDT,
+                        pabyDst + static_cast<GPtrDiff_t>(k) * nDstInnerStride,
+                        bufferDataType))
+                {
+                    return false;
+                }
+            }
+        }
+        padfSrc += nInnerCount;
+
+        bool bMore = false;
+        for (size_t i = nDims - 1; i > 0;)
+        {
+            --i;
+            if (++anIdx[i] < count[i])
+            {
+                bMore = true;
+                break;
+            }
+            anIdx[i] = 0;
+        }
+        if (!bMore)
+            return true;
+    }
+}
+
+//! @endcond
+
+/************************************************************************/
+/*                            GetReduced()                              */
+/************************************************************************/
+
+/** Return an array whose values are the reduction of the values of this
+ * array along one of its dimensions.
+ *
+ * The returned array has the dimensions of this array, except the reduced
+ * one. Its values are lazily computed at Read() time, by reading this array
+ * by slabs along the reduced dimension, so that memory usage is bounded
+ * regardless of the size of that dimension. NaN values, and values equal
+ * to the nodata value of this array, are ignored. Scale and offset are not
+ * applied: use GetUnscaled() first if needed.
+ *
+ * The data type of the returned array is Float64 for the mean, min, max and
+ * sum operations, with a NaN nodata value (except for sum) for elements that
+ * have no valid value. It is UInt64 for the count operation.
+ *
+ * This is the same as the C function GDALMDArrayGetReduced().
+ *
+ * @param osOperation Reduction operation: "mean", "min", "max", "sum" or
+ * "count" (number of valid values).
+ * @param iDim Index of the dimension to reduce, between 0 and
+ * GetDimensionCount() - 1.
+ * @param papszOptions NULL terminated list of options, or nullptr. Supported
+ * options are:
+ * <ul>
+ * <li>NUM_THREADS=integer or ALL_CPUS: number of threads used to accumulate
+ * values, while the next slab is read from this array. Defaults to the value
+ * of the GDAL_NUM_THREADS configuration option.</li>
+ * </ul>
+ *
+ * @return a new array, that holds a reference to the original one, and thus
+ * is a view of it (not a copy), or nullptr in case of error.
+ *
+ * @since GDAL 3.12
+ */
+std::shared_ptr<GDALMDArray>
+GDALMDArray::GetReduced(const std::string &osOperation, size_t iDim,
+                        CSLConstList papszOptions) const
+{
+    auto self = std::dynamic_pointer_cast<GDALMDArray>(m_pSelf.lock());
+    if (!self)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Driver implementation issue: m_pSelf not set !");
+        return nullptr;
+    }
+
+    GDALMDArrayReduced::Operation eOp;
+    if (EQUAL(osOperation.c_str(), "mean"))
+        eOp = GDALMDArrayReduced::Operation::MEAN;
+    else if (EQUAL(osOperation.c_str(), "min"))
+        eOp = GDALMDArrayReduced::Operation::MIN;
+    else if (EQUAL(osOperation.c_str(), "max"))
+        eOp = GDALMDArrayReduced::Operation::MAX;
+    else if (EQUAL(osOperation.c_str(), "sum"))
+        eOp = GDALMDArrayReduced::Operation::SUM;
+    else if (EQUAL(osOperation.c_str(), "count"))
+        eOp = GDALMDArrayReduced::Operation::COUNT;
+    else
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg,
+                 "Unsupported reduction operation: %s", osOperation.c_str());
+        return nullptr;
+    }
+
+    if (iDim >= GetDimensionCount())
+    {
+        CPLError(CE_Failure, CPLE_IllegalArg, "Invalid dimension index");
+        return nullptr;
+    }
+
+    const auto &dt = GetDataType();
+    if (dt.GetClass() != GEDTC_NUMERIC ||
+        GDALDataTypeIsComplex(dt.GetNumericDataType()))
+    {
+        CPLError(CE_Failure, CPLE_NotSupported,
+                 "GetReduced() only supports arrays of real numeric "
+                 "data type");
+        return nullptr;
+    }
+
+    const int nThreads = GDALGetNumThreads(papszOptions, "NUM_THREADS");
+    return GDALMDArrayReduced::Create(self, eOp, iDim, nThreads);
+}
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                    GDALMDArrayGetReducedFromExpr()                   */
+/************************************************************************/
+
+/** Return GetReduced() applied on poArray, from a "{operation}:{dim_name}"
+ * expression, as used by gdalmdimtranslate and VRT array sources.
+ */
+std::shared_ptr<GDALMDArray>
+GDALMDArrayGetReducedFromExpr(const std::shared_ptr<GDALMDArray> &poArray,
+                              const std::string &osReduceExpr)
+{
+    const auto nColonPos = osReduceExpr.find(':');
+    if (nColonPos == std::string::npos)
+    {
+        CPLError(CE_Failure, CPLE_AppDefined,
+                 "Invalid reduce expression '%s'. Expected "
+                 "{operation}:{dimension_name}",
+                 osReduceExpr.c_str());
+        return nullptr;
+    }
+    const std::string osOperation = osReduceExpr.substr(0, nColonPos);
+    const std::string osDimName = osReduceExpr.substr(nColonPos + 1);
+    const auto &apoDims = poArray->GetDimensions();
+    for (size_t i = 0; i < apoDims.size(); ++i)
+    {
+        if (apoDims[i]->GetName() == osDimName ||
+            apoDims[i]->GetFullName() == osDimName)
+        {
+            return poArray->GetReduced(osOperation, i);
+        }
+    }
+    CPLError(CE_Failure, CPLE_AppDefined,
+             "Array %s has no dimension named '%s'",
+             poArray->GetFullName().c_str(), osDimName.c_str());
+    return nullptr;
+}
+
+//! @endcond
@@ -24,13 +24,17 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <atomic>
 #include <limits>
 #include <memory>
+#include <mutex>
 #include <new>
 #include <type_traits>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
 #include "cpl_progress.h"
 #include "cpl_string.h"
@@ -42,6 +46,7 @@
 #include "gdal_rat.h"
 #include "gdal_rasterband.h"
 #include "gdal_priv_templates.hpp"
+#include "gdal_thread_pool.h"
 #include "gdal_interpolateatpoint.h"
 #include "gdal_minmax_element.hpp"
 #include "gdalmultidim_priv.h"
@@ -4143,6 +4148,281 @@ inline bool ARE_REAL_EQUAL(GFloat16 dfVal1, GFloat16 dfVal2, int ulp = 2)
                                       abs(dfVal1 + dfVal2) * ulp;
 }
 
+/************************************************************************/
+/*                 GDALRasterBandParallelBlockScanner                   */
+/************************************************************************/
+
+namespace
+{
+
+/** Helper for GetHistogram(), ComputeStatistics() and ComputeRasterMinMax()
+ * to process the (possibly sub-sampled) blocks of a band on the global thread
+ * pool, when the GDAL_NUM_THREADS configuration option is set.
+ *
+ * Blocks are read through a thread-safe dataset (see
+ * GDALGetThreadSafeDataset()) opened on the same file as the band, so that
+ * the band itself is never accessed concurrently. Sampled blocks are split
+ * into jobs of consecutive blocks. Callers typically use one accumulator per
+ * job, and merge them in job order once Run() has returned, so that results
+ * do not depend on thread scheduling.
+ */
+class GDALRasterBandParallelBlockScanner
+{
+  public:
+    GDALRasterBandParallelBlockScanner(GDALRasterBand *poBand,
+                                       int nSampleRate);
+
+    /** Return whether the multi-threaded code path can be used. */
+    bool IsEnabled() const
+    {
+        return m_poTSBand != nullptr;
+    }
+
+    /** Return the number of jobs (and accumulators) that Run() will use. */
+    int GetJobCount() const
+    {
+        return m_nJobs;
+    }
+
+    template <class BlockFunc, class JobEndFunc>
+    bool Run(bool bUseMask, const char *pszMessage,
+             GDALProgressFunc pfnProgress, void *pProgressData,
+             BlockFunc &&pfnBlock, JobEndFunc &&pfnJobEnd);
+
+  private:
+    CPL_DISALLOW_COPY_ASSIGN(GDALRasterBandParallelBlockScanner)
+
+    GDALRasterBand *const m_poBand;
+    const int m_nSampleRate;
+    std::unique_ptr<GDALDataset, GDALDatasetUniquePtrReleaser> m_poTSDS{};
+    GDALRasterBand *m_poTSBand = nullptr;
+    GIntBig m_nSampledBlocks = 0;
+    int m_nThreads = 0;
+    int m_nJobs = 0;
+};
+
+/************************************************************************/
+/*                 GDALRasterBandParallelBlockScanner()                 */
+/************************************************************************/
+
+GDALRasterBandParallelBlockScanner::GDALRasterBandParallelBlockScanner(
+    GDALRasterBand *poBand, int nSampleRate)
+    : m_poBand(poBand), m_nSampleRate(nSampleRate)
+{
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    if (nBlockXSize <= 0 || nBlockYSize <= 0)
+        return;
+    const GIntBig nTotalBlocks =
+        static_cast<GIntBig>(DIV_ROUND_UP(poBand->GetXSize(), nBlockXSize)) *
+        DIV_ROUND_UP(poBand->GetYSize(), nBlockYSize);
+    m_nSampledBlocks = DIV_ROUND_UP(nTotalBlocks, nSampleRate);
+
+    // Re-opening the dataset in each worker thread is not worth it for
+    // small amounts of pixels.
+    constexpr GIntBig MIN_PIXELS_FOR_MULTITHREADING = 1024 * 1024;
+    if (m_nSampledBlocks < 2 ||
+        m_nSampledBlocks * nBlockXSize * nBlockYSize <
+            MIN_PIXELS_FOR_MULTITHREADING)
+        return;
+
+    m_nThreads = static_cast<int>(
+        std::min<GIntBig>(GDALGetNumThreads(/* nMaxVal = */ 128,
+                                            /* bDefaultToAllCPUs = */ false),
+                          m_nSampledBlocks));
+    if (m_nThreads <= 1)
+        return;
+
+    // Only bands directly owned by a dataset opened in read-only mode can
+    // be re-opened, and blocks must not be dirty in the block cache.
+    GDALDataset *poDS = poBand->GetDataset();
+    const int nBand = poBand->GetBand();
+    if (!poDS || poDS->GetAccess() != GA_ReadOnly || nBand <= 0 ||
+        nBand > poDS->GetRasterCount() || poDS->GetRasterBand(nBand) != poBand)
+    {
+        return;
+    }
+
+    {
+        CPLErrorStateBackuper oErrorStateBackuper(CPLQuietErrorHandler);
+        m_poTSDS.reset(GDALGetThreadSafeDataset(poDS, GDAL_OF_RASTER));
+    }
+    if (!m_poTSDS || m_poTSDS->GetRasterCount() != poDS->GetRasterCount())
+    {
+        m_poTSDS.reset();
+        return;
+    }
+
+    // Check that the re-opened band is consistent with the band, which
+    // might not be the case if properties have been modified in memory.
+    GDALRasterBand *poTSBand = m_poTSDS->GetRasterBand(nBand);
+    int nTSBlockXSize = 0;
+    int nTSBlockYSize = 0;
+    poTSBand->GetBlockSize(&nTSBlockXSize, &nTSBlockYSize);
+    int bHasNoData = FALSE;
+    const double dfNoData = poBand->GetNoDataValue(&bHasNoData);
+    int bTSHasNoData = FALSE;
+    const double dfTSNoData = poTSBand->GetNoDataValue(&bTSHasNoData);
+    if (poTSBand->GetXSize() != poBand->GetXSize() ||
+        poTSBand->GetYSize() != poBand->GetYSize() ||
+        poTSBand->GetRasterDataType() != poBand->GetRasterDataType() ||
+        nTSBlockXSize != nBlockXSize || nTSBlockYSize != nBlockYSize ||
+        poTSBand->GetMaskFlags() != poBand->GetMaskFlags() ||
+        bTSHasNoData != bHasNoData ||
+        (bHasNoData && !(dfTSNoData == dfNoData ||
+                         (std::isnan(dfTSNoData) && std::isnan(dfNoData)))))
+    {
+        m_poTSDS.reset();
+        return;
+    }
+
+    m_poTSBand = poTSBand;
+    // Several jobs per thread for load balancing and progress reporting.
+    m_nJobs = static_cast<int>(
+        std::min<GIntBig>(m_nSampledBlocks, static_cast<GIntBig>(m_nThreads) *
+                                                16));
+}
+
+/************************************************************************/
+/*                                Run()                                 */
+/************************************************************************/
+
+/** Process sampled blocks in worker threads.
+ *
+ * pfnBlock is called as pfnBlock(iJob, pData, pabyMask, nXCheck, nYCheck),
+ * where pData (and pabyMask, which is null if bUseMask is false) are buffers
+ * with a line stride of nBlockXSize pixels, that is with the same layout as
+ * a block in the block cache. It must return false in case of error.
+ * Calls for a given iJob are made sequentially from the same thread.
+ *
+ * pfnJobEnd is called as pfnJobEnd(iJob) from the worker thread once all
+ * blocks of a job have been processed (or the job has been interrupted).
+ *
+ * @return true in case of success.
+ */
+template <class BlockFunc, class JobEndFunc>
+bool GDALRasterBandParallelBlockScanner::Run(bool bUseMask,
+                                             const char *pszMessage,
+                                             GDALProgressFunc pfnProgress,
+                                             void *pProgressData,
+                                             BlockFunc &&pfnBlock,
+                                             JobEndFunc &&pfnJobEnd)
+{
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(m_nThreads);
+    auto poJobQueue = poThreadPool ? poThreadPool->CreateJobQueue()
+                                   : std::unique_ptr<CPLJobQueue>(nullptr);
+    if (!poJobQueue)
+        return false;
+
+    const int nXSize = m_poTSBand->GetXSize();
+    const int nYSize = m_poTSBand->GetYSize();
+    int nBlockXSize = 0;
+    int nBlockYSize = 0;
+    m_poTSBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+    const int nBlocksPerRow = DIV_ROUND_UP(nXSize, nBlockXSize);
+    const GDALDataType eDataType = m_poTSBand->GetRasterDataType();
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+    GDALRasterBand *poTSMaskBand =
+        bUseMask ? m_poTSBand->GetMaskBand() : nullptr;
+
+    CPLDebug("GDAL",
+             "Processing " CPL_FRMT_GIB " blocks of band %d in %d jobs "
+             "using %d threads",
+             m_nSampledBlocks, m_poBand->GetBand(), m_nJobs, m_nThreads);
+
+    std::atomic<bool> bError{false};
+    std::atomic<bool> bStop{false};
+    std::atomic<GIntBig> nBlocksDone{0};
+    CPLErrorAccumulator oErrorAccumulator;
+
+    for (int iJob = 0; iJob < m_nJobs; ++iJob)
+    {
+        const GIntBig iFirst = m_nSampledBlocks * iJob / m_nJobs;
+        const GIntBig iLast = m_nSampledBlocks * (iJob + 1) / m_nJobs;
+        const auto Job = [this, iJob, iFirst, iLast, nXSize, nYSize,
+                          nBlockXSize, nBlockYSize, nBlocksPerRow, eDataType,
+                          nDTSize, poTSMaskBand, &bError, &bStop,
+                          &nBlocksDone, &oErrorAccumulator, &pfnBlock,
+                          &pfnJobEnd]()
+        {
+            auto oAccumulator = oErrorAccumulator.InstallForCurrentScope();
+            CPL_IGNORE_RET_VAL(oAccumulator);
+
+            void *pData = VSI_MALLOC_ALIGNED_AUTO_VERBOSE(
+                static_cast<size_t>(nDTSize) * nBlockXSize * nBlockYSize);
+            GByte *pabyMaskData = nullptr;
+            if (poTSMaskBand)
+                pabyMaskData = static_cast<GByte *>(
+                    VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
+            if (!pData || (poTSMaskBand && !pabyMaskData))
+                bError = true;
+
+            for (GIntBig i = iFirst; i < iLast && !bError && !bStop; ++i)
+            {
+                const GIntBig iSampleBlock = i * m_nSampleRate;
+                const int iYBlock =
+                    static_cast<int>(iSampleBlock / nBlocksPerRow);
+                const int iXBlock =
+                    static_cast<int>(iSampleBlock % nBlocksPerRow);
+                const int nXOff = iXBlock * nBlockXSize;
+                const int nYOff = iYBlock * nBlockYSize;
+                const int nXCheck = std::min(nBlockXSize, nXSize - nXOff);
+                const int nYCheck = std::min(nBlockYSize, nYSize - nYOff);
+
+                if ((poTSMaskBand &&
+                     poTSMaskBand->RasterIO(GF_Read, nXOff, nYOff, nXCheck,
+                                            nYCheck, pabyMaskData, nXCheck,
+                                            nYCheck, GDT_Byte, 0, nBlockXSize,
+                                            nullptr) != CE_None) ||
+                    m_poTSBand->RasterIO(
+                        GF_Read, nXOff, nYOff, nXCheck, nYCheck, pData, nXCheck,
+                        nYCheck, eDataType, nDTSize,
+                        static_cast<GSpacing>(nDTSize) * nBlockXSize,
+                        nullptr) != CE_None ||
+                    !pfnBlock(iJob, pData, pabyMaskData, nXCheck, nYCheck))
+                {
+                    bError = true;
+                }
+                ++nBlocksDone;
+            }
+
+            VSIFreeAligned(pData);
+            CPLFree(pabyMaskData);
+            pfnJobEnd(iJob);
+        };
+        if (!poJobQueue->SubmitJob(Job))
+        {
+            bError = true;
+            break;
+        }
+    }
+
+    while (poJobQueue->WaitEvent())
+    {
+        if (!bStop &&
+            !pfnProgress(static_cast<double>(nBlocksDone.load()) /
+                             static_cast<double>(m_nSampledBlocks),
+                         pszMessage, pProgressData))
+        {
+            bStop = true;
+        }
+    }
+    poJobQueue->WaitCompletion();
+
+    oErrorAccumulator.ReplayErrors();
+
+    if (bStop)
+    {
+        m_poBand->ReportError(CE_Failure, CPLE_UserInterrupt,
+                              "User terminated");
+        return false;
+    }
+    return !bError;
+}
+
+}  // namespace
+
 /************************************************************************/
 /*                            GetHistogram()                            */
 /************************************************************************/
@@ -4172,6 +4452,12 @@ inline bool ARE_REAL_EQUAL(GFloat16 dfVal1, GFloat16 dfVal2, int ulp = 2)
  * This method is the same as the C functions GDALGetRasterHistogram() and
  * GDALGetRasterHistogramEx().
  *
+ * Starting with GDAL 3.12, the GDAL_NUM_THREADS configuration option can be
+ * set to "ALL_CPUS" or a integer value to specify the number of threads to use
+ * to read and process blocks in parallel, when the dataset is opened in
+ * read-only mode and can be re-opened in worker threads (see
+ * GDALGetThreadSafeDataset()).
+ *
  * @param dfMin the lower bound of the histogram.
  * @param dfMax the upper bound of the histogram.
  * @param nBuckets the number of buckets in panHistogram.
@@ -4519,61 +4805,17 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
                 nSampleRate += 1;
         }
 
-        GByte *pabyMaskData = nullptr;
-        if (poMaskBand)
-        {
-            pabyMaskData = static_cast<GByte *>(
-                VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-            if (!pabyMaskData)
-            {
-                return CE_Failure;
-            }
-        }
-
         /* --------------------------------------------------------------------
          */
-        /*      Read the blocks, and add to histogram. */
+        /*      Add the valid pixels of a block to a histogram. */
         /* --------------------------------------------------------------------
          */
-        for (GIntBig iSampleBlock = 0;
-             iSampleBlock <
-             static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-             iSampleBlock += nSampleRate)
+        const auto AddBlockToHistogram =
+            [this, bSignedByte, &sNoDataValues, dfMin, dfScale, nBuckets,
+             bIncludeOutOfRange](GUIntBig *panHist, void *pData,
+                                 const GByte *pabyMaskData, int nXCheck,
+                                 int nYCheck)
         {
-            if (!pfnProgress(
-                    static_cast<double>(iSampleBlock) /
-                        (static_cast<double>(nBlocksPerRow) * nBlocksPerColumn),
-                    "Compute Histogram", pProgressData))
-            {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
-
-            const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
-            const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-            int nXCheck = 0, nYCheck = 0;
-            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-            if (poMaskBand &&
-                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                     pabyMaskData, nXCheck, nYCheck, GDT_Byte,
-                                     0, nBlockXSize, nullptr) != CE_None)
-            {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
-
-            GDALRasterBlock *poBlock = GetLockedBlockRef(iXBlock, iYBlock);
-            if (poBlock == nullptr)
-            {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
-
-            void *pData = poBlock->GetDataRef();
-
             // this is a special case for a common situation.
             if (eDataType == GDT_Byte && !bSignedByte && dfScale == 1.0 &&
                 (dfMin >= -0.5 && dfMin <= 0.5) && nYCheck == nBlockYSize &&
@@ -4591,12 +4833,11 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
                           (pabyData[i] ==
                            static_cast<GByte>(sNoDataValues.dfNoDataValue))))
                     {
-                        panHistogram[pabyData[i]]++;
+                        panHist[pabyData[i]]++;
                     }
                 }
 
-                poBlock->DropLock();
-                continue;  // To next sample block.
+                return true;
             }
 
             // This isn't the fastest way to do this, but is easier for now.
@@ -4730,8 +4971,7 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
                         case GDT_Unknown:
                         case GDT_TypeCount:
                             CPLAssert(false);
-                            CPLFree(pabyMaskData);
-                            return CE_Failure;
+                            return false;
                     }
 
                     if (eDataType != GDT_Float16 && eDataType != GDT_Float32 &&
@@ -4747,21 +4987,137 @@ CPLErr GDALRasterBand::GetHistogram(double dfMin, double dfMax, int nBuckets,
                     if (dfIndex < 0)
                     {
                         if (bIncludeOutOfRange)
-                            panHistogram[0]++;
+                            panHist[0]++;
                     }
                     else if (dfIndex >= nBuckets)
                     {
                         if (bIncludeOutOfRange)
-                            ++panHistogram[nBuckets - 1];
+                            ++panHist[nBuckets - 1];
                     }
                     else
                     {
-                        ++panHistogram[static_cast<int>(dfIndex)];
+                        ++panHist[static_cast<int>(dfIndex)];
+                    }
+                }
+            }
+
+            return true;
+        };
+
+        GDALRasterBandParallelBlockScanner oScanner(this, nSampleRate);
+        if (oScanner.IsEnabled())
+        {
+            // Each job accumulates in its own histogram, which is added to
+            // the final one when the job ends.
+            std::mutex oMutex;
+            std::vector<std::vector<GUIntBig>> aanJobHistograms(
+                oScanner.GetJobCount());
+            const auto AddBlock =
+                [this, nBuckets, &aanJobHistograms, &AddBlockToHistogram](
+                    int iJob, void *pData, const GByte *pabyMaskData,
+                    int nXCheck, int nYCheck)
+            {
+                auto &anJobHistogram = aanJobHistograms[iJob];
+                if (anJobHistogram.empty())
+                {
+                    try
+                    {
+                        anJobHistogram.resize(nBuckets);
+                    }
+                    catch (const std::bad_alloc &)
+                    {
+                        ReportError(CE_Failure, CPLE_OutOfMemory,
+                                    "Out of memory in GetHistogram()");
+                        return false;
                     }
                 }
+                return AddBlockToHistogram(anJobHistogram.data(), pData,
+                                           pabyMaskData, nXCheck, nYCheck);
+            };
+            const auto JobEnd =
+                [panHistogram, &oMutex, &aanJobHistograms](int iJob)
+            {
+                auto &anJobHistogram = aanJobHistograms[iJob];
+                {
+                    std::lock_guard oLock(oMutex);
+                    for (size_t i = 0; i < anJobHistogram.size(); ++i)
+                        panHistogram[i] += anJobHistogram[i];
+                }
+                anJobHistogram.clear();
+                anJobHistogram.shrink_to_fit();
+            };
+            if (!oScanner.Run(poMaskBand != nullptr, "Compute Histogram",
+                              pfnProgress, pProgressData, AddBlock, JobEnd))
+            {
+                return CE_Failure;
+            }
+
+            pfnProgress(1.0, "Compute Histogram", pProgressData);
+            return CE_None;
+        }
+
+        GByte *pabyMaskData = nullptr;
+        if (poMaskBand)
+        {
+            pabyMaskData = static_cast<GByte *>(
+                VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
+            if (!pabyMaskData)
+            {
+                return CE_Failure;
+            }
+        }
+
+        /* --------------------------------------------------------------------
+         */
+        /*      Read the blocks, and add to histogram. */
+        /* --------------------------------------------------------------------
+         */
+        for (GIntBig iSampleBlock = 0;
+             iSampleBlock <
+             static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
+             iSampleBlock += nSampleRate)
+        {
+            if (!pfnProgress(
+                    static_cast<double>(iSampleBlock) /
+                        (static_cast<double>(nBlocksPerRow) * nBlocksPerColumn),
+                    "Compute Histogram", pProgressData))
+            {
+                CPLFree(pabyMaskData);
+                return CE_Failure;
+            }
+
+            const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
+            const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
+
+            int nXCheck = 0, nYCheck = 0;
+            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+
+            if (poMaskBand &&
+                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
+                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
+                                     pabyMaskData, nXCheck, nYCheck, GDT_Byte,
+                                     0, nBlockXSize, nullptr) != CE_None)
+            {
+                CPLFree(pabyMaskData);
+                return CE_Failure;
+            }
+
+            GDALRasterBlock *poBlock = GetLockedBlockRef(iXBlock, iYBlock);
+            if (poBlock == nullptr)
+            {
+                CPLFree(pabyMaskData);
+                return CE_Failure;
             }
 
+            const bool bOK =
+                AddBlockToHistogram(panHistogram, poBlock->GetDataRef(),
+                                    pabyMaskData, nXCheck, nYCheck);
             poBlock->DropLock();
+            if (!bOK)
+            {
+                CPLFree(pabyMaskData);
+                return CE_Failure;
+            }
         }
 
         CPLFree(pabyMaskData);
@@ -6868,6 +7224,36 @@ ComputeStatisticsFloat64_SSE2(const double *padfData,
 
 #endif
 
+/************************************************************************/
+/*                          MergeMeanAndM2()                            */
+/************************************************************************/
+
+// Update the count, mean and M2 (the sum of squares of differences to the
+// mean) of a set of values, with the ones of another disjoint set, using
+// https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+static void MergeMeanAndM2(GUIntBig &nValidCount, double &dfMean, double &dfM2,
+                           GUIntBig nOtherValidCount, double dfOtherMean,
+                           double dfOtherM2)
+{
+    if (nOtherValidCount == 0)
+        return;
+    if (nValidCount == 0)
+    {
+        nValidCount = nOtherValidCount;
+        dfMean = dfOtherMean;
+        dfM2 = dfOtherM2;
+        return;
+    }
+    const double dfOtherValidCount = static_cast<double>(nOtherValidCount);
+    const GUIntBig nNewValidCount = nValidCount + nOtherValidCount;
+    const double dfNewValidCount = static_cast<double>(nNewValidCount);
+    const double dfDelta = dfOtherMean - dfMean;
+    dfMean += dfDelta * (dfOtherValidCount / dfNewValidCount);
+    dfM2 += dfOtherM2 + dfDelta * dfDelta * static_cast<double>(nValidCount) *
+                            dfOtherValidCount / dfNewValidCount;
+    nValidCount = nNewValidCount;
+}
+
 /************************************************************************/
 /*                         ComputeStatistics()                          */
 /************************************************************************/
@@ -6887,6 +7273,12 @@ ComputeStatisticsFloat64_SSE2(const double *padfData,
  *
  * This method is the same as the C function GDALComputeRasterStatistics().
  *
+ * Starting with GDAL 3.12, the GDAL_NUM_THREADS configuration option can be
+ * set to "ALL_CPUS" or a integer value to specify the number of threads to use
+ * to read and process blocks in parallel, when the dataset is opened in
+ * read-only mode and can be re-opened in worker threads (see
+ * GDALGetThreadSafeDataset()).
+ *
  * @param bApproxOK If TRUE statistics may be computed based on overviews
  * or a subset of all tiles.
  *
@@ -7154,10 +7546,6 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                     CPLGetConfigOption("GDAL_STATS_USE_INTEGER_STATS", "YES"));
 
             const GUInt32 nMaxValueType = (eDataType == GDT_Byte) ? 255 : 65535;
-            GUInt32 nMin = nMaxValueType;
-            GUInt32 nMax = 0;
-            GUIntBig nSum = 0;
-            GUIntBig nSumSquare = 0;
             // If no valid nodata, map to invalid value (256 for Byte)
             const GUInt32 nNoDataValue =
                 (sNoDataValues.bGotNoDataValue &&
@@ -7169,37 +7557,37 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                     ? static_cast<GUInt32>(sNoDataValues.dfNoDataValue + 1e-10)
                     : nMaxValueType + 1;
 
-            for (GIntBig iSampleBlock = 0;
-                 iSampleBlock <
-                 static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-                 iSampleBlock += nSampleRate)
+            // nSum and nSumSquare are only used if bIntegerStats, and
+            // dfMean and dfM2 otherwise.
+            struct IntegerStats
+            {
+                GUInt32 nMin = 0;
+                GUInt32 nMax = 0;
+                GUIntBig nSum = 0;
+                GUIntBig nSumSquare = 0;
+                GUIntBig nSampleCount = 0;
+                GUIntBig nValidCount = 0;
+                double dfMean = 0;
+                double dfM2 = 0;
+            };
+
+            const auto AddBlockToStats =
+                [this, bIntegerStats, nMaxValueType,
+                 nNoDataValue](IntegerStats &oStats, const void *pData,
+                               int nXCheck, int nYCheck)
             {
-                const int iYBlock =
-                    static_cast<int>(iSampleBlock / nBlocksPerRow);
-                const int iXBlock =
-                    static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-                GDALRasterBlock *const poBlock =
-                    GetLockedBlockRef(iXBlock, iYBlock);
-                if (poBlock == nullptr)
-                    return CE_Failure;
-
-                void *const pData = poBlock->GetDataRef();
-
-                int nXCheck = 0, nYCheck = 0;
-                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
                 GUIntBig nBlockSum = 0;
                 GUIntBig nBlockSumSquare = 0;
                 GUIntBig nBlockSampleCount = 0;
                 GUIntBig nBlockValidCount = 0;
-                GUIntBig &nBlockSumRef = bIntegerStats ? nSum : nBlockSum;
+                GUIntBig &nBlockSumRef =
+                    bIntegerStats ? oStats.nSum : nBlockSum;
                 GUIntBig &nBlockSumSquareRef =
-                    bIntegerStats ? nSumSquare : nBlockSumSquare;
+                    bIntegerStats ? oStats.nSumSquare : nBlockSumSquare;
                 GUIntBig &nBlockSampleCountRef =
-                    bIntegerStats ? nSampleCount : nBlockSampleCount;
+                    bIntegerStats ? oStats.nSampleCount : nBlockSampleCount;
                 GUIntBig &nBlockValidCountRef =
-                    bIntegerStats ? nValidCount : nBlockValidCount;
+                    bIntegerStats ? oStats.nValidCount : nBlockValidCount;
 
                 if (eDataType == GDT_Byte)
                 {
@@ -7207,9 +7595,10 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                         GByte, /* COMPUTE_OTHER_STATS = */ true>::
                         f(nXCheck, nBlockXSize, nYCheck,
                           static_cast<const GByte *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nBlockSumRef, nBlockSumSquareRef,
-                          nBlockSampleCountRef, nBlockValidCountRef);
+                          nNoDataValue <= nMaxValueType, nNoDataValue,
+                          oStats.nMin, oStats.nMax, nBlockSumRef,
+                          nBlockSumSquareRef, nBlockSampleCountRef,
+                          nBlockValidCountRef);
                 }
                 else
                 {
@@ -7217,21 +7606,19 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                         GUInt16, /* COMPUTE_OTHER_STATS = */ true>::
                         f(nXCheck, nBlockXSize, nYCheck,
                           static_cast<const GUInt16 *>(pData),
-                          nNoDataValue <= nMaxValueType, nNoDataValue, nMin,
-                          nMax, nBlockSumRef, nBlockSumSquareRef,
-                          nBlockSampleCountRef, nBlockValidCountRef);
+                          nNoDataValue <= nMaxValueType, nNoDataValue,
+                          oStats.nMin, oStats.nMax, nBlockSumRef,
+                          nBlockSumSquareRef, nBlockSampleCountRef,
+                          nBlockValidCountRef);
                 }
 
-                poBlock->DropLock();
-
                 if (!bIntegerStats)
                 {
-                    nSampleCount += nBlockSampleCount;
+                    oStats.nSampleCount += nBlockSampleCount;
                     if (nBlockValidCount)
                     {
                         // Update the global mean and M2 (the difference of the
                         // square to the mean) from the values of the block
-                        // using https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
                         const double dfBlockValidCount =
                             static_cast<double>(nBlockValidCount);
                         const double dfBlockMean =
@@ -7242,30 +7629,95 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                                                  nBlockValidCount) -
                                 GDALUInt128::Mul(nBlockSum, nBlockSum)) /
                             dfBlockValidCount;
-                        const double dfDelta = dfBlockMean - dfMean;
-                        const auto nNewValidCount =
-                            nValidCount + nBlockValidCount;
-                        const double dfNewValidCount =
-                            static_cast<double>(nNewValidCount);
-                        dfMean +=
-                            dfDelta * (dfBlockValidCount / dfNewValidCount);
-                        dfM2 +=
-                            dfBlockM2 + dfDelta * dfDelta *
-                                            static_cast<double>(nValidCount) *
-                                            dfBlockValidCount / dfNewValidCount;
-                        nValidCount = nNewValidCount;
+                        MergeMeanAndM2(oStats.nValidCount, oStats.dfMean,
+                                       oStats.dfM2, nBlockValidCount,
+                                       dfBlockMean, dfBlockM2);
                     }
                 }
+            };
 
-                if (!pfnProgress(static_cast<double>(iSampleBlock) /
-                                     (static_cast<double>(nBlocksPerRow) *
-                                      nBlocksPerColumn),
-                                 "Compute Statistics", pProgressData))
+            IntegerStats oStats;
+            oStats.nMin = nMaxValueType;
+
+            GDALRasterBandParallelBlockScanner oScanner(this, nSampleRate);
+            if (oScanner.IsEnabled())
+            {
+                std::vector<IntegerStats> aoJobStats(oScanner.GetJobCount(),
+                                                     oStats);
+                if (!oScanner.Run(
+                        /* bUseMask = */ false, "Compute Statistics",
+                        pfnProgress, pProgressData,
+                        [&aoJobStats, &AddBlockToStats](
+                            int iJob, const void *pData,
+                            const GByte * /* pabyMaskData */, int nXCheck,
+                            int nYCheck)
+                        {
+                            AddBlockToStats(aoJobStats[iJob], pData, nXCheck,
+                                            nYCheck);
+                            return true;
+                        },
+                        [](int /* iJob */) {}))
                 {
-                    ReportError(CE_Failure, CPLE_UserInterrupt,
-                                "User terminated");
                     return CE_Failure;
                 }
+
+                // Merge in job order, so that the result does not depend on
+                // thread scheduling. When bIntegerStats, the result is
+                // exactly the one of the single-threaded code path.
+                for (const auto &oJobStats : aoJobStats)
+                {
+                    oStats.nMin = std::min(oStats.nMin, oJobStats.nMin);
+                    oStats.nMax = std::max(oStats.nMax, oJobStats.nMax);
+                    oStats.nSampleCount += oJobStats.nSampleCount;
+                    if (bIntegerStats)
+                    {
+                        oStats.nSum += oJobStats.nSum;
+                        oStats.nSumSquare += oJobStats.nSumSquare;
+                        oStats.nValidCount += oJobStats.nValidCount;
+                    }
+                    else
+                    {
+                        MergeMeanAndM2(oStats.nValidCount, oStats.dfMean,
+                                       oStats.dfM2, oJobStats.nValidCount,
+                                       oJobStats.dfMean, oJobStats.dfM2);
+                    }
+                }
+            }
+            else
+            {
+                for (GIntBig iSampleBlock = 0;
+                     iSampleBlock <
+                     static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
+                     iSampleBlock += nSampleRate)
+                {
+                    const int iYBlock =
+                        static_cast<int>(iSampleBlock / nBlocksPerRow);
+                    const int iXBlock =
+                        static_cast<int>(iSampleBlock % nBlocksPerRow);
+
+                    GDALRasterBlock *const poBlock =
+                        GetLockedBlockRef(iXBlock, iYBlock);
+                    if (poBlock == nullptr)
+                        return CE_Failure;
+
+                    int nXCheck = 0, nYCheck = 0;
+                    GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+
+                    AddBlockToStats(oStats, poBlock->GetDataRef(), nXCheck,
+                                    nYCheck);
+
+                    poBlock->DropLock();
+
+                    if (!pfnProgress(static_cast<double>(iSampleBlock) /
+                                         (static_cast<double>(nBlocksPerRow) *
+                                          nBlocksPerColumn),
+                                     "Compute Statistics", pProgressData))
+                    {
+                        ReportError(CE_Failure, CPLE_UserInterrupt,
+                                    "User terminated");
+                        return CE_Failure;
+                    }
+                }
             }
 
             if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
@@ -7274,6 +7726,18 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                 return CE_Failure;
             }
 
+            const GUInt32 nMin = oStats.nMin;
+            const GUInt32 nMax = oStats.nMax;
+            const GUIntBig nSum = oStats.nSum;
+            const GUIntBig nSumSquare = oStats.nSumSquare;
+            nSampleCount = oStats.nSampleCount;
+            nValidCount = oStats.nValidCount;
+            if (!bIntegerStats)
+            {
+                dfMean = oStats.dfMean;
+                dfM2 = oStats.dfM2;
+            }
+
             double dfStdDev = 0;
             if (bIntegerStats)
             {
@@ -7337,64 +7801,38 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
             return CE_Failure;
         }
 
-        GByte *pabyMaskData = nullptr;
-        if (poMaskBand)
-        {
-            pabyMaskData = static_cast<GByte *>(
-                VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
-            if (!pabyMaskData)
-            {
-                return CE_Failure;
-            }
-        }
-
-        float fMin = std::numeric_limits<float>::infinity();
-        float fMax = -std::numeric_limits<float>::infinity();
         const bool bFloat32Optim =
-            eDataType == GDT_Float32 && !pabyMaskData &&
+            eDataType == GDT_Float32 && !poMaskBand &&
             nBlockXSize < std::numeric_limits<int>::max() / nBlockYSize &&
             CPLTestBool(
                 CPLGetConfigOption("GDAL_STATS_USE_FLOAT32_OPTIM", "YES"));
 
 #if (defined(__x86_64__) || defined(_M_X64))
         const bool bFloat64Optim =
-            eDataType == GDT_Float64 && !pabyMaskData &&
+            eDataType == GDT_Float64 && !poMaskBand &&
             nBlockXSize < std::numeric_limits<int>::max() / nBlockYSize &&
             CPLTestBool(
                 CPLGetConfigOption("GDAL_STATS_USE_FLOAT64_OPTIM", "YES"));
 #endif
 
-        for (GIntBig iSampleBlock = 0;
-             iSampleBlock <
-             static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
-             iSampleBlock += nSampleRate)
+        // fMin and fMax are only used if bFloat32Optim, and dfMin and dfMax
+        // otherwise.
+        struct Stats
         {
-            const int iYBlock = static_cast<int>(iSampleBlock / nBlocksPerRow);
-            const int iXBlock = static_cast<int>(iSampleBlock % nBlocksPerRow);
-
-            int nXCheck = 0, nYCheck = 0;
-            GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
-
-            if (poMaskBand &&
-                poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
-                                     iYBlock * nBlockYSize, nXCheck, nYCheck,
-                                     pabyMaskData, nXCheck, nYCheck, GDT_Byte,
-                                     0, nBlockXSize, nullptr) != CE_None)
-            {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
-
-            GDALRasterBlock *const poBlock =
-                GetLockedBlockRef(iXBlock, iYBlock);
-            if (poBlock == nullptr)
-            {
-                CPLFree(pabyMaskData);
-                return CE_Failure;
-            }
-
-            const void *const pData = poBlock->GetDataRef();
+            double dfMin = std::numeric_limits<double>::infinity();
+            double dfMax = -std::numeric_limits<double>::infinity();
+            double dfMean = 0;
+            double dfM2 = 0;
+            GUIntBig nValidCount = 0;
+            GUIntBig nSampleCount = 0;
+            float fMin = std::numeric_limits<float>::infinity();
+            float fMax = -std::numeric_limits<float>::infinity();
+        };
 
+        const auto AddBlockToStats =
+            [&](Stats &oStats, const void *pData, const GByte *pabyMaskData,
+                int nXCheck, int nYCheck)
+        {
             if (bFloat32Optim)
             {
                 const bool bHasNoData = sNoDataValues.bGotFloatNoDataValue &&
@@ -7405,7 +7843,7 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                 for (int iY = 0; iY < nYCheck; iY++)
                 {
                     const int iOffset = iY * nBlockXSize;
-                    if (nBlockValidCount && fMin != fMax)
+                    if (nBlockValidCount && oStats.fMin != oStats.fMax)
                     {
                         int iX = 0;
 #if (defined(__x86_64__) || defined(_M_X64))
@@ -7415,8 +7853,9 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                                 /* bCheckMinEqMax = */ false,
                                 /* bHasNoData = */ true>(
                                 static_cast<const float *>(pData) + iOffset,
-                                sNoDataValues.fNoDataValue, iX, nXCheck, fMin,
-                                fMax, fBlockMean, fBlockM2, nBlockValidCount);
+                                sNoDataValues.fNoDataValue, iX, nXCheck,
+                                oStats.fMin, oStats.fMax, fBlockMean, fBlockM2,
+                                nBlockValidCount);
                         }
                         else
                         {
@@ -7424,8 +7863,9 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                                 /* bCheckMinEqMax = */ false,
                                 /* bHasNoData = */ false>(
                                 static_cast<const float *>(pData) + iOffset,
-                                sNoDataValues.fNoDataValue, iX, nXCheck, fMin,
-                                fMax, fBlockMean, fBlockM2, nBlockValidCount);
+                                sNoDataValues.fNoDataValue, iX, nXCheck,
+                                oStats.fMin, oStats.fMax, fBlockMean, fBlockM2,
+                                nBlockValidCount);
                         }
 #endif
                         for (; iX < nXCheck; iX++)
@@ -7436,8 +7876,8 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                                 (bHasNoData &&
                                  fValue == sNoDataValues.fNoDataValue))
                                 continue;
-                            fMin = std::min(fMin, fValue);
-                            fMax = std::max(fMax, fValue);
+                            oStats.fMin = std::min(oStats.fMin, fValue);
+                            oStats.fMax = std::max(oStats.fMax, fValue);
                             ++nBlockValidCount;
                             const float fDelta = fValue - fBlockMean;
                             fBlockMean +=
@@ -7458,8 +7898,8 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                                     (bHasNoData &&
                                      fValue == sNoDataValues.fNoDataValue))
                                     continue;
-                                fMin = std::min(fMin, fValue);
-                                fMax = std::max(fMax, fValue);
+                                oStats.fMin = std::min(oStats.fMin, fValue);
+                                oStats.fMax = std::max(oStats.fMax, fValue);
                                 nBlockValidCount = 1;
                                 fBlockMean = fValue;
                                 iX++;
@@ -7473,8 +7913,9 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                                 /* bCheckMinEqMax = */ true,
                                 /* bHasNoData = */ true>(
                                 static_cast<const float *>(pData) + iOffset,
-                                sNoDataValues.fNoDataValue, iX, nXCheck, fMin,
-                                fMax, fBlockMean, fBlockM2, nBlockValidCount);
+                                sNoDataValues.fNoDataValue, iX, nXCheck,
+                                oStats.fMin, oStats.fMax, fBlockMean, fBlockM2,
+                                nBlockValidCount);
                         }
                         else
                         {
@@ -7482,8 +7923,9 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                                 /* bCheckMinEqMax = */ true,
                                 /* bHasNoData = */ false>(
                                 static_cast<const float *>(pData) + iOffset,
-                                sNoDataValues.fNoDataValue, iX, nXCheck, fMin,
-                                fMax, fBlockMean, fBlockM2, nBlockValidCount);
+                                sNoDataValues.fNoDataValue, iX, nXCheck,
+                                oStats.fMin, oStats.fMax, fBlockMean, fBlockM2,
+                                nBlockValidCount);
                         }
 #endif
                         for (; iX < nXCheck; iX++)
@@ -7494,10 +7936,10 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                                 (bHasNoData &&
                                  fValue == sNoDataValues.fNoDataValue))
                                 continue;
-                            fMin = std::min(fMin, fValue);
-                            fMax = std::max(fMax, fValue);
+                            oStats.fMin = std::min(oStats.fMin, fValue);
+                            oStats.fMax = std::max(oStats.fMax, fValue);
                             ++nBlockValidCount;
-                            if (fMin != fMax)
+                            if (oStats.fMin != oStats.fMax)
                             {
                                 const float fDelta = fValue - fBlockMean;
                                 fBlockMean += fDelta / static_cast<float>(
@@ -7513,32 +7955,34 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                     // Update the global mean and M2 (the difference of the
                     // square to the mean) from the values of the block
                     // using https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
-                    const auto nNewValidCount = nValidCount + nBlockValidCount;
+                    const auto nNewValidCount =
+                        oStats.nValidCount + nBlockValidCount;
                     const double dfBlockMean = static_cast<double>(fBlockMean);
-                    if (dfBlockMean != dfMean)
+                    if (dfBlockMean != oStats.dfMean)
                     {
                         const double dfBlockM2 = static_cast<double>(fBlockM2);
-                        if (nValidCount == 0)
+                        if (oStats.nValidCount == 0)
                         {
-                            dfMean = dfBlockMean;
-                            dfM2 = dfBlockM2;
+                            oStats.dfMean = dfBlockMean;
+                            oStats.dfM2 = dfBlockM2;
                         }
                         else
                         {
                             const double dfBlockValidCount =
                                 static_cast<double>(nBlockValidCount);
-                            const double dfDelta = dfBlockMean - dfMean;
+                            const double dfDelta = dfBlockMean - oStats.dfMean;
                             const double dfNewValidCount =
                                 static_cast<double>(nNewValidCount);
-                            dfMean +=
+                            oStats.dfMean +=
                                 dfDelta * (dfBlockValidCount / dfNewValidCount);
-                            dfM2 += dfBlockM2 +
-                                    dfDelta * dfDelta *
-                                        static_cast<double>(nValidCount) *
-                                        dfBlockValidCount / dfNewValidCount;
+                            oStats.dfM2 +=
+                                dfBlockM2 +
+                                dfDelta * dfDelta *
+                                    static_cast<double>(oStats.nValidCount) *
+                                    dfBlockValidCount / dfNewValidCount;
                         }
                     }
-                    nValidCount = nNewValidCount;
+                    oStats.nValidCount = nNewValidCount;
                 }
             }
 
@@ -7554,7 +7998,7 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                 for (int iY = 0; iY < nYCheck; iY++)
                 {
                     const int iOffset = iY * nBlockXSize;
-                    if (dfBlockValidCount != 0 && dfMin != dfMax)
+                    if (dfBlockValidCount != 0 && oStats.dfMin != oStats.dfMax)
                     {
                         int iX = 0;
                         if (bHasNoData)
@@ -7563,9 +8007,9 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                                 /* bCheckMinEqMax = */ false,
                                 /* bHasNoData = */ true>(
                                 static_cast<const double *>(pData) + iOffset,
-                                sNoDataValues.dfNoDataValue, iX, nXCheck, dfMin,
-                                dfMax, dfBlockMean, dfBlockM2,
-                                dfBlockValidCount);
+                                sNoDataValues.dfNoDataValue, iX, nXCheck,
+                                oStats.dfMin, oStats.dfMax, dfBlockMean,
+                                dfBlockM2, dfBlockValidCount);
                         }
                         else
                         {
@@ -7573,9 +8017,9 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                                 /* bCheckMinEqMax = */ false,
                                 /* bHasNoData = */ false>(
                                 static_cast<const double *>(pData) + iOffset,
-                                sNoDataValues.dfNoDataValue, iX, nXCheck, dfMin,
-                                dfMax, dfBlockMean, dfBlockM2,
-                                dfBlockValidCount);
+                                sNoDataValues.dfNoDataValue, iX, nXCheck,
+                                oStats.dfMin, oStats.dfMax, dfBlockMean,
+                                dfBlockM2, dfBlockValidCount);
                         }
                         for (; iX < nXCheck; iX++)
                         {
@@ -7585,8 +8029,8 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                                 (bHasNoData &&
                                  dfValue == sNoDataValues.dfNoDataValue))
                                 continue;
-                            dfMin = std::min(dfMin, dfValue);
-                            dfMax = std::max(dfMax, dfValue);
+                            oStats.dfMin = std::min(oStats.dfMin, dfValue);
+                            oStats.dfMax = std::max(oStats.dfMax, dfValue);
                             dfBlockValidCount += 1.0;
                             const double dfDelta = dfValue - dfBlockMean;
                             dfBlockMean += dfDelta / dfBlockValidCount;
@@ -7607,8 +8051,8 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                                     (bHasNoData &&
                                      dfValue == sNoDataValues.dfNoDataValue))
                                     continue;
-                                dfMin = std::min(dfMin, dfValue);
-                                dfMax = std::max(dfMax, dfValue);
+                                oStats.dfMin = std::min(oStats.dfMin, dfValue);
+                                oStats.dfMax = std::max(oStats.dfMax, dfValue);
                                 dfBlockValidCount = 1;
                                 dfBlockMean = dfValue;
                                 iX++;
@@ -7621,9 +8065,9 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                                 /* bCheckMinEqMax = */ true,
                                 /* bHasNoData = */ true>(
                                 static_cast<const double *>(pData) + iOffset,
-                                sNoDataValues.dfNoDataValue, iX, nXCheck, dfMin,
-                                dfMax, dfBlockMean, dfBlockM2,
-                                dfBlockValidCount);
+                                sNoDataValues.dfNoDataValue, iX, nXCheck,
+                                oStats.dfMin, oStats.dfMax, dfBlockMean,
+                                dfBlockM2, dfBlockValidCount);
                         }
                         else
                         {
@@ -7631,9 +8075,9 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                                 /* bCheckMinEqMax = */ true,
                                 /* bHasNoData = */ false>(
                                 static_cast<const double *>(pData) + iOffset,
-                                sNoDataValues.dfNoDataValue, iX, nXCheck, dfMin,
-                                dfMax, dfBlockMean, dfBlockM2,
-                                dfBlockValidCount);
+                                sNoDataValues.dfNoDataValue, iX, nXCheck,
+                                oStats.dfMin, oStats.dfMax, dfBlockMean,
+                                dfBlockM2, dfBlockValidCount);
                         }
                         for (; iX < nXCheck; iX++)
                         {
@@ -7643,10 +8087,10 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                                 (bHasNoData &&
                                  dfValue == sNoDataValues.dfNoDataValue))
                                 continue;
-                            dfMin = std::min(dfMin, dfValue);
-                            dfMax = std::max(dfMax, dfValue);
+                            oStats.dfMin = std::min(oStats.dfMin, dfValue);
+                            oStats.dfMax = std::max(oStats.dfMax, dfValue);
                             dfBlockValidCount += 1.0;
-                            if (dfMin != dfMax)
+                            if (oStats.dfMin != oStats.dfMax)
                             {
                                 const double dfDelta = dfValue - dfBlockMean;
                                 dfBlockMean += dfDelta / dfBlockValidCount;
@@ -7662,28 +8106,30 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                     // square to the mean) from the values of the block
                     // using https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
                     const auto nNewValidCount =
-                        nValidCount + static_cast<int>(dfBlockValidCount);
-                    if (dfBlockMean != dfMean)
+                        oStats.nValidCount +
+                        static_cast<int>(dfBlockValidCount);
+                    if (dfBlockMean != oStats.dfMean)
                     {
-                        if (nValidCount == 0)
+                        if (oStats.nValidCount == 0)
                         {
-                            dfMean = dfBlockMean;
-                            dfM2 = dfBlockM2;
+                            oStats.dfMean = dfBlockMean;
+                            oStats.dfM2 = dfBlockM2;
                         }
                         else
                         {
-                            const double dfDelta = dfBlockMean - dfMean;
+                            const double dfDelta = dfBlockMean - oStats.dfMean;
                             const double dfNewValidCount =
                                 static_cast<double>(nNewValidCount);
-                            dfMean +=
+                            oStats.dfMean +=
                                 dfDelta * (dfBlockValidCount / dfNewValidCount);
-                            dfM2 += dfBlockM2 +
-                                    dfDelta * dfDelta *
-                                        static_cast<double>(nValidCount) *
-                                        dfBlockValidCount / dfNewValidCount;
+                            oStats.dfM2 +=
+                                dfBlockM2 +
+                                dfDelta * dfDelta *
+                                    static_cast<double>(oStats.nValidCount) *
+                                    dfBlockValidCount / dfNewValidCount;
                         }
                     }
-                    nValidCount = nNewValidCount;
+                    oStats.nValidCount = nNewValidCount;
                 }
             }
 #endif  // (defined(__x86_64__) || defined(_M_X64))
@@ -7693,7 +8139,7 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                 // This isn't the fastest way to do this, but is easier for now.
                 for (int iY = 0; iY < nYCheck; iY++)
                 {
-                    if (nValidCount && dfMin != dfMax)
+                    if (oStats.nValidCount && oStats.dfMin != oStats.dfMax)
                     {
                         for (int iX = 0; iX < nXCheck; iX++)
                         {
@@ -7710,19 +8156,19 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                             if (!bValid)
                                 continue;
 
-                            dfMin = std::min(dfMin, dfValue);
-                            dfMax = std::max(dfMax, dfValue);
+                            oStats.dfMin = std::min(oStats.dfMin, dfValue);
+                            oStats.dfMax = std::max(oStats.dfMax, dfValue);
 
-                            nValidCount++;
-                            const double dfDelta = dfValue - dfMean;
-                            dfMean += dfDelta / nValidCount;
-                            dfM2 += dfDelta * (dfValue - dfMean);
+                            oStats.nValidCount++;
+                            const double dfDelta = dfValue - oStats.dfMean;
+                            oStats.dfMean += dfDelta / oStats.nValidCount;
+                            oStats.dfM2 += dfDelta * (dfValue - oStats.dfMean);
                         }
                     }
                     else
                     {
                         int iX = 0;
-                        if (nValidCount == 0)
+                        if (oStats.nValidCount == 0)
                         {
                             for (; iX < nXCheck; iX++)
                             {
@@ -7740,10 +8186,10 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                                 if (!bValid)
                                     continue;
 
-                                dfMin = dfValue;
-                                dfMax = dfValue;
-                                dfMean = dfValue;
-                                nValidCount = 1;
+                                oStats.dfMin = dfValue;
+                                oStats.dfMax = dfValue;
+                                oStats.dfMean = dfValue;
+                                oStats.nValidCount = 1;
                                 iX++;
                                 break;
                             }
@@ -7763,42 +8209,133 @@ CPLErr GDALRasterBand::ComputeStatistics(int bApproxOK, double *pdfMin,
                             if (!bValid)
                                 continue;
 
-                            dfMin = std::min(dfMin, dfValue);
-                            dfMax = std::max(dfMax, dfValue);
+                            oStats.dfMin = std::min(oStats.dfMin, dfValue);
+                            oStats.dfMax = std::max(oStats.dfMax, dfValue);
 
-                            nValidCount++;
-                            if (dfMin != dfMax)
+                            oStats.nValidCount++;
+                            if (oStats.dfMin != oStats.dfMax)
                             {
-                                const double dfDelta = dfValue - dfMean;
-                                dfMean += dfDelta / nValidCount;
-                                dfM2 += dfDelta * (dfValue - dfMean);
+                                const double dfDelta = dfValue - oStats.dfMean;
+                                oStats.dfMean += dfDelta / oStats.nValidCount;
+                                oStats.dfM2 +=
+                                    dfDelta * (dfValue - oStats.dfMean);
                             }
                         }
                     }
                 }
             }
 
-            nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
-
-            poBlock->DropLock();
+            oStats.nSampleCount += static_cast<GUIntBig>(nXCheck) * nYCheck;
+        };
 
-            if (!pfnProgress(
-                    static_cast<double>(iSampleBlock) /
-                        (static_cast<double>(nBlocksPerRow) * nBlocksPerColumn),
-                    "Compute Statistics", pProgressData))
+        const auto MergeStats = [&](const Stats &oStats)
+        {
+            if (bFloat32Optim)
+            {
+                dfMin = std::min(dfMin, static_cast<double>(oStats.fMin));
+                dfMax = std::max(dfMax, static_cast<double>(oStats.fMax));
+            }
+            else
+            {
+                dfMin = std::min(dfMin, oStats.dfMin);
+                dfMax = std::max(dfMax, oStats.dfMax);
+            }
+            nSampleCount += oStats.nSampleCount;
+            MergeMeanAndM2(nValidCount, dfMean, dfM2, oStats.nValidCount,
+                           oStats.dfMean, oStats.dfM2);
+        };
+
+        GDALRasterBandParallelBlockScanner oScanner(this, nSampleRate);
+        if (oScanner.IsEnabled())
+        {
+            std::vector<Stats> aoJobStats(oScanner.GetJobCount());
+            if (!oScanner.Run(
+                    poMaskBand != nullptr, "Compute Statistics", pfnProgress,
+                    pProgressData,
+                    [&aoJobStats, &AddBlockToStats](
+                        int iJob, const void *pData, const GByte *pabyMaskData,
+                        int nXCheck, int nYCheck)
+                    {
+                        AddBlockToStats(aoJobStats[iJob], pData, pabyMaskData,
+                                        nXCheck, nYCheck);
+                        return true;
+                    },
+                    [](int /* iJob */) {}))
             {
-                ReportError(CE_Failure, CPLE_UserInterrupt, "User terminated");
-                CPLFree(pabyMaskData);
                 return CE_Failure;
             }
-        }
 
-        if (bFloat32Optim)
+            // Merge in job order, so that the result does not depend on
+            // thread scheduling.
+            for (const auto &oJobStats : aoJobStats)
+                MergeStats(oJobStats);
+        }
+        else
         {
-            dfMin = static_cast<double>(fMin);
-            dfMax = static_cast<double>(fMax);
+            GByte *pabyMaskData = nullptr;
+            if (poMaskBand)
+            {
+                pabyMaskData = static_cast<GByte *>(
+                    VSI_MALLOC2_VERBOSE(nBlockXSize, nBlockYSize));
+                if (!pabyMaskData)
+                {
+                    return CE_Failure;
+                }
+            }
+
+            Stats oStats;
+            for (GIntBig iSampleBlock = 0;
+                 iSampleBlock <
+                 static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
+                 iSampleBlock += nSampleRate)
+            {
+                const int iYBlock =
+                    static_cast<int>(iSampleBlock / nBlocksPerRow);
+                const int iXBlock =
+                    static_cast<int>(iSampleBlock % nBlocksPerRow);
+
+                int nXCheck = 0, nYCheck = 0;
+                GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
+
+                if (poMaskBand &&
+                    poMaskBand->RasterIO(GF_Read, iXBlock * nBlockXSize,
+                                         iYBlock * nBlockYSize, nXCheck,
+                                         nYCheck, pabyMaskData, nXCheck,
+                                         nYCheck, GDT_Byte, 0, nBlockXSize,
+                                         nullptr) != CE_None)
+                {
+                    CPLFree(pabyMaskData);
+                    return CE_Failure;
+                }
+
+                GDALRasterBlock *const poBlock =
+                    GetLockedBlockRef(iXBlock, iYBlock);
+                if (poBlock == nullptr)
+                {
+                    CPLFree(pabyMaskData);
+                    return CE_Failure;
+                }
+
+                AddBlockToStats(oStats, poBlock->GetDataRef(), pabyMaskData,
+                                nXCheck, nYCheck);
+
+                poBlock->DropLock();
+
+                if (!pfnProgress(static_cast<double>(iSampleBlock) /
+                                     (static_cast<double>(nBlocksPerRow) *
+                                      nBlocksPerColumn),
+                                 "Compute Statistics", pProgressData))
+                {
+                    ReportError(CE_Failure, CPLE_UserInterrupt,
+                                "User terminated");
+                    CPLFree(pabyMaskData);
+                    return CE_Failure;
+                }
+            }
+            CPLFree(pabyMaskData);
+
+            MergeStats(oStats);
         }
-        CPLFree(pabyMaskData);
     }
 
     if (!pfnProgress(1.0, "Compute Statistics", pProgressData))
@@ -8203,6 +8740,12 @@ static bool ComputeMinMaxGenericIterBlocks(
  *
  * This method is the same as the C function GDALComputeRasterMinMax().
  *
+ * Starting with GDAL 3.12, the GDAL_NUM_THREADS configuration option can be
+ * set to "ALL_CPUS" or a integer value to specify the number of threads to use
+ * to read and process blocks in parallel, when the dataset is opened in
+ * read-only mode and can be re-opened in worker threads (see
+ * GDALGetThreadSafeDataset()).
+ *
  * @param bApproxOK TRUE if an approximate (faster) answer is OK, otherwise
  * FALSE.
  * @param adfMinMax the array in which the minimum (adfMinMax[0]) and the
@@ -8274,26 +8817,39 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
     GDALRasterIOExtraArg sExtraArg;
     INIT_RASTERIO_EXTRA_ARG(sExtraArg);
 
-    GUInt32 nMin = (eDataType == GDT_Byte)
-                       ? 255
-                       : 65535;  // used for GByte & GUInt16 cases
-    GUInt32 nMax = 0;            // used for GByte & GUInt16 cases
-    GInt16 nMinInt16 =
-        std::numeric_limits<GInt16>::max();  // used for GInt16 case
-    GInt16 nMaxInt16 =
-        std::numeric_limits<GInt16>::lowest();  // used for GInt16 case
-    double dfMin =
-        std::numeric_limits<double>::infinity();  // used for generic code path
-    double dfMax =
-        -std::numeric_limits<double>::infinity();  // used for generic code path
+    struct MinMax
+    {
+        // used for GByte & GUInt16 cases
+        GUInt32 nMin = 0;
+        GUInt32 nMax = 0;
+        // used for GInt16 case
+        GInt16 nMinInt16 = std::numeric_limits<GInt16>::max();
+        GInt16 nMaxInt16 = std::numeric_limits<GInt16>::lowest();
+        // used for generic code path
+        double dfMin = std::numeric_limits<double>::infinity();
+        double dfMax = -std::numeric_limits<double>::infinity();
+
+        void Merge(const MinMax &oOther)
+        {
+            nMin = std::min(nMin, oOther.nMin);
+            nMax = std::max(nMax, oOther.nMax);
+            nMinInt16 = std::min(nMinInt16, oOther.nMinInt16);
+            nMaxInt16 = std::max(nMaxInt16, oOther.nMaxInt16);
+            dfMin = std::min(dfMin, oOther.dfMin);
+            dfMax = std::max(dfMax, oOther.dfMax);
+        }
+    };
+
+    MinMax oMinMax;
+    oMinMax.nMin = (eDataType == GDT_Byte) ? 255 : 65535;
     const bool bUseOptimizedPath =
         !poMaskBand && ((eDataType == GDT_Byte && !bSignedByte) ||
                         eDataType == GDT_Int16 || eDataType == GDT_UInt16);
 
     const auto ComputeMinMaxForBlock =
-        [this, bSignedByte, &sNoDataValues, &nMin, &nMax, &nMinInt16,
-         &nMaxInt16](const void *pData, int nXCheck, int nBufferWidth,
-                     int nYCheck)
+        [this, bSignedByte, &sNoDataValues](MinMax &oState, const void *pData,
+                                            int nXCheck, int nBufferWidth,
+                                            int nYCheck)
     {
         if (eDataType == GDT_Byte && !bSignedByte)
         {
@@ -8310,7 +8866,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                                       /* COMPUTE_OTHER_STATS = */ false>::
                 f(nXCheck, nBufferWidth, nYCheck,
                   static_cast<const GByte *>(pData), bHasNoData, nNoDataValue,
-                  nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+                  oState.nMin, oState.nMax, nSum, nSumSquare, nSampleCount,
+                  nValidCount);
         }
         else if (eDataType == GDT_UInt16)
         {
@@ -8327,7 +8884,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                                       /* COMPUTE_OTHER_STATS = */ false>::
                 f(nXCheck, nBufferWidth, nYCheck,
                   static_cast<const GUInt16 *>(pData), bHasNoData, nNoDataValue,
-                  nMin, nMax, nSum, nSumSquare, nSampleCount, nValidCount);
+                  oState.nMin, oState.nMax, nSum, nSumSquare, nSampleCount,
+                  nValidCount);
         }
         else if (eDataType == GDT_Int16)
         {
@@ -8345,7 +8903,8 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                     ComputeMinMax<int16_t, true>(
                         static_cast<const int16_t *>(pData) +
                             static_cast<size_t>(iY) * nBufferWidth,
-                        nXCheck, nNoDataValue, &nMinInt16, &nMaxInt16);
+                        nXCheck, nNoDataValue, &oState.nMinInt16,
+                        &oState.nMaxInt16);
                 }
             }
             else
@@ -8355,7 +8914,7 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                     ComputeMinMax<int16_t, false>(
                         static_cast<const int16_t *>(pData) +
                             static_cast<size_t>(iY) * nBufferWidth,
-                        nXCheck, 0, &nMinInt16, &nMaxInt16);
+                        nXCheck, 0, &oState.nMinInt16, &oState.nMaxInt16);
                 }
             }
         }
@@ -8421,13 +8980,14 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
 
         if (bUseOptimizedPath)
         {
-            ComputeMinMaxForBlock(pData, nXReduced, nXReduced, nYReduced);
+            ComputeMinMaxForBlock(oMinMax, pData, nXReduced, nXReduced,
+                                  nYReduced);
         }
         else
         {
             ComputeMinMaxGeneric(pData, eDataType, bSignedByte, nXReduced,
                                  nYReduced, nXReduced, sNoDataValues,
-                                 pabyMaskData, dfMin, dfMax);
+                                 pabyMaskData, oMinMax.dfMin, oMinMax.dfMax);
         }
 
         CPLFree(pData);
@@ -8459,7 +9019,41 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                 nSampleRate += 1;
         }
 
-        if (bUseOptimizedPath)
+        GDALRasterBandParallelBlockScanner oScanner(this, nSampleRate);
+        if (oScanner.IsEnabled())
+        {
+            std::vector<MinMax> aoJobMinMax(oScanner.GetJobCount(), oMinMax);
+            const auto ComputeMinMaxForJobBlock =
+                [this, bUseOptimizedPath, bSignedByte, &sNoDataValues,
+                 &aoJobMinMax, &ComputeMinMaxForBlock](
+                    int iJob, const void *pData, const GByte *pabyMaskData,
+                    int nXCheck, int nYCheck)
+            {
+                MinMax &oJobMinMax = aoJobMinMax[iJob];
+                if (bUseOptimizedPath)
+                {
+                    ComputeMinMaxForBlock(oJobMinMax, pData, nXCheck,
+                                          nBlockXSize, nYCheck);
+                }
+                else
+                {
+                    ComputeMinMaxGeneric(pData, eDataType, bSignedByte,
+                                         nXCheck, nYCheck, nBlockXSize,
+                                         sNoDataValues, pabyMaskData,
+                                         oJobMinMax.dfMin, oJobMinMax.dfMax);
+                }
+                return true;
+            };
+            if (!oScanner.Run(poMaskBand != nullptr, "Compute min/max",
+                              GDALDummyProgress, nullptr,
+                              ComputeMinMaxForJobBlock, [](int /* iJob */) {}))
+            {
+                return CE_Failure;
+            }
+            for (const auto &oJobMinMax : aoJobMinMax)
+                oMinMax.Merge(oJobMinMax);
+        }
+        else if (bUseOptimizedPath)
         {
             for (GIntBig iSampleBlock = 0;
                  iSampleBlock <
@@ -8480,12 +9074,13 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                 int nXCheck = 0, nYCheck = 0;
                 GetActualBlockSize(iXBlock, iYBlock, &nXCheck, &nYCheck);
 
-                ComputeMinMaxForBlock(pData, nXCheck, nBlockXSize, nYCheck);
+                ComputeMinMaxForBlock(oMinMax, pData, nXCheck, nBlockXSize,
+                                      nYCheck);
 
                 poBlock->DropLock();
 
-                if (eDataType == GDT_Byte && !bSignedByte && nMin == 0 &&
-                    nMax == 255)
+                if (eDataType == GDT_Byte && !bSignedByte &&
+                    oMinMax.nMin == 0 && oMinMax.nMax == 255)
                     break;
             }
         }
@@ -8495,24 +9090,27 @@ CPLErr GDALRasterBand::ComputeRasterMinMax(int bApproxOK, double *adfMinMax)
                 static_cast<GIntBig>(nBlocksPerRow) * nBlocksPerColumn;
             if (!ComputeMinMaxGenericIterBlocks(
                     this, eDataType, bSignedByte, nTotalBlocks, nSampleRate,
-                    nBlocksPerRow, sNoDataValues, poMaskBand, dfMin, dfMax))
+                    nBlocksPerRow, sNoDataValues, poMaskBand, oMinMax.dfMin,
+                    oMinMax.dfMax))
             {
                 return CE_Failure;
             }
         }
     }
 
+    double dfMin = oMinMax.dfMin;
+    double dfMax = oMinMax.dfMax;
     if (bUseOptimizedPath)
     {
         if ((eDataType == GDT_Byte && !bSignedByte) || eDataType == GDT_UInt16)
         {
-            dfMin = nMin;
-            dfMax = nMax;
+            dfMin = oMinMax.nMin;
+            dfMax = oMinMax.nMax;
         }
         else if (eDataType == GDT_Int16)
         {
-            dfMin = nMinInt16;
-            dfMax = nMaxInt16;
+            dfMin = oMinMax.nMinInt16;
+            dfMax = oMinMax.nMaxInt16;
         }
     }
 
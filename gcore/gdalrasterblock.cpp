@@ -18,7 +18,10 @@
 
 #include <algorithm>
 #include <climits>
+#include <cstdint>
+#include <cstdlib>
 #include <cstring>
+#include <atomic>
 #include <mutex>
 
 #include "cpl_atomic_ops.h"
@@ -30,21 +33,51 @@
 
 // Will later be overridden by the default 5% if GDAL_CACHEMAX not defined.
 static GIntBig nCacheMax = 40 * 1024 * 1024;
-static GIntBig nCacheUsed = 0;
-
-static GDALRasterBlock *poOldest = nullptr;  // Tail.
-static GDALRasterBlock *poNewest = nullptr;  // Head.
+static std::atomic<GIntBig> nCacheUsed{0};
 
 static int nDisableDirtyBlockFlushCounter = 0;
 
-#if 0
-static CPLMutex *hRBLock = nullptr;
-#define INITIALIZE_LOCK CPLMutexHolderD(&hRBLock)
-#define TAKE_LOCK CPLMutexHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyMutex(hRBLock)
-#else
+namespace
+{
+/* -------------------------------------------------------------------- */
+/*      The LRU list of cached blocks is split into several shards,     */
+/*      each one with its own lock, so that threads touching different  */
+/*      blocks do not all serialize on a single mutex. A block belongs  */
+/*      to the shard selected by a hash of its address, which remains   */
+/*      stable during its lifetime, including when it is recycled.      */
+/*      The GDAL_CACHEMAX limit applies to the sum of all shards.       */
+/* -------------------------------------------------------------------- */
+constexpr int RECENT_PROMOTION_SLOTS = 256;
+
+struct alignas(64) GDALRasterBlockCacheShard
+{
+    CPLLock *hLock = nullptr;
+    GDALRasterBlock *poOldest = nullptr;  // Tail.
+    GDALRasterBlock *poNewest = nullptr;  // Head.
+    // Updated under hLock, but also read without it, hence atomic
+    std::atomic<GIntBig> nCacheUsed{0};
+    std::atomic<GIntBig> nBlockCount{0};
+    std::atomic<GUIntBig> nPromotionCounter{0};
+
+    // Value of nPromotionCounter when recently promoted blocks were moved
+    // to the head of the list, in slots selected by a hash of the address of
+    // the block. A block whose slot has been reused by another one is just
+    // considered as not recently promoted.
+    struct RecentPromotion
+    {
+        std::atomic<const GDALRasterBlock *> poBlock{nullptr};
+        std::atomic<GUIntBig> nSerial{0};
+    };
+
+    RecentPromotion asRecentPromotions[RECENT_PROMOTION_SLOTS];
+};
+
+constexpr int MAX_CACHE_SHARDS = 64;
+}  // namespace
+
+static GDALRasterBlockCacheShard aoShards[MAX_CACHE_SHARDS];
+static int nShards = 1;
 
-static CPLLock *hRBLock = nullptr;
 static bool bDebugContention = false;
 static bool bSleepsForBockCacheDebug = false;
 
@@ -75,13 +108,84 @@ static CPLLockType GetLockType()
     return static_cast<CPLLockType>(nLockType);
 }
 
-#define INITIALIZE_LOCK                                                        \
-    CPLLockHolderD(&hRBLock, GetLockType());                                   \
-    CPLLockSetDebugPerf(hRBLock, bDebugContention)
-#define TAKE_LOCK CPLLockHolderOptionalLockD(hRBLock)
-#define DESTROY_LOCK CPLDestroyLock(hRBLock)
+#define INITIALIZE_LOCK(oShard)                                                \
+    CPLLockHolderD(&((oShard).hLock), GetLockType());                          \
+    CPLLockSetDebugPerf((oShard).hLock, bDebugContention)
+#define TAKE_LOCK(oShard) CPLLockHolderOptionalLockD((oShard).hLock)
 
-#endif
+/************************************************************************/
+/*                         GetCacheShardCount()                         */
+/************************************************************************/
+
+static int GetCacheShardCount()
+{
+    const char *pszShards = CPLGetConfigOption("GDAL_RB_CACHE_SHARDS", "AUTO");
+    if (EQUAL(pszShards, "AUTO"))
+    {
+        // Sharding only pays off with many concurrent readers and makes the
+        // LRU order approximate, so keep a single list on small machines.
+        const int nCPUs = CPLGetNumCPUs();
+        return nCPUs >= 4 ? std::min(nCPUs, 16) : 1;
+    }
+    const int nVal = atoi(pszShards);
+    if (nVal < 1 || nVal > MAX_CACHE_SHARDS)
+    {
+        const int nClamped = std::clamp(nVal, 1, MAX_CACHE_SHARDS);
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "GDAL_RB_CACHE_SHARDS=%s is out of range [1, %d]. Using %d",
+                 pszShards, MAX_CACHE_SHARDS, nClamped);
+        return nClamped;
+    }
+    return nVal;
+}
+
+/************************************************************************/
+/*                        InitializeShardLocks()                        */
+/************************************************************************/
+
+static void InitializeShardLocks()
+{
+    for (int i = 0; i < nShards; ++i)
+    {
+        INITIALIZE_LOCK(aoShards[i]);
+    }
+}
+
+/************************************************************************/
+/*                              GetShard()                              */
+/************************************************************************/
+
+static inline GUIntBig HashBlock(const GDALRasterBlock *poBlock)
+{
+    // The lowest bits of heap addresses carry little entropy, hence the
+    // multiplicative hashing.
+    return static_cast<GUIntBig>(reinterpret_cast<uintptr_t>(poBlock) >> 4) *
+           UINT64_C(0x9E3779B97F4A7C15);
+}
+
+static inline GDALRasterBlockCacheShard &
+GetShard(const GDALRasterBlock *poBlock)
+{
+    if (nShards == 1)
+        return aoShards[0];
+    return aoShards[static_cast<int>((HashBlock(poBlock) >> 32) %
+                                     static_cast<GUIntBig>(nShards))];
+}
+
+/************************************************************************/
+/*                         GetRecentPromotion()                         */
+/************************************************************************/
+
+static inline GDALRasterBlockCacheShard::RecentPromotion &
+GetRecentPromotion(GDALRasterBlockCacheShard &oShard,
+                   const GDALRasterBlock *poBlock)
+{
+    // Use the highest bits of the hash, which are not used by GetShard()
+    // for reasonable shard counts.
+    static_assert(RECENT_PROMOTION_SLOTS == 256);
+    const int iSlot = static_cast<int>(HashBlock(poBlock) >> 56);
+    return oShard.asRecentPromotions[iSlot];
+}
 
 // #define ENABLE_DEBUG
 
@@ -219,9 +323,10 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
         flagSetupGDALGetCacheMax64,
         []()
         {
-            {
-                INITIALIZE_LOCK;
-            }
+            nShards = GetCacheShardCount();
+            InitializeShardLocks();
+            if (nShards > 1)
+                CPLDebug("GDAL", "Using %d block cache shards", nShards);
             bSleepsForBockCacheDebug =
                 CPLTestBool(CPLGetConfigOption("GDAL_DEBUG_BLOCK_CACHE", "NO"));
 
@@ -270,14 +375,15 @@ GIntBig CPL_STDCALL GDALGetCacheMax64()
 
 int CPL_STDCALL GDALGetCacheUsed()
 {
-    if (nCacheUsed > INT_MAX)
+    const GIntBig nCurCacheUsed = nCacheUsed.load();
+    if (nCurCacheUsed > INT_MAX)
     {
         CPLErrorOnce(CE_Warning, CPLE_AppDefined,
                      "Cache used value doesn't fit on a 32 bit integer. "
                      "Call GDALGetCacheUsed64() instead");
         return INT_MAX;
     }
-    return static_cast<int>(nCacheUsed);
+    return static_cast<int>(nCurCacheUsed);
 }
 
 /************************************************************************/
@@ -294,7 +400,7 @@ int CPL_STDCALL GDALGetCacheUsed()
 
 GIntBig CPL_STDCALL GDALGetCacheUsed64()
 {
-    return nCacheUsed;
+    return nCacheUsed.load();
 }
 
 /************************************************************************/
@@ -374,11 +480,22 @@ int CPL_STDCALL GDALFlushCacheBlock()
 int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
 
 {
-    GDALRasterBlock *poTarget;
+    // Make sure the shards are initialized.
+    GDALGetCacheMax64();
 
+    // Start from a different shard at each call, so that repeated calls
+    // do not always drain the same one.
+    static std::atomic<unsigned> nNextShard{0};
+    const int iFirstShard =
+        nShards == 1 ? 0 : static_cast<int>(nNextShard++ % nShards);
+
+    GDALRasterBlock *poTarget = nullptr;
+
+    for (int iIter = 0; iIter < nShards && poTarget == nullptr; ++iIter)
     {
-        INITIALIZE_LOCK;
-        poTarget = poOldest;
+        auto &oShard = aoShards[(iFirstShard + iIter) % nShards];
+        INITIALIZE_LOCK(oShard);
+        poTarget = oShard.poOldest;
 
         while (poTarget != nullptr)
         {
@@ -392,7 +509,7 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         }
 
         if (poTarget == nullptr)
-            return FALSE;
+            continue;
 #ifndef __COVERITY__
         // Disabled to avoid complains about sleeping under locks, that
         // are only true for debug/testing code
@@ -409,6 +526,9 @@ int GDALRasterBlock::FlushCacheBlock(int bDirtyBlocksOnly)
         poTarget->GetBand()->UnreferenceBlock(poTarget);
     }
 
+    if (poTarget == nullptr)
+        return FALSE;
+
 #ifndef __COVERITY__
     // Disabled to avoid complains about sleeping under locks, that
     // are only true for debug/testing code
@@ -529,11 +649,11 @@ GDALRasterBlock::GDALRasterBlock(GDALRasterBand *poBandIn, int nXOffIn,
     : eType(poBandIn->GetRasterDataType()), nXOff(nXOffIn), nYOff(nYOffIn),
       poBand(poBandIn), bMustDetach(true)
 {
-    if (!hRBLock)
+    if (!aoShards[0].hLock)
     {
         // Needed for scenarios where GDALAllRegister() is called after
         // GDALDestroyDriverManager()
-        INITIALIZE_LOCK;
+        InitializeShardLocks();
     }
 
     CPLAssert(poBandIn != nullptr);
@@ -648,19 +768,24 @@ void GDALRasterBlock::Detach()
 {
     if (bMustDetach)
     {
-        TAKE_LOCK;
+        TAKE_LOCK(GetShard(this));
         Detach_unlocked();
     }
 }
 
 void GDALRasterBlock::Detach_unlocked()
 {
-    if (poOldest == this)
-        poOldest = poPrevious;
+    auto &oShard = GetShard(this);
+
+    if (oShard.poNewest == this || poPrevious != nullptr)
+        oShard.nBlockCount--;
+
+    if (oShard.poOldest == this)
+        oShard.poOldest = poPrevious;
 
-    if (poNewest == this)
+    if (oShard.poNewest == this)
     {
-        poNewest = poNext;
+        oShard.poNewest = poNext;
     }
 
     if (poPrevious != nullptr)
@@ -673,8 +798,22 @@ void GDALRasterBlock::Detach_unlocked()
     poNext = nullptr;
     bMustDetach = false;
 
+    // So that a block that is no longer in the list, or another block
+    // allocated at the same address, is never considered as recently
+    // promoted by Touch().
+    if (nShards > 1)
+    {
+        auto &oRecent = GetRecentPromotion(oShard, this);
+        if (oRecent.poBlock.load(std::memory_order_relaxed) == this)
+            oRecent.poBlock.store(nullptr, std::memory_order_relaxed);
+    }
+
     if (pData)
-        nCacheUsed -= GetEffectiveBlockSize(GetBlockSize());
+    {
+        const GIntBig nEffectiveSize = GetEffectiveBlockSize(GetBlockSize());
+        nCacheUsed -= nEffectiveSize;
+        oShard.nCacheUsed -= nEffectiveSize;
+    }
 
 #ifdef ENABLE_DEBUG
     Verify();
@@ -694,26 +833,34 @@ void GDALRasterBlock::Detach_unlocked()
 void GDALRasterBlock::Verify()
 
 {
-    TAKE_LOCK;
-
-    CPLAssert((poNewest == nullptr && poOldest == nullptr) ||
-              (poNewest != nullptr && poOldest != nullptr));
-
-    if (poNewest != nullptr)
+    for (int i = 0; i < nShards; ++i)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        CPLAssert(poOldest->poNext == nullptr);
+        auto &oShard = aoShards[i];
+        TAKE_LOCK(oShard);
+
+        CPLAssert((oShard.poNewest == nullptr && oShard.poOldest == nullptr) ||
+                  (oShard.poNewest != nullptr && oShard.poOldest != nullptr));
 
-        GDALRasterBlock *poLast = nullptr;
-        for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-             poBlock = poBlock->poNext)
+        if (oShard.poNewest != nullptr)
         {
-            CPLAssert(poBlock->poPrevious == poLast);
+            CPLAssert(oShard.poNewest->poPrevious == nullptr);
+            CPLAssert(oShard.poOldest->poNext == nullptr);
 
-            poLast = poBlock;
-        }
+            GDALRasterBlock *poLast = nullptr;
+            GIntBig nCount = 0;
+            for (GDALRasterBlock *poBlock = oShard.poNewest; poBlock != nullptr;
+                 poBlock = poBlock->poNext)
+            {
+                CPLAssert(poBlock->poPrevious == poLast);
+                CPLAssert(&GetShard(poBlock) == &oShard);
 
-        CPLAssert(poOldest == poLast);
+                poLast = poBlock;
+                ++nCount;
+            }
+
+            CPLAssert(oShard.poOldest == poLast);
+            CPLAssert(oShard.nBlockCount == nCount);
+        }
     }
 }
 
@@ -726,24 +873,27 @@ void GDALRasterBlock::Verify()
 #ifdef notdef
 void GDALRasterBlock::CheckNonOrphanedBlocks(GDALRasterBand *poBand)
 {
-    TAKE_LOCK;
-    for (GDALRasterBlock *poBlock = poNewest; poBlock != nullptr;
-         poBlock = poBlock->poNext)
+    for (int i = 0; i < nShards; ++i)
     {
-        if (poBlock->GetBand() == poBand)
+        TAKE_LOCK(aoShards[i]);
+        for (GDALRasterBlock *poBlock = aoShards[i].poNewest;
+             poBlock != nullptr; poBlock = poBlock->poNext)
         {
-            printf("Cache has still blocks of band %p\n", poBand); /*ok*/
-            printf("Band : %d\n", poBand->GetBand());              /*ok*/
-            printf("nRasterXSize = %d\n", poBand->GetXSize());     /*ok*/
-            printf("nRasterYSize = %d\n", poBand->GetYSize());     /*ok*/
-            int nBlockXSize, nBlockYSize;
-            poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
-            printf("nBlockXSize = %d\n", nBlockXSize);      /*ok*/
-            printf("nBlockYSize = %d\n", nBlockYSize);      /*ok*/
-            printf("Dataset : %p\n", poBand->GetDataset()); /*ok*/
-            if (poBand->GetDataset())
-                printf("Dataset : %s\n", /*ok*/
-                       poBand->GetDataset()->GetDescription());
+            if (poBlock->GetBand() == poBand)
+            {
+                printf("Cache has still blocks of band %p\n", poBand); /*ok*/
+                printf("Band : %d\n", poBand->GetBand());              /*ok*/
+                printf("nRasterXSize = %d\n", poBand->GetXSize());     /*ok*/
+                printf("nRasterYSize = %d\n", poBand->GetYSize());     /*ok*/
+                int nBlockXSize, nBlockYSize;
+                poBand->GetBlockSize(&nBlockXSize, &nBlockYSize);
+                printf("nBlockXSize = %d\n", nBlockXSize);      /*ok*/
+                printf("nBlockYSize = %d\n", nBlockYSize);      /*ok*/
+                printf("Dataset : %p\n", poBand->GetDataset()); /*ok*/
+                if (poBand->GetDataset())
+                    printf("Dataset : %s\n", /*ok*/
+                           poBand->GetDataset()->GetDescription());
+            }
         }
     }
 }
@@ -800,32 +950,60 @@ CPLErr GDALRasterBlock::Write()
 void GDALRasterBlock::Touch()
 
 {
+    auto &oShard = GetShard(this);
+
     // Can be safely tested outside the lock
-    if (poNewest == this)
+    if (oShard.poNewest == this)
         return;
 
-    TAKE_LOCK;
+    // When the cache is sharded, which is done when it is accessed by many
+    // threads, do not bother promoting a block that is still in the most
+    // recently promoted quarter of its shard. This avoids taking the lock
+    // each time a hot block is accessed, at the expense of a slightly
+    // approximate LRU order.
+    if (nShards > 1)
+    {
+        const auto &oRecent = GetRecentPromotion(oShard, this);
+        if (oRecent.poBlock.load(std::memory_order_relaxed) == this &&
+            oShard.nPromotionCounter.load(std::memory_order_relaxed) -
+                    oRecent.nSerial.load(std::memory_order_relaxed) <
+                static_cast<GUIntBig>(
+                    oShard.nBlockCount.load(std::memory_order_relaxed) / 4))
+        {
+            return;
+        }
+    }
+
+    TAKE_LOCK(oShard);
     Touch_unlocked();
 }
 
 void GDALRasterBlock::Touch_unlocked()
 
 {
+    auto &oShard = GetShard(this);
+
     // Could happen even if tested in Touch() before taking the lock
     // Scenario would be :
     // 0. this is the second block (the one pointed by poNewest->poNext)
     // 1. Thread 1 calls Touch() and poNewest != this at that point
     // 2. Thread 2 detaches poNewest
     // 3. Thread 1 arrives here
-    if (poNewest == this)
+    if (oShard.poNewest == this)
         return;
 
     // We should not try to touch a block that has been detached.
     // If that happen, corruption has already occurred.
     CPLAssert(bMustDetach);
 
-    if (poOldest == this)
-        poOldest = this->poPrevious;
+    if (poPrevious == nullptr)
+    {
+        // Not the head, and no predecessor: not yet in the list.
+        oShard.nBlockCount++;
+    }
+
+    if (oShard.poOldest == this)
+        oShard.poOldest = this->poPrevious;
 
     if (poPrevious != nullptr)
         poPrevious->poNext = poNext;
@@ -834,19 +1012,27 @@ void GDALRasterBlock::Touch_unlocked()
         poNext->poPrevious = poPrevious;
 
     poPrevious = nullptr;
-    poNext = poNewest;
+    poNext = oShard.poNewest;
 
-    if (poNewest != nullptr)
+    if (oShard.poNewest != nullptr)
     {
-        CPLAssert(poNewest->poPrevious == nullptr);
-        poNewest->poPrevious = this;
+        CPLAssert(oShard.poNewest->poPrevious == nullptr);
+        oShard.poNewest->poPrevious = this;
     }
-    poNewest = this;
+    oShard.poNewest = this;
 
-    if (poOldest == nullptr)
+    if (oShard.poOldest == nullptr)
     {
         CPLAssert(poPrevious == nullptr && poNext == nullptr);
-        poOldest = this;
+        oShard.poOldest = this;
+    }
+
+    const GUIntBig nSerial = ++oShard.nPromotionCounter;
+    if (nShards > 1)
+    {
+        auto &oRecent = GetRecentPromotion(oShard, this);
+        oRecent.nSerial.store(nSerial, std::memory_order_relaxed);
+        oRecent.poBlock.store(this, std::memory_order_relaxed);
     }
 #ifdef ENABLE_DEBUG
     Verify();
@@ -875,15 +1061,21 @@ CPLErr GDALRasterBlock::Internalize()
 
     void *pNewData = nullptr;
 
-    // This call will initialize the hRBLock mutex. Other call places can
+    // This call will initialize the shard locks. Other call places can
     // only be called if we have go through there.
     const GIntBig nCurCacheMax = GDALGetCacheMax64();
 
     // No risk of overflow as it is checked in GDALRasterBand::InitBlockInfo().
     const auto nSizeInBytes = GetBlockSize();
+    const GIntBig nEffectiveSize = GetEffectiveBlockSize(nSizeInBytes);
+
+    auto &oThisShard = GetShard(this);
+    const int iThisShard = static_cast<int>(&oThisShard - aoShards);
 
     /* -------------------------------------------------------------------- */
     /*      Flush old blocks if we are nearing our memory limit.            */
+    /*      We start with the shard of this block, and go on with the       */
+    /*      other ones until the global limit is respected.                 */
     /* -------------------------------------------------------------------- */
     bool bFirstIter = true;
     bool bLoopAgain = false;
@@ -893,12 +1085,24 @@ CPLErr GDALRasterBlock::Internalize()
         bLoopAgain = false;
         GDALRasterBlock *apoBlocksToFree[64] = {nullptr};
         int nBlocksToFree = 0;
+        bool bStopEviction = false;
+
+        if (bFirstIter)
+            nCacheUsed += nEffectiveSize;
+
+        for (int iIter = 0;
+             iIter < nShards && !bStopEviction && nCacheUsed > nCurCacheMax;
+             ++iIter)
         {
-            TAKE_LOCK;
+            auto &oShard = aoShards[(iThisShard + iIter) % nShards];
+            // Can be safely tested outside the lock: at worst, we skip a
+            // shard that has just received a block.
+            if (oShard.nCacheUsed.load(std::memory_order_relaxed) == 0)
+                continue;
+
+            TAKE_LOCK(oShard);
 
-            if (bFirstIter)
-                nCacheUsed += GetEffectiveBlockSize(nSizeInBytes);
-            GDALRasterBlock *poTarget = poOldest;
+            GDALRasterBlock *poTarget = oShard.poOldest;
             while (nCacheUsed > nCurCacheMax)
             {
                 GDALRasterBlock *poDirtyBlockOtherDataset = nullptr;
@@ -945,7 +1149,7 @@ CPLErr GDALRasterBlock::Internalize()
                     }
                     else
                     {
-                        poTarget = poOldest;
+                        poTarget = oShard.poOldest;
                         while (poTarget != nullptr)
                         {
                             if (CPLAtomicCompareAndExchange(
@@ -987,11 +1191,13 @@ CPLErr GDALRasterBlock::Internalize()
                         // other dirty blocks of other bands with the same
                         // coordinates can be found with TryGetLockedBlock()
                         bLoopAgain = nCacheUsed > nCurCacheMax;
+                        bStopEviction = true;
                         break;
                     }
                     if (nBlocksToFree == 64)
                     {
                         bLoopAgain = (nCacheUsed > nCurCacheMax);
+                        bStopEviction = true;
                         break;
                     }
 
@@ -1002,14 +1208,18 @@ CPLErr GDALRasterBlock::Internalize()
                     break;
                 }
             }
+        }
 
-            /* ------------------------------------------------------------------
-             */
-            /*      Add this block to the list. */
-            /* ------------------------------------------------------------------
-             */
-            if (!bLoopAgain)
-                Touch_unlocked();
+        /* ------------------------------------------------------------------
+         */
+        /*      Add this block to the list. */
+        /* ------------------------------------------------------------------
+         */
+        if (!bLoopAgain)
+        {
+            TAKE_LOCK(oThisShard);
+            oThisShard.nCacheUsed += nEffectiveSize;
+            Touch_unlocked();
         }
 
         bFirstIter = false;
@@ -1120,9 +1330,12 @@ void GDALRasterBlock::MarkClean()
 /*! @cond Doxygen_Suppress */
 void GDALRasterBlock::DestroyRBMutex()
 {
-    if (hRBLock != nullptr)
-        DESTROY_LOCK;
-    hRBLock = nullptr;
+    for (auto &oShard : aoShards)
+    {
+        if (oShard.hLock != nullptr)
+            CPLDestroyLock(oShard.hLock);
+        oShard.hLock = nullptr;
+    }
 }
 
 /*! @endcond */
@@ -1205,7 +1418,7 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 #endif
 
     // Wait for the block for having been unreferenced.
-    TAKE_LOCK;
+    TAKE_LOCK(GetShard(this));
 
     return FALSE;
 }
@@ -1214,14 +1427,17 @@ int GDALRasterBlock::DropLockForRemovalFromStorage()
 void GDALRasterBlock::DumpAll()
 {
     int iBlock = 0;
-    for( GDALRasterBlock *poBlock = poNewest;
-         poBlock != nullptr;
-         poBlock = poBlock->poNext )
+    for( int i = 0; i < nShards; ++i )
     {
-        printf("Block %d\n", iBlock);/*ok*/
-        poBlock->DumpBlock();
-        printf("\n");/*ok*/
-        iBlock++;
+        for( GDALRasterBlock *poBlock = aoShards[i].poNewest;
+             poBlock != nullptr;
+             poBlock = poBlock->poNext )
+        {
+            printf("Block %d\n", iBlock);/*ok*/
+            poBlock->DumpBlock();
+            printf("\n");/*ok*/
+            iBlock++;
+        }
     }
 }
 
@@ -191,6 +191,13 @@ RawRasterBand::RawRasterBand(VSILFILE *fpRawLIn, vsi_l_offset nImgOffsetIn,
 void RawRasterBand::Initialize()
 
 {
+    const char *pszVirtualMemIO =
+        CPLGetConfigOption("RAW_VIRTUAL_MEM_IO", "NO");
+    if (EQUAL(pszVirtualMemIO, "IF_ENOUGH_RAM"))
+        m_eVirtualMemIOUsage = VirtualMemIOEnum::IF_ENOUGH_RAM;
+    else if (CPLTestBool(pszVirtualMemIO))
+        m_eVirtualMemIOUsage = VirtualMemIOEnum::YES;
+
     vsi_l_offset nSmallestOffset = nImgOffset;
     vsi_l_offset nLargestOffset = nImgOffset;
     if (nLineOffset < 0)
@@ -320,6 +327,9 @@ RawRasterBand::~RawRasterBand()
 
     RawRasterBand::FlushCache(true);
 
+    if (m_psVirtualMemIOMapping)
+        CPLVirtualMemFree(m_psVirtualMemIOMapping);
+
     if (bOwnsFP)
     {
         if (VSIFCloseL(fpRawL) != 0)
@@ -1047,6 +1057,202 @@ int RawRasterBand::CanUseDirectIO(int /* nXOff */, int nYOff, int nXSize,
     return result;
 }
 
+/************************************************************************/
+/*                         CanUseVirtualMemIO()                         */
+/************************************************************************/
+
+// Cheap check of whether VirtualMemIO() could handle a request. The actual
+// mapping of the file is only attempted by VirtualMemIO().
+bool RawRasterBand::CanUseVirtualMemIO(
+    GDALRWFlag eRWFlag, int nXSize, int nYSize, int nBufXSize, int nBufYSize,
+    const GDALRasterIOExtraArg *psExtraArg)
+{
+    // Only know how to deal with nearest neighbour in this optimized routine.
+    // And do not interfere with the use of overviews when subsampling.
+    return m_eVirtualMemIOUsage != VirtualMemIOEnum::NO &&
+           eRWFlag == GF_Read && eAccess == GA_ReadOnly &&
+           ((nXSize == nBufXSize && nYSize == nBufYSize) ||
+            (psExtraArg->eResampleAlg == GRIORA_NearestNeighbour &&
+             GetOverviewCount() == 0));
+}
+
+/************************************************************************/
+/*                           VirtualMemIO()                             */
+/************************************************************************/
+
+// Read a window directly from a read-only memory mapping of the file,
+// bypassing the block cache.
+// Returns -1 if the request cannot be handled by this method, or a CPLErr
+// value otherwise.
+int RawRasterBand::VirtualMemIO(int nXOff, int nYOff, int nXSize, int nYSize,
+                                void *pData, int nBufXSize, int nBufYSize,
+                                GDALDataType eBufType, GSpacing nPixelSpace,
+                                GSpacing nLineSpace,
+                                GDALRasterIOExtraArg *psExtraArg)
+{
+    if (m_psVirtualMemIOMapping == nullptr)
+    {
+        if (!CPLIsVirtualMemFileMapAvailable() ||
+            VSIFGetNativeFileDescriptorL(fpRawL) == nullptr)
+        {
+            m_eVirtualMemIOUsage = VirtualMemIOEnum::NO;
+            return -1;
+        }
+        // Map the whole file, to share the same logic whatever the
+        // sign of nPixelOffset and nLineOffset.
+        const vsi_l_offset nCurPos = VSIFTellL(fpRawL);
+        if (VSIFSeekL(fpRawL, 0, SEEK_END) != 0)
+        {
+            m_eVirtualMemIOUsage = VirtualMemIOEnum::NO;
+            return -1;
+        }
+        const vsi_l_offset nLength = VSIFTellL(fpRawL);
+        CPL_IGNORE_RET_VAL(VSIFSeekL(fpRawL, nCurPos, SEEK_SET));
+        if (nLength == 0 || static_cast<size_t>(nLength) != nLength)
+        {
+            m_eVirtualMemIOUsage = VirtualMemIOEnum::NO;
+            return -1;
+        }
+        if (m_eVirtualMemIOUsage == VirtualMemIOEnum::IF_ENOUGH_RAM)
+        {
+            const GIntBig nRAM = CPLGetUsablePhysicalRAM();
+            if (static_cast<GIntBig>(nLength) > nRAM)
+            {
+                CPLDebug("RAW",
+                         "Not enough RAM to map whole file into memory.");
+                m_eVirtualMemIOUsage = VirtualMemIOEnum::NO;
+                return -1;
+            }
+        }
+        m_psVirtualMemIOMapping = CPLVirtualMemFileMapNew(
+            fpRawL, 0, nLength, VIRTUALMEM_READONLY, nullptr, nullptr);
+        if (m_psVirtualMemIOMapping == nullptr)
+        {
+            m_eVirtualMemIOUsage = VirtualMemIOEnum::NO;
+            return -1;
+        }
+    }
+
+    const GByte *pabyMapping = static_cast<const GByte *>(
+        CPLVirtualMemGetAddr(m_psVirtualMemIOMapping));
+    const GIntBig nMappingSize =
+        static_cast<GIntBig>(CPLVirtualMemGetSize(m_psVirtualMemIOMapping));
+    const int nDTSize = GDALGetDataTypeSizeBytes(eDataType);
+
+    // Check that all pixels of the window are within the mapping: as a
+    // truncated file would cause a SIGBUS, and not a read error.
+    const auto GetOffset = [this](int iX, int iY)
+    {
+        return static_cast<GIntBig>(nImgOffset) +
+               static_cast<GIntBig>(iY) * nLineOffset +
+               static_cast<GIntBig>(iX) * nPixelOffset;
+    };
+    const GIntBig anCornerOffsets[] = {
+        GetOffset(nXOff, nYOff), GetOffset(nXOff + nXSize - 1, nYOff),
+        GetOffset(nXOff, nYOff + nYSize - 1),
+        GetOffset(nXOff + nXSize - 1, nYOff + nYSize - 1)};
+    if (*std::min_element(std::begin(anCornerOffsets),
+                          std::end(anCornerOffsets)) < 0 ||
+        *std::max_element(std::begin(anCornerOffsets),
+                          std::end(anCornerOffsets)) >
+            nMappingSize - nDTSize)
+    {
+        // Let the regular code path report the error
+        return -1;
+    }
+
+#ifdef DEBUG
+    CPLDebug("RAW", "Using VirtualMemIO");
+#endif
+
+    // In case of byte swapping, pixels are first gathered and swapped in a
+    // temporary buffer.
+    const bool bNeedsByteOrderChange = NeedsByteOrderChange();
+    std::vector<GByte> abyTmp;
+    if (bNeedsByteOrderChange)
+    {
+        try
+        {
+            abyTmp.resize(static_cast<size_t>(nBufXSize) * nDTSize);
+        }
+        catch (const std::exception &)
+        {
+            CPLError(CE_Failure, CPLE_OutOfMemory,
+                     "Cannot allocate temporary buffer");
+            return CE_Failure;
+        }
+    }
+
+    // Needed for ICC fast math approximations
+    constexpr double EPS = 1e-10;
+    const double dfSrcXInc = static_cast<double>(nXSize) / nBufXSize;
+    const double dfSrcYInc = static_cast<double>(nYSize) / nBufYSize;
+    const bool bSameXSize = nXSize == nBufXSize;
+
+    for (int iLine = 0; iLine < nBufYSize; iLine++)
+    {
+        const int iSrcLine =
+            nYOff + static_cast<int>(iLine * dfSrcYInc + EPS);
+        const GByte *pabySrcLine =
+            pabyMapping + GetOffset(nXOff, iSrcLine);
+        GByte *pabyDstLine = static_cast<GByte *>(pData) + iLine * nLineSpace;
+
+        const GByte *pabySrc = pabySrcLine;
+        int nSrcPixelSpace = nPixelOffset;
+        if (bNeedsByteOrderChange)
+        {
+            if (bSameXSize)
+            {
+                GDALCopyWords64(pabySrcLine, eDataType, nPixelOffset,
+                                abyTmp.data(), eDataType, nDTSize, nXSize);
+            }
+            else
+            {
+                for (int iPixel = 0; iPixel < nBufXSize; iPixel++)
+                {
+                    memcpy(abyTmp.data() + static_cast<size_t>(iPixel) *
+                                               nDTSize,
+                           pabySrcLine + static_cast<GPtrDiff_t>(
+                                             iPixel * dfSrcXInc + EPS) *
+                                             nPixelOffset,
+                           nDTSize);
+                }
+            }
+            DoByteSwap(abyTmp.data(), nBufXSize, nDTSize, true);
+            pabySrc = abyTmp.data();
+            nSrcPixelSpace = nDTSize;
+        }
+
+        if (bSameXSize || bNeedsByteOrderChange)
+        {
+            GDALCopyWords64(pabySrc, eDataType, nSrcPixelSpace, pabyDstLine,
+                            eBufType, static_cast<int>(nPixelSpace),
+                            nBufXSize);
+        }
+        else
+        {
+            for (int iPixel = 0; iPixel < nBufXSize; iPixel++)
+            {
+                GDALCopyWords64(
+                    pabySrc +
+                        static_cast<GPtrDiff_t>(iPixel * dfSrcXInc + EPS) *
+                            nPixelOffset,
+                    eDataType, nPixelOffset, pabyDstLine + iPixel * nPixelSpace,
+                    eBufType, static_cast<int>(nPixelSpace), 1);
+            }
+        }
+
+        if (psExtraArg->pfnProgress != nullptr &&
+            !psExtraArg->pfnProgress(1.0 * (iLine + 1) / nBufYSize, "",
+                                     psExtraArg->pProgressData))
+        {
+            return CE_Failure;
+        }
+    }
+
+    return CE_None;
+}
+
 /************************************************************************/
 /*                             IRasterIO()                              */
 /************************************************************************/
@@ -1068,6 +1274,17 @@ CPLErr RawRasterBand::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
 #endif
     const int nBufDataSize = GDALGetDataTypeSizeBytes(eBufType);
 
+    if (CanUseVirtualMemIO(eRWFlag, nXSize, nYSize, nBufXSize, nBufYSize,
+                           psExtraArg))
+    {
+        const int nErr =
+            VirtualMemIO(nXOff, nYOff, nXSize, nYSize, pData, nBufXSize,
+                         nBufYSize, eBufType, nPixelSpace, nLineSpace,
+                         psExtraArg);
+        if (nErr >= 0)
+            return static_cast<CPLErr>(nErr);
+    }
+
     if (!CanUseDirectIO(nXOff, nYOff, nXSize, nYSize, eBufType, psExtraArg))
     {
         return GDALRasterBand::IRasterIO(eRWFlag, nXOff, nYOff, nXSize, nYSize,
@@ -1612,7 +1829,10 @@ CPLErr RawDataset::IRasterIO(GDALRWFlag eRWFlag, int nXOff, int nYOff,
                 break;
             }
             else if (!poBand->CanUseDirectIO(nXOff, nYOff, nXSize, nYSize,
-                                             eBufType, psExtraArg))
+                                             eBufType, psExtraArg) &&
+                     !poBand->CanUseVirtualMemIO(eRWFlag, nXSize, nYSize,
+                                                 nBufXSize, nBufYSize,
+                                                 psExtraArg))
             {
                 bCanUseDirectIO = false;
                 if (!bCanDirectAccessToBIPDataset)
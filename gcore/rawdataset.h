@@ -239,6 +239,24 @@ class CPL_DLL RawRasterBand : public GDALPamRasterBand
   private:
     CPL_DISALLOW_COPY_ASSIGN(RawRasterBand)
 
+    enum class VirtualMemIOEnum
+    {
+        NO,
+        YES,
+        IF_ENOUGH_RAM
+    };
+
+    VirtualMemIOEnum m_eVirtualMemIOUsage = VirtualMemIOEnum::NO;
+    CPLVirtualMem *m_psVirtualMemIOMapping = nullptr;
+
+    bool CanUseVirtualMemIO(GDALRWFlag eRWFlag, int nXSize, int nYSize,
+                            int nBufXSize, int nBufYSize,
+                            const GDALRasterIOExtraArg *psExtraArg);
+    int VirtualMemIO(int nXOff, int nYOff, int nXSize, int nYSize, void *pData,
+                     int nBufXSize, int nBufYSize, GDALDataType eBufType,
+                     GSpacing nPixelSpace, GSpacing nLineSpace,
+                     GDALRasterIOExtraArg *psExtraArg);
+
     bool NeedsByteOrderChange() const;
     void DoByteSwap(void *pBuffer, size_t nValues, int nByteSkip,
                     bool bDiskToCPU) const;
@@ -1969,6 +1969,7 @@ class OGRLayer;
 class swq_expr_node;
 class swq_custom_func_registrar;
 struct swq_evaluation_context;
+class swq_program;
 
 class CPL_DLL OGRFeatureQuery
 {
@@ -1976,6 +1977,7 @@ class CPL_DLL OGRFeatureQuery
     const OGRFeatureDefn *poTargetDefn;
     void *pSWQExpr;
     swq_evaluation_context *m_psContext = nullptr;
+    std::unique_ptr<swq_program> m_poProgram{};
 
     char **FieldCollector(void *, char **);
 
@@ -2010,6 +2012,13 @@ class CPL_DLL OGRFeatureQuery
     {
         return pSWQExpr;
     }
+
+    /** Return the compiled form of the expression, or nullptr if it could
+     * not be compiled. */
+    const swq_program *GetCompiledProgram() const
+    {
+        return m_poProgram.get();
+    }
 };
 
 //! @endcond
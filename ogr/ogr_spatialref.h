@@ -1010,6 +1010,7 @@ struct CPL_DLL OGRCoordinateTransformationOptions
     bool SetDesiredAccuracy(double dfAccuracy);
     bool SetBallparkAllowed(bool bAllowBallpark);
     bool SetOnlyBest(bool bOnlyBest);
+    bool SetNumThreads(int nNumThreads);
 
     bool SetCoordinateOperation(const char *pszCT, bool bReverseCT);
     /*! @cond Doxygen_Suppress */
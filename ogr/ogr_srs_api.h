@@ -1023,6 +1023,9 @@ int CPL_DLL OCTCoordinateTransformationOptionsSetBallparkAllowed(
 int CPL_DLL OCTCoordinateTransformationOptionsSetOnlyBest(
     OGRCoordinateTransformationOptionsH hOptions, bool bOnlyBest);
 
+int CPL_DLL OCTCoordinateTransformationOptionsSetNumThreads(
+    OGRCoordinateTransformationOptionsH hOptions, int nNumThreads);
+
 void CPL_DLL OCTDestroyCoordinateTransformationOptions(
     OGRCoordinateTransformationOptionsH);
 
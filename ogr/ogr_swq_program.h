@@ -0,0 +1,181 @@
+/******************************************************************************
+ *
+ * Project:  OpenGIS Simple Features Reference Implementation
+ * Purpose:  Flat, allocation-free form of simple SQL WHERE expressions.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#ifndef OGR_SWQ_PROGRAM_H_INCLUDED
+#define OGR_SWQ_PROGRAM_H_INCLUDED
+
+#ifndef DOXYGEN_SKIP
+
+#include "cpl_port.h"
+#include "ogr_swq.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+class OGRFeature;
+class OGRFeatureDefn;
+
+/** Type of the values compared by a swq_instruction. */
+enum class swq_program_value_type
+{
+    INTEGER,
+    FLOAT,
+    STRING
+};
+
+/** Instruction of a swq_program.
+ *
+ * SWQ_AND, SWQ_OR and SWQ_NOT combine the results of the previous
+ * instructions. Other operators test the value of a column against
+ * constants, and push their result.
+ */
+struct swq_instruction
+{
+    swq_op eOp = SWQ_AND;
+
+    /** Index of the tested field in the feature definition, or index of the
+     * FID special field. -1 for SWQ_AND, SWQ_OR and SWQ_NOT. */
+    int iField = -1;
+
+    /** Type of the tested field. */
+    swq_field_type eFieldType = SWQ_INTEGER;
+
+    /** Type in which comparisons are done. */
+    swq_program_value_type eValueType = swq_program_value_type::INTEGER;
+
+    /** Constants, in the order of the operator arguments. Only the vector
+     * corresponding to eValueType is used. */
+    std::vector<int64_t> anValues{};
+    std::vector<double> adfValues{};
+    std::vector<std::string> aosValues{};
+
+    /** Only used for SWQ_LIKE and SWQ_ILIKE. */
+    char chEscape = '\0';
+    bool bInsensitive = false;
+    bool bUTF8Strings = false;
+
+    inline bool TestInteger(int64_t nValue) const;
+    inline bool TestFloat(double dfValue) const;
+    bool TestString(const char *pszValue) const;
+};
+
+/** Compiled form of a WHERE expression, made of a sequence of instructions in
+ * postfix order.
+ *
+ * Only a subset of expressions can be compiled: logical combinations of
+ * comparisons of a column with constants. The result of evaluation is the same
+ * as the one of swq_expr_node::Evaluate(), including the handling of NULL
+ * values.
+ */
+class swq_program
+{
+  public:
+    /** Maximum number of intermediate results. Matches the maximum recursion
+     * level of swq_expr_node::Evaluate(). */
+    static constexpr int MAX_STACK_DEPTH = 32;
+
+    swq_program() = default;
+
+    static std::unique_ptr<swq_program> Compile(const swq_expr_node *poExpr,
+                                                const OGRFeatureDefn *poDefn,
+                                                bool bUTF8Strings);
+
+    bool Evaluate(const OGRFeature *poFeature) const;
+
+    const std::vector<swq_instruction> &GetInstructions() const
+    {
+        return m_aoInstructions;
+    }
+
+  private:
+    std::vector<swq_instruction> m_aoInstructions{};
+
+    bool CompileNode(const swq_expr_node *poNode, const OGRFeatureDefn *poDefn,
+                     bool bUTF8Strings, int nLevel, int &nDepth);
+
+    CPL_DISALLOW_COPY_ASSIGN(swq_program)
+};
+
+/************************************************************************/
+/*                  swq_instruction::TestInteger()                      */
+/************************************************************************/
+
+inline bool swq_instruction::TestInteger(int64_t nValue) const
+{
+    switch (eOp)
+    {
+        case SWQ_EQ:
+            return nValue == anValues[0];
+        case SWQ_NE:
+            return nValue != anValues[0];
+        case SWQ_LT:
+            return nValue < anValues[0];
+        case SWQ_LE:
+            return nValue <= anValues[0];
+        case SWQ_GT:
+            return nValue > anValues[0];
+        case SWQ_GE:
+            return nValue >= anValues[0];
+        case SWQ_BETWEEN:
+            return nValue >= anValues[0] && nValue <= anValues[1];
+        case SWQ_IN:
+            for (const int64_t nOther : anValues)
+            {
+                if (nValue == nOther)
+                    return true;
+            }
+            return false;
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                   swq_instruction::TestFloat()                       */
+/************************************************************************/
+
+inline bool swq_instruction::TestFloat(double dfValue) const
+{
+    switch (eOp)
+    {
+        case SWQ_EQ:
+            return dfValue == adfValues[0];
+        case SWQ_NE:
+            return dfValue != adfValues[0];
+        case SWQ_LT:
+            return dfValue < adfValues[0];
+        case SWQ_LE:
+            return dfValue <= adfValues[0];
+        case SWQ_GT:
+            return dfValue > adfValues[0];
+        case SWQ_GE:
+            return dfValue >= adfValues[0];
+        case SWQ_BETWEEN:
+            return dfValue >= adfValues[0] && dfValue <= adfValues[1];
+        case SWQ_IN:
+            for (const double dfOther : adfValues)
+            {
+                if (dfValue == dfOther)
+                    return true;
+            }
+            return false;
+        default:
+            break;
+    }
+    return false;
+}
+
+#endif /* #ifndef DOXYGEN_SKIP */
+
+#endif /* OGR_SWQ_PROGRAM_H_INCLUDED */
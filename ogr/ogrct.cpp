@@ -21,11 +21,15 @@
 #include <limits>
 #include <list>
 #include <mutex>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_mem_cache.h"
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
 #include "ogr_core.h"
 #include "ogr_srs_api.h"
 #include "ogr_proj_p.h"
@@ -106,6 +110,8 @@ struct OGRCoordinateTransformationOptions::Private
 
     bool bCheckWithInvertProj = false;
 
+    int nNumThreads = 1;
+
     Private();
     Private(const Private &) = default;
     Private(Private &&) = default;
@@ -123,6 +129,11 @@ struct OGRCoordinateTransformationOptions::Private
 OGRCoordinateTransformationOptions::Private::Private()
 {
     RefreshCheckWithInvertProj();
+
+    const char *pszNumThreads = CPLGetConfigOption("OGR_CT_NUM_THREADS", "1");
+    nNumThreads = EQUAL(pszNumThreads, "ALL_CPUS")
+                      ? CPLGetNumCPUs()
+                      : std::max(1, std::min(atoi(pszNumThreads), 1024));
 }
 
 /************************************************************************/
@@ -148,6 +159,7 @@ std::string OGRCoordinateTransformationOptions::Private::GetKey() const
     ret += std::to_string(static_cast<int>(bHasTargetCenterLong));
     ret += std::to_string(dfTargetCenterLong);
     ret += std::to_string(static_cast<int>(bCheckWithInvertProj));
+    ret += std::to_string(nNumThreads);
     return ret;
 }
 
@@ -657,6 +669,52 @@ int OCTCoordinateTransformationOptionsSetOnlyBest(
     return hOptions->SetOnlyBest(bOnlyBest);
 }
 
+/************************************************************************/
+/*                           SetNumThreads()                            */
+/************************************************************************/
+
+/** \brief Sets the maximum number of threads used by Transform().
+ *
+ * When transforming large arrays of coordinates with PROJ, Transform() and
+ * TransformWithErrorCodes() can split them across several threads of the
+ * GDAL global thread pool, each one using its own copy of the PROJ
+ * coordinate operation. Results are the same as with a single thread.
+ *
+ * Arrays whose size is less than a few tens of thousands of points are
+ * always transformed by the calling thread, and multi-threading is disabled
+ * while OGRProjCTDifferentOperationsStart() is in effect.
+ *
+ * The default value is set from the OGR_CT_NUM_THREADS configuration
+ * option (an integer value or ALL_CPUS, defaults to 1) when the options
+ * object is created.
+ *
+ * @param nNumThreads maximum number of threads (1 to disable multi-threading)
+ *
+ * @since GDAL 3.12
+ */
+bool OGRCoordinateTransformationOptions::SetNumThreads(int nNumThreads)
+{
+    d->nNumThreads = std::max(1, std::min(nNumThreads, 1024));
+    return true;
+}
+
+/************************************************************************/
+/*          OCTCoordinateTransformationOptionsSetNumThreads()           */
+/************************************************************************/
+
+/** \brief Sets the maximum number of threads used by Transform().
+ *
+ * See OGRCoordinateTransformationOptions::SetNumThreads()
+ *
+ * @since GDAL 3.12
+ */
+int OCTCoordinateTransformationOptionsSetNumThreads(
+    OGRCoordinateTransformationOptionsH hOptions, int nNumThreads)
+{
+    // cppcheck-suppress knownConditionTrueFalse
+    return hOptions->SetNumThreads(nNumThreads);
+}
+
 /************************************************************************/
 /*                              OGRProjCT                               */
 /************************************************************************/
@@ -815,6 +873,22 @@ class OGRProjCT final : public OGRCoordinateTransformation
     std::string m_lastPjUsedPROJString{};
     bool m_differentOperationsUsed = false;
 
+    // Copies of m_pjWorkersSource used by the worker threads of
+    // TransformWithPROJMultiThreaded()
+    const PJ *m_pjWorkersSource = nullptr;
+    std::vector<PjPtr> m_apjWorkers{};
+
+    int GetTransformThreadCount(size_t nCount) const;
+    int TransformPointWithPROJ(PJ *pj, PJ_CONTEXT *ctx, double &x, double &y,
+                               double *pz, double *pt, double dfDefaultTime,
+                               bool bRecordOperation);
+    bool TransformWithPROJMultiThreaded(PJ *pj, int nThreads, size_t nCount,
+                                        double *x, double *y, double *z,
+                                        double *t, double dfDefaultTime,
+                                        std::vector<int> &anErrorCodes);
+    void ReportPROJError(PJ_CONTEXT *ctx, int err, size_t i,
+                         GUInt32 nLastErrorCounter);
+
     void ComputeThreshold();
     void DetectWebMercatorToWGS84();
 
@@ -2346,16 +2420,315 @@ int OGRProjCT::Transform(size_t nCount, double *x, double *y, double *z,
     return bRet;
 }
 
-/************************************************************************/
-/*                       TransformWithErrorCodes()                      */
-/************************************************************************/
-
 #ifndef PROJ_ERR_COORD_TRANSFM_INVALID_COORD
 #define PROJ_ERR_COORD_TRANSFM_INVALID_COORD 2049
 #define PROJ_ERR_COORD_TRANSFM_OUTSIDE_PROJECTION_DOMAIN 2050
 #define PROJ_ERR_COORD_TRANSFM_NO_OPERATION 2051
 #endif
 
+/************************************************************************/
+/*                      GetTransformThreadCount()                       */
+/************************************************************************/
+
+// Return the number of threads to use to transform nCount points with PROJ.
+int OGRProjCT::GetTransformThreadCount(size_t nCount) const
+{
+    const int nThreads = m_options.d->nNumThreads;
+    if (nThreads <= 1)
+        return 1;
+
+    // Below that number of points per thread, the cost of dispatching jobs
+    // is not worth it (config option only/mostly for autotest purposes)
+    const size_t nMinPointsPerThread = static_cast<size_t>(std::max(
+        1, atoi(CPLGetConfigOption("OGR_CT_MIN_POINTS_PER_THREAD", "10000"))));
+    return static_cast<int>(std::max<size_t>(
+        1, std::min(static_cast<size_t>(nThreads),
+                    nCount / nMinPointsPerThread)));
+}
+
+/************************************************************************/
+/*                       TransformPointWithPROJ()                       */
+/************************************************************************/
+
+// Transform a single point with pj. Return 0 in case of success, a PROJ
+// error code in case of failure, or -1 if the input coordinates are invalid.
+// This may be called concurrently on different PJ objects, provided that
+// bRecordOperation is false.
+int OGRProjCT::TransformPointWithPROJ(PJ *pj, PJ_CONTEXT *ctx, double &x,
+                                      double &y, double *pz, double *pt,
+                                      double dfDefaultTime,
+                                      bool bRecordOperation)
+{
+    PJ_COORD coord;
+    const double xIn = x;
+    const double yIn = y;
+    if (!std::isfinite(xIn))
+    {
+        x = HUGE_VAL;
+        y = HUGE_VAL;
+        return -1;
+    }
+    coord.xyzt.x = x;
+    coord.xyzt.y = y;
+    coord.xyzt.z = pz ? *pz : 0;
+    coord.xyzt.t = pt ? *pt : dfDefaultTime;
+    proj_errno_reset(pj);
+    coord = proj_trans(pj, m_bReversePj ? PJ_INV : PJ_FWD, coord);
+#if 0
+    CPLDebug("OGRCT",
+             "Transforming (x=%f,y=%f,z=%f,time=%f) to "
+             "(x=%f,y=%f,z=%f,time=%f)",
+             x, y, pz ? *pz : 0, pt ? *pt : dfDefaultTime,
+             coord.xyzt.x, coord.xyzt.y, coord.xyzt.z, coord.xyzt.t);
+#endif
+    x = coord.xyzt.x;
+    y = coord.xyzt.y;
+    if (pz)
+        *pz = coord.xyzt.z;
+    if (pt)
+        *pt = coord.xyzt.t;
+    int err = 0;
+    if (std::isnan(coord.xyzt.x))
+    {
+        // This shouldn't normally happen if PROJ projections behave
+        // correctly, but e.g inverse laea before PROJ 8.1.1 could
+        // do that for points out of domain.
+        // See https://github.com/OSGeo/PROJ/pull/2800
+        x = HUGE_VAL;
+        y = HUGE_VAL;
+        err = PROJ_ERR_COORD_TRANSFM_OUTSIDE_PROJECTION_DOMAIN;
+
+#ifdef DEBUG
+        CPLErrorOnce(CE_Warning, CPLE_AppDefined,
+                     "PROJ returned a NaN value. It should be fixed");
+#else
+        CPLDebugOnce("OGR_CT", "PROJ returned a NaN value. It should be fixed");
+#endif
+    }
+    else if (coord.xyzt.x == HUGE_VAL)
+    {
+        err = proj_errno(pj);
+        // PROJ should normally emit an error, but in case it does not
+        // (e.g PROJ 6.3 with the +ortho projection), synthesize one
+        if (err == 0)
+            err = PROJ_ERR_COORD_TRANSFM_OUTSIDE_PROJECTION_DOMAIN;
+    }
+    else
+    {
+        if (bRecordOperation && !m_differentOperationsUsed)
+        {
+#if PROJ_VERSION_MAJOR > 9 ||                                                  \
+    (PROJ_VERSION_MAJOR == 9 && PROJ_VERSION_MINOR >= 1)
+
+            PJ *lastOp = proj_trans_get_last_used_operation(pj);
+            if (lastOp)
+            {
+                const char *projString =
+                    proj_as_proj_string(ctx, lastOp, PJ_PROJ_5, nullptr);
+                if (projString)
+                {
+                    if (m_lastPjUsedPROJString.empty())
+                    {
+                        m_lastPjUsedPROJString = projString;
+                    }
+                    else if (m_lastPjUsedPROJString != projString)
+                    {
+                        m_differentOperationsUsed = true;
+                    }
+                }
+                proj_destroy(lastOp);
+            }
+#else
+            CPL_IGNORE_RET_VAL(ctx);
+#endif
+        }
+
+        if (m_options.d->bCheckWithInvertProj)
+        {
+            // For some projections, we cannot detect if we are trying to
+            // reproject coordinates outside the validity area of the
+            // projection. So let's do the reverse reprojection and compare
+            // with the source coordinates.
+            coord = proj_trans(pj, m_bReversePj ? PJ_FWD : PJ_INV, coord);
+            if (fabs(coord.xyzt.x - xIn) > dfThreshold ||
+                fabs(coord.xyzt.y - yIn) > dfThreshold)
+            {
+                err = PROJ_ERR_COORD_TRANSFM_OUTSIDE_PROJECTION_DOMAIN;
+                x = HUGE_VAL;
+                y = HUGE_VAL;
+            }
+        }
+    }
+    return err;
+}
+
+/************************************************************************/
+/*                   TransformWithPROJMultiThreaded()                   */
+/************************************************************************/
+
+// Transform the nCount points by splitting them across nThreads threads,
+// the calling thread using pj and the worker threads a copy of it.
+// The return code of TransformPointWithPROJ() for each point is stored in
+// anErrorCodes. Return false if the points could not be transformed this
+// way, in which case they are left unmodified.
+bool OGRProjCT::TransformWithPROJMultiThreaded(PJ *pj, int nThreads,
+                                               size_t nCount, double *x,
+                                               double *y, double *z, double *t,
+                                               double dfDefaultTime,
+                                               std::vector<int> &anErrorCodes)
+{
+    CPLWorkerThreadPool *poThreadPool = GDALGetGlobalThreadPool(nThreads);
+    if (!poThreadPool)
+        return false;
+    auto poJobQueue = poThreadPool->CreateJobQueue();
+
+    auto ctx = OSRGetProjTLSContext();
+    const size_t nWorkers = static_cast<size_t>(nThreads - 1);
+    if (m_pjWorkersSource != pj || m_apjWorkers.size() < nWorkers)
+    {
+        m_pjWorkersSource = nullptr;
+        m_apjWorkers = std::vector<PjPtr>(nWorkers);
+        for (auto &pjWorker : m_apjWorkers)
+        {
+            pjWorker = proj_clone(ctx, pj);
+            if (!static_cast<PJ *>(pjWorker))
+            {
+                m_apjWorkers.clear();
+                return false;
+            }
+        }
+        m_pjWorkersSource = pj;
+    }
+
+    try
+    {
+        anErrorCodes.resize(nCount);
+    }
+    catch (const std::exception &)
+    {
+        return false;
+    }
+
+    const size_t nChunkSize = (nCount + nThreads - 1) / nThreads;
+    const auto TransformChunk =
+        [this, x, y, z, t, dfDefaultTime, &anErrorCodes](
+            PJ *pjChunk, PJ_CONTEXT *ctxChunk, size_t iStart, size_t iEnd)
+    {
+        for (size_t i = iStart; i < iEnd; ++i)
+        {
+            anErrorCodes[i] = TransformPointWithPROJ(
+                pjChunk, ctxChunk, x[i], y[i], z ? z + i : nullptr,
+                t ? t + i : nullptr, dfDefaultTime, false);
+        }
+    };
+
+    CPLDebug("OGRCT", "Transforming " CPL_FRMT_GUIB " points with %d threads",
+             static_cast<GUIntBig>(nCount), nThreads);
+
+    // Errors emitted while transforming each chunk are accumulated, and
+    // replayed in the calling thread in chunk order, so that they are
+    // reported in the same order as with the single-threaded code path.
+    std::vector<CPLErrorAccumulator> aoErrorAccumulators(nWorkers + 1);
+    for (size_t iWorker = 0; iWorker < nWorkers; ++iWorker)
+    {
+        const size_t iStart = (iWorker + 1) * nChunkSize;
+        const size_t iEnd = std::min(nCount, iStart + nChunkSize);
+        if (iStart >= iEnd)
+            break;
+        PJ *pjWorker = m_apjWorkers[iWorker];
+        CPLErrorAccumulator *poErrorAccumulator =
+            &aoErrorAccumulators[iWorker + 1];
+        poJobQueue->SubmitJob(
+            [&TransformChunk, poErrorAccumulator, pjWorker, iStart, iEnd]()
+            {
+                auto oContext = poErrorAccumulator->InstallForCurrentScope();
+                CPL_IGNORE_RET_VAL(oContext);
+                auto ctxWorker = OSRGetProjTLSContext();
+                proj_assign_context(pjWorker, ctxWorker);
+                TransformChunk(pjWorker, ctxWorker, iStart, iEnd);
+            });
+    }
+    {
+        auto oContext = aoErrorAccumulators[0].InstallForCurrentScope();
+        CPL_IGNORE_RET_VAL(oContext);
+        TransformChunk(pj, ctx, 0, std::min(nCount, nChunkSize));
+    }
+    poJobQueue->WaitCompletion();
+    for (auto &oErrorAccumulator : aoErrorAccumulators)
+        oErrorAccumulator.ReplayErrors();
+
+    return true;
+}
+
+/************************************************************************/
+/*                          ReportPROJError()                           */
+/************************************************************************/
+
+// Try to report an error through CPL. Get proj error string if possible.
+// Try to avoid reporting thousands of errors. Suppress further error
+// reporting on this OGRProjCT if we have already reported 20 errors.
+void OGRProjCT::ReportPROJError(PJ_CONTEXT *ctx, int err, size_t i,
+                                GUInt32 nLastErrorCounter)
+{
+    if (++nErrorCount < 20)
+    {
+#if PROJ_VERSION_MAJOR >= 8
+        const char *pszError = proj_context_errno_string(ctx, err);
+#else
+        CPL_IGNORE_RET_VAL(ctx);
+        const char *pszError = proj_errno_string(err);
+#endif
+        if (m_bEmitErrors
+#ifdef PROJ_ERR_OTHER_NO_INVERSE_OP
+            || (i == 0 && err == PROJ_ERR_OTHER_NO_INVERSE_OP)
+#endif
+        )
+        {
+            if (nLastErrorCounter != CPLGetErrorCounter() &&
+                CPLGetLastErrorType() == CE_Failure &&
+                strstr(CPLGetLastErrorMsg(), "PROJ:"))
+            {
+                // do nothing
+            }
+            else if (pszError == nullptr)
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "Reprojection failed, err = %d", err);
+            else
+                CPLError(CE_Failure, CPLE_AppDefined, "%s", pszError);
+        }
+        else
+        {
+            if (pszError == nullptr)
+                CPLDebug("OGRCT", "Reprojection failed, err = %d", err);
+            else
+                CPLDebug("OGRCT", "%s", pszError);
+        }
+    }
+    else if (nErrorCount == 20)
+    {
+        if (m_bEmitErrors)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Reprojection failed, err = %d, further "
+                     "errors will be "
+                     "suppressed on the transform object.",
+                     err);
+        }
+        else
+        {
+            CPLDebug("OGRCT",
+                     "Reprojection failed, err = %d, further "
+                     "errors will be "
+                     "suppressed on the transform object.",
+                     err);
+        }
+    }
+}
+
+/************************************************************************/
+/*                       TransformWithErrorCodes()                      */
+/************************************************************************/
+
 int OGRProjCT::TransformWithErrorCodes(size_t nCount, double *x, double *y,
                                        double *z, double *t, int *panErrorCodes)
 
@@ -2758,185 +3131,40 @@ int OGRProjCT::TransformWithErrorCodes(size_t nCount, double *x, double *y,
     {
         const auto nLastErrorCounter = CPLGetErrorCounter();
 
+        std::vector<int> anErrorCodes;
+        const int nThreads = m_recordDifferentOperationsUsed
+                                 ? 1
+                                 : GetTransformThreadCount(nCount);
+        const bool bMultiThreaded =
+            nThreads > 1 &&
+            TransformWithPROJMultiThreaded(pj, nThreads, nCount, x, y, z, t,
+                                           dfDefaultTime, anErrorCodes);
+
         for (size_t i = 0; i < nCount; i++)
         {
-            PJ_COORD coord;
-            const double xIn = x[i];
-            const double yIn = y[i];
-            if (!std::isfinite(xIn))
+            const int err =
+                bMultiThreaded
+                    ? anErrorCodes[i]
+                    : TransformPointWithPROJ(
+                          pj, ctx, x[i], y[i], z ? z + i : nullptr,
+                          t ? t + i : nullptr, dfDefaultTime,
+                          m_recordDifferentOperationsUsed);
+            if (err < 0)
             {
+                // Invalid input coordinate: no error is emitted
                 bRet = FALSE;
-                x[i] = HUGE_VAL;
-                y[i] = HUGE_VAL;
                 if (panErrorCodes)
                     panErrorCodes[i] = PROJ_ERR_COORD_TRANSFM_INVALID_COORD;
                 continue;
             }
-            coord.xyzt.x = x[i];
-            coord.xyzt.y = y[i];
-            coord.xyzt.z = z ? z[i] : 0;
-            coord.xyzt.t = t ? t[i] : dfDefaultTime;
-            proj_errno_reset(pj);
-            coord = proj_trans(pj, m_bReversePj ? PJ_INV : PJ_FWD, coord);
-#if 0
-            CPLDebug("OGRCT",
-                     "Transforming (x=%f,y=%f,z=%f,time=%f) to "
-                     "(x=%f,y=%f,z=%f,time=%f)",
-                     x[i], y[i], z ? z[i] : 0, t ? t[i] : dfDefaultTime,
-                     coord.xyzt.x, coord.xyzt.y, coord.xyzt.z, coord.xyzt.t);
-#endif
-            x[i] = coord.xyzt.x;
-            y[i] = coord.xyzt.y;
-            if (z)
-                z[i] = coord.xyzt.z;
-            if (t)
-                t[i] = coord.xyzt.t;
-            int err = 0;
-            if (std::isnan(coord.xyzt.x))
-            {
-                bRet = FALSE;
-                // This shouldn't normally happen if PROJ projections behave
-                // correctly, but e.g inverse laea before PROJ 8.1.1 could
-                // do that for points out of domain.
-                // See https://github.com/OSGeo/PROJ/pull/2800
-                x[i] = HUGE_VAL;
-                y[i] = HUGE_VAL;
-                err = PROJ_ERR_COORD_TRANSFM_OUTSIDE_PROJECTION_DOMAIN;
-
-#ifdef DEBUG
-                CPLErrorOnce(CE_Warning, CPLE_AppDefined,
-                             "PROJ returned a NaN value. It should be fixed");
-#else
-                CPLDebugOnce("OGR_CT",
-                             "PROJ returned a NaN value. It should be fixed");
-#endif
-            }
-            else if (coord.xyzt.x == HUGE_VAL)
-            {
+            if (err != 0)
                 bRet = FALSE;
-                err = proj_errno(pj);
-                // PROJ should normally emit an error, but in case it does not
-                // (e.g PROJ 6.3 with the +ortho projection), synthesize one
-                if (err == 0)
-                    err = PROJ_ERR_COORD_TRANSFM_OUTSIDE_PROJECTION_DOMAIN;
-            }
-            else
-            {
-                if (m_recordDifferentOperationsUsed &&
-                    !m_differentOperationsUsed)
-                {
-#if PROJ_VERSION_MAJOR > 9 ||                                                  \
-    (PROJ_VERSION_MAJOR == 9 && PROJ_VERSION_MINOR >= 1)
-
-                    PJ *lastOp = proj_trans_get_last_used_operation(pj);
-                    if (lastOp)
-                    {
-                        const char *projString = proj_as_proj_string(
-                            ctx, lastOp, PJ_PROJ_5, nullptr);
-                        if (projString)
-                        {
-                            if (m_lastPjUsedPROJString.empty())
-                            {
-                                m_lastPjUsedPROJString = projString;
-                            }
-                            else if (m_lastPjUsedPROJString != projString)
-                            {
-                                m_differentOperationsUsed = true;
-                            }
-                        }
-                        proj_destroy(lastOp);
-                    }
-#endif
-                }
-
-                if (m_options.d->bCheckWithInvertProj)
-                {
-                    // For some projections, we cannot detect if we are trying to
-                    // reproject coordinates outside the validity area of the
-                    // projection. So let's do the reverse reprojection and compare
-                    // with the source coordinates.
-                    coord =
-                        proj_trans(pj, m_bReversePj ? PJ_FWD : PJ_INV, coord);
-                    if (fabs(coord.xyzt.x - xIn) > dfThreshold ||
-                        fabs(coord.xyzt.y - yIn) > dfThreshold)
-                    {
-                        bRet = FALSE;
-                        err = PROJ_ERR_COORD_TRANSFM_OUTSIDE_PROJECTION_DOMAIN;
-                        x[i] = HUGE_VAL;
-                        y[i] = HUGE_VAL;
-                    }
-                }
-            }
 
             if (panErrorCodes)
                 panErrorCodes[i] = err;
 
-            /* --------------------------------------------------------------------
-             */
-            /*      Try to report an error through CPL.  Get proj error string
-             */
-            /*      if possible.  Try to avoid reporting thousands of errors. */
-            /*      Suppress further error reporting on this OGRProjCT if we */
-            /*      have already reported 20 errors. */
-            /* --------------------------------------------------------------------
-             */
             if (err != 0)
-            {
-                if (++nErrorCount < 20)
-                {
-#if PROJ_VERSION_MAJOR >= 8
-                    const char *pszError = proj_context_errno_string(ctx, err);
-#else
-                    const char *pszError = proj_errno_string(err);
-#endif
-                    if (m_bEmitErrors
-#ifdef PROJ_ERR_OTHER_NO_INVERSE_OP
-                        || (i == 0 && err == PROJ_ERR_OTHER_NO_INVERSE_OP)
-#endif
-                    )
-                    {
-                        if (nLastErrorCounter != CPLGetErrorCounter() &&
-                            CPLGetLastErrorType() == CE_Failure &&
-                            strstr(CPLGetLastErrorMsg(), "PROJ:"))
-                        {
-                            // do nothing
-                        }
-                        else if (pszError == nullptr)
-                            CPLError(CE_Failure, CPLE_AppDefined,
-                                     "Reprojection failed, err = %d", err);
-                        else
-                            CPLError(CE_Failure, CPLE_AppDefined, "%s",
-                                     pszError);
-                    }
-                    else
-                    {
-                        if (pszError == nullptr)
-                            CPLDebug("OGRCT", "Reprojection failed, err = %d",
-                                     err);
-                        else
-                            CPLDebug("OGRCT", "%s", pszError);
-                    }
-                }
-                else if (nErrorCount == 20)
-                {
-                    if (m_bEmitErrors)
-                    {
-                        CPLError(CE_Failure, CPLE_AppDefined,
-                                 "Reprojection failed, err = %d, further "
-                                 "errors will be "
-                                 "suppressed on the transform object.",
-                                 err);
-                    }
-                    else
-                    {
-                        CPLDebug("OGRCT",
-                                 "Reprojection failed, err = %d, further "
-                                 "errors will be "
-                                 "suppressed on the transform object.",
-                                 err);
-                    }
-                }
-            }
+                ReportPROJError(ctx, err, i, nLastErrorCounter);
         }
     }
 
@@ -15,6 +15,7 @@
 #include "cpl_port.h"
 #include "ogr_feature.h"
 #include "ogr_swq.h"
+#include "ogr_swq_program.h"
 
 #include <cstddef>
 #include <algorithm>
@@ -105,6 +106,7 @@ OGRFeatureQuery::Compile(const OGRLayer *poLayer, const OGRFeatureDefn *poDefn,
         delete static_cast<swq_expr_node *>(pSWQExpr);
         pSWQExpr = nullptr;
     }
+    m_poProgram.reset();
 
     const char *pszFIDColumn = nullptr;
     bool bMustAddFID = false;
@@ -228,6 +230,15 @@ OGRFeatureQuery::Compile(const OGRLayer *poLayer, const OGRFeatureDefn *poDefn,
         eErr = OGRERR_CORRUPT_DATA;
         pSWQExpr = nullptr;
     }
+    else if (CPLTestBool(
+                 CPLGetConfigOption("OGR_FEATURE_QUERY_COMPILED", "YES")))
+    {
+        // Use a flat representation of the expression, when possible, to
+        // avoid the allocation of intermediate nodes when evaluating it.
+        m_poProgram =
+            swq_program::Compile(static_cast<swq_expr_node *>(pSWQExpr),
+                                 poDefn, m_psContext->bUTF8Strings);
+    }
 
     CPLFree(papszFieldNames);
     CPLFree(paeFieldTypes);
@@ -314,6 +325,9 @@ int OGRFeatureQuery::Evaluate(OGRFeature *poFeature)
     if (pSWQExpr == nullptr)
         return FALSE;
 
+    if (m_poProgram)
+        return m_poProgram->Evaluate(poFeature);
+
     swq_expr_node *poResult = static_cast<swq_expr_node *>(pSWQExpr)->Evaluate(
         OGRFeatureFetcher, poFeature, *m_psContext);
 
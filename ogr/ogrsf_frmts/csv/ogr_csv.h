@@ -16,6 +16,7 @@
 
 #include "ogrsf_frmts.h"
 
+#include <memory>
 #include <set>
 
 typedef enum
@@ -136,6 +137,13 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
 
     char **GetNextLineTokens();
 
+    // State of the native GetNextArrowArray() implementation
+    struct ArrowReadState;
+    std::unique_ptr<ArrowReadState> m_poArrowReadState{};
+    bool m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
+
+    bool InitArrowReadState(ArrowReadState *poState) const;
+
     static bool Matches(const char *pszFieldName, char **papszPossibleNames);
 
     CPL_DISALLOW_COPY_ASSIGN(OGRCSVLayer)
@@ -216,6 +224,11 @@ class OGRCSVLayer final : public IOGRCSVLayer, public OGRLayer
     OGRFeature *GetNextFeature() override;
     OGRFeature *GetFeature(GIntBig nFID) override;
 
+    int GetNextArrowArray(struct ArrowArrayStream *,
+                          struct ArrowArray *out_array) override;
+    const char *GetMetadataItem(const char *pszName,
+                                const char *pszDomain) override;
+
     using OGRLayer::GetLayerDefn;
 
     const OGRFeatureDefn *GetLayerDefn() const override
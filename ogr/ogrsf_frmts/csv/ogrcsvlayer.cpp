@@ -21,17 +21,27 @@
 #include <cstdlib>
 #include <cstring>
 #include <algorithm>
+#include <atomic>
 #include <cinttypes>
+#include <cmath>
+#include <ctime>
+#include <deque>
 #include <limits>
+#include <memory>
 #include <string>
+#include <system_error>
 #include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_csv.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_string.h"
 #include "cpl_vsi.h"
 #include "cpl_vsi_virtual.h"
+#include "cpl_worker_thread_pool.h"
+#include "gdal_thread_pool.h"
+#include "include_fast_float.h"
 #include "ogr_api.h"
 #include "ogr_core.h"
 #include "ogr_feature.h"
@@ -39,6 +49,8 @@
 #include "ogr_p.h"
 #include "ogr_spatialref.h"
 #include "ogrsf_frmts.h"
+#include "ograrrowarrayhelper.h"
+#include "ogrlayerarrow.h"
 
 #define DIGIT_ZERO '0'
 
@@ -1235,6 +1247,8 @@ char **OGRCSVLayer::AutodetectFieldTypes(CSLConstList papszOpenOptions,
 OGRCSVLayer::~OGRCSVLayer()
 
 {
+    m_poArrowReadState.reset();
+
     if (m_nFeaturesRead > 0)
     {
         CPLDebug("CSV", "%d features read on layer '%s'.",
@@ -1261,6 +1275,8 @@ OGRCSVLayer::~OGRCSVLayer()
 void OGRCSVLayer::ResetReading()
 
 {
+    m_poArrowReadState.reset();
+
     if (fpCSV)
         VSIRewindL(fpCSV);
 
@@ -1323,6 +1339,70 @@ OGRFeature *OGRCSVLayer::GetFeature(GIntBig nFID)
     return GetNextUnfilteredFeature();
 }
 
+/************************************************************************/
+/*                      OGRCSVIsCPLAtofMParsable()                      */
+/************************************************************************/
+
+// Is it a numeric value parsable by local-aware CPLAtofM()
+static bool OGRCSVIsCPLAtofMParsable(char *pszVal)
+{
+    auto l_eType = CPLGetValueType(pszVal);
+    if (l_eType == CPL_VALUE_INTEGER || l_eType == CPL_VALUE_REAL)
+        return true;
+    char *pszComma = strchr(pszVal, ',');
+    if (pszComma)
+    {
+        *pszComma = '.';
+        l_eType = CPLGetValueType(pszVal);
+        *pszComma = ',';
+    }
+    return l_eType == CPL_VALUE_REAL;
+}
+
+/************************************************************************/
+/*                        OGRCSVParseGeometry()                         */
+/************************************************************************/
+
+// Parse the value of a geometry column: WKT only for the unnamed geometry
+// field, or WKT, GeoJSON or hexadecimal (E)WKB otherwise.
+static std::unique_ptr<OGRGeometry> OGRCSVParseGeometry(const char *pszStr,
+                                                        bool bWKTOnly)
+{
+    while (*pszStr == ' ')
+        pszStr++;
+    std::unique_ptr<OGRGeometry> poGeom = nullptr;
+    OGRErr eErr;
+
+    if (bWKTOnly)
+    {
+        std::tie(poGeom, eErr) = OGRGeometryFactory::createFromWkt(pszStr);
+        if (eErr != OGRERR_NONE)
+        {
+            CPLError(CE_Warning, CPLE_AppDefined, "Ignoring invalid WKT: %s",
+                     pszStr);
+        }
+    }
+    else
+    {
+        CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
+
+        std::tie(poGeom, eErr) = OGRGeometryFactory::createFromWkt(pszStr);
+
+        if (!poGeom && *pszStr == '{')
+        {
+            poGeom.reset(
+                OGRGeometry::FromHandle(OGR_G_CreateGeometryFromJson(pszStr)));
+        }
+        else if (!poGeom && ((*pszStr >= '0' && *pszStr <= '9') ||
+                             (*pszStr >= 'a' && *pszStr <= 'z') ||
+                             (*pszStr >= 'A' && *pszStr <= 'Z')))
+        {
+            poGeom.reset(OGRGeometryFromHexEWKB(pszStr, nullptr, FALSE));
+        }
+    }
+    return poGeom;
+}
+
 /************************************************************************/
 /*                      GetNextUnfilteredFeature()                      */
 /************************************************************************/
@@ -1388,43 +1468,9 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
             if (papszTokens[iAttr][0] != '\0' &&
                 !(poGeomFieldDefn->IsIgnored()))
             {
-                const char *pszStr = papszTokens[iAttr];
-                while (*pszStr == ' ')
-                    pszStr++;
-                std::unique_ptr<OGRGeometry> poGeom = nullptr;
-                OGRErr eErr;
-
-                if (EQUAL(poGeomFieldDefn->GetNameRef(), ""))
-                {
-                    std::tie(poGeom, eErr) =
-                        OGRGeometryFactory::createFromWkt(pszStr);
-                    if (eErr != OGRERR_NONE)
-                    {
-                        CPLError(CE_Warning, CPLE_AppDefined,
-                                 "Ignoring invalid WKT: %s", pszStr);
-                    }
-                }
-                else
-                {
-                    CPLErrorHandlerPusher oErrorHandler(CPLQuietErrorHandler);
-
-                    std::tie(poGeom, eErr) =
-                        OGRGeometryFactory::createFromWkt(pszStr);
-
-                    if (!poGeom && *pszStr == '{')
-                    {
-                        poGeom.reset(OGRGeometry::FromHandle(
-                            OGR_G_CreateGeometryFromJson(pszStr)));
-                    }
-                    else if (!poGeom && ((*pszStr >= '0' && *pszStr <= '9') ||
-                                         (*pszStr >= 'a' && *pszStr <= 'z') ||
-                                         (*pszStr >= 'A' && *pszStr <= 'Z')))
-                    {
-                        poGeom.reset(
-                            OGRGeometryFromHexEWKB(pszStr, nullptr, FALSE));
-                    }
-                }
-
+                std::unique_ptr<OGRGeometry> poGeom = OGRCSVParseGeometry(
+                    papszTokens[iAttr],
+                    EQUAL(poGeomFieldDefn->GetNameRef(), ""));
                 if (poGeom)
                 {
                     poGeom->assignSpatialReference(
@@ -1649,22 +1695,6 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
         }
     }
 
-    // Is it a numeric value parsable by local-aware CPLAtofM()
-    const auto IsCPLAtofMParsable = [](char *pszVal)
-    {
-        auto l_eType = CPLGetValueType(pszVal);
-        if (l_eType == CPL_VALUE_INTEGER || l_eType == CPL_VALUE_REAL)
-            return true;
-        char *pszComma = strchr(pszVal, ',');
-        if (pszComma)
-        {
-            *pszComma = '.';
-            l_eType = CPLGetValueType(pszVal);
-            *pszComma = ',';
-        }
-        return l_eType == CPL_VALUE_REAL;
-    };
-
     // http://www.faa.gov/airports/airport_safety/airportdata_5010/menu/index.cfm
     // specific
 
@@ -1687,8 +1717,8 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
              nAttrCount > iLatitudeField && nAttrCount > iLongitudeField &&
              papszTokens[iLongitudeField][0] != 0 &&
              papszTokens[iLatitudeField][0] != 0 &&
-             IsCPLAtofMParsable(papszTokens[iLongitudeField]) &&
-             IsCPLAtofMParsable(papszTokens[iLatitudeField]))
+             OGRCSVIsCPLAtofMParsable(papszTokens[iLongitudeField]) &&
+             OGRCSVIsCPLAtofMParsable(papszTokens[iLatitudeField]))
     {
         if (!m_bIsGNIS ||
             // GNIS specific: some records have dummy 0,0 value.
@@ -1703,7 +1733,7 @@ OGRFeature *OGRCSVLayer::GetNextUnfilteredFeature()
             {
                 if (iZField != -1 && nAttrCount > iZField &&
                     papszTokens[iZField][0] != 0 &&
-                    IsCPLAtofMParsable(papszTokens[iZField]))
+                    OGRCSVIsCPLAtofMParsable(papszTokens[iZField]))
                     poFeature->SetGeometryDirectly(new OGRPoint(
                         dfLon, dfLat, CPLAtofM(papszTokens[iZField])));
                 else
@@ -1755,6 +1785,916 @@ OGRFeature *OGRCSVLayer::GetNextFeature()
     }
 }
 
+/************************************************************************/
+/*                           ArrowReadState                             */
+/************************************************************************/
+
+// State of the native GetNextArrowArray() implementation.
+//
+// The calling thread reads the file by large blocks and cuts it into chunks
+// of complete records. Record boundaries are validated by tracking whether
+// each double quote character opens or closes a quoted value, with the same
+// rules as CSVReadParseLine3L(), so that new line characters within quoted
+// values never split a record. Chunks are then tokenized and decoded into
+// Arrow arrays, by worker threads when GDAL_NUM_THREADS > 1.
+struct OGRCSVLayer::ArrowReadState
+{
+    // For each CSV column, OGR field and geometry field it is decoded into
+    struct Column
+    {
+        int iOGRField = -1;
+        OGRFieldType eType = OFTString;
+        OGRFieldSubType eSubType = OFSTNone;
+        int iGeomField = -1;
+        bool bGeomWKTOnly = false;
+    };
+
+    struct Chunk
+    {
+        // Content of the records, each one terminated by a nul character,
+        // and with new line sequences in multi-line records normalized to \n
+        std::string osRecords{};
+        std::vector<size_t> anRecordOffsets{};
+        int nRecords = 0;
+        int64_t nFirstFID = 0;
+        struct ArrowArray sArray{};
+        std::unique_ptr<OGRArrowArrayHelper> poHelper{};
+        CPLErrorAccumulator oErrorAccumulator{};
+        // FID and OGR field index of the first invalid value
+        int64_t nBadValueFID = -1;
+        int iBadValueField = -1;
+        bool bOutOfMemory = false;
+        std::atomic<bool> bDone{false};
+
+        Chunk() = default;
+
+        ~Chunk()
+        {
+            if (sArray.release)
+                sArray.release(&sArray);
+        }
+
+        CPL_DISALLOW_COPY_ASSIGN(Chunk)
+    };
+
+    enum class RecordStatus
+    {
+        COMPLETE,
+        INCOMPLETE,
+        UNBALANCED_QUOTES,
+        LINE_TOO_LONG,
+    };
+
+    struct Record
+    {
+        const char *pszContent = nullptr;
+        const char *pszContentEnd = nullptr;
+        const char *pszNext = nullptr;
+        bool bMultiLine = false;
+    };
+
+    // Progress of FindRecordEnd() within the current record, kept when
+    // more bytes must be read so that the scan resumes where it stopped.
+    // Offsets are relative to the start of the record.
+    struct RecordScan
+    {
+        bool bStarted = false;
+        bool bInString = false;
+        bool bMultiLine = false;
+        size_t nContentOffset = 0;
+        size_t nLineStartOffset = 0;
+        size_t nScanOffset = 0;
+    };
+
+    std::vector<Column> aoColumns{};
+    char chDelimiter = ',';
+    int nMaxLineSize = -1;
+    bool bEmptyStringNull = false;
+    bool bIsGNIS = false;
+    int iLongitudeField = -1;
+    int iLatitudeField = -1;
+    int iZField = -1;
+
+    int nMaxRecordsInChunk = 0;
+    size_t nMaxChunkSize = 0;
+    bool bPreserveOrder = true;
+
+    std::unique_ptr<CPLJobQueue> poJobQueue{};
+    size_t nMaxChunksInFlight = 1;
+    std::deque<std::shared_ptr<Chunk>> apoChunks{};
+
+    // Bytes read from the file and not yet assigned to a chunk
+    size_t nReadSize = 1024 * 1024;
+    std::string osBuffer{};
+    size_t nBufferPos = 0;
+    RecordScan sRecordScan{};
+    bool bFileEOF = false;
+    bool bEOF = false;
+
+    ArrowReadState() = default;
+
+    ~ArrowReadState()
+    {
+        if (poJobQueue)
+            poJobQueue->WaitCompletion();
+    }
+
+    RecordStatus FindRecordEnd(const char *pszStart, const char *pszBufferEnd,
+                               Record &sRecord);
+    std::shared_ptr<Chunk> ReadNextChunk(VSILFILE *fp);
+    void ParseChunk(Chunk &oChunk) const;
+
+    CPL_DISALLOW_COPY_ASSIGN(ArrowReadState)
+};
+
+/************************************************************************/
+/*                           FindRecordEnd()                            */
+/************************************************************************/
+
+OGRCSVLayer::ArrowReadState::RecordStatus
+OGRCSVLayer::ArrowReadState::FindRecordEnd(const char *pszStart,
+                                           const char *pszBufferEnd,
+                                           Record &sRecord)
+{
+    RecordScan &sScan = sRecordScan;
+    if (!sScan.bStarted)
+    {
+        if (pszBufferEnd - pszStart < 3 && !bFileEOF)
+            return RecordStatus::INCOMPLETE;
+        // Skip BOM, like CSVReadParseLine3L() does for each record
+        if (pszBufferEnd - pszStart >= 3 &&
+            memcmp(pszStart, "\xEF\xBB\xBF", 3) == 0)
+        {
+            sScan.nContentOffset = 3;
+        }
+        sScan.nScanOffset = sScan.nContentOffset;
+        sScan.bStarted = true;
+    }
+
+    sRecord.pszContent = pszStart + sScan.nContentOffset;
+    const char *p = pszStart + sScan.nScanOffset;
+    const char *pszLineStart = pszStart + sScan.nLineStartOffset;
+    bool bInString = sScan.bInString;
+    const auto SaveScanAndRequestMoreBytes = [&]()
+    {
+        sScan.bInString = bInString;
+        sScan.nLineStartOffset = pszLineStart - pszStart;
+        sScan.nScanOffset = p - pszStart;
+        return RecordStatus::INCOMPLETE;
+    };
+    const auto EndScan = [&sScan, &sRecord](RecordStatus eStatus)
+    {
+        sRecord.bMultiLine = sScan.bMultiLine;
+        sScan = RecordScan();
+        return eStatus;
+    };
+
+    while (true)
+    {
+        while (p < pszBufferEnd && *p != '"' && *p != '\n' && *p != '\r')
+            ++p;
+        // CPLReadLine3L() does not check the size limit for the last
+        // character of the file
+        const auto nLineLength = p - pszLineStart;
+        if (nMaxLineSize > 0 && nLineLength >= nMaxLineSize &&
+            !(p == pszBufferEnd && nLineLength == nMaxLineSize))
+        {
+            return EndScan(RecordStatus::LINE_TOO_LONG);
+        }
+        if (p == pszBufferEnd)
+        {
+            if (!bFileEOF)
+                return SaveScanAndRequestMoreBytes();
+            if (bInString)
+                return EndScan(RecordStatus::UNBALANCED_QUOTES);
+            sRecord.pszContentEnd = p;
+            sRecord.pszNext = p;
+            return EndScan(RecordStatus::COMPLETE);
+        }
+
+        // The next character is needed to recognize an escaped double
+        // quote or a two-character new line sequence.
+        if (p + 1 == pszBufferEnd && !bFileEOF)
+            return SaveScanAndRequestMoreBytes();
+        const char ch = *p;
+        const char chNext = p + 1 < pszBufferEnd ? p[1] : '\0';
+        if (ch == '"')
+        {
+            if (!bInString)
+            {
+                // Only a double quote at the start of the record or just
+                // after a delimiter starts a quoted value
+                if (p == sRecord.pszContent || p[-1] == chDelimiter)
+                    bInString = true;
+            }
+            else if (chNext == '"')
+            {
+                ++p;
+            }
+            else
+            {
+                bInString = false;
+            }
+            ++p;
+        }
+        else
+        {
+            const char *pszEOL = p;
+            p += ((ch == '\r' && chNext == '\n') ||
+                  (ch == '\n' && chNext == '\r'))
+                     ? 2
+                     : 1;
+            if (!bInString)
+            {
+                sRecord.pszContentEnd = pszEOL;
+                sRecord.pszNext = p;
+                return EndScan(RecordStatus::COMPLETE);
+            }
+            sScan.bMultiLine = true;
+            pszLineStart = p;
+        }
+    }
+}
+
+/************************************************************************/
+/*                           ReadNextChunk()                            */
+/************************************************************************/
+
+std::shared_ptr<OGRCSVLayer::ArrowReadState::Chunk>
+OGRCSVLayer::ArrowReadState::ReadNextChunk(VSILFILE *fp)
+{
+    auto poChunk = std::make_shared<Chunk>();
+    while (!bEOF && poChunk->nRecords < nMaxRecordsInChunk &&
+           poChunk->osRecords.size() < nMaxChunkSize)
+    {
+        if (bFileEOF && nBufferPos == osBuffer.size())
+        {
+            bEOF = true;
+            break;
+        }
+
+        Record sRecord;
+        const auto eStatus =
+            FindRecordEnd(osBuffer.data() + nBufferPos,
+                          osBuffer.data() + osBuffer.size(), sRecord);
+        if (eStatus == RecordStatus::INCOMPLETE)
+        {
+            osBuffer.erase(0, nBufferPos);
+            nBufferPos = 0;
+            const size_t nOldSize = osBuffer.size();
+            try
+            {
+                osBuffer.resize(nOldSize + nReadSize);
+            }
+            catch (const std::exception &e)
+            {
+                CPLError(CE_Failure, CPLE_OutOfMemory, "%s", e.what());
+                bEOF = true;
+                break;
+            }
+            const size_t nRead =
+                VSIFReadL(&osBuffer[nOldSize], 1, nReadSize, fp);
+            osBuffer.resize(nOldSize + nRead);
+            if (nRead < nReadSize)
+                bFileEOF = true;
+            continue;
+        }
+        else if (eStatus == RecordStatus::UNBALANCED_QUOTES)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "CSV file has unbalanced number of double-quotes. "
+                     "Corrupted data will likely be returned");
+            bEOF = true;
+            break;
+        }
+        else if (eStatus == RecordStatus::LINE_TOO_LONG)
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Maximum number of characters allowed reached.");
+            bEOF = true;
+            break;
+        }
+
+        nBufferPos = sRecord.pszNext - osBuffer.data();
+
+        // Empty lines are skipped
+        if (sRecord.pszContentEnd == sRecord.pszContent)
+            continue;
+
+        std::string &osRecords = poChunk->osRecords;
+        poChunk->anRecordOffsets.push_back(osRecords.size());
+        if (!sRecord.bMultiLine)
+        {
+            osRecords.append(sRecord.pszContent, sRecord.pszContentEnd);
+        }
+        else
+        {
+            // New line sequences are joined as \n by CSVReadParseLine3L()
+            const char *p = sRecord.pszContent;
+            while (p < sRecord.pszContentEnd)
+            {
+                const char ch = *p;
+                ++p;
+                if (ch == '\r' || ch == '\n')
+                {
+                    if (p < sRecord.pszContentEnd &&
+                        ((ch == '\r' && *p == '\n') ||
+                         (ch == '\n' && *p == '\r')))
+                    {
+                        ++p;
+                    }
+                    osRecords += '\n';
+                }
+                else
+                {
+                    osRecords += ch;
+                }
+            }
+        }
+        osRecords += '\0';
+        poChunk->nRecords++;
+    }
+
+    if (poChunk->nRecords == 0)
+        return nullptr;
+    return poChunk;
+}
+
+/************************************************************************/
+/*                        OGRCSVParseCoordinate()                       */
+/************************************************************************/
+
+// Same as CPLAtofM(), with a fast path for plain decimal numbers.
+static double OGRCSVParseCoordinate(const char *pszVal)
+{
+    const char *pszEnd = pszVal + strlen(pszVal);
+    double dfVal = 0;
+    const fast_float::parse_options options{fast_float::chars_format::general,
+                                            '.'};
+    const auto answer =
+        fast_float::from_chars_advanced(pszVal, pszEnd, dfVal, options);
+    if (answer.ec == std::errc() && answer.ptr == pszEnd)
+        return dfVal;
+    return CPLAtofM(pszVal);
+}
+
+/************************************************************************/
+/*                             ParseChunk()                             */
+/************************************************************************/
+
+// Decode the records of a chunk into its Arrow array. May be called from a
+// worker thread: it must not access the layer.
+void OGRCSVLayer::ArrowReadState::ParseChunk(Chunk &oChunk) const
+{
+    OGRArrowArrayHelper &oHelper = *(oChunk.poHelper);
+    struct ArrowArray *out_array = &oChunk.sArray;
+
+    std::string osValues;
+    std::vector<size_t> anValueOffsets;
+    const char szDelimiter[2] = {chDelimiter, '\0'};
+    std::vector<GByte> abyWKB;
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    const auto SetNullValue = [&oHelper, out_array](const Column &oColumn,
+                                                    int iArrowField, int iFeat)
+    {
+        if (oHelper.m_abNullableFields[oColumn.iOGRField])
+            oHelper.SetNull(iArrowField, iFeat);
+        else if (oColumn.eType == OFTString)
+            oHelper.SetEmptyStringOrBinary(out_array->children[iArrowField],
+                                           iFeat);
+    };
+
+    const auto SetBinaryValue =
+        [&oHelper, &oChunk](int iArrowField, int iFeat, const void *pData,
+                            size_t nLen)
+    {
+        GByte *outPtr =
+            oHelper.GetPtrForStringOrBinary(iArrowField, iFeat, nLen);
+        if (outPtr == nullptr)
+        {
+            oChunk.bOutOfMemory = true;
+            return false;
+        }
+        memcpy(outPtr, pData, nLen);
+        return true;
+    };
+
+    const auto SetGeometry =
+        [&abyWKB, &SetBinaryValue](int iArrowField, int iFeat,
+                                   const OGRGeometry &oGeom)
+    {
+        abyWKB.resize(oGeom.WkbSize());
+        oGeom.exportToWkb(wkbNDR, abyWKB.data(), wkbVariantIso);
+        return SetBinaryValue(iArrowField, iFeat, abyWKB.data(),
+                              abyWKB.size());
+    };
+
+    const int nCSVFieldCount = static_cast<int>(aoColumns.size());
+    const int iPointArrowField =
+        iLongitudeField >= 0 && iLatitudeField >= 0
+            ? oHelper.m_mapOGRGeomFieldToArrowField[0]
+            : -1;
+    for (int iFeat = 0; iFeat < oChunk.nRecords; ++iFeat)
+    {
+        CSVSplitLineToTokens(oChunk.osRecords.c_str() +
+                                 oChunk.anRecordOffsets[iFeat],
+                             szDelimiter, false, false, osValues,
+                             anValueOffsets);
+
+        const int nAttrCount =
+            std::min(static_cast<int>(anValueOffsets.size()), nCSVFieldCount);
+        const auto NoteBadValue = [&oChunk, iFeat](const Column &oColumn)
+        {
+            if (oChunk.nBadValueFID < 0)
+            {
+                oChunk.nBadValueFID = oChunk.nFirstFID + iFeat;
+                oChunk.iBadValueField = oColumn.iOGRField;
+            }
+        };
+
+        for (int iAttr = 0; iAttr < nCSVFieldCount; ++iAttr)
+        {
+            const Column &oColumn = aoColumns[iAttr];
+            char *pszToken =
+                iAttr < nAttrCount ? &osValues[anValueOffsets[iAttr]] : nullptr;
+
+            if (oColumn.iGeomField >= 0)
+            {
+                const int iArrowField =
+                    oHelper.m_mapOGRGeomFieldToArrowField[oColumn.iGeomField];
+                if (iArrowField >= 0)
+                {
+                    std::unique_ptr<OGRGeometry> poGeom;
+                    if (pszToken != nullptr && pszToken[0] != '\0')
+                        poGeom =
+                            OGRCSVParseGeometry(pszToken, oColumn.bGeomWKTOnly);
+                    if (!poGeom)
+                        oHelper.SetNull(iArrowField, iFeat);
+                    else if (!SetGeometry(iArrowField, iFeat, *poGeom))
+                        return;
+                }
+            }
+
+            if (oColumn.iOGRField < 0)
+                continue;
+            const int iArrowField =
+                oHelper.m_mapOGRFieldToArrowField[oColumn.iOGRField];
+            if (iArrowField < 0)
+                continue;
+            auto psArray = out_array->children[iArrowField];
+
+            if (pszToken == nullptr ||
+                (pszToken[0] == '\0' &&
+                 (oColumn.eType != OFTString || bEmptyStringNull)))
+            {
+                SetNullValue(oColumn, iArrowField, iFeat);
+                continue;
+            }
+
+            switch (oColumn.eType)
+            {
+                case OFTInteger:
+                case OFTInteger64:
+                {
+                    if (oColumn.eSubType == OFSTBoolean)
+                    {
+                        if (OGRCSVIsTrue(pszToken) ||
+                            strcmp(pszToken, "1") == 0)
+                        {
+                            oHelper.SetBoolOn(psArray, iFeat);
+                        }
+                        else if (!OGRCSVIsFalse(pszToken) &&
+                                 strcmp(pszToken, "0") != 0)
+                        {
+                            // Set to TRUE because it's different than 0
+                            oHelper.SetBoolOn(psArray, iFeat);
+                            NoteBadValue(oColumn);
+                        }
+                        break;
+                    }
+
+                    char *endptr = nullptr;
+                    const GIntBig nVal = static_cast<GIntBig>(
+                        std::strtoll(pszToken, &endptr, 10));
+                    if (*endptr != '\0')
+                    {
+                        NoteBadValue(oColumn);
+                        SetNullValue(oColumn, iArrowField, iFeat);
+                    }
+                    else if (oColumn.eType == OFTInteger64)
+                    {
+                        oHelper.SetInt64(psArray, iFeat, nVal);
+                    }
+                    else if (oColumn.eSubType == OFSTInt16)
+                    {
+                        oHelper.SetInt16(
+                            psArray, iFeat,
+                            static_cast<int16_t>(std::clamp<GIntBig>(
+                                nVal, std::numeric_limits<int16_t>::min(),
+                                std::numeric_limits<int16_t>::max())));
+                    }
+                    else
+                    {
+                        oHelper.SetInt32(
+                            psArray, iFeat,
+                            static_cast<int32_t>(std::clamp<GIntBig>(
+                                nVal, std::numeric_limits<int32_t>::min(),
+                                std::numeric_limits<int32_t>::max())));
+                    }
+                    break;
+                }
+
+                case OFTReal:
+                {
+                    char *chComma = strchr(pszToken, ',');
+                    if (chComma)
+                        *chComma = '.';
+                    const char *pszEnd = pszToken + strlen(pszToken);
+                    double dfVal = 0;
+                    const fast_float::parse_options options{
+                        fast_float::chars_format::general, '.'};
+                    const auto answer = fast_float::from_chars_advanced(
+                        pszToken, pszEnd, dfVal, options);
+                    if (answer.ec != std::errc() || answer.ptr != pszEnd ||
+                        !std::isfinite(dfVal))
+                    {
+                        // Slow path, for leading spaces, infinity, etc.
+                        char *endptr = nullptr;
+                        dfVal = CPLStrtodDelim(pszToken, &endptr, '.');
+                        if (endptr != pszEnd)
+                        {
+                            NoteBadValue(oColumn);
+                            SetNullValue(oColumn, iArrowField, iFeat);
+                            break;
+                        }
+                    }
+                    if (oColumn.eSubType == OFSTFloat32)
+                        oHelper.SetFloat(psArray, iFeat,
+                                         static_cast<float>(dfVal));
+                    else
+                        oHelper.SetDouble(psArray, iFeat, dfVal);
+                    break;
+                }
+
+                case OFTString:
+                {
+                    if (!SetBinaryValue(iArrowField, iFeat, pszToken,
+                                        strlen(pszToken)))
+                        return;
+                    break;
+                }
+
+                case OFTDate:
+                case OFTTime:
+                case OFTDateTime:
+                {
+                    OGRField sField;
+                    if (!OGRParseDate(pszToken, &sField, 0))
+                    {
+                        NoteBadValue(oColumn);
+                        SetNullValue(oColumn, iArrowField, iFeat);
+                    }
+                    else if (oColumn.eType == OFTDate)
+                    {
+                        oHelper.SetDate(psArray, iFeat, brokenDown, sField);
+                    }
+                    else if (oColumn.eType == OFTTime)
+                    {
+                        oHelper.SetInt32(
+                            psArray, iFeat,
+                            sField.Date.Hour * 3600000 +
+                                sField.Date.Minute * 60000 +
+                                static_cast<int>(sField.Date.Second * 1000 +
+                                                 0.5f));
+                    }
+                    else
+                    {
+                        oHelper.SetDateTime(
+                            psArray, iFeat, brokenDown,
+                            oHelper.m_anTZFlags[oColumn.iOGRField], sField);
+                    }
+                    break;
+                }
+
+                default:
+                    break;
+            }
+        }
+
+        if (iPointArrowField >= 0)
+        {
+            bool bHasPoint = false;
+            if (nAttrCount > iLatitudeField && nAttrCount > iLongitudeField)
+            {
+                char *pszLon = &osValues[anValueOffsets[iLongitudeField]];
+                char *pszLat = &osValues[anValueOffsets[iLatitudeField]];
+                if (pszLon[0] != '\0' && pszLat[0] != '\0' &&
+                    OGRCSVIsCPLAtofMParsable(pszLon) &&
+                    OGRCSVIsCPLAtofMParsable(pszLat) &&
+                    // GNIS specific: some records have dummy 0,0 value.
+                    !(bIsGNIS && strcmp(pszLon, "0") == 0 &&
+                      strcmp(pszLat, "0") == 0))
+                {
+                    const double dfLon = OGRCSVParseCoordinate(pszLon);
+                    const double dfLat = OGRCSVParseCoordinate(pszLat);
+                    char *pszZ = iZField >= 0 && nAttrCount > iZField
+                                     ? &osValues[anValueOffsets[iZField]]
+                                     : nullptr;
+                    OGRPoint oPoint(dfLon, dfLat);
+                    if (pszZ && pszZ[0] != '\0' &&
+                        OGRCSVIsCPLAtofMParsable(pszZ))
+                    {
+                        oPoint.setZ(OGRCSVParseCoordinate(pszZ));
+                    }
+                    if (!SetGeometry(iPointArrowField, iFeat, oPoint))
+                        return;
+                    bHasPoint = true;
+                }
+            }
+            if (!bHasPoint)
+                oHelper.SetNull(iPointArrowField, iFeat);
+        }
+
+        if (oHelper.m_panFIDValues)
+            oHelper.m_panFIDValues[iFeat] = oChunk.nFirstFID + iFeat;
+    }
+
+    oHelper.Shrink(oChunk.nRecords);
+}
+
+/************************************************************************/
+/*                         InitArrowReadState()                         */
+/************************************************************************/
+
+// Return whether the native GetNextArrowArray() implementation can be used,
+// or if the layout of the file requires the generic implementation. When
+// poState is not null, its column mapping and parsing options are set.
+// Cheap enough to be called by TestCapability(): nothing is read from the
+// file.
+bool OGRCSVLayer::InitArrowReadState(ArrowReadState *poState) const
+{
+    if (fpCSV == nullptr || bInWriteMode || !bHonourStrings ||
+        bMergeDelimiter || bIsEurostatTSV || bHiddenWKTColumn ||
+        bKeepSourceColumns ||
+        (iNfdcLatitudeS != -1 && iNfdcLongitudeS != -1))
+    {
+        return false;
+    }
+    if (const auto poCsvDs = static_cast<const OGRCSVDataSource *>(m_poDS))
+    {
+        if (!poCsvDs->DeletedFieldIndexes().empty())
+            return false;
+    }
+
+    if (poState)
+        poState->aoColumns.resize(nCSVFieldCount);
+    // Whether each geometry field is filled by a column
+    std::vector<bool> abGeomFieldHandled(poFeatureDefn->GetGeomFieldCount());
+    int iOGRField = 0;
+    for (int iAttr = 0; iAttr < nCSVFieldCount; iAttr++)
+    {
+        ArrowReadState::Column oColumn;
+        if ((iAttr == iLongitudeField || iAttr == iLatitudeField ||
+             iAttr == iZField) &&
+            !bKeepGeomColumns)
+        {
+            continue;
+        }
+
+        const int iGeom = panGeomFieldIndex[iAttr];
+        if (iGeom >= 0)
+        {
+            const auto poGeomFieldDefn = poFeatureDefn->GetGeomFieldDefn(iGeom);
+            // Null geometries of non-nullable fields are written as empty
+            // geometries by the generic implementation
+            if (!poGeomFieldDefn->IsNullable() &&
+                !poGeomFieldDefn->IsIgnored())
+            {
+                return false;
+            }
+            oColumn.iGeomField = iGeom;
+            abGeomFieldHandled[iGeom] = true;
+            oColumn.bGeomWKTOnly = EQUAL(poGeomFieldDefn->GetNameRef(), "");
+            if (!bKeepGeomColumns)
+            {
+                if (poState)
+                    poState->aoColumns[iAttr] = oColumn;
+                continue;
+            }
+        }
+
+        if (iOGRField >= poFeatureDefn->GetFieldCount())
+            return false;
+        const auto poFieldDefn = poFeatureDefn->GetFieldDefn(iOGRField);
+        oColumn.iOGRField = iOGRField;
+        oColumn.eType = poFieldDefn->GetType();
+        oColumn.eSubType = poFieldDefn->GetSubType();
+        if (oColumn.eType != OFTInteger && oColumn.eType != OFTInteger64 &&
+            oColumn.eType != OFTReal && oColumn.eType != OFTString &&
+            oColumn.eType != OFTDate && oColumn.eType != OFTTime &&
+            oColumn.eType != OFTDateTime)
+        {
+            return false;
+        }
+        if (poState)
+            poState->aoColumns[iAttr] = oColumn;
+        iOGRField++;
+    }
+    if (iOGRField != poFeatureDefn->GetFieldCount())
+        return false;
+
+    if (iLatitudeField != -1 && iLongitudeField != -1)
+    {
+        if (poFeatureDefn->GetGeomFieldCount() != 1 ||
+            !poFeatureDefn->GetGeomFieldDefn(0)->IsNullable())
+        {
+            return false;
+        }
+        abGeomFieldHandled[0] = true;
+        if (poState)
+        {
+            poState->iLongitudeField = iLongitudeField;
+            poState->iLatitudeField = iLatitudeField;
+            poState->iZField = iZField;
+            poState->bIsGNIS = m_bIsGNIS;
+        }
+    }
+    if (std::find(abGeomFieldHandled.begin(), abGeomFieldHandled.end(),
+                  false) != abGeomFieldHandled.end())
+    {
+        return false;
+    }
+
+    if (poState)
+    {
+        poState->chDelimiter = szDelimiter[0];
+        poState->nMaxLineSize = m_nMaxLineSize;
+        poState->bEmptyStringNull = bEmptyStringNull;
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                         GetNextArrowArray()                          */
+/************************************************************************/
+
+// Specialized implementation that tokenizes the file directly into Arrow
+// arrays, without going through OGRFeature, and using worker threads when
+// GDAL_NUM_THREADS > 1. Falls back to the generic implementation when
+// filters are set, or for layouts that it does not handle.
+int OGRCSVLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                   struct ArrowArray *out_array)
+{
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
+    if (!m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.empty() ||
+        m_poAttrQuery != nullptr || m_poFilterGeom != nullptr ||
+        m_aosArrowArrayStreamOptions.FetchBool(GAS_OPT_DATETIME_AS_STRING,
+                                               false) ||
+        CPLTestBool(CPLGetConfigOption("OGR_CSV_STREAM_BASE_IMPL", "NO")))
+    {
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    if (!m_poArrowReadState)
+    {
+        auto poState = std::make_unique<ArrowReadState>();
+        if (!InitArrowReadState(poState.get()))
+            return OGRLayer::GetNextArrowArray(stream, out_array);
+
+        if (bNeedRewindBeforeRead)
+            ResetReading();
+
+        poState->nMaxRecordsInChunk =
+            OGRArrowArrayHelper::GetMaxFeaturesInBatch(
+                m_aosArrowArrayStreamOptions);
+        poState->nMaxChunkSize =
+            std::min<size_t>(16 * 1024 * 1024,
+                             std::max<uint32_t>(
+                                 1, OGRArrowArrayHelper::GetMemLimit() / 2));
+        poState->bPreserveOrder =
+            m_aosArrowArrayStreamOptions.FetchBool("PRESERVE_ORDER", true);
+        // Only for testing purposes
+        poState->nReadSize = std::max(
+            1, atoi(CPLGetConfigOption("OGR_CSV_STREAM_READ_SIZE", "1048576")));
+
+        const int nThreads = GDALGetNumThreads();
+        if (nThreads > 1)
+        {
+            CPLWorkerThreadPool *poThreadPool =
+                GDALGetGlobalThreadPool(nThreads);
+            if (poThreadPool)
+            {
+                poState->poJobQueue = poThreadPool->CreateJobQueue();
+                // Bound the number of chunks being decoded or waiting to
+                // be returned
+                poState->nMaxChunksInFlight = 2 * static_cast<size_t>(nThreads);
+            }
+        }
+        m_poArrowReadState = std::move(poState);
+    }
+
+    memset(out_array, 0, sizeof(*out_array));
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = true;
+    ArrowReadState &oState = *m_poArrowReadState;
+
+    while (!oState.bEOF &&
+           oState.apoChunks.size() < oState.nMaxChunksInFlight)
+    {
+        std::shared_ptr<ArrowReadState::Chunk> poChunk =
+            oState.ReadNextChunk(fpCSV);
+        if (!poChunk)
+            break;
+        poChunk->nFirstFID = m_nNextFID;
+        m_nNextFID += poChunk->nRecords;
+        m_nFeaturesRead += poChunk->nRecords;
+        poChunk->poHelper = std::make_unique<OGRArrowArrayHelper>(
+            m_poDS, poFeatureDefn, m_aosArrowArrayStreamOptions,
+            &poChunk->sArray);
+        if (poChunk->sArray.release == nullptr)
+            return ENOMEM;
+        oState.apoChunks.push_back(poChunk);
+
+        if (oState.poJobQueue)
+        {
+            const ArrowReadState *poState = &oState;
+            oState.poJobQueue->SubmitJob(
+                [poState, poChunk]()
+                {
+                    {
+                        auto oContext =
+                            poChunk->oErrorAccumulator.InstallForCurrentScope();
+                        CPL_IGNORE_RET_VAL(oContext);
+                        poState->ParseChunk(*poChunk);
+                    }
+                    poChunk->bDone = true;
+                });
+        }
+        else
+        {
+            oState.ParseChunk(*poChunk);
+            poChunk->bDone = true;
+        }
+    }
+
+    if (oState.apoChunks.empty())
+        return 0;
+
+    // Pick the first chunk, or with PRESERVE_ORDER=NO, the first decoded one
+    auto oIter = oState.apoChunks.begin();
+    while (!(*oIter)->bDone)
+    {
+        if (!oState.bPreserveOrder)
+        {
+            oIter = std::find_if(
+                oState.apoChunks.begin(), oState.apoChunks.end(),
+                [](const std::shared_ptr<ArrowReadState::Chunk> &poChunk)
+                { return poChunk->bDone.load(); });
+            if (oIter != oState.apoChunks.end())
+                break;
+            oIter = oState.apoChunks.begin();
+        }
+        oState.poJobQueue->WaitEvent();
+    }
+    std::shared_ptr<ArrowReadState::Chunk> poChunk = std::move(*oIter);
+    oState.apoChunks.erase(oIter);
+
+    poChunk->oErrorAccumulator.ReplayErrors();
+    if (poChunk->nBadValueFID >= 0 && !bWarningBadTypeOrWidth)
+    {
+        bWarningBadTypeOrWidth = true;
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Invalid value type found in record %" PRId64
+                 " for field %s. "
+                 "This warning will no longer be emitted",
+                 poChunk->nBadValueFID,
+                 poFeatureDefn->GetFieldDefn(poChunk->iBadValueField)
+                     ->GetNameRef());
+    }
+    if (poChunk->bOutOfMemory)
+        return ENOMEM;
+
+    memcpy(out_array, &poChunk->sArray, sizeof(*out_array));
+    memset(&poChunk->sArray, 0, sizeof(poChunk->sArray));
+    return 0;
+}
+
+/************************************************************************/
+/*                          GetMetadataItem()                           */
+/************************************************************************/
+
+const char *OGRCSVLayer::GetMetadataItem(const char *pszName,
+                                         const char *pszDomain)
+{
+    if (pszName && pszDomain && EQUAL(pszDomain, "__DEBUG__") &&
+        EQUAL(pszName, "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH"))
+    {
+        return m_bLastGetNextArrowArrayUsedOptimizedCodePath ? "YES" : "NO";
+    }
+    return OGRLayer::GetMetadataItem(pszName, pszDomain);
+}
+
 /************************************************************************/
 /*                           TestCapability()                           */
 /************************************************************************/
@@ -1777,6 +2717,9 @@ int OGRCSVLayer::TestCapability(const char *pszCap) const
         return TRUE;
     else if (EQUAL(pszCap, OLCZGeometries))
         return TRUE;
+    else if (EQUAL(pszCap, OLCFastGetArrowStream))
+        return m_poAttrQuery == nullptr && m_poFilterGeom == nullptr &&
+               InitArrowReadState(nullptr);
     else
         return FALSE;
 }
@@ -17,6 +17,7 @@
 #include "ogrlayerarrow.h"
 #include "ogr_p.h"
 #include "ogr_swq.h"
+#include "ogr_swq_program.h"
 #include "ogr_wkb.h"
 #include "ogr_p.h"
 #include "ogrlayer_private.h"
@@ -4844,6 +4845,342 @@ static bool SetFieldForOtherFormats(OGRFeature &oFeature,
     return true;
 }
 
+/************************************************************************/
+/*                 IsFormatUsableByCompiledAttrQuery()                  */
+/************************************************************************/
+
+/** Whether values of an Arrow array of the specified format can be directly
+ * compared by a swq_instruction, with the same result as after their
+ * conversion to a OGRFeature field of type eFieldType.
+ */
+static bool IsFormatUsableByCompiledAttrQuery(swq_field_type eFieldType,
+                                              const char *format)
+{
+    const bool bIsSmallInt = IsBoolean(format) || IsInt8(format) ||
+                             IsUInt8(format) || IsInt16(format) ||
+                             IsUInt16(format) || IsInt32(format);
+    switch (eFieldType)
+    {
+        case SWQ_INTEGER:
+        case SWQ_BOOLEAN:
+            return bIsSmallInt;
+        case SWQ_INTEGER64:
+            return bIsSmallInt || IsUInt32(format) || IsInt64(format);
+        case SWQ_FLOAT:
+            return IsFloat32(format) || IsFloat64(format) || IsUInt64(format);
+        case SWQ_STRING:
+            return IsString(format) || IsLargeString(format);
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                    TestNumericArrayValues()                          */
+/************************************************************************/
+
+template <class T>
+static void TestNumericArrayValues(const swq_instruction &oInstr,
+                                   const struct ArrowArray *psArray,
+                                   size_t nLength, uint8_t *pabyValue)
+{
+    const T *paValues = static_cast<const T *>(psArray->buffers[1]) +
+                        static_cast<size_t>(psArray->offset);
+    if (oInstr.eValueType == swq_program_value_type::FLOAT)
+    {
+        for (size_t i = 0; i < nLength; ++i)
+            pabyValue[i] = oInstr.TestFloat(static_cast<double>(paValues[i]));
+    }
+    else if (oInstr.eFieldType == SWQ_INTEGER && sizeof(T) == sizeof(int64_t))
+    {
+        // FID, read as a 32-bit integer, as done by
+        // OGRFeature::GetFieldAsInteger()
+        for (size_t i = 0; i < nLength; ++i)
+        {
+            const int64_t nValue = static_cast<int64_t>(paValues[i]);
+            pabyValue[i] = oInstr.TestInteger(
+                std::clamp<int64_t>(nValue, INT_MIN, INT_MAX));
+        }
+    }
+    else
+    {
+        for (size_t i = 0; i < nLength; ++i)
+            pabyValue[i] =
+                oInstr.TestInteger(static_cast<int64_t>(paValues[i]));
+    }
+}
+
+/************************************************************************/
+/*                     TestStringArrayValues()                          */
+/************************************************************************/
+
+template <class OffsetType>
+static void TestStringArrayValues(const swq_instruction &oInstr,
+                                  const struct ArrowArray *psArray,
+                                  size_t nLength, uint8_t *pabyValue)
+{
+    const OffsetType *panOffsets =
+        static_cast<const OffsetType *>(psArray->buffers[1]) +
+        static_cast<size_t>(psArray->offset);
+    const char *pabyData = static_cast<const char *>(psArray->buffers[2]);
+    std::string osValue;
+    for (size_t i = 0; i < nLength; ++i)
+    {
+        osValue.assign(pabyData + static_cast<size_t>(panOffsets[i]),
+                       static_cast<size_t>(panOffsets[i + 1] - panOffsets[i]));
+        pabyValue[i] = oInstr.TestString(osValue.c_str());
+    }
+}
+
+/************************************************************************/
+/*               FillValidityArrayFromCompiledAttrQuery()               */
+/************************************************************************/
+
+/** Evaluate a compiled attribute filter column by column on the rows of a
+ * batch, without instantiating features.
+ *
+ * Returns false if some fields used by the filter cannot be directly read
+ * from the batch, in which case FillValidityArrayFromAttrQuery() must
+ * evaluate it feature by feature.
+ */
+static bool FillValidityArrayFromCompiledAttrQuery(
+    const OGRLayer *poLayer, const swq_program &oProgram,
+    const struct ArrowSchema *schema, const struct ArrowArray *array,
+    std::vector<bool> &abyValidityFromFilters, CSLConstList papszOptions,
+    size_t &nCountIntersecting)
+{
+    auto poFeatureDefn = const_cast<OGRLayer *>(poLayer)->GetLayerDefn();
+    const int nFieldCount = poFeatureDefn->GetFieldCount();
+    const size_t nLength = abyValidityFromFilters.size();
+    const auto &aoInstructions = oProgram.GetInstructions();
+
+    // Find the Arrow array of the field tested by each instruction.
+    // Only top-level arrays are handled.
+    std::vector<const struct ArrowArray *> apsArrays(aoInstructions.size());
+    std::vector<const char *> apszFormats(aoInstructions.size());
+    const char *pszBaseSeqFID =
+        CSLFetchNameValue(papszOptions, "BASE_SEQUENTIAL_FID");
+    for (size_t iInstr = 0; iInstr < aoInstructions.size(); ++iInstr)
+    {
+        const auto &oInstr = aoInstructions[iInstr];
+        if (oInstr.iField < 0)
+            continue;
+        const bool bIsFID = oInstr.iField >= nFieldCount;
+        // BASE_SEQUENTIAL_FID is set when there is no Arrow column for the
+        // FID and we assume sequential FID numbering
+        if (bIsFID && pszBaseSeqFID)
+            continue;
+        const char *pszName =
+            bIsFID ? const_cast<OGRLayer *>(poLayer)->GetFIDColumn()
+                   : poFeatureDefn->GetFieldDefn(oInstr.iField)->GetNameRef();
+        if (!pszName || !pszName[0])
+            return false;
+        for (int64_t iChild = 0; iChild < schema->n_children; ++iChild)
+        {
+            if (strcmp(schema->children[iChild]->name, pszName) == 0)
+            {
+                const char *format = schema->children[iChild]->format;
+                // Dictionary-encoded values are not handled
+                if (schema->children[iChild]->dictionary)
+                    break;
+                if (bIsFID ? (IsInt32(format) || IsInt64(format))
+                           : (oInstr.eOp == SWQ_ISNULL ||
+                              IsFormatUsableByCompiledAttrQuery(
+                                  oInstr.eFieldType, format)))
+                {
+                    apsArrays[iInstr] = array->children[iChild];
+                    apszFormats[iInstr] = format;
+                }
+                break;
+            }
+        }
+        if (!apsArrays[iInstr])
+            return false;
+    }
+
+    // Stack of results of the instructions, as value and null flags, with
+    // the same semantics as in swq_program::Evaluate()
+    std::vector<std::vector<uint8_t>> aabyValue;
+    std::vector<std::vector<uint8_t>> aabyNull;
+    size_t nDepth = 0;
+    for (size_t iInstr = 0; iInstr < aoInstructions.size(); ++iInstr)
+    {
+        const auto &oInstr = aoInstructions[iInstr];
+        if (oInstr.eOp == SWQ_AND || oInstr.eOp == SWQ_OR)
+        {
+            --nDepth;
+            uint8_t *pabyValue0 = aabyValue[nDepth - 1].data();
+            uint8_t *pabyNull0 = aabyNull[nDepth - 1].data();
+            const uint8_t *pabyValue1 = aabyValue[nDepth].data();
+            const uint8_t *pabyNull1 = aabyNull[nDepth].data();
+            if (oInstr.eOp == SWQ_AND)
+            {
+                for (size_t i = 0; i < nLength; ++i)
+                {
+                    pabyValue0[i] &= pabyValue1[i];
+                    pabyNull0[i] &= pabyNull1[i];
+                }
+            }
+            else
+            {
+                for (size_t i = 0; i < nLength; ++i)
+                {
+                    pabyValue0[i] |= pabyValue1[i];
+                    pabyNull0[i] |= pabyNull1[i];
+                }
+            }
+            continue;
+        }
+        if (oInstr.eOp == SWQ_NOT)
+        {
+            uint8_t *pabyValue = aabyValue[nDepth - 1].data();
+            const uint8_t *pabyNull = aabyNull[nDepth - 1].data();
+            for (size_t i = 0; i < nLength; ++i)
+                pabyValue[i] = (pabyValue[i] | pabyNull[i]) ^ 1;
+            continue;
+        }
+
+        if (nDepth == aabyValue.size())
+        {
+            aabyValue.emplace_back(nLength);
+            aabyNull.emplace_back(nLength);
+        }
+        uint8_t *pabyValue = aabyValue[nDepth].data();
+        uint8_t *pabyNull = aabyNull[nDepth].data();
+        ++nDepth;
+
+        const struct ArrowArray *psArray = apsArrays[iInstr];
+        if (!psArray)
+        {
+            // Sequential FID
+            const GIntBig nBaseSeqFID = CPLAtoGIntBig(pszBaseSeqFID);
+            for (size_t i = 0; i < nLength; ++i)
+            {
+                pabyNull[i] = false;
+                if (oInstr.eOp == SWQ_ISNULL)
+                {
+                    pabyValue[i] = false;
+                    continue;
+                }
+                const int64_t nFID = nBaseSeqFID + static_cast<int64_t>(i);
+                pabyValue[i] =
+                    oInstr.eValueType == swq_program_value_type::FLOAT
+                        ? oInstr.TestFloat(static_cast<double>(nFID))
+                    : oInstr.eFieldType == SWQ_INTEGER
+                        ? oInstr.TestInteger(
+                              std::min<int64_t>(nFID, INT_MAX))
+                        : oInstr.TestInteger(nFID);
+            }
+            continue;
+        }
+
+        const char *format = apszFormats[iInstr];
+        const size_t nOffset = static_cast<size_t>(psArray->offset);
+        if (oInstr.eOp == SWQ_ISNULL)
+        {
+            // done below
+        }
+        else if (IsBoolean(format))
+        {
+            const uint8_t *pabyData =
+                static_cast<const uint8_t *>(psArray->buffers[1]);
+            for (size_t i = 0; i < nLength; ++i)
+            {
+                const int64_t nValue = TestBit(pabyData, nOffset + i) ? 1 : 0;
+                pabyValue[i] =
+                    oInstr.eValueType == swq_program_value_type::FLOAT
+                        ? oInstr.TestFloat(static_cast<double>(nValue))
+                        : oInstr.TestInteger(nValue);
+            }
+        }
+        else if (IsInt8(format))
+            TestNumericArrayValues<int8_t>(oInstr, psArray, nLength,
+                                           pabyValue);
+        else if (IsUInt8(format))
+            TestNumericArrayValues<uint8_t>(oInstr, psArray, nLength,
+                                            pabyValue);
+        else if (IsInt16(format))
+            TestNumericArrayValues<int16_t>(oInstr, psArray, nLength,
+                                            pabyValue);
+        else if (IsUInt16(format))
+            TestNumericArrayValues<uint16_t>(oInstr, psArray, nLength,
+                                             pabyValue);
+        else if (IsInt32(format))
+            TestNumericArrayValues<int32_t>(oInstr, psArray, nLength,
+                                            pabyValue);
+        else if (IsUInt32(format))
+            TestNumericArrayValues<uint32_t>(oInstr, psArray, nLength,
+                                             pabyValue);
+        else if (IsInt64(format))
+            TestNumericArrayValues<int64_t>(oInstr, psArray, nLength,
+                                            pabyValue);
+        else if (IsUInt64(format))
+            TestNumericArrayValues<uint64_t>(oInstr, psArray, nLength,
+                                             pabyValue);
+        else if (IsFloat32(format))
+            TestNumericArrayValues<float>(oInstr, psArray, nLength,
+                                          pabyValue);
+        else if (IsFloat64(format))
+            TestNumericArrayValues<double>(oInstr, psArray, nLength,
+                                           pabyValue);
+        else if (IsString(format))
+            TestStringArrayValues<uint32_t>(oInstr, psArray, nLength,
+                                            pabyValue);
+        else if (IsLargeString(format))
+            TestStringArrayValues<uint64_t>(oInstr, psArray, nLength,
+                                            pabyValue);
+        else
+        {
+            // Guaranteed by IsFormatUsableByCompiledAttrQuery()
+            CPLAssert(false);
+        }
+
+        const bool bIsFID = oInstr.iField >= nFieldCount;
+        const uint8_t *pabyValidity =
+            psArray->null_count == 0
+                ? nullptr
+                : static_cast<const uint8_t *>(psArray->buffers[0]);
+        for (size_t i = 0; i < nLength; ++i)
+        {
+            // A FID of OGRNullFID is considered as null by OGRFeature
+            const bool bIsNull =
+                (pabyValidity && !TestBit(pabyValidity, nOffset + i)) ||
+                (bIsFID &&
+                 (IsInt32(format)
+                      ? static_cast<const int32_t *>(
+                            psArray->buffers[1])[nOffset + i] == OGRNullFID
+                      : static_cast<const int64_t *>(
+                            psArray->buffers[1])[nOffset + i] == OGRNullFID));
+            if (oInstr.eOp == SWQ_ISNULL)
+            {
+                pabyValue[i] = bIsNull;
+                pabyNull[i] = false;
+            }
+            else
+            {
+                if (bIsNull)
+                    pabyValue[i] = false;
+                pabyNull[i] = bIsNull;
+            }
+        }
+    }
+    CPLAssert(nDepth == 1);
+
+    nCountIntersecting = 0;
+    const uint8_t *pabyResult = aabyValue[0].data();
+    for (size_t i = 0; i < nLength; ++i)
+    {
+        if (!abyValidityFromFilters[i])
+            continue;
+        if (pabyResult[i])
+            ++nCountIntersecting;
+        else
+            abyValidityFromFilters[i] = false;
+    }
+    return true;
+}
+
 /************************************************************************/
 /*                 FillValidityArrayFromAttrQuery()                     */
 /************************************************************************/
@@ -4854,6 +5191,16 @@ static size_t FillValidityArrayFromAttrQuery(
     std::vector<bool> &abyValidityFromFilters, CSLConstList papszOptions)
 {
     size_t nCountIntersecting = 0;
+    if (const auto poProgram = poAttrQuery->GetCompiledProgram())
+    {
+        if (FillValidityArrayFromCompiledAttrQuery(
+                poLayer, *poProgram, schema, array, abyValidityFromFilters,
+                papszOptions, nCountIntersecting))
+        {
+            return nCountIntersecting;
+        }
+    }
+
     auto poFeatureDefn = const_cast<OGRLayer *>(poLayer)->GetLayerDefn();
     OGRFeature oFeature(poFeatureDefn);
 
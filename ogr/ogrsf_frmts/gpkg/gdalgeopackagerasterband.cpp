@@ -15,9 +15,12 @@
 #include "gdal_alg_priv.h"
 #include "ogrsqlitevfs.h"
 #include "cpl_error.h"
+#include "cpl_error_internal.h"
 #include "cpl_float.h"
+#include "gdal_thread_pool.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <limits>
 #include <set>
@@ -27,6 +30,34 @@
 #define DEBUG_VERBOSE
 #endif
 
+/************************************************************************/
+/*                             PendingTile                              */
+/************************************************************************/
+
+struct GDALGPKGMBTilesLikePseudoDataset::PendingTile
+{
+    // Dataset (main or overview) into which the tile must be written
+    GDALGPKGMBTilesLikePseudoDataset *poDS = nullptr;
+    int nRow = 0;
+    int nCol = 0;
+    // If false, the tile must be deleted from the database
+    bool bInsert = true;
+    // Encoded tile, allocated with VSIMalloc(). nullptr on encoding failure
+    GByte *pabyBlob = nullptr;
+    vsi_l_offset nBlobSize = 0;
+    std::atomic<bool> bDone{false};
+    CPLErrorAccumulator oErrorAccumulator{};
+
+    PendingTile() = default;
+
+    ~PendingTile()
+    {
+        CPLFree(pabyBlob);
+    }
+
+    CPL_DISALLOW_COPY_ASSIGN(PendingTile)
+};
+
 /************************************************************************/
 /*                    GDALGPKGMBTilesLikePseudoDataset()                */
 /************************************************************************/
@@ -53,6 +84,10 @@ GDALGPKGMBTilesLikePseudoDataset::GDALGPKGMBTilesLikePseudoDataset()
 
 GDALGPKGMBTilesLikePseudoDataset::~GDALGPKGMBTilesLikePseudoDataset()
 {
+    // Normally already done by FlushTiles()
+    m_poTileEncodingJobQueue.reset();
+    m_apoPendingTiles.clear();
+
     if (m_poParentDS == nullptr && m_hTempDB != nullptr)
     {
         sqlite3_close(m_hTempDB);
@@ -156,6 +191,16 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::FlushTiles()
         }
     }
 
+    if (poMainDS->InsertPendingTiles(0) != CE_None)
+        eErr = CE_Failure;
+    if (poMainDS->m_nTilesEncodedInThreads > 0)
+    {
+        CPLDebug("GPKG", "%d tiles encoded using %d threads",
+                 poMainDS->m_nTilesEncodedInThreads,
+                 poMainDS->m_nTileEncodingThreads);
+        poMainDS->m_nTilesEncodedInThreads = 0;
+    }
+
     if (poMainDS->m_nTileInsertionCount > 0)
     {
         if (poMainDS->ICommitTransaction() != OGRERR_NONE)
@@ -869,6 +914,20 @@ GByte *GDALGPKGMBTilesLikePseudoDataset::ReadTile(int nRow, int nCol,
     CPLDebug("GPKG", "ReadTile(row=%d, col=%d)", nRow, nCol);
 #endif
 
+    // Make sure tiles being encoded are visible in the database
+    GDALGPKGMBTilesLikePseudoDataset *poMainDS =
+        m_poParentDS ? m_poParentDS : this;
+    if (!poMainDS->m_apoPendingTiles.empty())
+    {
+        CPLDebug("GPKG",
+                 "Inserting %d pending tiles before reading tile "
+                 "(row=%d, col=%d)",
+                 static_cast<int>(poMainDS->m_apoPendingTiles.size()), nRow,
+                 nCol);
+        if (poMainDS->InsertPendingTiles(0) != CE_None)
+            return nullptr;
+    }
+
     char *pszSQL = sqlite3_mprintf(
         "SELECT tile_data%s FROM \"%w\" "
         "WHERE zoom_level = %d AND tile_row = %d AND tile_column = %d%s",
@@ -1547,6 +1606,175 @@ static void ProcessInt16UInt16Tile(
     }
 }
 
+/************************************************************************/
+/*                             EncodeTile()                             */
+/************************************************************************/
+
+// Encode poMEMDS with poDriver. Return a buffer to be freed with CPLFree(),
+// or nullptr in case of error. May be called from worker threads.
+static GByte *EncodeTile(GDALDriver *poDriver, GDALDataset *poMEMDS,
+                         CSLConstList papszDriverOptions,
+                         vsi_l_offset &nBlobSize)
+{
+    const CPLString osMemFileName(
+        VSIMemGenerateHiddenFilename("gpkg_write_tile"));
+#ifdef DEBUG
+    VSIStatBufL sStat;
+    CPLAssert(VSIStatL(osMemFileName, &sStat) != 0);
+#endif
+    GDALDataset *poOutDS = poDriver->CreateCopy(
+        osMemFileName, poMEMDS, FALSE, papszDriverOptions, nullptr, nullptr);
+    GByte *pabyBlob = nullptr;
+    if (poOutDS)
+    {
+        GDALClose(poOutDS);
+        pabyBlob = VSIGetMemFileBuffer(osMemFileName, &nBlobSize, TRUE);
+    }
+    VSIUnlink(osMemFileName);
+    return pabyBlob;
+}
+
+/************************************************************************/
+/*                      GetTileEncodingJobQueue()                       */
+/************************************************************************/
+
+CPLJobQueue *GDALGPKGMBTilesLikePseudoDataset::GetTileEncodingJobQueue()
+{
+    CPLAssert(m_poParentDS == nullptr);
+    if (!m_bTileEncodingJobQueueInitialized)
+    {
+        m_bTileEncodingJobQueueInitialized = true;
+        const int nThreads = GDALGetNumThreads();
+        if (nThreads > 1)
+        {
+            CPLWorkerThreadPool *poThreadPool =
+                GDALGetGlobalThreadPool(nThreads);
+            if (poThreadPool)
+            {
+                m_poTileEncodingJobQueue = poThreadPool->CreateJobQueue();
+                m_nTileEncodingThreads = nThreads;
+            }
+        }
+    }
+    return m_poTileEncodingJobQueue.get();
+}
+
+/************************************************************************/
+/*                        InsertPendingTiles()                          */
+/************************************************************************/
+
+// Insert tiles encoded by worker threads, in submission order, until at
+// most nMaxRemaining tiles are pending.
+CPLErr
+GDALGPKGMBTilesLikePseudoDataset::InsertPendingTiles(size_t nMaxRemaining)
+{
+    CPLAssert(m_poParentDS == nullptr);
+    CPLErr eErr = CE_None;
+    while (m_apoPendingTiles.size() > nMaxRemaining)
+    {
+        std::shared_ptr<PendingTile> poTile =
+            std::move(m_apoPendingTiles.front());
+        m_apoPendingTiles.pop_front();
+        while (!poTile->bDone)
+            m_poTileEncodingJobQueue->WaitEvent();
+        poTile->oErrorAccumulator.ReplayErrors();
+        ++m_nTilesEncodedInThreads;
+
+        if (!poTile->bInsert)
+        {
+            if (!poTile->poDS->DeleteTile(poTile->nRow, poTile->nCol))
+                eErr = CE_Failure;
+        }
+        else if (poTile->pabyBlob == nullptr)
+        {
+            eErr = CE_Failure;
+        }
+        else
+        {
+            GByte *pabyBlob = poTile->pabyBlob;
+            poTile->pabyBlob = nullptr;
+            if (poTile->poDS->InsertTileBlob(poTile->nRow, poTile->nCol,
+                                             pabyBlob,
+                                             poTile->nBlobSize) != CE_None)
+            {
+                eErr = CE_Failure;
+            }
+        }
+    }
+    return eErr;
+}
+
+/************************************************************************/
+/*                          InsertTileBlob()                            */
+/************************************************************************/
+
+// Insert an encoded tile in the tile table, within a transaction that is
+// committed every 1000 tiles. Takes ownership of pabyBlob.
+CPLErr GDALGPKGMBTilesLikePseudoDataset::InsertTileBlob(int nRow, int nCol,
+                                                        GByte *pabyBlob,
+                                                        vsi_l_offset nBlobSize)
+{
+    /* Create or commit and recreate transaction */
+    GDALGPKGMBTilesLikePseudoDataset *poMainDS =
+        m_poParentDS ? m_poParentDS : this;
+    if (poMainDS->m_nTileInsertionCount < 0)
+    {
+        CPLFree(pabyBlob);
+        return CE_Failure;
+    }
+    if (poMainDS->m_nTileInsertionCount == 0)
+    {
+        poMainDS->IStartTransaction();
+    }
+    else if (poMainDS->m_nTileInsertionCount == 1000)
+    {
+        if (poMainDS->ICommitTransaction() != OGRERR_NONE)
+        {
+            poMainDS->m_nTileInsertionCount = -1;
+            CPLFree(pabyBlob);
+            return CE_Failure;
+        }
+        poMainDS->IStartTransaction();
+        poMainDS->m_nTileInsertionCount = 0;
+    }
+    poMainDS->m_nTileInsertionCount++;
+
+    CPLErr eErr = CE_Failure;
+    char *pszSQL = sqlite3_mprintf("INSERT OR REPLACE INTO \"%w\" "
+                                   "(zoom_level, tile_row, tile_column, "
+                                   "tile_data) VALUES (%d, %d, %d, ?)",
+                                   m_osRasterTable.c_str(), m_nZoomLevel,
+                                   GetRowFromIntoTopConvention(nRow), nCol);
+#ifdef DEBUG_VERBOSE
+    CPLDebug("GPKG", "%s", pszSQL);
+#endif
+    sqlite3_stmt *hStmt = nullptr;
+    int rc = SQLPrepareWithError(IGetDB(), pszSQL, -1, &hStmt, nullptr);
+    if (rc != SQLITE_OK)
+    {
+        CPLFree(pabyBlob);
+    }
+    else
+    {
+        sqlite3_bind_blob(hStmt, 1, pabyBlob, static_cast<int>(nBlobSize),
+                          CPLFree);
+        rc = sqlite3_step(hStmt);
+        if (rc == SQLITE_DONE)
+            eErr = CE_None;
+        else
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "Failure when inserting tile (row=%d,col=%d) at "
+                     "zoom_level=%d : %s",
+                     GetRowFromIntoTopConvention(nRow), nCol, m_nZoomLevel,
+                     sqlite3_errmsg(IGetDB()));
+        }
+    }
+    sqlite3_finalize(hStmt);
+    sqlite3_free(pszSQL);
+    return eErr;
+}
+
 /************************************************************************/
 /*                         WriteTile()                                  */
 /************************************************************************/
@@ -1599,6 +1827,35 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
     if (bAllNonDirty)
         return CE_None;
 
+    // Tiles are encoded by worker threads if GDAL_NUM_THREADS > 1, except
+    // for gridded coverage data whose ancillary table needs the tile id.
+    GDALGPKGMBTilesLikePseudoDataset *poMainDS =
+        m_poParentDS ? m_poParentDS : this;
+    CPLJobQueue *poJobQueue =
+        (m_eTF == GPKG_TF_PNG_16BIT || m_eTF == GPKG_TF_TIFF_32BIT_FLOAT)
+            ? nullptr
+            : poMainDS->GetTileEncodingJobQueue();
+
+    // Deletion of an empty tile must not overtake the insertion of a
+    // previous version of it that would still be being encoded.
+    const auto DeleteEmptyTile = [this, poMainDS, nRow, nCol]()
+    {
+        if (poMainDS->m_apoPendingTiles.empty())
+        {
+            DeleteTile(nRow, nCol);
+        }
+        else
+        {
+            auto poTile = std::make_shared<PendingTile>();
+            poTile->poDS = this;
+            poTile->nRow = nRow;
+            poTile->nCol = nCol;
+            poTile->bInsert = false;
+            poTile->bDone = true;
+            poMainDS->m_apoPendingTiles.push_back(std::move(poTile));
+        }
+    };
+
     int nBlockXSize, nBlockYSize;
     IGetRasterBand(1)->GetBlockSize(&nBlockXSize, &nBlockYSize);
 
@@ -1754,7 +2011,7 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
             // it exists
             if (byFirstAlphaVal == 0)
             {
-                DeleteTile(nRow, nCol);
+                DeleteEmptyTile();
 
                 return CE_None;
             }
@@ -1781,7 +2038,7 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
         {
             // If tile is fully transparent, don't serialize it and remove it if
             // it exists
-            DeleteTile(nRow, nCol);
+            DeleteEmptyTile();
 
             return CE_None;
         }
@@ -1810,7 +2067,7 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
         {
             // If tile is fully transparent, don't serialize it and remove it if
             // it exists
-            DeleteTile(nRow, nCol);
+            DeleteEmptyTile();
 
             return CE_None;
         }
@@ -1825,8 +2082,6 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
                  nRow, nCol, m_nZoomLevel);
     }
 
-    const CPLString osMemFileName(
-        VSIMemGenerateHiddenFilename("gpkg_write_tile"));
     const char *pszDriverName = "PNG";
     CPL_IGNORE_RET_VAL(pszDriverName);  // Make CSA happy
     bool bTileDriverSupports1Band = false;
@@ -2362,78 +2617,64 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
                                     CPLSPrintf("%d", nBlockYSize));
             }
         }
-#ifdef DEBUG
-        VSIStatBufL sStat;
-        CPLAssert(VSIStatL(osMemFileName, &sStat) != 0);
-#endif
-        GDALDataset *poOutDS =
-            l_poDriver->CreateCopy(osMemFileName, poMEMDS, FALSE,
-                                   papszDriverOptions, nullptr, nullptr);
-        CSLDestroy(papszDriverOptions);
-        CPLFree(pTempTileBuffer);
 
-        if (poOutDS)
+        if (poJobQueue)
         {
-            GDALClose(poOutDS);
-            vsi_l_offset nBlobSize = 0;
-            GByte *pabyBlob =
-                VSIGetMemFileBuffer(osMemFileName, &nBlobSize, TRUE);
-
-            /* Create or commit and recreate transaction */
-            GDALGPKGMBTilesLikePseudoDataset *poMainDS =
-                m_poParentDS ? m_poParentDS : this;
-            if (poMainDS->m_nTileInsertionCount == 0)
-            {
-                poMainDS->IStartTransaction();
-            }
-            else if (poMainDS->m_nTileInsertionCount == 1000)
+            // The encoding job works on its own copy of the tile, since
+            // m_pabyCachedTiles is going to be reused for the next tiles.
+            GDALDriver *poMEMDriver =
+                GDALDriver::FromHandle(GDALGetDriverByName("MEM"));
+            GDALDataset *poMEMCopyDS =
+                poMEMDriver ? poMEMDriver->CreateCopy("", poMEMDS, FALSE,
+                                                      nullptr, nullptr, nullptr)
+                            : nullptr;
+            delete poMEMDS;
+            CPLFree(pTempTileBuffer);
+            if (poMEMCopyDS == nullptr)
             {
-                if (poMainDS->ICommitTransaction() != OGRERR_NONE)
-                {
-                    poMainDS->m_nTileInsertionCount = -1;
-                    CPLFree(pabyBlob);
-                    VSIUnlink(osMemFileName);
-                    delete poMEMDS;
-                    return CE_Failure;
-                }
-                poMainDS->IStartTransaction();
-                poMainDS->m_nTileInsertionCount = 0;
+                CSLDestroy(papszDriverOptions);
+                return CE_Failure;
             }
-            poMainDS->m_nTileInsertionCount++;
 
-            char *pszSQL =
-                sqlite3_mprintf("INSERT OR REPLACE INTO \"%w\" "
-                                "(zoom_level, tile_row, tile_column, "
-                                "tile_data) VALUES (%d, %d, %d, ?)",
-                                m_osRasterTable.c_str(), m_nZoomLevel,
-                                GetRowFromIntoTopConvention(nRow), nCol);
-#ifdef DEBUG_VERBOSE
-            CPLDebug("GPKG", "%s", pszSQL);
-#endif
-            sqlite3_stmt *hStmt = nullptr;
-            int rc = SQLPrepareWithError(IGetDB(), pszSQL, -1, &hStmt, nullptr);
-            if (rc != SQLITE_OK)
-            {
-                CPLFree(pabyBlob);
-            }
-            else
-            {
-                sqlite3_bind_blob(hStmt, 1, pabyBlob,
-                                  static_cast<int>(nBlobSize), CPLFree);
-                rc = sqlite3_step(hStmt);
-                if (rc == SQLITE_DONE)
-                    eErr = CE_None;
-                else
+            auto poTile = std::make_shared<PendingTile>();
+            poTile->poDS = this;
+            poTile->nRow = nRow;
+            poTile->nCol = nCol;
+            poMainDS->m_apoPendingTiles.push_back(poTile);
+            poJobQueue->SubmitJob(
+                [poTile, l_poDriver, poMEMCopyDS, papszDriverOptions]()
                 {
-                    CPLError(CE_Failure, CPLE_AppDefined,
-                             "Failure when inserting tile (row=%d,col=%d) at "
-                             "zoom_level=%d : %s",
-                             GetRowFromIntoTopConvention(nRow), nCol,
-                             m_nZoomLevel, sqlite3_errmsg(IGetDB()));
-                }
-            }
-            sqlite3_finalize(hStmt);
-            sqlite3_free(pszSQL);
+                    {
+                        auto oContext = poTile->oErrorAccumulator
+                                            .InstallForCurrentScope();
+                        CPL_IGNORE_RET_VAL(oContext);
+                        poTile->pabyBlob =
+                            EncodeTile(l_poDriver, poMEMCopyDS,
+                                       papszDriverOptions, poTile->nBlobSize);
+                    }
+                    delete poMEMCopyDS;
+                    CSLDestroy(papszDriverOptions);
+                    poTile->bDone = true;
+                });
+
+            // Bound the number of tiles being encoded or waiting for
+            // insertion
+            return poMainDS->InsertPendingTiles(
+                2 * static_cast<size_t>(poMainDS->m_nTileEncodingThreads));
+        }
+
+        vsi_l_offset nBlobSize = 0;
+        GByte *pabyBlob =
+            EncodeTile(l_poDriver, poMEMDS, papszDriverOptions, nBlobSize);
+        CSLDestroy(papszDriverOptions);
+        delete poMEMDS;
+        CPLFree(pTempTileBuffer);
+
+        if (pabyBlob)
+        {
+            eErr = InsertTileBlob(nRow, nCol, pabyBlob, nBlobSize);
+            if (poMainDS->m_nTileInsertionCount < 0)
+                return CE_Failure;
 
             if (m_eTF == GPKG_TF_PNG_16BIT || m_eTF == GPKG_TF_TIFF_32BIT_FLOAT)
             {
@@ -2444,7 +2685,7 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
                 {
                     DeleteFromGriddedTileAncillary(nTileId);
 
-                    pszSQL = sqlite3_mprintf(
+                    char *pszSQL = sqlite3_mprintf(
                         "INSERT INTO gpkg_2d_gridded_tile_ancillary "
                         "(tpudt_name, tpudt_id, scale, offset, min, max, "
                         "mean, std_dev) VALUES "
@@ -2453,9 +2694,9 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
 #ifdef DEBUG_VERBOSE
                     CPLDebug("GPKG", "%s", pszSQL);
 #endif
-                    hStmt = nullptr;
-                    rc = SQLPrepareWithError(IGetDB(), pszSQL, -1, &hStmt,
-                                             nullptr);
+                    sqlite3_stmt *hStmt = nullptr;
+                    int rc = SQLPrepareWithError(IGetDB(), pszSQL, -1, &hStmt,
+                                                 nullptr);
                     if (rc != SQLITE_OK)
                     {
                         eErr = CE_Failure;
@@ -2485,9 +2726,6 @@ CPLErr GDALGPKGMBTilesLikePseudoDataset::WriteTileInternal()
                 }
             }
         }
-
-        VSIUnlink(osMemFileName);
-        delete poMEMDS;
     }
     else
     {
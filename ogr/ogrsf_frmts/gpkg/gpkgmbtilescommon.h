@@ -14,9 +14,13 @@
 #define GPKGMBTILESCOMMON_H_INCLUDED
 
 #include "cpl_string.h"
+#include "cpl_worker_thread_pool.h"
 #include "gdal_pam.h"
 #include <sqlite3.h>
 
+#include <deque>
+#include <memory>
+
 typedef struct
 {
     int nRow;
@@ -97,6 +101,24 @@ class GDALGPKGMBTilesLikePseudoDataset /* non final */
 
   private:
     bool m_bInWriteTile = false;
+
+    // Tile encoding jobs run by worker threads when GDAL_NUM_THREADS > 1.
+    // Only used on the main dataset (m_poParentDS == nullptr). Encoded tiles
+    // are inserted in the database by the calling thread, in submission
+    // order.
+    struct PendingTile;
+    std::deque<std::shared_ptr<PendingTile>> m_apoPendingTiles{};
+    std::unique_ptr<CPLJobQueue> m_poTileEncodingJobQueue{};
+    int m_nTileEncodingThreads = 0;
+    bool m_bTileEncodingJobQueueInitialized = false;
+    // Number of tiles encoded by worker threads since the last FlushTiles()
+    int m_nTilesEncodedInThreads = 0;
+
+    CPLJobQueue *GetTileEncodingJobQueue();
+    CPLErr InsertPendingTiles(size_t nMaxRemaining);
+    CPLErr InsertTileBlob(int nRow, int nCol, GByte *pabyBlob,
+                          vsi_l_offset nBlobSize);
+
     CPLErr WriteTileInternal(); /* should only be called by WriteTile() */
     GIntBig GetTileId(int nRow, int nCol);
     bool DeleteTile(int nRow, int nCol);
@@ -777,9 +777,11 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
 #ifdef ENABLE_GPKG_OGR_CONTENTS
     void CreateFeatureCountTriggers(const char *pszTableName = nullptr);
     void DisableFeatureCountTriggers(bool bNullifyFeatureCount = true);
+    void IncrementTotalFeatureCount();
 #endif
 
     void CheckGeometryType(const OGRFeature *poFeature);
+    void CheckGeometryType(OGRwkbGeometryType eGeomTypeIn);
 
     OGRErr ReadTableDefinition();
     void InitView();
@@ -788,6 +790,7 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
 
     bool StartDeferredSpatialIndexUpdate();
     bool FlushPendingSpatialIndexUpdate();
+    bool AddRTreeEntry(GIntBig nFID, const OGREnvelope &oEnv);
     void WorkaroundUpdate1TriggerIssue();
     void RevertWorkaroundUpdate1TriggerIssue();
 
@@ -895,6 +898,10 @@ class OGRGeoPackageTableLayer final : public OGRGeoPackageLayer
     OGRErr RollbackTransaction() override;
     GIntBig GetFeatureCount(int) override;
 
+    bool WriteArrowBatch(const struct ArrowSchema *schema,
+                         struct ArrowArray *array,
+                         CSLConstList papszOptions = nullptr) override;
+
     OGRErr IGetExtent(int iGeomField, OGREnvelope *psExtent,
                       bool bForce) override;
 
@@ -2155,16 +2155,22 @@ void OGRGeoPackageTableLayer::DisableFeatureCountTriggers(
  * reflect the dimensionality of feature geometries.
  */
 void OGRGeoPackageTableLayer::CheckGeometryType(const OGRFeature *poFeature)
+{
+    const OGRGeometry *poGeom = poFeature->GetGeometryRef();
+    CheckGeometryType(poGeom ? poGeom->getGeometryType() : wkbNone);
+}
+
+// eGeomTypeIn is the type of the geometry to be written, or wkbNone if the
+// geometry is null.
+void OGRGeoPackageTableLayer::CheckGeometryType(OGRwkbGeometryType eGeomTypeIn)
 {
     const OGRwkbGeometryType eLayerGeomType = GetGeomType();
     const OGRwkbGeometryType eFlattenLayerGeomType = wkbFlatten(eLayerGeomType);
-    const OGRGeometry *poGeom = poFeature->GetGeometryRef();
     if (eFlattenLayerGeomType != wkbNone && eFlattenLayerGeomType != wkbUnknown)
     {
-        if (poGeom != nullptr)
+        if (eGeomTypeIn != wkbNone)
         {
-            OGRwkbGeometryType eGeomType =
-                wkbFlatten(poGeom->getGeometryType());
+            OGRwkbGeometryType eGeomType = wkbFlatten(eGeomTypeIn);
             if (!OGR_GT_IsSubClassOf(eGeomType, eFlattenLayerGeomType) &&
                 !cpl::contains(m_eSetBadGeomTypeWarned, eGeomType))
             {
@@ -2189,10 +2195,10 @@ void OGRGeoPackageTableLayer::CheckGeometryType(const OGRFeature *poFeature)
     // if we have geometries with Z and M components
     if (m_nZFlag == 0 || m_nMFlag == 0)
     {
-        if (poGeom != nullptr)
+        if (eGeomTypeIn != wkbNone)
         {
             bool bUpdateGpkgGeometryColumnsTable = false;
-            const OGRwkbGeometryType eGeomType = poGeom->getGeometryType();
+            const OGRwkbGeometryType eGeomType = eGeomTypeIn;
             if (m_nZFlag == 0 && wkbHasZ(eGeomType))
             {
                 if (eLayerGeomType != wkbUnknown && !wkbHasZ(eLayerGeomType))
@@ -2320,6 +2326,123 @@ static float rtreeValueUp(double d)
     return f;
 }
 
+/************************************************************************/
+/*                           AddRTreeEntry()                            */
+/************************************************************************/
+
+// Register the envelope of a newly inserted (non-empty) geometry, either
+// for the deferred spatial index update or for the background R-Tree build.
+bool OGRGeoPackageTableLayer::AddRTreeEntry(GIntBig nFID,
+                                            const OGREnvelope &oEnv)
+{
+    if (!m_bDeferredSpatialIndexCreation && HasSpatialIndex() &&
+        m_poDS->IsInTransaction())
+    {
+        m_nCountInsertInTransaction++;
+        if (m_nCountInsertInTransactionThreshold < 0)
+        {
+            m_nCountInsertInTransactionThreshold = atoi(CPLGetConfigOption(
+                "OGR_GPKG_DEFERRED_SPI_UPDATE_THRESHOLD", "100"));
+        }
+        if (m_nCountInsertInTransaction == m_nCountInsertInTransactionThreshold)
+        {
+            StartDeferredSpatialIndexUpdate();
+        }
+        else if (!m_aoRTreeTriggersSQL.empty())
+        {
+            if (m_aoRTreeEntries.size() == 1000 * 1000)
+            {
+                if (!FlushPendingSpatialIndexUpdate())
+                    return false;
+            }
+            GPKGRTreeEntry sEntry;
+            sEntry.nId = nFID;
+            sEntry.fMinX = rtreeValueDown(oEnv.MinX);
+            sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
+            sEntry.fMinY = rtreeValueDown(oEnv.MinY);
+            sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
+            m_aoRTreeEntries.push_back(sEntry);
+        }
+    }
+    else if (m_bAllowedRTreeThread && !m_bErrorDuringRTreeThread)
+    {
+        GPKGRTreeEntry sEntry;
+#ifdef DEBUG_VERBOSE
+        if (m_aoRTreeEntries.empty())
+            CPLDebug("GPKG",
+                     "Starting to fill m_aoRTreeEntries at "
+                     "FID " CPL_FRMT_GIB,
+                     nFID);
+#endif
+        sEntry.nId = nFID;
+        sEntry.fMinX = rtreeValueDown(oEnv.MinX);
+        sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
+        sEntry.fMinY = rtreeValueDown(oEnv.MinY);
+        sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
+        try
+        {
+            m_aoRTreeEntries.push_back(sEntry);
+            if (m_aoRTreeEntries.size() == m_nRTreeBatchSize)
+            {
+                m_oQueueRTreeEntries.push(std::move(m_aoRTreeEntries));
+                m_aoRTreeEntries = std::vector<GPKGRTreeEntry>();
+            }
+            if (!m_bThreadRTreeStarted &&
+                m_oQueueRTreeEntries.size() == m_nRTreeBatchesBeforeStart)
+            {
+                StartAsyncRTree();
+            }
+        }
+        catch (const std::bad_alloc &)
+        {
+            CPLDebug("GPKG", "Memory allocation error regarding RTree "
+                             "structures. Falling back to slower method");
+            if (m_bThreadRTreeStarted)
+                CancelAsyncRTree();
+            else
+                m_bAllowedRTreeThread = false;
+        }
+    }
+    return true;
+}
+
+#ifdef ENABLE_GPKG_OGR_CONTENTS
+
+/************************************************************************/
+/*                     IncrementTotalFeatureCount()                     */
+/************************************************************************/
+
+void OGRGeoPackageTableLayer::IncrementTotalFeatureCount()
+{
+    if (m_nTotalFeatureCount >= 0)
+    {
+        if (m_nTotalFeatureCount < std::numeric_limits<int64_t>::max())
+        {
+            m_nTotalFeatureCount++;
+        }
+        else
+        {
+            if (m_poDS->m_bHasGPKGOGRContents)
+            {
+                char *pszSQL = sqlite3_mprintf(
+                    "UPDATE gpkg_ogr_contents SET feature_count = null "
+                    "WHERE lower(table_name) = lower('%q')",
+                    m_pszTableName);
+                CPL_IGNORE_RET_VAL(sqlite3_exec(m_poDS->hDB, pszSQL, nullptr,
+                                                nullptr, nullptr));
+                sqlite3_free(pszSQL);
+            }
+            m_nTotalFeatureCount = -1;
+        }
+    }
+}
+
+#endif
+
+/************************************************************************/
+/*                       CreateOrUpsertFeature()                        */
+/************************************************************************/
+
 OGRErr OGRGeoPackageTableLayer::CreateOrUpsertFeature(OGRFeature *poFeature,
                                                       bool bUpsert)
 {
@@ -2579,104 +2702,13 @@ OGRErr OGRGeoPackageTableLayer::CreateOrUpsertFeature(OGRFeature *poFeature,
             poGeom->getEnvelope(&oEnv);
             UpdateExtent(&oEnv);
 
-            if (!bUpsert && !m_bDeferredSpatialIndexCreation &&
-                HasSpatialIndex() && m_poDS->IsInTransaction())
-            {
-                m_nCountInsertInTransaction++;
-                if (m_nCountInsertInTransactionThreshold < 0)
-                {
-                    m_nCountInsertInTransactionThreshold =
-                        atoi(CPLGetConfigOption(
-                            "OGR_GPKG_DEFERRED_SPI_UPDATE_THRESHOLD", "100"));
-                }
-                if (m_nCountInsertInTransaction ==
-                    m_nCountInsertInTransactionThreshold)
-                {
-                    StartDeferredSpatialIndexUpdate();
-                }
-                else if (!m_aoRTreeTriggersSQL.empty())
-                {
-                    if (m_aoRTreeEntries.size() == 1000 * 1000)
-                    {
-                        if (!FlushPendingSpatialIndexUpdate())
-                            return OGRERR_FAILURE;
-                    }
-                    GPKGRTreeEntry sEntry;
-                    sEntry.nId = nFID;
-                    sEntry.fMinX = rtreeValueDown(oEnv.MinX);
-                    sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
-                    sEntry.fMinY = rtreeValueDown(oEnv.MinY);
-                    sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
-                    m_aoRTreeEntries.push_back(sEntry);
-                }
-            }
-            else if (!bUpsert && m_bAllowedRTreeThread &&
-                     !m_bErrorDuringRTreeThread)
-            {
-                GPKGRTreeEntry sEntry;
-#ifdef DEBUG_VERBOSE
-                if (m_aoRTreeEntries.empty())
-                    CPLDebug("GPKG",
-                             "Starting to fill m_aoRTreeEntries at "
-                             "FID " CPL_FRMT_GIB,
-                             nFID);
-#endif
-                sEntry.nId = nFID;
-                sEntry.fMinX = rtreeValueDown(oEnv.MinX);
-                sEntry.fMaxX = rtreeValueUp(oEnv.MaxX);
-                sEntry.fMinY = rtreeValueDown(oEnv.MinY);
-                sEntry.fMaxY = rtreeValueUp(oEnv.MaxY);
-                try
-                {
-                    m_aoRTreeEntries.push_back(sEntry);
-                    if (m_aoRTreeEntries.size() == m_nRTreeBatchSize)
-                    {
-                        m_oQueueRTreeEntries.push(std::move(m_aoRTreeEntries));
-                        m_aoRTreeEntries = std::vector<GPKGRTreeEntry>();
-                    }
-                    if (!m_bThreadRTreeStarted &&
-                        m_oQueueRTreeEntries.size() ==
-                            m_nRTreeBatchesBeforeStart)
-                    {
-                        StartAsyncRTree();
-                    }
-                }
-                catch (const std::bad_alloc &)
-                {
-                    CPLDebug("GPKG",
-                             "Memory allocation error regarding RTree "
-                             "structures. Falling back to slower method");
-                    if (m_bThreadRTreeStarted)
-                        CancelAsyncRTree();
-                    else
-                        m_bAllowedRTreeThread = false;
-                }
-            }
+            if (!bUpsert && !AddRTreeEntry(nFID, oEnv))
+                return OGRERR_FAILURE;
         }
     }
 
 #ifdef ENABLE_GPKG_OGR_CONTENTS
-    if (m_nTotalFeatureCount >= 0)
-    {
-        if (m_nTotalFeatureCount < std::numeric_limits<int64_t>::max())
-        {
-            m_nTotalFeatureCount++;
-        }
-        else
-        {
-            if (m_poDS->m_bHasGPKGOGRContents)
-            {
-                char *pszSQL = sqlite3_mprintf(
-                    "UPDATE gpkg_ogr_contents SET feature_count = null "
-                    "WHERE lower(table_name) = lower('%q')",
-                    m_pszTableName);
-                CPL_IGNORE_RET_VAL(sqlite3_exec(m_poDS->hDB, pszSQL, nullptr,
-                                                nullptr, nullptr));
-                sqlite3_free(pszSQL);
-            }
-            m_nTotalFeatureCount = -1;
-        }
-    }
+    IncrementTotalFeatureCount();
 #endif
 
     m_bContentChanged = true;
@@ -4407,6 +4439,10 @@ int OGRGeoPackageTableLayer::TestCapability(const char *pszCap) const
     {
         return m_pszFidColumn != nullptr;
     }
+    else if (EQUAL(pszCap, OLCFastWriteArrowBatch))
+    {
+        return m_poDS->GetUpdate() && m_bIsTable && m_pszFidColumn != nullptr;
+    }
     else if (EQUAL(pszCap, OLCTransactions))
     {
         return TRUE;
@@ -9049,6 +9085,511 @@ int OGRGeoPackageTableLayer::GetNextArrowArrayInternal(
     return 0;
 }
 
+/************************************************************************/
+/*                  IsArrowFormatCompatibleOfFieldType()                */
+/************************************************************************/
+
+// Return whether values of an Arrow array of the given (primitive) format
+// can be bound as they are to a column of the given OGR type.
+static bool IsArrowFormatCompatibleOfFieldType(char chFormat,
+                                               OGRFieldType eType)
+{
+    switch (eType)
+    {
+        case OFTInteger:
+            return chFormat == 'b' || chFormat == 'c' || chFormat == 'C' ||
+                   chFormat == 's' || chFormat == 'S' || chFormat == 'i';
+        case OFTInteger64:
+            return chFormat == 'I' || chFormat == 'l';
+        case OFTReal:
+            return chFormat == 'f' || chFormat == 'g';
+        case OFTString:
+            return chFormat == 'u' || chFormat == 'U';
+        case OFTBinary:
+            return chFormat == 'z' || chFormat == 'Z';
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                          WriteArrowBatch()                           */
+/************************************************************************/
+
+/** Native implementation of OGRLayer::WriteArrowBatch().
+ *
+ * Arrow columns are directly bound to the parameters of a prepared INSERT
+ * statement, and WKB geometries are prefixed with a GeoPackage header
+ * (when possible without instantiating an OGRGeometry), their envelope being
+ * fed into the spatial index in the same way as CreateFeature() does.
+ * Schemas involving types that need a conversion (date/time, lists, ...),
+ * dictionary-encoded or nested columns are handled by the generic
+ * OGRLayer::WriteArrowBatch() implementation.
+ */
+bool OGRGeoPackageTableLayer::WriteArrowBatch(const struct ArrowSchema *schema,
+                                              struct ArrowArray *array,
+                                              CSLConstList papszOptions)
+{
+    if (!m_bFeatureDefnCompleted)
+        GetLayerDefn();
+
+    if (CPLTestBool(CPLGetConfigOption("OGR_GPKG_WRITE_ARROW_BATCH_BASE_IMPL",
+                                       "NO")) ||
+        !m_poDS->GetUpdate() || !m_bIsTable || m_pszFidColumn == nullptr ||
+        m_iFIDAsRegularColumnIndex >= 0 || strcmp(schema->format, "+s") != 0 ||
+        schema->n_children != array->n_children)
+    {
+        return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+    }
+
+    const char *pszFIDName =
+        CSLFetchNameValueDef(papszOptions, "FID", GetFIDColumn());
+    if (!pszFIDName || pszFIDName[0] == 0)
+        pszFIDName = DEFAULT_ARROW_FID_NAME;
+    const char *pszGeomFieldName = CSLFetchNameValueDef(
+        papszOptions, "GEOMETRY_NAME", GetGeometryColumn());
+    if (!pszGeomFieldName || pszGeomFieldName[0] == 0)
+        pszGeomFieldName = DEFAULT_ARROW_GEOMETRY_NAME;
+
+    // Map each Arrow column to a column of the table
+    const int nFieldCount = m_poFeatureDefn->GetFieldCount();
+    std::vector<bool> abFieldBound(nFieldCount, false);
+    int iArrowFID = -1;
+    int iArrowGeom = -1;
+    std::string osColumns;
+    for (int i = 0; i < static_cast<int>(schema->n_children); ++i)
+    {
+        const struct ArrowSchema *childSchema = schema->children[i];
+        const char *pszName = childSchema->name;
+        const char *pszFormat = childSchema->format;
+        if (childSchema->dictionary || childSchema->n_children != 0 ||
+            pszName == nullptr || pszFormat[0] == 0 || pszFormat[1] != 0)
+        {
+            return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+        }
+
+        const char *pszColumnName = nullptr;
+        const int iField = m_poFeatureDefn->GetFieldIndex(pszName);
+        if (strcmp(pszName, pszFIDName) == 0)
+        {
+            if (iArrowFID >= 0 || (pszFormat[0] != 'i' && pszFormat[0] != 'l'))
+                return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+            iArrowFID = i;
+            pszColumnName = m_pszFidColumn;
+        }
+        else if (iField >= 0)
+        {
+            const OGRFieldDefn *poFieldDefn =
+                m_poFeatureDefn->GetFieldDefnUnsafe(iField);
+            if (abFieldBound[iField] || poFieldDefn->IsGenerated() ||
+                // Width checking and truncation of strings not handled here
+                (poFieldDefn->GetType() == OFTString &&
+                 poFieldDefn->GetWidth() > 0) ||
+                !IsArrowFormatCompatibleOfFieldType(pszFormat[0],
+                                                    poFieldDefn->GetType()))
+            {
+                return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+            }
+            abFieldBound[iField] = true;
+            pszColumnName = poFieldDefn->GetNameRef();
+        }
+        else
+        {
+            bool bIsGeom = m_poFeatureDefn->GetGeomFieldCount() == 1 &&
+                           (m_poFeatureDefn->GetGeomFieldIndex(pszName) == 0 ||
+                            strcmp(pszName, pszGeomFieldName) == 0);
+            if (!bIsGeom && m_poFeatureDefn->GetGeomFieldCount() == 1 &&
+                childSchema->metadata)
+            {
+                const auto oMetadata =
+                    OGRParseArrowMetadata(childSchema->metadata);
+                const auto oIter = oMetadata.find(ARROW_EXTENSION_NAME_KEY);
+                bIsGeom = oIter != oMetadata.end() &&
+                          (oIter->second == EXTENSION_NAME_OGC_WKB ||
+                           oIter->second == EXTENSION_NAME_GEOARROW_WKB);
+            }
+            if (!bIsGeom || iArrowGeom >= 0 ||
+                (pszFormat[0] != 'z' && pszFormat[0] != 'Z'))
+            {
+                return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+            }
+            iArrowGeom = i;
+            pszColumnName = GetGeometryColumn();
+        }
+
+        if (!osColumns.empty())
+            osColumns += ", ";
+        osColumns += '"';
+        osColumns += SQLEscapeName(pszColumnName);
+        osColumns += '"';
+    }
+
+    // Columns that are not bound get their SQL default value (or NULL),
+    // except date/time ones whose default value is set by CreateFeature()
+    // through OGRFeature::FillUnsetWithDefault()
+    for (int iField = 0; iField < nFieldCount; ++iField)
+    {
+        const OGRFieldDefn *poFieldDefn =
+            m_poFeatureDefn->GetFieldDefnUnsafe(iField);
+        const auto eType = poFieldDefn->GetType();
+        if (!abFieldBound[iField] && poFieldDefn->GetDefault() != nullptr &&
+            (eType == OFTDate || eType == OFTTime || eType == OFTDateTime))
+        {
+            return OGRLayer::WriteArrowBatch(schema, array, papszOptions);
+        }
+    }
+
+    if (m_bDeferredCreation && RunDeferredCreationIfNecessary() != OGRERR_NONE)
+        return false;
+
+    CancelAsyncNextArrowArray();
+
+#ifdef ENABLE_GPKG_OGR_CONTENTS
+    // To maximize performance of insertion, disable feature count triggers
+    if (m_bOGRFeatureCountTriggersEnabled)
+    {
+        DisableFeatureCountTriggers();
+    }
+#endif
+
+    std::string osSQL("INSERT INTO \"");
+    osSQL += SQLEscapeName(m_pszTableName);
+    osSQL += '"';
+    if (osColumns.empty())
+    {
+        osSQL += " DEFAULT VALUES";
+    }
+    else
+    {
+        osSQL += " (";
+        osSQL += osColumns;
+        osSQL += ") VALUES (";
+        for (int i = 0; i < static_cast<int>(schema->n_children); ++i)
+        {
+            if (i > 0)
+                osSQL += ", ";
+            osSQL += '?';
+        }
+        osSQL += ')';
+    }
+
+    sqlite3_stmt *hStmt = nullptr;
+    if (SQLPrepareWithError(m_poDS->GetDB(), osSQL.c_str(), -1, &hStmt,
+                            nullptr) != SQLITE_OK)
+    {
+        return false;
+    }
+
+    bool bTransactionOK;
+    {
+        CPLErrorStateBackuper oBackuper(CPLQuietErrorHandler);
+        bTransactionOK = StartTransaction() == OGRERR_NONE;
+    }
+
+    const auto IsNull = [](const struct ArrowArray *childArray, size_t iRow)
+    {
+        const GByte *pabyValidity =
+            static_cast<const GByte *>(childArray->buffers[0]);
+        if (childArray->null_count == 0 || pabyValidity == nullptr)
+            return false;
+        const size_t iBit = iRow + static_cast<size_t>(childArray->offset);
+        return (pabyValidity[iBit / 8] & (1 << (iBit % 8))) == 0;
+    };
+
+    // Return a pointer to the value at iRow of a binary or string array
+    const auto GetBinaryValue =
+        [](const struct ArrowArray *childArray, char chFormat, size_t iRow,
+           size_t &nLen) -> const GByte *
+    {
+        const size_t iIdx = iRow + static_cast<size_t>(childArray->offset);
+        const GByte *pabyData =
+            static_cast<const GByte *>(childArray->buffers[2]);
+        if (chFormat == 'z' || chFormat == 'u')
+        {
+            const auto *panOffsets =
+                static_cast<const int32_t *>(childArray->buffers[1]);
+            nLen = static_cast<size_t>(panOffsets[iIdx + 1] - panOffsets[iIdx]);
+            return pabyData + static_cast<size_t>(panOffsets[iIdx]);
+        }
+        const auto *panOffsets =
+            static_cast<const int64_t *>(childArray->buffers[1]);
+        nLen = static_cast<size_t>(panOffsets[iIdx + 1] - panOffsets[iIdx]);
+        return pabyData + static_cast<size_t>(panOffsets[iIdx]);
+    };
+
+    const bool bNoBinaryPrecision =
+        m_sBinaryPrecision.nXYBitPrecision == INT_MIN &&
+        m_sBinaryPrecision.nZBitPrecision == INT_MIN &&
+        m_sBinaryPrecision.nMBitPrecision == INT_MIN;
+    std::vector<GByte> abyGeomBlob;
+    OGRwkbGeometryType eLastCheckedGeomType = wkbUnknown;
+    bool bGeomTypeChecked = false;
+    int64_t nFIDNullCount = 0;
+    bool bRet = true;
+    const size_t nRows = static_cast<size_t>(array->length);
+    for (size_t iRow = 0; bRet && iRow < nRows; ++iRow)
+    {
+        OGRwkbGeometryType eGeomType = wkbNone;
+        OGREnvelope sEnvelope;
+        for (int i = 0; bRet && i < static_cast<int>(schema->n_children); ++i)
+        {
+            const struct ArrowArray *childArray = array->children[i];
+            const char chFormat = schema->children[i]->format[0];
+            const int iParam = i + 1;
+            int err = SQLITE_OK;
+            if (IsNull(childArray, iRow))
+            {
+                err = sqlite3_bind_null(hStmt, iParam);
+            }
+            else if (i == iArrowGeom)
+            {
+                size_t nLen = 0;
+                const GByte *pabyWKB =
+                    GetBinaryValue(childArray, chFormat, iRow, nLen);
+                if (bNoBinaryPrecision &&
+                    GPkgGeometryFromWKB(pabyWKB, nLen, m_iSrs, abyGeomBlob,
+                                        eGeomType, sEnvelope))
+                {
+                    err = sqlite3_bind_blob(
+                        hStmt, iParam, abyGeomBlob.data(),
+                        static_cast<int>(abyGeomBlob.size()), SQLITE_STATIC);
+                }
+                else
+                {
+                    // Curve geometries, big endian WKB, coordinate precision
+                    // rounding, etc.: go through OGRGeometry.
+                    std::unique_ptr<OGRGeometry> poGeom;
+                    {
+                        OGRGeometry *poGeomRaw = nullptr;
+                        size_t nBytesConsumedOut = 0;
+                        OGRGeometryFactory::createFromWkb(
+                            pabyWKB, nullptr, &poGeomRaw, nLen, wkbVariantIso,
+                            nBytesConsumedOut);
+                        poGeom.reset(poGeomRaw);
+                    }
+                    if (poGeom)
+                    {
+                        size_t nBlobLen = 0;
+                        GByte *pabyBlob = GPkgGeometryFromOGR(
+                            poGeom.get(), m_iSrs, &m_sBinaryPrecision,
+                            &nBlobLen);
+                        if (!pabyBlob)
+                        {
+                            bRet = false;
+                            break;
+                        }
+                        err = sqlite3_bind_blob(hStmt, iParam, pabyBlob,
+                                                static_cast<int>(nBlobLen),
+                                                CPLFree);
+                        CreateGeometryExtensionIfNecessary(poGeom.get());
+                        eGeomType = poGeom->getGeometryType();
+                        if (!poGeom->IsEmpty())
+                            poGeom->getEnvelope(&sEnvelope);
+                    }
+                    else
+                    {
+                        err = sqlite3_bind_null(hStmt, iParam);
+                    }
+                }
+            }
+            else
+            {
+                const size_t iIdx =
+                    iRow + static_cast<size_t>(childArray->offset);
+                const void *pData = childArray->buffers[1];
+                switch (chFormat)
+                {
+                    case 'b':
+                    {
+                        const GByte *pabyData =
+                            static_cast<const GByte *>(pData);
+                        err = sqlite3_bind_int(
+                            hStmt, iParam,
+                            (pabyData[iIdx / 8] & (1 << (iIdx % 8))) != 0);
+                        break;
+                    }
+                    case 'c':
+                        err = sqlite3_bind_int(
+                            hStmt, iParam,
+                            static_cast<const int8_t *>(pData)[iIdx]);
+                        break;
+                    case 'C':
+                        err = sqlite3_bind_int(
+                            hStmt, iParam,
+                            static_cast<const uint8_t *>(pData)[iIdx]);
+                        break;
+                    case 's':
+                        err = sqlite3_bind_int(
+                            hStmt, iParam,
+                            static_cast<const int16_t *>(pData)[iIdx]);
+                        break;
+                    case 'S':
+                        err = sqlite3_bind_int(
+                            hStmt, iParam,
+                            static_cast<const uint16_t *>(pData)[iIdx]);
+                        break;
+                    case 'i':
+                        err = sqlite3_bind_int(
+                            hStmt, iParam,
+                            static_cast<const int32_t *>(pData)[iIdx]);
+                        break;
+                    case 'I':
+                        err = sqlite3_bind_int64(
+                            hStmt, iParam,
+                            static_cast<const uint32_t *>(pData)[iIdx]);
+                        break;
+                    case 'l':
+                        err = sqlite3_bind_int64(
+                            hStmt, iParam,
+                            static_cast<const int64_t *>(pData)[iIdx]);
+                        break;
+                    case 'f':
+                        err = sqlite3_bind_double(
+                            hStmt, iParam,
+                            static_cast<const float *>(pData)[iIdx]);
+                        break;
+                    case 'g':
+                        err = sqlite3_bind_double(
+                            hStmt, iParam,
+                            static_cast<const double *>(pData)[iIdx]);
+                        break;
+                    default:
+                    {
+                        size_t nLen = 0;
+                        const GByte *pabyData =
+                            GetBinaryValue(childArray, chFormat, iRow, nLen);
+                        if (nLen > static_cast<size_t>(INT_MAX))
+                        {
+                            CPLError(CE_Failure, CPLE_NotSupported,
+                                     "Content for field %s is too large",
+                                     schema->children[i]->name);
+                            bRet = false;
+                            break;
+                        }
+                        if (chFormat == 'u' || chFormat == 'U')
+                        {
+                            err = sqlite3_bind_text(
+                                hStmt, iParam,
+                                reinterpret_cast<const char *>(pabyData),
+                                static_cast<int>(nLen), SQLITE_STATIC);
+                        }
+                        else
+                        {
+                            err = sqlite3_bind_blob(hStmt, iParam, pabyData,
+                                                    static_cast<int>(nLen),
+                                                    SQLITE_STATIC);
+                        }
+                        break;
+                    }
+                }
+            }
+            if (bRet && err != SQLITE_OK)
+            {
+                CPLError(CE_Failure, CPLE_AppDefined,
+                         "sqlite3_bind_() for column %s failed: %s",
+                         schema->children[i]->name,
+                         sqlite3_errmsg(m_poDS->GetDB()));
+                bRet = false;
+            }
+        }
+        if (!bRet)
+            break;
+
+        if (eGeomType != wkbNone &&
+            (!bGeomTypeChecked || eGeomType != eLastCheckedGeomType))
+        {
+            CheckGeometryType(eGeomType);
+            bGeomTypeChecked = true;
+            eLastCheckedGeomType = eGeomType;
+        }
+
+        const int err = sqlite3_step(hStmt);
+        if (!(err == SQLITE_OK || err == SQLITE_DONE))
+        {
+            CPLError(CE_Failure, CPLE_AppDefined,
+                     "failed to execute insert : %s",
+                     sqlite3_errmsg(m_poDS->GetDB())
+                         ? sqlite3_errmsg(m_poDS->GetDB())
+                         : "");
+            bRet = false;
+            break;
+        }
+        sqlite3_reset(hStmt);
+
+        const GIntBig nFID = sqlite3_last_insert_rowid(m_poDS->GetDB());
+
+        // Report the FID of the created feature into the FID array, as the
+        // generic implementation does
+        if (iArrowFID >= 0)
+        {
+            struct ArrowArray *arrayFID = array->children[iArrowFID];
+            GByte *pabyValidity =
+                static_cast<GByte *>(const_cast<void *>(arrayFID->buffers[0]));
+            const size_t iIdx = iRow + static_cast<size_t>(arrayFID->offset);
+            const GByte nMask = static_cast<GByte>(1 << (iIdx % 8));
+            if (schema->children[iArrowFID]->format[0] == 'i' &&
+                nFID > std::numeric_limits<int32_t>::max())
+            {
+                if (pabyValidity)
+                {
+                    ++nFIDNullCount;
+                    pabyValidity[iIdx / 8] &= static_cast<GByte>(~nMask);
+                }
+                CPLError(CE_Warning, CPLE_AppDefined,
+                         "FID " CPL_FRMT_GIB
+                         " cannot be stored in FID array of type int32",
+                         nFID);
+            }
+            else
+            {
+                if (pabyValidity)
+                    pabyValidity[iIdx / 8] |= nMask;
+                void *pValues = const_cast<void *>(arrayFID->buffers[1]);
+                if (schema->children[iArrowFID]->format[0] == 'i')
+                {
+                    static_cast<int32_t *>(pValues)[iIdx] =
+                        static_cast<int32_t>(nFID);
+                }
+                else
+                {
+                    static_cast<int64_t *>(pValues)[iIdx] = nFID;
+                }
+            }
+        }
+
+        if (sEnvelope.IsInit())
+        {
+            UpdateExtent(&sEnvelope);
+            if (!AddRTreeEntry(nFID, sEnvelope))
+            {
+                bRet = false;
+                break;
+            }
+        }
+
+#ifdef ENABLE_GPKG_OGR_CONTENTS
+        IncrementTotalFeatureCount();
+#endif
+        m_bContentChanged = true;
+    }
+
+    sqlite3_finalize(hStmt);
+
+    if (iArrowFID >= 0 && array->children[iArrowFID]->buffers[0])
+        array->children[iArrowFID]->null_count = nFIDNullCount;
+
+    if (bTransactionOK)
+    {
+        if (bRet)
+            bRet = CommitTransaction() == OGRERR_NONE;
+        else
+            RollbackTransaction();
+    }
+
+    return bRet;
+}
+
 /************************************************************************/
 /*               OGR_GPKG_GeometryExtent3DAggregate()                   */
 /************************************************************************/
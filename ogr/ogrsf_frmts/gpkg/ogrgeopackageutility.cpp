@@ -349,6 +349,168 @@ GByte *GPkgGeometryFromOGR(const OGRGeometry *poGeometry, int iSrsId,
     return pabyWkb;
 }
 
+/*
+ * GPkgGetCopyableWKBSize()
+ *
+ * Return the size in bytes of the linear ISO WKB geometry at pabyWKB, or 0
+ * if it cannot be copied as it is into a GeoPackage blob: truncated content,
+ * sub-geometry with a byte order different from the native one, or type code
+ * that is not allowed at its position.
+ */
+
+static size_t GPkgGetCopyableWKBSize(const GByte *pabyWKB, size_t nWKBLen,
+                                     uint32_t nExpectedWKBType)
+{
+    if (nWKBLen < 5 || pabyWKB[0] != static_cast<GByte>(CPL_IS_LSB))
+        return 0;
+    uint32_t nWKBType = 0;
+    memcpy(&nWKBType, pabyWKB + 1, sizeof(nWKBType));
+    if (nExpectedWKBType != 0 && nWKBType != nExpectedWKBType)
+        return 0;
+    const uint32_t nFlatWKBType = nWKBType % 1000;
+    const uint32_t nDimCode = nWKBType / 1000;
+    if (nDimCode > 3 || nFlatWKBType < wkbPoint ||
+        nFlatWKBType > wkbMultiPolygon)
+    {
+        return 0;
+    }
+    // XY, XYZ, XYM or XYZM
+    const size_t nPointSize = 8 * (nDimCode == 0 ? 2 : nDimCode == 3 ? 4 : 3);
+
+    size_t nOffset = 5;
+    const auto ReadCount = [pabyWKB, nWKBLen, &nOffset](uint32_t &nCount)
+    {
+        if (nWKBLen - nOffset < sizeof(nCount))
+            return false;
+        memcpy(&nCount, pabyWKB + nOffset, sizeof(nCount));
+        nOffset += sizeof(nCount);
+        return true;
+    };
+    const auto SkipPoints = [nWKBLen, nPointSize, &nOffset](uint32_t nCount)
+    {
+        if (nCount > (nWKBLen - nOffset) / nPointSize)
+            return false;
+        nOffset += nCount * nPointSize;
+        return true;
+    };
+
+    uint32_t nCount = 0;
+    switch (nFlatWKBType)
+    {
+        case wkbPoint:
+            return SkipPoints(1) ? nOffset : 0;
+
+        case wkbLineString:
+            return ReadCount(nCount) && SkipPoints(nCount) ? nOffset : 0;
+
+        case wkbPolygon:
+        {
+            if (!ReadCount(nCount))
+                return 0;
+            for (uint32_t iRing = 0; iRing < nCount; ++iRing)
+            {
+                uint32_t nPoints = 0;
+                if (!ReadCount(nPoints) || !SkipPoints(nPoints))
+                    return 0;
+            }
+            return nOffset;
+        }
+
+        default:
+        {
+            if (nExpectedWKBType != 0 || !ReadCount(nCount))
+                return 0;
+            // Multi* geometries contain sub-geometries of the matching
+            // single type, with the same dimensions
+            const uint32_t nSubWKBType = nWKBType - 3;
+            for (uint32_t iPart = 0; iPart < nCount; ++iPart)
+            {
+                const size_t nPartLen = GPkgGetCopyableWKBSize(
+                    pabyWKB + nOffset, nWKBLen - nOffset, nSubWKBType);
+                if (nPartLen == 0)
+                    return 0;
+                nOffset += nPartLen;
+            }
+            return nOffset;
+        }
+    }
+}
+
+/*
+ * GPkgGeometryFromWKB()
+ *
+ * Build a GeoPackage geometry blob into abyGpkg by prefixing the ISO WKB
+ * geometry with a GeoPackage header, without going through OGRGeometry.
+ * This is only possible for linear geometry types (Point to MultiPolygon)
+ * whose WKB, including all sub-geometries, is in the native byte order, and
+ * takes exactly nWKBLen bytes. false is returned if the WKB cannot be copied
+ * as it is, in which case GPkgGeometryFromOGR() must be used instead.
+ * On success, eGeomType is set to the geometry type, and sEnvelope to the
+ * 2D envelope of the geometry (left uninitialized for an empty geometry).
+ */
+
+bool GPkgGeometryFromWKB(const GByte *pabyWKB, size_t nWKBLen, int iSrsId,
+                         std::vector<GByte> &abyGpkg,
+                         OGRwkbGeometryType &eGeomType, OGREnvelope &sEnvelope)
+{
+    // Trailing bytes are not accepted
+    if (GPkgGetCopyableWKBSize(pabyWKB, nWKBLen, 0) != nWKBLen)
+        return false;
+    uint32_t nWKBType = 0;
+    memcpy(&nWKBType, pabyWKB + 1, sizeof(nWKBType));
+    const uint32_t nFlatWKBType = nWKBType % 1000;
+    if (OGRReadWKBGeometryType(pabyWKB, wkbVariantIso, &eGeomType) !=
+        OGRERR_NONE)
+    {
+        return false;
+    }
+
+    /* Same conventions as GPkgGeometryFromOGR(): no envelope for points and
+     * empty geometries, 3D envelope for geometries with Z */
+    const bool bHasZ = CPL_TO_BOOL(OGR_GT_HasZ(eGeomType));
+    OGREnvelope3D sEnvelope3D;
+    if (!OGRWKBGetBoundingBox(pabyWKB, nWKBLen, sEnvelope3D))
+        return false;
+    const bool bEmpty = !sEnvelope3D.IsInit();
+    GByte byEnv = 0;
+    if (!bEmpty && nFlatWKBType != wkbPoint)
+        byEnv = bHasZ ? 2 : 1;
+    const size_t nHeaderLen = 8 + 8 * 2 * (byEnv == 0 ? 0 : byEnv + 1);
+    if (nWKBLen > static_cast<size_t>(std::numeric_limits<int>::max()) -
+                      nHeaderLen)
+    {
+        return false;
+    }
+
+    try
+    {
+        abyGpkg.resize(nHeaderLen + nWKBLen);
+    }
+    catch (const std::bad_alloc &)
+    {
+        return false;
+    }
+
+    GByte *pabyGpkg = abyGpkg.data();
+    pabyGpkg[0] = 0x47;
+    pabyGpkg[1] = 0x50;
+    pabyGpkg[2] = 0;
+    pabyGpkg[3] = static_cast<GByte>((bEmpty ? (1 << 4) : 0) | (byEnv << 1) |
+                                     static_cast<GByte>(CPL_IS_LSB));
+    memcpy(pabyGpkg + 4, &iSrsId, 4);
+    if (byEnv != 0)
+    {
+        const double adfEnv[] = {sEnvelope3D.MinX, sEnvelope3D.MaxX,
+                                 sEnvelope3D.MinY, sEnvelope3D.MaxY,
+                                 sEnvelope3D.MinZ, sEnvelope3D.MaxZ};
+        memcpy(pabyGpkg + 8, adfEnv, nHeaderLen - 8);
+    }
+    memcpy(pabyGpkg + nHeaderLen, pabyWKB, nWKBLen);
+
+    sEnvelope = sEnvelope3D;
+    return true;
+}
+
 OGRErr GPkgHeaderFromWKB(const GByte *pabyGpkg, size_t nGpkgLen,
                          GPkgHeader *poHeader)
 {
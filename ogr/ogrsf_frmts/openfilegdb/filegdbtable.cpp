@@ -3250,6 +3250,7 @@ class FileGDBOGRGeometryConverterImpl final : public FileGDBOGRGeometryConverter
     ~FileGDBOGRGeometryConverterImpl() override;
 
     OGRGeometry *GetAsGeometry(const OGRField *psField) override;
+    bool GetAsWKB(const OGRField *psField, std::vector<GByte> &abyWKB) override;
 };
 
 /************************************************************************/
@@ -4387,6 +4388,272 @@ FileGDBOGRGeometryConverterImpl::GetAsGeometry(const OGRField *psField)
     return nullptr;
 }
 
+/************************************************************************/
+/*                            XYWKBSetter                               */
+/************************************************************************/
+
+class XYWKBSetter
+{
+    GByte *pabyBuffer;
+    const size_t nStride;
+
+  public:
+    XYWKBSetter(GByte *pabyBufferIn, size_t nStrideIn)
+        : pabyBuffer(pabyBufferIn), nStride(nStrideIn)
+    {
+    }
+
+    void set(int i, double dfX, double dfY)
+    {
+        CPL_LSBPTR64(&dfX);
+        memcpy(pabyBuffer + nStride * static_cast<size_t>(i), &dfX, 8);
+        CPL_LSBPTR64(&dfY);
+        memcpy(pabyBuffer + nStride * static_cast<size_t>(i) + 8, &dfY, 8);
+    }
+};
+
+/************************************************************************/
+/*                             ZWKBSetter                               */
+/************************************************************************/
+
+class ZWKBSetter
+{
+    GByte *pabyBuffer;
+    const size_t nStride;
+
+  public:
+    ZWKBSetter(GByte *pabyBufferIn, size_t nStrideIn)
+        : pabyBuffer(pabyBufferIn), nStride(nStrideIn)
+    {
+    }
+
+    void set(int i, double dfZ)
+    {
+        CPL_LSBPTR64(&dfZ);
+        memcpy(pabyBuffer + nStride * static_cast<size_t>(i), &dfZ, 8);
+    }
+};
+
+/************************************************************************/
+/*                             GetAsWKB()                               */
+/************************************************************************/
+
+bool FileGDBOGRGeometryConverterImpl::GetAsWKB(const OGRField *psField,
+                                               std::vector<GByte> &abyWKB)
+{
+    const bool errorRetValue = false;
+    GByte *pabyCur = psField->Binary.paData;
+    GByte *pabyEnd = pabyCur + psField->Binary.nCount;
+    GUInt32 nGeomType, i, nPoints, nParts, nCurves;
+
+    abyWKB.clear();
+
+    ReadVarUInt32NoCheck(pabyCur, nGeomType);
+
+    bool bHasZ = (nGeomType & EXT_SHAPE_Z_FLAG) != 0;
+    const bool bHasM = (nGeomType & EXT_SHAPE_M_FLAG) != 0;
+    switch ((nGeomType & 0xff))
+    {
+        case SHPT_POINTZ:
+        case SHPT_POINTZM:
+            bHasZ = true; /* go on */
+            [[fallthrough]];
+        case SHPT_POINT:
+        case SHPT_POINTM:
+        case SHPT_GENERALPOINT:
+        {
+            if (bHasM || nGeomType == SHPT_POINTM || nGeomType == SHPT_POINTZM)
+                return false;
+
+            GUIntBig x, y;
+            ReadVarUInt64NoCheck(pabyCur, x);
+            ReadVarUInt64NoCheck(pabyCur, y);
+
+            const double dfX = x == 0 ? std::numeric_limits<double>::quiet_NaN()
+                                      : (x - 1U) / poGeomField->GetXYScale() +
+                                            poGeomField->GetXOrigin();
+            const double dfY = y == 0 ? std::numeric_limits<double>::quiet_NaN()
+                                      : (y - 1U) / poGeomField->GetXYScale() +
+                                            poGeomField->GetYOrigin();
+
+            WriteUInt8(abyWKB, wkbNDR);
+            WriteUInt32(abyWKB, wkbPoint + (bHasZ ? 1000 : 0));
+            WriteFloat64(abyWKB, dfX);
+            WriteFloat64(abyWKB, dfY);
+            if (bHasZ)
+            {
+                GUIntBig z;
+                ReadVarUInt64NoCheck(pabyCur, z);
+                const double dfZScale = SanitizeScale(poGeomField->GetZScale());
+                WriteFloat64(abyWKB,
+                             z == 0 ? std::numeric_limits<double>::quiet_NaN()
+                                    : (z - 1U) / dfZScale +
+                                          poGeomField->GetZOrigin());
+            }
+            return true;
+        }
+
+        case SHPT_MULTIPOINTZM:
+        case SHPT_MULTIPOINTZ:
+            bHasZ = true; /* go on */
+            [[fallthrough]];
+        case SHPT_MULTIPOINT:
+        case SHPT_MULTIPOINTM:
+        {
+            if (bHasM || nGeomType == SHPT_MULTIPOINTM ||
+                nGeomType == SHPT_MULTIPOINTZM)
+                return false;
+
+            returnErrorIf(!ReadVarUInt32(pabyCur, pabyEnd, nPoints));
+            if (nPoints == 0)
+                return false;
+            returnErrorIf(nPoints > static_cast<size_t>(pabyEnd - pabyCur));
+
+            returnErrorIf(!SkipVarUInt(pabyCur, pabyEnd, 4));
+
+            const uint32_t nPointType = wkbPoint + (bHasZ ? 1000 : 0);
+            const size_t nPointSize = 1 + 4 + (bHasZ ? 3 : 2) * 8;
+            WriteUInt8(abyWKB, wkbNDR);
+            WriteUInt32(abyWKB, wkbMultiPoint + (bHasZ ? 1000 : 0));
+            WriteUInt32(abyWKB, nPoints);
+            const size_t nFirstPointPos = abyWKB.size();
+            abyWKB.resize(nFirstPointPos + nPoints * nPointSize);
+            for (i = 0; i < nPoints; i++)
+            {
+                const size_t nPos = nFirstPointPos + i * nPointSize;
+                abyWKB[nPos] = wkbNDR;
+                WriteUInt32(abyWKB, nPointType, nPos + 1);
+            }
+
+            GIntBig dx = 0, dy = 0;
+            XYWKBSetter xySetter(abyWKB.data() + nFirstPointPos + 5,
+                                 nPointSize);
+            if (!ReadXYArray<XYWKBSetter>(xySetter, pabyCur, pabyEnd, nPoints,
+                                          dx, dy))
+            {
+                abyWKB.clear();
+                return false;
+            }
+
+            if (bHasZ)
+            {
+                GIntBig dz = 0;
+                ZWKBSetter zSetter(abyWKB.data() + nFirstPointPos + 5 + 16,
+                                   nPointSize);
+                if (!ReadZArray<ZWKBSetter>(zSetter, pabyCur, pabyEnd, nPoints,
+                                            dz))
+                {
+                    abyWKB.clear();
+                    return false;
+                }
+            }
+
+            return true;
+        }
+
+        case SHPT_ARCZ:
+        case SHPT_ARCZM:
+        case SHPT_POLYGONZ:
+        case SHPT_POLYGONZM:
+            bHasZ = true; /* go on */
+            [[fallthrough]];
+        case SHPT_ARC:
+        case SHPT_ARCM:
+        case SHPT_GENERALPOLYLINE:
+        case SHPT_POLYGON:
+        case SHPT_POLYGONM:
+        case SHPT_GENERALPOLYGON:
+        {
+            if (bHasM || nGeomType == SHPT_ARCM || nGeomType == SHPT_ARCZM ||
+                nGeomType == SHPT_POLYGONM || nGeomType == SHPT_POLYGONZM)
+                return false;
+
+            const GUInt32 nShapeType = nGeomType & 0xff;
+            const bool bIsPolygon =
+                nShapeType == SHPT_POLYGON || nShapeType == SHPT_POLYGONZ ||
+                nShapeType == SHPT_POLYGONM || nShapeType == SHPT_POLYGONZM ||
+                nShapeType == SHPT_GENERALPOLYGON;
+
+            returnErrorIf(
+                !ReadPartDefs(pabyCur, pabyEnd, nPoints, nParts, nCurves,
+                              (nGeomType & EXT_SHAPE_CURVE_FLAG) != 0, false));
+
+            // Polygons with several rings need organizePolygons()
+            if (nPoints == 0 || nParts == 0 || nCurves != 0 ||
+                (bIsPolygon && nParts > 1))
+                return false;
+
+            // A single ring polygon is emitted as a MultiPolygon, and a
+            // polyline as a MultiLineString
+            const size_t nCoordSize = (bHasZ ? 3 : 2) * 8;
+            // byte order, geometry type, number of rings/points, and for
+            // polygons, number of points of the ring
+            const size_t nPartHeaderSize = bIsPolygon ? 13 : 9;
+            WriteUInt8(abyWKB, wkbNDR);
+            WriteUInt32(abyWKB,
+                        (bIsPolygon ? wkbMultiPolygon : wkbMultiLineString) +
+                            (bHasZ ? 1000 : 0));
+            WriteUInt32(abyWKB, nParts);
+            const size_t nFirstPartPos = abyWKB.size();
+            abyWKB.resize(nFirstPartPos + nParts * nPartHeaderSize +
+                          static_cast<size_t>(nPoints) * nCoordSize);
+
+            const uint32_t nPartType =
+                (bIsPolygon ? wkbPolygon : wkbLineString) + (bHasZ ? 1000 : 0);
+            GIntBig dx = 0, dy = 0;
+            size_t nPos = nFirstPartPos;
+            for (i = 0; i < nParts; i++)
+            {
+                abyWKB[nPos] = wkbNDR;
+                WriteUInt32(abyWKB, nPartType, nPos + 1);
+                if (bIsPolygon)
+                {
+                    WriteUInt32(abyWKB, 1, nPos + 5);
+                    WriteUInt32(abyWKB, panPointCount[i], nPos + 9);
+                }
+                else
+                {
+                    WriteUInt32(abyWKB, panPointCount[i], nPos + 5);
+                }
+                nPos += nPartHeaderSize;
+
+                XYWKBSetter xySetter(abyWKB.data() + nPos, nCoordSize);
+                if (!ReadXYArray<XYWKBSetter>(xySetter, pabyCur, pabyEnd,
+                                              panPointCount[i], dx, dy))
+                {
+                    abyWKB.clear();
+                    return false;
+                }
+                nPos += panPointCount[i] * nCoordSize;
+            }
+
+            if (bHasZ)
+            {
+                GIntBig dz = 0;
+                nPos = nFirstPartPos;
+                for (i = 0; i < nParts; i++)
+                {
+                    nPos += nPartHeaderSize;
+                    ZWKBSetter zSetter(abyWKB.data() + nPos + 16, nCoordSize);
+                    if (!ReadZArray<ZWKBSetter>(zSetter, pabyCur, pabyEnd,
+                                                panPointCount[i], dz))
+                    {
+                        abyWKB.clear();
+                        return false;
+                    }
+                    nPos += panPointCount[i] * nCoordSize;
+                }
+            }
+
+            return true;
+        }
+
+        default:
+            break;
+    }
+    return false;
+}
+
 /************************************************************************/
 /*                           BuildConverter()                           */
 /************************************************************************/
@@ -840,6 +840,14 @@ class FileGDBOGRGeometryConverter /* non final */
 
     virtual OGRGeometry *GetAsGeometry(const OGRField *psField) = 0;
 
+    // Directly encode the geometry as ISO WKB (little-endian), with polygons
+    // and linestrings promoted to their multi counterparts, like
+    // OGROpenFileGDBLayer does. Returns false for geometries that are not
+    // handled (measures, curves, empty geometries, polygons with several
+    // rings), in which case GetAsGeometry() must be used.
+    virtual bool GetAsWKB(const OGRField *psField,
+                          std::vector<GByte> &abyWKB) = 0;
+
     static FileGDBOGRGeometryConverter *
     BuildConverter(const FileGDBGeomField *poGeomField);
     static OGRwkbGeometryType
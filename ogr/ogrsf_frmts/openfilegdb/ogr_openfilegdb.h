@@ -136,6 +136,11 @@ class OGROpenFileGDBLayer final : public OGRLayer
 
     bool m_bWarnedDateNotConvertibleUTC = false;
 
+    // Row selected, but not emitted, by the last GetNextArrowArray() call
+    // because the batch was full.
+    int64_t m_nArrowPendingRow = -1;
+    bool m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
+
     bool m_bHasCreatedBackupForTransaction = false;
     std::unique_ptr<OGRFeatureDefn> m_poFeatureDefnBackup{};
 
@@ -265,6 +270,11 @@ class OGROpenFileGDBLayer final : public OGRLayer
     OGRFeature *GetFeature(GIntBig nFeatureId) override;
     OGRErr SetNextByIndex(GIntBig nIndex) override;
 
+    int GetNextArrowArray(struct ArrowArrayStream *,
+                          struct ArrowArray *out_array) override;
+    const char *GetMetadataItem(const char *pszName,
+                                const char *pszDomain) override;
+
     GIntBig GetFeatureCount(int bForce = TRUE) override;
     OGRErr IGetExtent(int iGeomField, OGREnvelope *psExtent,
                       bool bForce) override;
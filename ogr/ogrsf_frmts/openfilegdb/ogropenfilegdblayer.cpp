@@ -13,6 +13,7 @@
 #include "cpl_port.h"
 #include "ogr_openfilegdb.h"
 
+#include <cerrno>
 #include <cmath>
 #include <cstddef>
 #include <cstdio>
@@ -21,7 +22,9 @@
 #include <cwchar>
 #include <algorithm>
 #include <limits>
+#include <memory>
 #include <string>
+#include <vector>
 
 #include "cpl_conv.h"
 #include "cpl_error.h"
@@ -37,6 +40,8 @@
 #include "ogrsf_frmts.h"
 #include "filegdbtable.h"
 #include "ogr_swq.h"
+#include "ograrrowarrayhelper.h"
+#include "ogrlayerarrow.h"
 #include "filegdb_coordprec_read.h"
 
 OGROpenFileGDBGeomFieldDefn::~OGROpenFileGDBGeomFieldDefn() = default;
@@ -906,6 +911,7 @@ void OGROpenFileGDBLayer::ResetReading()
     }
     m_bEOF = FALSE;
     m_iCurFeat = 0;
+    m_nArrowPendingRow = -1;
     if (m_poAttributeIterator)
         m_poAttributeIterator->Reset();
     if (m_poSpatialIndexIterator)
@@ -1720,6 +1726,34 @@ void OGROpenFileGDBLayer::BuildCombinedIterator()
     }
 }
 
+/***********************************************************************/
+/*                       PromoteToMultiGeometry()                      */
+/***********************************************************************/
+
+// Polygons and linestrings are returned as their multi counterparts, to be
+// consistent with the layer geometry type.
+static OGRGeometry *PromoteToMultiGeometry(OGRGeometry *poGeom)
+{
+    OGRwkbGeometryType eFlattenType = wkbFlatten(poGeom->getGeometryType());
+    if (eFlattenType == wkbPolygon)
+        poGeom = OGRGeometryFactory::forceToMultiPolygon(poGeom);
+    else if (eFlattenType == wkbCurvePolygon)
+    {
+        OGRMultiSurface *poMS = new OGRMultiSurface();
+        poMS->addGeometryDirectly(poGeom);
+        poGeom = poMS;
+    }
+    else if (eFlattenType == wkbLineString)
+        poGeom = OGRGeometryFactory::forceToMultiLineString(poGeom);
+    else if (eFlattenType == wkbCompoundCurve)
+    {
+        OGRMultiCurve *poMC = new OGRMultiCurve();
+        poMC->addGeometryDirectly(poGeom);
+        poGeom = poMC;
+    }
+    return poGeom;
+}
+
 /***********************************************************************/
 /*                         GetCurrentFeature()                         */
 /***********************************************************************/
@@ -1788,26 +1822,7 @@ OGRFeature *OGROpenFileGDBLayer::GetCurrentFeature()
                 OGRGeometry *poGeom = m_poGeomConverter->GetAsGeometry(psField);
                 if (poGeom != nullptr)
                 {
-                    OGRwkbGeometryType eFlattenType =
-                        wkbFlatten(poGeom->getGeometryType());
-                    if (eFlattenType == wkbPolygon)
-                        poGeom =
-                            OGRGeometryFactory::forceToMultiPolygon(poGeom);
-                    else if (eFlattenType == wkbCurvePolygon)
-                    {
-                        OGRMultiSurface *poMS = new OGRMultiSurface();
-                        poMS->addGeometryDirectly(poGeom);
-                        poGeom = poMS;
-                    }
-                    else if (eFlattenType == wkbLineString)
-                        poGeom =
-                            OGRGeometryFactory::forceToMultiLineString(poGeom);
-                    else if (eFlattenType == wkbCompoundCurve)
-                    {
-                        OGRMultiCurve *poMC = new OGRMultiCurve();
-                        poMC->addGeometryDirectly(poGeom);
-                        poGeom = poMC;
-                    }
+                    poGeom = PromoteToMultiGeometry(poGeom);
 
                     poGeom->assignSpatialReference(
                         m_poFeatureDefn->GetGeomFieldDefn(0)->GetSpatialRef());
@@ -2011,6 +2026,449 @@ OGRFeature *OGROpenFileGDBLayer::GetFeature(GIntBig nFeatureId)
     return poFeature;
 }
 
+/***********************************************************************/
+/*                        GetNextArrowArray()                          */
+/***********************************************************************/
+
+// Specialized implementation that decodes rows of the FileGDBTable directly
+// into the Arrow buffers, without going through OGRFeature and, for the
+// common geometry types, OGRGeometry. Attribute filters are only handled when
+// they can be fully evaluated by the .atx indices. In other cases, fall back
+// to the generic implementation.
+int OGROpenFileGDBLayer::GetNextArrowArray(struct ArrowArrayStream *stream,
+                                           struct ArrowArray *out_array)
+{
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = false;
+    if (!BuildLayerDefinition())
+    {
+        memset(out_array, 0, sizeof(*out_array));
+        return EIO;
+    }
+
+    const bool bGeomIgnored =
+        m_iGeomFieldIdx < 0 ||
+        m_poFeatureDefn->GetGeomFieldDefn(0)->IsIgnored();
+    if (!m_poSharedArrowArrayStreamPrivateData->m_anQueriedFIDs.empty() ||
+        (m_poAttrQuery != nullptr &&
+         !(m_poAttributeIterator != nullptr &&
+           m_bIteratorSufficientToEvaluateFilter)) ||
+        (m_poFilterGeom != nullptr && bGeomIgnored) ||
+        m_iFieldToReadAsBinary >= 0 || m_iFIDAsRegularColumnIndex >= 0 ||
+        m_poLyrTable->HasDeletedFeaturesListed() ||
+        m_aosArrowArrayStreamOptions.FetchBool(GAS_OPT_DATETIME_AS_STRING,
+                                               false) ||
+        CPLTestBool(
+            CPLGetConfigOption("OGR_OPENFILEGDB_STREAM_BASE_IMPL", "NO")))
+    {
+        return OGRLayer::GetNextArrowArray(stream, out_array);
+    }
+
+    memset(out_array, 0, sizeof(*out_array));
+    if (m_bEOF)
+        return 0;
+
+    OGRArrowArrayHelper sHelper(m_poDS, m_poFeatureDefn,
+                                m_aosArrowArrayStreamOptions, out_array);
+    if (out_array->release == nullptr)
+    {
+        return ENOMEM;
+    }
+
+    m_bLastGetNextArrowArrayUsedOptimizedCodePath = true;
+
+    // The in-memory spatial index is built by GetNextFeature() only
+    if (m_eSpatialIndexState == SPI_IN_BUILDING)
+        m_eSpatialIndexState = SPI_INVALID;
+
+    FileGDBIterator *poIterator = m_poCombinedIterator ? m_poCombinedIterator
+                                  : m_poSpatialIndexIterator
+                                      ? m_poSpatialIndexIterator
+                                      : m_poAttributeIterator;
+
+    // Index of the OGR field for each FileGDB field, or -1
+    const int nGDBFieldCount = m_poLyrTable->GetFieldCount();
+    std::vector<int> anOGRFieldIdx(nGDBFieldCount, -1);
+    for (int iGDBIdx = 0, iOGRIdx = 0; iGDBIdx < nGDBFieldCount; iGDBIdx++)
+    {
+        if (iGDBIdx != m_iGeomFieldIdx &&
+            iGDBIdx != m_poLyrTable->GetObjectIdFieldIdx())
+        {
+            anOGRFieldIdx[iGDBIdx] = iOGRIdx;
+            iOGRIdx++;
+        }
+    }
+
+    const int iGeomArrowField =
+        bGeomIgnored ? -1 : sHelper.m_mapOGRGeomFieldToArrowField[0];
+    const bool bGeomNullable =
+        !bGeomIgnored &&
+        CPL_TO_BOOL(m_poFeatureDefn->GetGeomFieldDefn(0)->IsNullable());
+    // Null geometries of a non-nullable geometry field are emitted as an
+    // empty geometry, like in the generic implementation
+    std::vector<GByte> abyEmptyWKB;
+    if (!bGeomIgnored && !bGeomNullable)
+    {
+        const auto eGeomType = m_poFeatureDefn->GetGeomFieldDefn(0)->GetType();
+        auto poEmptyGeom =
+            std::unique_ptr<OGRGeometry>(OGRGeometryFactory::createGeometry(
+                wkbFlatten(eGeomType) == wkbUnknown ? wkbGeometryCollection
+                                                    : eGeomType));
+        if (poEmptyGeom)
+        {
+            abyEmptyWKB.resize(poEmptyGeom->WkbSize());
+            poEmptyGeom->exportToWkb(wkbNDR, abyEmptyWKB.data(),
+                                     wkbVariantIso);
+        }
+    }
+    const uint32_t nMemLimit = OGRArrowArrayHelper::GetMemLimit();
+    std::vector<GByte> abyWKB;
+    struct tm brokenDown;
+    memset(&brokenDown, 0, sizeof(brokenDown));
+
+    // Returns whether appending nLen bytes to a string or binary field
+    // would exceed the memory limit, in which case the batch is over.
+    const auto IsBatchFull = [out_array, nMemLimit](int iArrowField, int iFeat,
+                                                    size_t nLen)
+    {
+        if (iFeat == 0 || nLen > nMemLimit)
+            return false;
+        const auto psArray = out_array->children[iArrowField];
+        const auto panOffsets =
+            static_cast<const int32_t *>(psArray->buffers[1]);
+        const uint32_t nCurLength = static_cast<uint32_t>(panOffsets[iFeat]);
+        return nLen > nMemLimit - nCurLength;
+    };
+
+    int iFeat = 0;
+    while (iFeat < sHelper.m_nMaxBatchSize)
+    {
+        int64_t iRow;
+        if (m_nArrowPendingRow >= 0)
+        {
+            iRow = m_nArrowPendingRow;
+            m_nArrowPendingRow = -1;
+            if (!m_poLyrTable->SelectRow(iRow))
+            {
+                m_bEOF = TRUE;
+                break;
+            }
+        }
+        else if (m_nFilteredFeatureCount >= 0)
+        {
+            if (m_iCurFeat >= m_nFilteredFeatureCount)
+                break;
+            iRow = static_cast<int64_t>(reinterpret_cast<GUIntptr_t>(
+                m_pahFilteredFeatures[m_iCurFeat++]));
+            if (!m_poLyrTable->SelectRow(iRow))
+            {
+                if (m_poLyrTable->HasGotError())
+                {
+                    m_bEOF = TRUE;
+                    break;
+                }
+                continue;
+            }
+        }
+        else if (poIterator != nullptr)
+        {
+            iRow = poIterator->GetNextRowSortedByFID();
+            if (iRow < 0)
+                break;
+            if (!m_poLyrTable->SelectRow(iRow))
+            {
+                if (m_poLyrTable->HasGotError())
+                {
+                    m_bEOF = TRUE;
+                    break;
+                }
+                continue;
+            }
+        }
+        else
+        {
+            if (m_iCurFeat == m_poLyrTable->GetTotalRecordCount())
+                break;
+            m_iCurFeat = m_poLyrTable->GetAndSelectNextNonEmptyRow(m_iCurFeat);
+            if (m_iCurFeat < 0)
+            {
+                m_bEOF = TRUE;
+                break;
+            }
+            iRow = m_iCurFeat;
+            m_iCurFeat++;
+        }
+
+        // Geometry is read first, so that rows not matching the spatial
+        // filter are discarded before any attribute is written.
+        OGRField sGeomField;
+        const OGRField *psGeomField = nullptr;
+        if (!bGeomIgnored)
+        {
+            psGeomField = m_poLyrTable->GetFieldValue(m_iGeomFieldIdx);
+            if (psGeomField != nullptr)
+            {
+                // Further GetFieldValue() calls will override it
+                sGeomField = *psGeomField;
+                psGeomField = &sGeomField;
+            }
+        }
+
+        std::unique_ptr<OGRGeometry> poGeom;
+        if (m_poFilterGeom != nullptr)
+        {
+            if (psGeomField == nullptr)
+                continue;
+            if (m_eSpatialIndexState != SPI_COMPLETED &&
+                !m_poLyrTable->DoesGeometryIntersectsFilterEnvelope(
+                    psGeomField))
+                continue;
+            OGREnvelope sFeatureEnvelope;
+            if (!m_bFilterIsEnvelope ||
+                !m_poLyrTable->GetFeatureExtent(psGeomField,
+                                                &sFeatureEnvelope) ||
+                !m_sFilterEnvelope.Contains(sFeatureEnvelope))
+            {
+                poGeom.reset(m_poGeomConverter->GetAsGeometry(psGeomField));
+                if (!poGeom || !FilterGeometry(poGeom.get()))
+                    continue;
+            }
+        }
+
+        bool bBatchFull = false;
+        if (iGeomArrowField >= 0)
+        {
+            bool bHasWKB = false;
+            if (psGeomField != nullptr)
+            {
+                if (!poGeom && m_poGeomConverter->GetAsWKB(psGeomField, abyWKB))
+                {
+                    bHasWKB = true;
+                }
+                else
+                {
+                    if (!poGeom)
+                        poGeom.reset(
+                            m_poGeomConverter->GetAsGeometry(psGeomField));
+                    if (poGeom)
+                    {
+                        poGeom.reset(PromoteToMultiGeometry(poGeom.release()));
+                        abyWKB.resize(poGeom->WkbSize());
+                        poGeom->exportToWkb(wkbNDR, abyWKB.data(),
+                                            wkbVariantIso);
+                        bHasWKB = true;
+                    }
+                }
+            }
+            if (!bHasWKB && !abyEmptyWKB.empty())
+            {
+                abyWKB = abyEmptyWKB;
+                bHasWKB = true;
+            }
+
+            if (bHasWKB)
+            {
+                if (IsBatchFull(iGeomArrowField, iFeat, abyWKB.size()))
+                {
+                    bBatchFull = true;
+                }
+                else
+                {
+                    GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                        iGeomArrowField, iFeat, abyWKB.size());
+                    if (outPtr == nullptr)
+                    {
+                        sHelper.ClearArray();
+                        return ENOMEM;
+                    }
+                    memcpy(outPtr, abyWKB.data(), abyWKB.size());
+                }
+            }
+            else if (bGeomNullable)
+            {
+                sHelper.SetNull(iGeomArrowField, iFeat);
+            }
+            else
+            {
+                sHelper.SetEmptyStringOrBinary(
+                    out_array->children[iGeomArrowField], iFeat);
+            }
+        }
+
+        for (int iGDBIdx = 0; !bBatchFull && iGDBIdx < nGDBFieldCount;
+             iGDBIdx++)
+        {
+            const int iOGRIdx = anOGRFieldIdx[iGDBIdx];
+            if (iOGRIdx < 0)
+                continue;
+            const int iArrowField = sHelper.m_mapOGRFieldToArrowField[iOGRIdx];
+            if (iArrowField < 0)
+                continue;
+
+            const OGRFieldDefn *poFieldDefn =
+                m_poFeatureDefn->GetFieldDefn(iOGRIdx);
+            const OGRFieldType eType = poFieldDefn->GetType();
+            auto psArray = out_array->children[iArrowField];
+            const OGRField *psField = m_poLyrTable->GetFieldValue(iGDBIdx);
+            if (psField == nullptr)
+            {
+                if (sHelper.m_abNullableFields[iOGRIdx])
+                    sHelper.SetNull(iArrowField, iFeat);
+                else if (eType == OFTString || eType == OFTBinary)
+                    sHelper.SetEmptyStringOrBinary(psArray, iFeat);
+                continue;
+            }
+
+            switch (eType)
+            {
+                case OFTInteger:
+                {
+                    const auto eSubType = poFieldDefn->GetSubType();
+                    if (eSubType == OFSTBoolean)
+                    {
+                        if (psField->Integer)
+                            sHelper.SetBoolOn(psArray, iFeat);
+                    }
+                    else if (eSubType == OFSTInt16)
+                    {
+                        sHelper.SetInt16(
+                            psArray, iFeat,
+                            static_cast<int16_t>(psField->Integer));
+                    }
+                    else
+                    {
+                        sHelper.SetInt32(psArray, iFeat, psField->Integer);
+                    }
+                    break;
+                }
+
+                case OFTInteger64:
+                {
+                    sHelper.SetInt64(psArray, iFeat, psField->Integer64);
+                    break;
+                }
+
+                case OFTReal:
+                {
+                    if (poFieldDefn->GetSubType() == OFSTFloat32)
+                    {
+                        sHelper.SetFloat(psArray, iFeat,
+                                         static_cast<float>(psField->Real));
+                    }
+                    else
+                    {
+                        sHelper.SetDouble(psArray, iFeat, psField->Real);
+                    }
+                    break;
+                }
+
+                case OFTString:
+                case OFTBinary:
+                {
+                    const GByte *pabyData =
+                        eType == OFTString
+                            ? reinterpret_cast<const GByte *>(psField->String)
+                            : psField->Binary.paData;
+                    const size_t nLen = eType == OFTString
+                                            ? strlen(psField->String)
+                                            : psField->Binary.nCount;
+                    if (IsBatchFull(iArrowField, iFeat, nLen))
+                    {
+                        bBatchFull = true;
+                        break;
+                    }
+                    GByte *outPtr = sHelper.GetPtrForStringOrBinary(
+                        iArrowField, iFeat, nLen);
+                    if (outPtr == nullptr)
+                    {
+                        sHelper.ClearArray();
+                        return ENOMEM;
+                    }
+                    memcpy(outPtr, pabyData, nLen);
+                    break;
+                }
+
+                case OFTDate:
+                {
+                    sHelper.SetDate(psArray, iFeat, brokenDown, *psField);
+                    break;
+                }
+
+                case OFTTime:
+                {
+                    sHelper.SetInt32(
+                        psArray, iFeat,
+                        psField->Date.Hour * 3600000 +
+                            psField->Date.Minute * 60000 +
+                            static_cast<int>(psField->Date.Second * 1000 +
+                                             0.5f));
+                    break;
+                }
+
+                case OFTDateTime:
+                {
+                    OGRField sField = *psField;
+                    if (m_poLyrTable->GetField(iGDBIdx)->GetType() ==
+                        FGFT_DATETIME)
+                    {
+                        sField.Date.TZFlag = m_bTimeInUTC ? 100 : 0;
+                    }
+                    sHelper.SetDateTime(psArray, iFeat, brokenDown,
+                                        sHelper.m_anTZFlags[iOGRIdx], sField);
+                    break;
+                }
+
+                default:
+                    break;
+            }
+        }
+
+        if (bBatchFull)
+        {
+            // Emit this row in the next batch, and cancel the nulls that
+            // might have been set on it
+            m_nArrowPendingRow = iRow;
+            for (int i = 0; i < sHelper.m_nChildren; ++i)
+            {
+                auto psChild = out_array->children[i];
+                auto pabyNull = static_cast<uint8_t *>(
+                    const_cast<void *>(psChild->buffers[0]));
+                if (pabyNull && !(pabyNull[iFeat / 8] & (1 << (iFeat % 8))))
+                {
+                    pabyNull[iFeat / 8] |=
+                        static_cast<uint8_t>(1 << (iFeat % 8));
+                    --psChild->null_count;
+                }
+            }
+            break;
+        }
+
+        if (sHelper.m_panFIDValues)
+            sHelper.m_panFIDValues[iFeat] = iRow + 1;
+        iFeat++;
+    }
+
+    sHelper.Shrink(iFeat);
+    if (iFeat == 0)
+        sHelper.ClearArray();
+
+    return 0;
+}
+
+/***********************************************************************/
+/*                          GetMetadataItem()                          */
+/***********************************************************************/
+
+const char *OGROpenFileGDBLayer::GetMetadataItem(const char *pszName,
+                                                 const char *pszDomain)
+{
+    if (pszName && pszDomain && EQUAL(pszDomain, "__DEBUG__") &&
+        EQUAL(pszName, "LAST_GET_NEXT_ARROW_ARRAY_USED_OPTIMIZED_CODE_PATH"))
+    {
+        return m_bLastGetNextArrowArrayUsedOptimizedCodePath ? "YES" : "NO";
+    }
+    return OGRLayer::GetMetadataItem(pszName, pszDomain);
+}
+
 /***********************************************************************/
 /*                         SetNextByIndex()                            */
 /***********************************************************************/
@@ -2366,6 +2824,9 @@ int OGROpenFileGDBLayer::TestCapability(const char *pszCap) const
                 m_poLyrTable->HasSpatialIndex());
     }
 
+    else if (EQUAL(pszCap, OLCFastGetArrowStream))
+        return TRUE;
+
     return FALSE;
 }
 
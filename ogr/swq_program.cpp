@@ -0,0 +1,422 @@
+/******************************************************************************
+ *
+ * Component: OGR SQL Engine
+ * Purpose: Implementation of the swq_program class, a flat form of simple
+ *          WHERE expressions that can be evaluated without allocations.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "ogr_swq_program.h"
+
+#include <cstring>
+
+#include "cpl_conv.h"
+#include "ogr_feature.h"
+#include "ogr_p.h"
+
+//! @cond Doxygen_Suppress
+
+/************************************************************************/
+/*                   swq_instruction::TestString()                      */
+/************************************************************************/
+
+bool swq_instruction::TestString(const char *pszValue) const
+{
+    switch (eOp)
+    {
+        case SWQ_EQ:
+            return strcasecmp(pszValue, aosValues[0].c_str()) == 0;
+        case SWQ_NE:
+            return strcasecmp(pszValue, aosValues[0].c_str()) != 0;
+        case SWQ_LT:
+            return strcasecmp(pszValue, aosValues[0].c_str()) < 0;
+        case SWQ_LE:
+            return strcasecmp(pszValue, aosValues[0].c_str()) <= 0;
+        case SWQ_GT:
+            return strcasecmp(pszValue, aosValues[0].c_str()) > 0;
+        case SWQ_GE:
+            return strcasecmp(pszValue, aosValues[0].c_str()) >= 0;
+        case SWQ_BETWEEN:
+            return strcasecmp(pszValue, aosValues[0].c_str()) >= 0 &&
+                   strcasecmp(pszValue, aosValues[1].c_str()) <= 0;
+        case SWQ_IN:
+            for (const auto &osOther : aosValues)
+            {
+                if (strcasecmp(pszValue, osOther.c_str()) == 0)
+                    return true;
+            }
+            return false;
+        case SWQ_LIKE:
+        case SWQ_ILIKE:
+            return swq_test_like(pszValue, aosValues[0].c_str(), chEscape,
+                                 bInsensitive, bUTF8Strings) != 0;
+        default:
+            break;
+    }
+    return false;
+}
+
+/************************************************************************/
+/*                            GetColumn()                               */
+/************************************************************************/
+
+/** Return the feature field index read by a SNT_COLUMN node, or -1 if it is
+ * not a regular field or the FID. */
+static int GetColumn(const swq_expr_node *poNode, const OGRFeatureDefn *poDefn)
+{
+    if (poNode->eNodeType != SNT_COLUMN || poNode->table_index != 0 ||
+        poNode->field_type == SWQ_GEOMETRY)
+    {
+        return -1;
+    }
+    const int nFieldCount = poDefn->GetFieldCount();
+    if (poNode->field_index >= 0 && poNode->field_index < nFieldCount)
+        return poNode->field_index;
+    // FID special field, or FID column added after the geometry fields
+    // by OGRFeatureQuery::Compile()
+    if (poNode->field_index == nFieldCount + SPF_FID ||
+        poNode->field_index ==
+            nFieldCount + SPECIAL_FIELD_COUNT + poDefn->GetGeomFieldCount())
+    {
+        return nFieldCount + SPF_FID;
+    }
+    return -1;
+}
+
+/************************************************************************/
+/*                         CompileComparison()                          */
+/************************************************************************/
+
+/** Compile the test of a column against constants.
+ *
+ * This mimics the dispatching of SWQGeneralEvaluator() on argument types,
+ * and rejects cases where its behavior depends on the evaluated values
+ * beyond what swq_instruction implements.
+ */
+static bool CompileComparison(const swq_expr_node *poNode,
+                              const OGRFeatureDefn *poDefn, bool bUTF8Strings,
+                              swq_instruction &oInstr)
+{
+    if (poNode->field_type != SWQ_BOOLEAN)
+        return false;
+
+    oInstr.eOp = poNode->nOperation;
+    const int nSubExprCount = poNode->nSubExprCount;
+
+    if (oInstr.eOp == SWQ_ISNULL)
+    {
+        if (nSubExprCount != 1)
+            return false;
+        oInstr.iField = GetColumn(poNode->papoSubExpr[0], poDefn);
+        oInstr.eFieldType = poNode->papoSubExpr[0]->field_type;
+        return oInstr.iField >= 0;
+    }
+
+    int iColumnSubExpr = 0;
+    switch (oInstr.eOp)
+    {
+        case SWQ_EQ:
+        case SWQ_NE:
+        case SWQ_LT:
+        case SWQ_LE:
+        case SWQ_GT:
+        case SWQ_GE:
+            if (nSubExprCount != 2)
+                return false;
+            // "constant op column": swap operands.
+            if (poNode->papoSubExpr[0]->eNodeType == SNT_CONSTANT &&
+                poNode->papoSubExpr[1]->eNodeType == SNT_COLUMN)
+            {
+                iColumnSubExpr = 1;
+                if (oInstr.eOp == SWQ_LT)
+                    oInstr.eOp = SWQ_GT;
+                else if (oInstr.eOp == SWQ_LE)
+                    oInstr.eOp = SWQ_GE;
+                else if (oInstr.eOp == SWQ_GT)
+                    oInstr.eOp = SWQ_LT;
+                else if (oInstr.eOp == SWQ_GE)
+                    oInstr.eOp = SWQ_LE;
+            }
+            break;
+
+        case SWQ_IN:
+            if (nSubExprCount < 2)
+                return false;
+            break;
+
+        case SWQ_BETWEEN:
+            if (nSubExprCount != 3)
+                return false;
+            break;
+
+        case SWQ_LIKE:
+        case SWQ_ILIKE:
+            if (nSubExprCount != 2 && nSubExprCount != 3)
+                return false;
+            break;
+
+        default:
+            return false;
+    }
+
+    const swq_expr_node *poColumn = poNode->papoSubExpr[iColumnSubExpr];
+    oInstr.iField = GetColumn(poColumn, poDefn);
+    if (oInstr.iField < 0)
+        return false;
+    oInstr.eFieldType = poColumn->field_type;
+
+    std::vector<const swq_expr_node *> apoConstants;
+    for (int i = 0; i < nSubExprCount; ++i)
+    {
+        if (i == iColumnSubExpr)
+            continue;
+        const swq_expr_node *poConstant = poNode->papoSubExpr[i];
+        if (poConstant->eNodeType != SNT_CONSTANT || poConstant->is_null)
+            return false;
+        apoConstants.push_back(poConstant);
+    }
+
+    if (oInstr.eFieldType == SWQ_STRING)
+    {
+        oInstr.eValueType = swq_program_value_type::STRING;
+        for (const auto *poConstant : apoConstants)
+        {
+            if (poConstant->field_type != SWQ_STRING ||
+                poConstant->string_value == nullptr)
+            {
+                return false;
+            }
+            oInstr.aosValues.push_back(poConstant->string_value);
+        }
+
+        if (oInstr.eOp == SWQ_EQ)
+        {
+            // SWQGeneralEvaluator() has special rules for comparing values
+            // that look like timestamps with a time zone. Make sure they
+            // cannot be triggered.
+            const std::string &osValue = oInstr.aosValues[0];
+            const size_t nLen = osValue.size();
+            if (nLen > 3 && (osValue[nLen - 3] == ':' ||
+                             osValue.compare(nLen - 3, 3, "+00") == 0))
+            {
+                return false;
+            }
+        }
+        else if (oInstr.eOp == SWQ_LIKE || oInstr.eOp == SWQ_ILIKE)
+        {
+            if (oInstr.aosValues.size() == 2)
+            {
+                oInstr.chEscape = oInstr.aosValues[1][0];
+                oInstr.aosValues.resize(1);
+            }
+            oInstr.bInsensitive =
+                oInstr.eOp == SWQ_ILIKE ||
+                CPLTestBool(
+                    CPLGetConfigOption("OGR_SQL_LIKE_AS_ILIKE", "FALSE"));
+            oInstr.bUTF8Strings = bUTF8Strings;
+        }
+        return true;
+    }
+
+    if (oInstr.eOp == SWQ_LIKE || oInstr.eOp == SWQ_ILIKE ||
+        !(SWQ_IS_INTEGER(oInstr.eFieldType) ||
+          oInstr.eFieldType == SWQ_BOOLEAN ||
+          oInstr.eFieldType == SWQ_FLOAT))
+    {
+        return false;
+    }
+
+    // Same rule as SWQGeneralEvaluator(): floating point comparison if one
+    // of the first two arguments is a floating point value.
+    const bool bFloat = oInstr.eFieldType == SWQ_FLOAT ||
+                        apoConstants[0]->field_type == SWQ_FLOAT;
+    oInstr.eValueType = bFloat ? swq_program_value_type::FLOAT
+                               : swq_program_value_type::INTEGER;
+    for (size_t i = 0; i < apoConstants.size(); ++i)
+    {
+        const auto *poConstant = apoConstants[i];
+        if (poConstant->field_type == SWQ_FLOAT)
+        {
+            if (!bFloat)
+                return false;
+            oInstr.adfValues.push_back(poConstant->float_value);
+        }
+        else if (SWQ_IS_INTEGER(poConstant->field_type) ||
+                 poConstant->field_type == SWQ_BOOLEAN)
+        {
+            if (bFloat)
+            {
+                // SWQGeneralEvaluator() only converts the first two
+                // arguments to floating point.
+                if (i > 0)
+                    return false;
+                oInstr.adfValues.push_back(
+                    static_cast<double>(poConstant->int_value));
+            }
+            else
+            {
+                oInstr.anValues.push_back(poConstant->int_value);
+            }
+        }
+        else
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/************************************************************************/
+/*                     swq_program::CompileNode()                       */
+/************************************************************************/
+
+bool swq_program::CompileNode(const swq_expr_node *poNode,
+                              const OGRFeatureDefn *poDefn, bool bUTF8Strings,
+                              int nLevel, int &nDepth)
+{
+    if (nLevel == MAX_STACK_DEPTH || poNode->eNodeType != SNT_OPERATION)
+        return false;
+
+    if (poNode->nOperation == SWQ_AND || poNode->nOperation == SWQ_OR ||
+        poNode->nOperation == SWQ_NOT)
+    {
+        const int nExpectedSubExprCount =
+            poNode->nOperation == SWQ_NOT ? 1 : 2;
+        if (poNode->field_type != SWQ_BOOLEAN ||
+            poNode->nSubExprCount != nExpectedSubExprCount)
+        {
+            return false;
+        }
+        for (int i = 0; i < nExpectedSubExprCount; ++i)
+        {
+            if (!CompileNode(poNode->papoSubExpr[i], poDefn, bUTF8Strings,
+                             nLevel + 1, nDepth))
+            {
+                return false;
+            }
+        }
+        swq_instruction oInstr;
+        oInstr.eOp = poNode->nOperation;
+        m_aoInstructions.push_back(std::move(oInstr));
+        nDepth -= nExpectedSubExprCount - 1;
+        return true;
+    }
+
+    swq_instruction oInstr;
+    if (!CompileComparison(poNode, poDefn, bUTF8Strings, oInstr) ||
+        nDepth == MAX_STACK_DEPTH)
+    {
+        return false;
+    }
+    m_aoInstructions.push_back(std::move(oInstr));
+    ++nDepth;
+    return true;
+}
+
+/************************************************************************/
+/*                       swq_program::Compile()                         */
+/************************************************************************/
+
+/** Compile a checked expression whose columns refer to fields of poDefn, as
+ * done by OGRFeatureQuery::Compile().
+ *
+ * Returns nullptr if the expression uses constructs that cannot be compiled.
+ */
+std::unique_ptr<swq_program>
+swq_program::Compile(const swq_expr_node *poExpr, const OGRFeatureDefn *poDefn,
+                     bool bUTF8Strings)
+{
+    auto poProgram = std::make_unique<swq_program>();
+    int nDepth = 0;
+    if (!poProgram->CompileNode(poExpr, poDefn, bUTF8Strings, 0, nDepth))
+        return nullptr;
+    CPLAssert(nDepth == 1);
+    return poProgram;
+}
+
+/************************************************************************/
+/*                       swq_program::Evaluate()                        */
+/************************************************************************/
+
+/** Evaluate the program on a feature. */
+bool swq_program::Evaluate(const OGRFeature *poFeature) const
+{
+    // Results of SWQGeneralEvaluator() are a value and a null flag.
+    // The value is false when the null flag is set.
+    bool abValue[MAX_STACK_DEPTH];
+    bool abNull[MAX_STACK_DEPTH];
+    int nDepth = 0;
+
+    for (const auto &oInstr : m_aoInstructions)
+    {
+        switch (oInstr.eOp)
+        {
+            case SWQ_AND:
+                --nDepth;
+                abValue[nDepth - 1] = abValue[nDepth - 1] && abValue[nDepth];
+                abNull[nDepth - 1] = abNull[nDepth - 1] && abNull[nDepth];
+                break;
+
+            case SWQ_OR:
+                --nDepth;
+                abValue[nDepth - 1] = abValue[nDepth - 1] || abValue[nDepth];
+                abNull[nDepth - 1] = abNull[nDepth - 1] || abNull[nDepth];
+                break;
+
+            case SWQ_NOT:
+                abValue[nDepth - 1] =
+                    !abValue[nDepth - 1] && !abNull[nDepth - 1];
+                break;
+
+            default:
+            {
+                const int iField = oInstr.iField;
+                bool bValue = false;
+                bool bNull = false;
+                if (!poFeature->IsFieldSetAndNotNull(iField))
+                {
+                    bValue = oInstr.eOp == SWQ_ISNULL;
+                    bNull = !bValue;
+                }
+                else if (oInstr.eOp == SWQ_ISNULL)
+                {
+                    // bValue = false
+                }
+                else if (oInstr.eValueType == swq_program_value_type::STRING)
+                {
+                    bValue =
+                        oInstr.TestString(poFeature->GetFieldAsString(iField));
+                }
+                else if (oInstr.eFieldType == SWQ_FLOAT)
+                {
+                    bValue =
+                        oInstr.TestFloat(poFeature->GetFieldAsDouble(iField));
+                }
+                else
+                {
+                    const int64_t nValue =
+                        oInstr.eFieldType == SWQ_INTEGER64
+                            ? poFeature->GetFieldAsInteger64(iField)
+                            : poFeature->GetFieldAsInteger(iField);
+                    bValue = oInstr.eValueType == swq_program_value_type::FLOAT
+                                 ? oInstr.TestFloat(static_cast<double>(nValue))
+                                 : oInstr.TestInteger(nValue);
+                }
+                abValue[nDepth] = bValue;
+                abNull[nDepth] = bNull;
+                ++nDepth;
+                break;
+            }
+        }
+    }
+
+    CPLAssert(nDepth == 1);
+    return abValue[0];
+}
+
+//! @endcond
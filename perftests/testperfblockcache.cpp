@@ -0,0 +1,168 @@
+/******************************************************************************
+ * Project:  GDAL Core
+ * Purpose:  Test performance of the global block cache when random blocks
+ *           are read concurrently from several threads.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gdal.h"
+#include "cpl_conv.h"
+#include "cpl_multiproc.h"
+#include "cpl_string.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <thread>
+#include <vector>
+
+static void Usage()
+{
+    printf("Usage: testperfblockcache [-threads <max_threads>] "
+           "[-iters <reads_per_thread>]\n");
+    printf("                          [-size <raster_size>] "
+           "[-blocksize <block_size>]\n");
+    printf("                          [--config GDAL_RB_CACHE_SHARDS <val>]\n");
+    exit(1);
+}
+
+int main(int argc, char *argv[])
+{
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    if (argc < 1)
+        exit(-argc);
+
+    int nMaxThreads = CPLGetNumCPUs();
+    int nIters = 1000 * 1000;
+    int nSize = 2048;
+    int nBlockSize = 64;
+    for (int i = 1; i < argc; i++)
+    {
+        if (EQUAL(argv[i], "-threads") && i + 1 < argc)
+            nMaxThreads = std::max(1, atoi(argv[++i]));
+        else if (EQUAL(argv[i], "-iters") && i + 1 < argc)
+            nIters = std::max(1, atoi(argv[++i]));
+        else if (EQUAL(argv[i], "-size") && i + 1 < argc)
+            nSize = std::max(1, atoi(argv[++i]));
+        else if (EQUAL(argv[i], "-blocksize") && i + 1 < argc)
+            nBlockSize = std::max(16, atoi(argv[++i]) / 16 * 16);
+        else
+            Usage();
+    }
+
+    GDALAllRegister();
+
+    // Make sure that all blocks of all threads fit in the cache, so that
+    // we measure the cost of cache hits, that is the LRU management.
+    GDALSetCacheMax64(static_cast<GIntBig>(nMaxThreads + 1) * nSize * nSize +
+                      256 * 1024 * 1024);
+
+    const char *pszFilename = "/vsimem/testperfblockcache.tif";
+    {
+        GDALDriverH hDrv = GDALGetDriverByName("GTiff");
+        if (!hDrv)
+        {
+            fprintf(stderr, "GTiff driver not available\n");
+            return 1;
+        }
+        CPLStringList aosOptions;
+        aosOptions.SetNameValue("TILED", "YES");
+        aosOptions.SetNameValue("BLOCKXSIZE", CPLSPrintf("%d", nBlockSize));
+        aosOptions.SetNameValue("BLOCKYSIZE", CPLSPrintf("%d", nBlockSize));
+        GDALDatasetH hDS = GDALCreate(hDrv, pszFilename, nSize, nSize, 1,
+                                      GDT_Byte, aosOptions.List());
+        if (!hDS)
+            return 1;
+        std::vector<GByte> abyLine(nSize);
+        for (int iY = 0; iY < nSize; ++iY)
+        {
+            for (int iX = 0; iX < nSize; ++iX)
+                abyLine[iX] = static_cast<GByte>(iX + iY);
+            if (GDALRasterIO(GDALGetRasterBand(hDS, 1), GF_Write, 0, iY, nSize,
+                             1, abyLine.data(), nSize, 1, GDT_Byte, 0,
+                             0) != CE_None)
+            {
+                GDALClose(hDS);
+                return 1;
+            }
+        }
+        GDALClose(hDS);
+    }
+
+    GDALDatasetH hDS = GDALOpenEx(pszFilename,
+                                  GDAL_OF_RASTER | GDAL_OF_THREAD_SAFE,
+                                  nullptr, nullptr, nullptr);
+    if (!hDS)
+        return 1;
+    GDALRasterBandH hBand = GDALGetRasterBand(hDS, 1);
+    const int nBlocksPerRow = (nSize + nBlockSize - 1) / nBlockSize;
+    const int nBlockCount = nBlocksPerRow * nBlocksPerRow;
+
+    const auto ReadRandomBlocks =
+        [hBand, nSize, nBlockSize, nBlocksPerRow,
+         nBlockCount](int nSeed, int nReads, bool bSequential)
+    {
+        std::vector<GByte> abyBuffer(static_cast<size_t>(nBlockSize) *
+                                     nBlockSize);
+        std::mt19937 gen(nSeed);
+        std::uniform_int_distribution<int> dist(0, nBlockCount - 1);
+        for (int i = 0; i < nReads; ++i)
+        {
+            const int iBlock = bSequential ? i : dist(gen);
+            const int nXOff = (iBlock % nBlocksPerRow) * nBlockSize;
+            const int nYOff = (iBlock / nBlocksPerRow) * nBlockSize;
+            const int nXSize = std::min(nBlockSize, nSize - nXOff);
+            const int nYSize = std::min(nBlockSize, nSize - nYOff);
+            CPL_IGNORE_RET_VAL(GDALRasterIO(
+                hBand, GF_Read, nXOff, nYOff, nXSize, nYSize, abyBuffer.data(),
+                nXSize, nYSize, GDT_Byte, 0, 0));
+        }
+    };
+
+    printf("Raster %dx%d, blocks %dx%d, %d reads per thread\n", nSize, nSize,
+           nBlockSize, nBlockSize, nIters);
+    for (int nThreads = 1; nThreads <= nMaxThreads;
+         nThreads = (nThreads == nMaxThreads)
+                        ? nThreads + 1
+                        : std::min(nThreads * 2, nMaxThreads))
+    {
+        // Warm the cache, so that the timed loop only hits cached blocks.
+        {
+            std::vector<std::thread> aoThreads;
+            for (int i = 0; i < nThreads; ++i)
+                aoThreads.emplace_back(ReadRandomBlocks, i, nBlockCount,
+                                       true);
+            for (auto &oThread : aoThreads)
+                oThread.join();
+        }
+
+        const auto start = std::chrono::steady_clock::now();
+        {
+            std::vector<std::thread> aoThreads;
+            for (int i = 0; i < nThreads; ++i)
+                aoThreads.emplace_back(ReadRandomBlocks, i, nIters, false);
+            for (auto &oThread : aoThreads)
+                oThread.join();
+        }
+        const auto end = std::chrono::steady_clock::now();
+        const double dfSeconds =
+            std::chrono::duration<double>(end - start).count();
+        printf("%2d thread(s): %.3f s, %.2f M block reads/s\n", nThreads,
+               dfSeconds,
+               static_cast<double>(nThreads) * nIters / dfSeconds / 1e6);
+    }
+
+    GDALClose(hDS);
+    VSIUnlink(pszFilename);
+
+    CSLDestroy(argv);
+    GDALDestroyDriverManager();
+
+    return 0;
+}
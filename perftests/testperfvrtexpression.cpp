@@ -0,0 +1,192 @@
+/******************************************************************************
+ * Project:  GDAL Core
+ * Purpose:  Compare the performance of the vectorized and per-pixel
+ *           evaluation of VRT "expression" pixel functions.
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "gdal.h"
+#include "cpl_conv.h"
+#include "cpl_minixml.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+static void Usage()
+{
+    printf("Usage: testperfvrtexpression [-size <raster_size>] "
+           "[-iters <iterations>]\n");
+    exit(1);
+}
+
+static std::string BuildVRT(int nSize, const char *pszExpression,
+                            const std::vector<std::string> &aosSources)
+{
+    std::string osXML = CPLSPrintf(
+        "<VRTDataset rasterXSize=\"%d\" rasterYSize=\"%d\">"
+        "<VRTRasterBand dataType=\"Float32\" band=\"1\" "
+        "subClass=\"VRTDerivedRasterBand\">"
+        "<PixelFunctionType>expression</PixelFunctionType>"
+        "<PixelFunctionArguments expression=\"",
+        nSize, nSize);
+    char *pszEscaped = CPLEscapeString(pszExpression, -1, CPLES_XML);
+    osXML += pszEscaped;
+    CPLFree(pszEscaped);
+    osXML += "\" dialect=\"muparser\" />";
+    for (const auto &osSource : aosSources)
+    {
+        osXML += "<SimpleSource name=\"";
+        osXML += osSource;
+        osXML += "\"><SourceFilename>/vsimem/testperfvrtexpression_";
+        osXML += osSource;
+        osXML += ".tif</SourceFilename><SourceBand>1</SourceBand>"
+                 "</SimpleSource>";
+    }
+    osXML += "</VRTRasterBand></VRTDataset>";
+    return osXML;
+}
+
+int main(int argc, char *argv[])
+{
+    argc = GDALGeneralCmdLineProcessor(argc, &argv, 0);
+    if (argc < 1)
+        exit(-argc);
+
+    int nSize = 2048;
+    int nIters = 5;
+    for (int i = 1; i < argc; i++)
+    {
+        if (EQUAL(argv[i], "-size") && i + 1 < argc)
+            nSize = std::max(1, atoi(argv[++i]));
+        else if (EQUAL(argv[i], "-iters") && i + 1 < argc)
+            nIters = std::max(1, atoi(argv[++i]));
+        else
+            Usage();
+    }
+
+    GDALAllRegister();
+
+    GDALDriverH hDrv = GDALGetDriverByName("GTiff");
+    if (!hDrv)
+    {
+        fprintf(stderr, "GTiff driver not available\n");
+        return 1;
+    }
+
+    // Sources named after the bands of a multispectral image
+    const std::vector<std::string> aosSources = {"RED", "GREEN", "NIR"};
+    std::vector<float> afBuffer(static_cast<size_t>(nSize) * nSize);
+    std::mt19937 oRandom(0);
+    std::uniform_real_distribution<float> oDist(0.0f, 10000.0f);
+    for (const auto &osSource : aosSources)
+    {
+        for (auto &fVal : afBuffer)
+            fVal = oDist(oRandom);
+        const std::string osFilename =
+            "/vsimem/testperfvrtexpression_" + osSource + ".tif";
+        GDALDatasetH hDS = GDALCreate(hDrv, osFilename.c_str(), nSize, nSize,
+                                      1, GDT_Float32, nullptr);
+        if (!hDS)
+            return 1;
+        CPL_IGNORE_RET_VAL(GDALRasterIO(GDALGetRasterBand(hDS, 1), GF_Write,
+                                        0, 0, nSize, nSize, afBuffer.data(),
+                                        nSize, nSize, GDT_Float32, 0, 0));
+        GDALClose(hDS);
+    }
+
+    const char *const apszExpressions[] = {
+        "(NIR-RED)/(NIR+RED)",
+        "2.5*(NIR-RED)/(NIR+6*RED-7.5*GREEN+1)",
+        "(NIR-RED)/(NIR+RED) > 0.2 ? NIR : RED",
+        "sqrt(RED^2+GREEN^2+NIR^2)",
+        "min(RED, GREEN, NIR) / max(RED, GREEN, NIR)",
+    };
+
+    int nRet = 0;
+    for (const char *pszExpression : apszExpressions)
+    {
+        const std::string osVRT = BuildVRT(nSize, pszExpression, aosSources);
+        std::vector<float> afRef;
+        double adfTimes[2] = {0, 0};
+        for (int iMode = 0; iMode < 2; ++iMode)
+        {
+            CPLSetConfigOption("GDAL_VRT_VECTORIZED_EXPRESSION",
+                               iMode == 0 ? "NO" : "YES");
+            GDALDatasetH hDS = GDALOpen(osVRT.c_str(), GA_ReadOnly);
+            if (!hDS)
+            {
+                fprintf(stderr, "Cannot open VRT. Is muparser available?\n");
+                CPLSetConfigOption("GDAL_VRT_VECTORIZED_EXPRESSION", nullptr);
+                return 1;
+            }
+            const auto start = std::chrono::steady_clock::now();
+            for (int iIter = 0; iIter < nIters; ++iIter)
+            {
+                // Flush the cache, so that pixels are actually computed
+                GDALFlushRasterCache(GDALGetRasterBand(hDS, 1));
+                if (GDALRasterIO(GDALGetRasterBand(hDS, 1), GF_Read, 0, 0,
+                                 nSize, nSize, afBuffer.data(), nSize, nSize,
+                                 GDT_Float32, 0, 0) != CE_None)
+                {
+                    nRet = 1;
+                }
+            }
+            const auto end = std::chrono::steady_clock::now();
+            adfTimes[iMode] =
+                std::chrono::duration<double>(end - start).count();
+            GDALClose(hDS);
+
+            if (iMode == 0)
+            {
+                afRef = afBuffer;
+            }
+            else
+            {
+                // Both evaluations may differ by floating-point rounding
+                for (size_t i = 0; i < afBuffer.size(); ++i)
+                {
+                    if (!(std::fabs(afBuffer[i] - afRef[i]) <=
+                          1e-6f * std::max(1.0f, std::fabs(afRef[i]))) &&
+                        !(std::isnan(afBuffer[i]) && std::isnan(afRef[i])))
+                    {
+                        fprintf(stderr, "%s: mismatch at %d: %g vs %g\n",
+                                pszExpression, static_cast<int>(i),
+                                afBuffer[i], afRef[i]);
+                        nRet = 1;
+                        break;
+                    }
+                }
+            }
+        }
+        const double dfMPixels =
+            static_cast<double>(nSize) * nSize * nIters / 1e6;
+        printf("%-45s per-pixel: %7.1f Mpixel/s, vectorized: %7.1f "
+               "Mpixel/s\n",
+               pszExpression, dfMPixels / adfTimes[0],
+               dfMPixels / adfTimes[1]);
+    }
+    CPLSetConfigOption("GDAL_VRT_VECTORIZED_EXPRESSION", nullptr);
+
+    for (const auto &osSource : aosSources)
+    {
+        VSIUnlink(
+            ("/vsimem/testperfvrtexpression_" + osSource + ".tif").c_str());
+    }
+
+    CSLDestroy(argv);
+    GDALDestroyDriverManager();
+
+    return nRet;
+}
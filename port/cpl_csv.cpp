@@ -25,6 +25,8 @@
 #include "gdal_csv.h"
 
 #include <algorithm>
+#include <string>
+#include <vector>
 
 /* ==================================================================== */
 /*      The CSVTable is a persistent set of info about an open CSV      */
@@ -249,25 +251,36 @@ void CSVDeaccess(const char *pszFilename)
 }
 
 /************************************************************************/
-/*                            CSVSplitLine()                            */
-/*                                                                      */
-/*      Tokenize a CSV line into fields in the form of a string         */
-/*      list.  This is used instead of the CPLTokenizeString()          */
-/*      because it provides correct CSV escaping and quoting            */
-/*      semantics.                                                      */
+/*                        CSVSplitLineToTokens()                        */
 /************************************************************************/
 
-static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
-                           bool bKeepLeadingAndClosingQuotes,
-                           bool bMergeDelimiter)
+/** Tokenize a CSV line into fields, with the same CSV escaping and quoting
+ * rules as CSVReadParseLine3L().
+ *
+ * Fields are written nul-terminated into osTokens, and their start offsets
+ * into anTokenOffsets. This avoids allocating a string list per line.
+ *
+ * @param pszString line to tokenize.
+ * @param pszDelimiter field delimiter.
+ * @param bKeepLeadingAndClosingQuotes whether the double quotes surrounding
+ * quoted fields are kept.
+ * @param bMergeDelimiter whether consecutive delimiters are merged.
+ * @param osTokens output fields (previous content is discarded).
+ * @param anTokenOffsets output field offsets (previous content is
+ * discarded).
+ * @since GDAL 3.12
+ */
+void CSVSplitLineToTokens(const char *pszString, const char *pszDelimiter,
+                          bool bKeepLeadingAndClosingQuotes,
+                          bool bMergeDelimiter, std::string &osTokens,
+                          std::vector<size_t> &anTokenOffsets)
 
 {
-    CPLStringList aosRetList;
+    osTokens.clear();
+    anTokenOffsets.clear();
     if (pszString == nullptr)
-        return static_cast<char **>(CPLCalloc(sizeof(char *), 1));
+        return;
 
-    char *pszToken = static_cast<char *>(CPLCalloc(10, 1));
-    int nTokenMax = 10;
     const size_t nDelimiterLength = strlen(pszDelimiter);
 
     const char *pszIter = pszString;
@@ -275,7 +288,8 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
     {
         bool bInString = false;
 
-        int nTokenLen = 0;
+        size_t nTokenLen = 0;
+        anTokenOffsets.push_back(osTokens.size());
 
         // Try to find the next delimiter, marking end of token.
         do
@@ -314,31 +328,47 @@ static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
                 }
             }
 
-            if (nTokenLen >= nTokenMax - 2)
-            {
-                nTokenMax = nTokenMax * 2 + 10;
-                pszToken = static_cast<char *>(CPLRealloc(pszToken, nTokenMax));
-            }
-
-            pszToken[nTokenLen] = *pszIter;
+            osTokens += *pszIter;
             nTokenLen++;
         } while (*(++pszIter) != '\0');
 
-        pszToken[nTokenLen] = '\0';
-        aosRetList.AddString(pszToken);
+        osTokens += '\0';
 
         // If the last token is an empty token, then we have to catch
         // it now, otherwise we won't reenter the loop and it will be lost.
         if (*pszIter == '\0' &&
-            pszIter - pszString >= static_cast<int>(nDelimiterLength) &&
+            static_cast<size_t>(pszIter - pszString) >= nDelimiterLength &&
             strncmp(pszIter - nDelimiterLength, pszDelimiter,
                     nDelimiterLength) == 0)
         {
-            aosRetList.AddString("");
+            anTokenOffsets.push_back(osTokens.size());
+            osTokens += '\0';
         }
     }
+}
+
+/************************************************************************/
+/*                            CSVSplitLine()                            */
+/*                                                                      */
+/*      Tokenize a CSV line into fields in the form of a string         */
+/*      list.  This is used instead of the CPLTokenizeString()          */
+/*      because it provides correct CSV escaping and quoting            */
+/*      semantics.                                                      */
+/************************************************************************/
 
-    CPLFree(pszToken);
+static char **CSVSplitLine(const char *pszString, const char *pszDelimiter,
+                           bool bKeepLeadingAndClosingQuotes,
+                           bool bMergeDelimiter)
+
+{
+    std::string osTokens;
+    std::vector<size_t> anTokenOffsets;
+    CSVSplitLineToTokens(pszString, pszDelimiter, bKeepLeadingAndClosingQuotes,
+                         bMergeDelimiter, osTokens, anTokenOffsets);
+
+    CPLStringList aosRetList;
+    for (const size_t nOffset : anTokenOffsets)
+        aosRetList.AddString(osTokens.c_str() + nOffset);
 
     if (aosRetList.Count() == 0)
         return static_cast<char **>(CPLCalloc(sizeof(char *), 1));
@@ -67,4 +67,17 @@ void CPL_DLL SetCSVFilenameHook(const char *(*)(const char *));
 
 CPL_C_END
 
+#if defined(__cplusplus) && !defined(CPL_SUPPRESS_CPLUSPLUS)
+
+#include <string>
+#include <vector>
+
+void CPL_DLL CSVSplitLineToTokens(const char *pszString,
+                                  const char *pszDelimiter,
+                                  bool bKeepLeadingAndClosingQuotes,
+                                  bool bMergeDelimiter, std::string &osTokens,
+                                  std::vector<size_t> &anTokenOffsets);
+
+#endif
+
 #endif /* ndef CPL_CSV_H_INCLUDED */
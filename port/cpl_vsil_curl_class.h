@@ -291,10 +291,11 @@ class VSICurlFilesystemHandlerBase : public VSIFilesystemHandler
     }
 
     std::shared_ptr<std::string> GetRegion(const char *pszURL,
-                                           vsi_l_offset nFileOffsetStart);
+                                           vsi_l_offset nFileOffsetStart,
+                                           bool bUseDiskCache);
 
     void AddRegion(const char *pszURL, vsi_l_offset nFileOffsetStart,
-                   size_t nSize, const char *pData);
+                   size_t nSize, const char *pData, bool bUseDiskCache);
 
     std::pair<bool, std::string>
     NotifyStartDownloadRegion(const std::string &osURL,
@@ -1265,6 +1266,13 @@ void VSICURLInvalidateCachedFileProp(const char *pszURL);
 void VSICURLInvalidateCachedFilePropPrefix(const char *pszURL);
 void VSICURLDestroyCacheFileProp();
 
+// Persistent on-disk cache of regions (cpl_vsil_curl_disk_cache.cpp)
+std::shared_ptr<std::string>
+VSICURLDiskCacheGetRegion(const char *pszURL, vsi_l_offset nFileOffsetStart);
+void VSICURLDiskCacheAddRegion(const char *pszURL,
+                               vsi_l_offset nFileOffsetStart, size_t nSize,
+                               const char *pData);
+
 void VSICURLMultiCleanup(CURLM *hCurlMultiHandle);
 
 //! @endcond
@@ -0,0 +1,371 @@
+/******************************************************************************
+ *
+ * Project:  CPL - Common Portability Library
+ * Purpose:  Persistent on-disk cache of regions downloaded by /vsicurl/ and
+ *           related file systems
+ *
+ ******************************************************************************
+ * Copyright (c) 2026, GDAL contributors
+ *
+ * SPDX-License-Identifier: MIT
+ ****************************************************************************/
+
+#include "cpl_port.h"
+#include "cpl_vsil_curl_class.h"
+
+#ifdef HAVE_CURL
+
+#include "cpl_conv.h"
+#include "cpl_multiproc.h"
+#include "cpl_sha256.h"
+#include "cpl_string.h"
+#include "cpl_vsi.h"
+
+#include <algorithm>
+#include <atomic>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
+
+//! @cond Doxygen_Suppress
+
+/* The cache stores each region (of VSICURLGetDownloadChunkSize() bytes) in
+ * its own file, whose name is the SHA256 hash of the URL, of the properties
+ * of the remote file that change when it is modified (ETag, or last
+ * modification time, and size), and of the region offset. Modified remote
+ * files are thus never served from the cache: their stale regions are just no
+ * longer accessed, and end up being evicted.
+ *
+ * Files are written under a temporary name and renamed, so that concurrent
+ * processes never see partially written files. The modification time of files
+ * is updated when they are read, and the least recently used files are
+ * removed when the size of the cache exceeds CPL_VSIL_CURL_DISK_CACHE_SIZE.
+ * Eviction is done by a single process at a time, thanks to a lock file.
+ */
+
+namespace
+{
+
+constexpr const char *TMP_EXTENSION = "tmp";
+
+/************************************************************************/
+/*                        GetDiskCacheDirectory()                       */
+/************************************************************************/
+
+// Empty if the disk cache is disabled.
+std::string GetDiskCacheDirectory()
+{
+    return CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_DIR", "");
+}
+
+/************************************************************************/
+/*                         GetDiskCacheMaxSize()                        */
+/************************************************************************/
+
+GIntBig GetDiskCacheMaxSize()
+{
+    constexpr GIntBig CACHE_SIZE_DEFAULT =
+        static_cast<GIntBig>(1024) * 1024 * 1024;
+    GIntBig nCacheSize = CACHE_SIZE_DEFAULT;
+    const char *pszCacheSize =
+        CPLGetConfigOption("CPL_VSIL_CURL_DISK_CACHE_SIZE", nullptr);
+    if (pszCacheSize &&
+        (CPLParseMemorySize(pszCacheSize, &nCacheSize, nullptr) != CE_None ||
+         nCacheSize < 0))
+    {
+        nCacheSize = CACHE_SIZE_DEFAULT;
+        CPLError(CE_Warning, CPLE_AppDefined,
+                 "Could not parse value for CPL_VSIL_CURL_DISK_CACHE_SIZE. "
+                 "Using default value of " CPL_FRMT_GIB " instead.",
+                 nCacheSize);
+    }
+    return nCacheSize;
+}
+
+/************************************************************************/
+/*                          GetRegionFilename()                         */
+/************************************************************************/
+
+/** Return the name of the file caching the region of pszURL starting at
+ * nFileOffsetStart, and the expected size of that region.
+ *
+ * An empty string is returned if the properties of the remote file are not
+ * known, or if there is no way of detecting that it has been modified.
+ */
+std::string GetRegionFilename(const std::string &osCacheDir,
+                              const char *pszURL,
+                              vsi_l_offset nFileOffsetStart,
+                              size_t &nExpectedSize)
+{
+    cpl::FileProp oFileProp;
+    if (!VSICURLGetCachedFileProp(pszURL, oFileProp) ||
+        oFileProp.eExists != cpl::EXIST_YES ||
+        !oFileProp.bHasComputedFileSize || oFileProp.bIsDirectory ||
+        nFileOffsetStart >= oFileProp.fileSize)
+    {
+        return std::string();
+    }
+
+    std::string osKey(pszURL);
+    if (!oFileProp.ETag.empty())
+    {
+        osKey += "\netag=";
+        osKey += oFileProp.ETag;
+    }
+    else if (oFileProp.mTime > 0)
+    {
+        osKey += CPLSPrintf("\nmtime=" CPL_FRMT_GIB,
+                            static_cast<GIntBig>(oFileProp.mTime));
+    }
+    else
+    {
+        return std::string();
+    }
+    const int nChunkSize = VSICURLGetDownloadChunkSize();
+    osKey += CPLSPrintf("\nsize=" CPL_FRMT_GUIB "\nchunk_size=%d"
+                        "\noffset=" CPL_FRMT_GUIB,
+                        static_cast<GUIntBig>(oFileProp.fileSize), nChunkSize,
+                        static_cast<GUIntBig>(nFileOffsetStart));
+
+    nExpectedSize = static_cast<size_t>(std::min<vsi_l_offset>(
+        nChunkSize, oFileProp.fileSize - nFileOffsetStart));
+
+    GByte abyHash[CPL_SHA256_HASH_SIZE];
+    CPL_SHA256(osKey.data(), osKey.size(), abyHash);
+    char *pszHash = CPLBinaryToHex(CPL_SHA256_HASH_SIZE, abyHash);
+    const std::string osHash(pszHash);
+    CPLFree(pszHash);
+
+    // Spread files among 256 sub-directories.
+    return CPLFormFilenameSafe(
+        CPLFormFilenameSafe(osCacheDir.c_str(), osHash.substr(0, 2).c_str(),
+                            nullptr)
+            .c_str(),
+        osHash.substr(2).c_str(), nullptr);
+}
+
+/************************************************************************/
+/*                              TouchFile()                             */
+/************************************************************************/
+
+// Set the modification time of a cached file to the current time, so that
+// it is considered as recently used.
+void TouchFile(const std::string &osFilename)
+{
+#ifdef _WIN32
+    wchar_t *pwszFilename =
+        CPLRecodeToWChar(osFilename.c_str(), CPL_ENC_UTF8, CPL_ENC_UCS2);
+    CPL_IGNORE_RET_VAL(_wutime(pwszFilename, nullptr));
+    CPLFree(pwszFilename);
+#else
+    CPL_IGNORE_RET_VAL(utime(osFilename.c_str(), nullptr));
+#endif
+}
+
+/************************************************************************/
+/*                            TrimDiskCache()                           */
+/************************************************************************/
+
+// Remove the least recently used files until the cache is 20% below its
+// maximum size, so that this does not need to be done too often.
+void TrimDiskCache(const std::string &osCacheDir, GIntBig nMaxSize)
+{
+    // If another process or thread is already trimming the cache, let it do
+    // the job.
+    const std::string osLockFilename =
+        CPLFormFilenameSafe(osCacheDir.c_str(), ".lock", nullptr);
+    CPLLockFileHandle hLockFileHandle = nullptr;
+    CPLStringList aosLockOptions;
+    aosLockOptions.SetNameValue("WAIT_TIME", "0");
+    if (CPLLockFileEx(osLockFilename.c_str(), &hLockFileHandle,
+                      aosLockOptions.List()) != CLFS_OK)
+    {
+        return;
+    }
+
+    struct CachedFile
+    {
+        time_t nMTime;
+        GIntBig nSize;
+        std::string osFilename;
+    };
+
+    std::vector<CachedFile> aoFiles;
+    GIntBig nTotalSize = 0;
+    const time_t nNow = time(nullptr);
+    const CPLStringList aosSubDirs(VSIReadDir(osCacheDir.c_str()));
+    for (const char *pszSubDir : aosSubDirs)
+    {
+        if (strlen(pszSubDir) != 2 || pszSubDir[0] == '.')
+            continue;
+        const std::string osSubDir =
+            CPLFormFilenameSafe(osCacheDir.c_str(), pszSubDir, nullptr);
+        const CPLStringList aosFiles(VSIReadDir(osSubDir.c_str()));
+        for (const char *pszFile : aosFiles)
+        {
+            if (pszFile[0] == '.')
+                continue;
+            std::string osFilename =
+                CPLFormFilenameSafe(osSubDir.c_str(), pszFile, nullptr);
+            VSIStatBufL sStat;
+            if (VSIStatL(osFilename.c_str(), &sStat) != 0 ||
+                !VSI_ISREG(sStat.st_mode))
+            {
+                continue;
+            }
+            if (EQUAL(CPLGetExtensionSafe(pszFile).c_str(), TMP_EXTENSION))
+            {
+                // Left over by a process interrupted while writing it
+                constexpr time_t STALLED_TMP_FILE_DELAY = 3600;
+                if (sStat.st_mtime + STALLED_TMP_FILE_DELAY < nNow)
+                    VSIUnlink(osFilename.c_str());
+                continue;
+            }
+            nTotalSize += static_cast<GIntBig>(sStat.st_size);
+            aoFiles.push_back({sStat.st_mtime,
+                               static_cast<GIntBig>(sStat.st_size),
+                               std::move(osFilename)});
+        }
+    }
+
+    if (nTotalSize > nMaxSize)
+    {
+        std::sort(aoFiles.begin(), aoFiles.end(),
+                  [](const CachedFile &a, const CachedFile &b)
+                  { return a.nMTime < b.nMTime; });
+        const GIntBig nTargetSize = nMaxSize - nMaxSize / 5;
+        for (const auto &oFile : aoFiles)
+        {
+            if (nTotalSize <= nTargetSize)
+                break;
+            if (VSIUnlink(oFile.osFilename.c_str()) == 0)
+                nTotalSize -= oFile.nSize;
+        }
+        CPLDebug("VSICURL", "Disk cache trimmed to " CPL_FRMT_GIB " bytes",
+                 nTotalSize);
+    }
+
+    CPLUnlockFileEx(hLockFileHandle);
+}
+
+}  // namespace
+
+/************************************************************************/
+/*                     VSICURLDiskCacheGetRegion()                      */
+/************************************************************************/
+
+/** Return the content of a region from the disk cache, or nullptr if it is
+ * not cached or if the disk cache is disabled.
+ */
+std::shared_ptr<std::string> VSICURLDiskCacheGetRegion(
+    const char *pszURL, vsi_l_offset nFileOffsetStart)
+{
+    const std::string osCacheDir = GetDiskCacheDirectory();
+    if (osCacheDir.empty())
+        return nullptr;
+
+    size_t nExpectedSize = 0;
+    const std::string osFilename = GetRegionFilename(
+        osCacheDir, pszURL, nFileOffsetStart, nExpectedSize);
+    VSIStatBufL sStat;
+    if (osFilename.empty() || VSIStatL(osFilename.c_str(), &sStat) != 0 ||
+        static_cast<size_t>(sStat.st_size) != nExpectedSize)
+    {
+        return nullptr;
+    }
+
+    VSILFILE *fp = VSIFOpenL(osFilename.c_str(), "rb");
+    if (!fp)
+        return nullptr;
+    auto poData = std::make_shared<std::string>();
+    poData->resize(nExpectedSize);
+    const bool bOK = VSIFReadL(&(*poData)[0], 1, nExpectedSize, fp) ==
+                     nExpectedSize;
+    VSIFCloseL(fp);
+    if (!bOK)
+        return nullptr;
+
+    // Avoid updating the modification time of files that are frequently
+    // accessed.
+    constexpr time_t TOUCH_DELAY = 60;
+    if (sStat.st_mtime + TOUCH_DELAY < time(nullptr))
+        TouchFile(osFilename);
+
+    return poData;
+}
+
+/************************************************************************/
+/*                     VSICURLDiskCacheAddRegion()                      */
+/************************************************************************/
+
+/** Store a region in the disk cache, if it is enabled.
+ *
+ * Failures are silently ignored.
+ */
+void VSICURLDiskCacheAddRegion(const char *pszURL,
+                               vsi_l_offset nFileOffsetStart, size_t nSize,
+                               const char *pData)
+{
+    const std::string osCacheDir = GetDiskCacheDirectory();
+    if (osCacheDir.empty())
+        return;
+
+    // Only complete regions are cached, to avoid serving truncated data.
+    size_t nExpectedSize = 0;
+    const std::string osFilename = GetRegionFilename(
+        osCacheDir, pszURL, nFileOffsetStart, nExpectedSize);
+    VSIStatBufL sStat;
+    if (osFilename.empty() || nSize != nExpectedSize ||
+        VSIStatL(osFilename.c_str(), &sStat) == 0)
+    {
+        return;
+    }
+
+    const std::string osSubDir = CPLGetPathSafe(osFilename.c_str());
+    if (VSIStatL(osSubDir.c_str(), &sStat) != 0 &&
+        VSIMkdirRecursive(osSubDir.c_str(), 0755) != 0)
+    {
+        CPLDebug("VSICURL", "Cannot create %s", osSubDir.c_str());
+        return;
+    }
+
+    static std::atomic<int> nTmpFileCounter{0};
+    const std::string osTmpFilename =
+        CPLSPrintf("%s.%d.%d.%s", osFilename.c_str(), CPLGetCurrentProcessID(),
+                   ++nTmpFileCounter, TMP_EXTENSION);
+    VSILFILE *fp = VSIFOpenL(osTmpFilename.c_str(), "wb");
+    if (!fp)
+        return;
+    bool bOK = VSIFWriteL(pData, 1, nSize, fp) == nSize;
+    bOK = VSIFCloseL(fp) == 0 && bOK;
+    // On Windows, the rename fails if another thread or process has cached
+    // the region in the meantime, which is fine.
+    if (!bOK || VSIRename(osTmpFilename.c_str(), osFilename.c_str()) != 0)
+    {
+        VSIUnlink(osTmpFilename.c_str());
+        return;
+    }
+
+    // Check the size of the cache each time 1/16th of its maximum size has
+    // been written by this process.
+    static std::atomic<GIntBig> nBytesWrittenSinceLastTrim{0};
+    const GIntBig nMaxSize = GetDiskCacheMaxSize();
+    const GIntBig nBytesWritten =
+        nBytesWrittenSinceLastTrim.fetch_add(static_cast<GIntBig>(nSize)) +
+        static_cast<GIntBig>(nSize);
+    if (nBytesWritten >= std::max<GIntBig>(1, nMaxSize / 16))
+    {
+        nBytesWrittenSinceLastTrim = 0;
+        TrimDiskCache(osCacheDir, nMaxSize);
+    }
+}
+
+//! @endcond
+
+#endif  // HAVE_CURL
@@ -1155,6 +1155,24 @@ public:
   }
 %clear char **;
 
+%newobject GetChunkCached;
+%apply (char **CSL) {char **};
+  GDALMDArrayHS* GetChunkCached(char** options = 0)
+  {
+    return GDALMDArrayGetChunkCached(self, options);
+  }
+%clear char **;
+
+%newobject GetReduced;
+%apply Pointer NONNULL {const char* pszOperation};
+%apply (char **CSL) {char **};
+  GDALMDArrayHS* GetReduced(const char* pszOperation, size_t iDim,
+                            char** options = 0)
+  {
+    return GDALMDArrayGetReduced(self, pszOperation, iDim, options);
+  }
+%clear char **;
+
 %newobject GetGridded;
 %feature ("kwargs") GetGridded;
 %apply Pointer NONNULL {const char* pszGridOptions};
@@ -1237,6 +1237,10 @@ public:
   bool SetOnlyBest(bool onlyBest) {
     return OCTCoordinateTransformationOptionsSetOnlyBest(self, onlyBest);
   }
+
+  bool SetNumThreads(int numThreads) {
+    return OCTCoordinateTransformationOptionsSetNumThreads(self, numThreads);
+  }
 } /*extend */
 };
 